@@ -0,0 +1,60 @@
+#pragma once
+/**
+ * Benchmark Helpers
+ *
+ * Minimal timing utilities shared by the native benchmarks. Not built for
+ * WASM; numbers are only meaningful from a Release build.
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+namespace bench {
+
+// Sink that keeps the optimizer from discarding benchmarked work
+inline volatile size_t g_sink = 0;
+
+inline void consume(size_t value) {
+    g_sink = g_sink + value;
+}
+
+/**
+ * Run fn() `iterations` times and return the mean nanoseconds per call
+ * @param iterations Number of calls to time
+ * @param fn Callable returning a value to feed into consume()
+ */
+template <typename Fn>
+double time_ns(size_t iterations, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++) {
+        consume(static_cast<size_t>(fn(i)));
+    }
+    auto end = std::chrono::steady_clock::now();
+    double total = std::chrono::duration<double, std::nano>(end - start).count();
+    return iterations > 0 ? total / static_cast<double>(iterations) : 0.0;
+}
+
+inline void print_header(const char* title) {
+    printf("\n%s\n", title);
+    printf("  %-28s %14s %14s %10s\n", "case", "before ns/op", "after ns/op", "speedup");
+}
+
+inline void print_row(const char* label, double before_ns, double after_ns) {
+    printf("  %-28s %14.1f %14.1f %9.1fx\n", label, before_ns, after_ns,
+           after_ns > 0 ? before_ns / after_ns : 0.0);
+}
+
+inline void print_qps_header(const char* title) {
+    printf("\n%s\n", title);
+    printf("  %-28s %14s %14s %10s\n", "case", "before q/s", "after q/s", "speedup");
+}
+
+inline void print_qps_row(const char* label, double before_ns, double after_ns) {
+    double before_qps = before_ns > 0 ? 1e9 / before_ns : 0.0;
+    double after_qps = after_ns > 0 ? 1e9 / after_ns : 0.0;
+    printf("  %-28s %14.1f %14.1f %9.1fx\n", label, before_qps, after_qps,
+           before_qps > 0 ? after_qps / before_qps : 0.0);
+}
+
+}  // namespace bench
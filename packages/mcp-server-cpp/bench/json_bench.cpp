@@ -0,0 +1,347 @@
+/**
+ * JSON Message Benchmark
+ *
+ * Compares extracting the fields of a tools/call message with the key
+ * scans json_rpc.cpp used to do (strstr from the start of the text for
+ * every field, copying params and arguments out on the way) against
+ * tokenizing the message once and looking fields up on the tape, the
+ * structural scan (json_scan.h) with the scalar classifier against the
+ * compiled-in vector kernel, copying string fields out against viewing
+ * them in place, reading a positions array vertex by vertex against
+ * json_get_number_rows(), and N tool calls sent as N messages against one
+ * JSON-RPC batch (natively there is no WASM boundary crossing to save, so
+ * that row shows only the parsing and dispatch side). Build natively in
+ * Release mode and run:
+ *   ./scripts/build-native.sh && ./build-native/json-bench
+ */
+
+#include "bench_util.h"
+#include "json_rpc.h"
+#include "json_scan.h"
+#include "mcp_server.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace cesium::mcp;
+
+// ============================================================================
+// Reference: per-field key scans
+// ============================================================================
+
+static const char* scan_skip_whitespace(const char* json) {
+    while (*json == ' ' || *json == '\t' || *json == '\n' || *json == '\r') json++;
+    return json;
+}
+
+static const char* scan_find_key(const char* json, const char* key) {
+    char search_key[256];
+    snprintf(search_key, sizeof(search_key), "\"%s\"", key);
+    size_t key_len = strlen(search_key);
+
+    const char* pos = json;
+    while ((pos = strstr(pos, search_key)) != nullptr) {
+        if (pos > json) {
+            const char* before = pos - 1;
+            while (before > json && (*before == ' ' || *before == '\t' || *before == '\n' || *before == '\r')) {
+                before--;
+            }
+            if (*before != '{' && *before != ',') {
+                pos++;
+                continue;
+            }
+        }
+        const char* colon = scan_skip_whitespace(pos + key_len);
+        if (*colon == ':') return scan_skip_whitespace(colon + 1);
+        pos++;
+    }
+    return nullptr;
+}
+
+static bool scan_get_string(const char* json, const char* key, char* value, size_t value_size) {
+    value[0] = '\0';
+    const char* pos = scan_find_key(json, key);
+    if (!pos || *pos != '"') return false;
+    pos++;
+    size_t i = 0;
+    bool escaped = false;
+    while (*pos) {
+        char c = *pos++;
+        if (escaped) {
+            escaped = false;
+        } else if (c == '\\') {
+            escaped = true;
+            continue;
+        } else if (c == '"') {
+            break;
+        }
+        if (i < value_size - 1) value[i++] = c;
+    }
+    value[i] = '\0';
+    return true;
+}
+
+static bool scan_get_number(const char* json, const char* key, double& value) {
+    const char* pos = scan_find_key(json, key);
+    if (!pos || strncmp(pos, "null", 4) == 0) return false;
+    char* end;
+    value = strtod(pos, &end);
+    return end != pos;
+}
+
+static bool scan_get_object(const char* json, const char* key, char* value, size_t value_size) {
+    value[0] = '\0';
+    const char* start = scan_find_key(json, key);
+    if (!start || *start != '{') return false;
+    int depth = 1;
+    const char* pos = start + 1;
+    bool in_string = false;
+    bool escaped = false;
+    while (*pos && depth > 0) {
+        if (in_string) {
+            if (escaped) escaped = false;
+            else if (*pos == '\\') escaped = true;
+            else if (*pos == '"') in_string = false;
+        } else if (*pos == '"') {
+            in_string = true;
+        } else if (*pos == '{') {
+            depth++;
+        } else if (*pos == '}') {
+            depth--;
+        }
+        pos++;
+    }
+    size_t length = std::min(static_cast<size_t>(pos - start), value_size - 1);
+    memcpy(value, start, length);
+    value[length] = '\0';
+    return true;
+}
+
+// ============================================================================
+// Cases
+// ============================================================================
+
+static const char* STRING_FIELDS[] = {"startLocation", "endLocation", "apiKey", "modelUrl"};
+static const char* NUMBER_FIELDS[] = {"startLon", "startLat", "endLon", "endLat", "duration"};
+
+// Envelope fields, then the nine walkTo-style arguments
+static size_t extract_scan(const char* message) {
+    char jsonrpc[8], method[64], name[64], value[512];
+    static char params[8192];
+    static char args[4096];
+    double number = 0;
+    size_t found = 0;
+
+    found += scan_get_string(message, "jsonrpc", jsonrpc, sizeof(jsonrpc));
+    found += scan_get_number(message, "id", number);
+    found += scan_get_string(message, "method", method, sizeof(method));
+    scan_get_object(message, "params", params, sizeof(params));
+    found += scan_get_string(params, "name", name, sizeof(name));
+    scan_get_object(params, "arguments", args, sizeof(args));
+    for (const char* key : STRING_FIELDS) found += scan_get_string(args, key, value, sizeof(value));
+    for (const char* key : NUMBER_FIELDS) found += scan_get_number(args, key, number);
+    return found;
+}
+
+static size_t extract_tape(const char* message, JsonDocument& document) {
+    char method[64], name[64], value[512];
+    double number = 0;
+    size_t found = 0;
+
+    if (!json_parse(message, strlen(message), document)) return 0;
+    const JsonNode* root = json_root(document);
+    found += json_find(root, "jsonrpc") != nullptr;
+    found += json_get_number(root, "id", number);
+    found += json_get_string(root, "method", method, sizeof(method));
+    const JsonNode* params = json_find(root, "params");
+    found += json_get_string(params, "name", name, sizeof(name));
+    const JsonNode* args = json_find(params, "arguments");
+    for (const char* key : STRING_FIELDS) found += json_get_string(args, key, value, sizeof(value));
+    for (const char* key : NUMBER_FIELDS) found += json_get_number(args, key, number);
+    return found;
+}
+
+// The string fields of a parsed message, copied out / viewed in place
+static size_t strings_copy(const JsonNode* args) {
+    char value[512];
+    size_t length = 0;
+    for (const char* key : STRING_FIELDS) {
+        json_get_string(args, key, value, sizeof(value));
+        length += strlen(value);
+    }
+    return length;
+}
+
+static size_t strings_view(const JsonNode* args) {
+    std::string_view value;
+    size_t length = 0;
+    for (const char* key : STRING_FIELDS) {
+        if (json_get_string_view(args, key, value)) length += value.size();
+    }
+    return length;
+}
+
+// A route request; padding grows the message the way long tool arguments do
+static std::string route_message(size_t padding) {
+    std::string message =
+        R"({"jsonrpc":"2.0","id":42,"method":"tools/call","params":{"name":"walkTo","arguments":{)"
+        R"("note":")";
+    message.append(padding, 'x');
+    message +=
+        R"(","startLocation":"Eiffel Tower","endLocation":"Louvre Museum","apiKey":"",)"
+        R"("modelUrl":"https://example.com/walker.glb","startLon":2.2945,"startLat":48.8584,)"
+        R"("endLon":2.3376,"endLat":48.8606,"duration":600}}})";
+    return message;
+}
+
+// An addPolyline request with a vertex object per position
+static std::string polyline_message(size_t vertices) {
+    std::string message =
+        R"({"jsonrpc":"2.0","id":7,"method":"tools/call","params":{"name":"addPolyline","arguments":{"positions":[)";
+    char vertex[128];
+    for (size_t i = 0; i < vertices; i++) {
+        snprintf(vertex, sizeof(vertex), R"(%s{"longitude":%.6f,"latitude":%.6f,"height":%.1f})",
+                 i ? "," : "", -122.4194 + i * 0.001, 37.7749 + i * 0.0005, i * 2.5);
+        message += vertex;
+    }
+    message += R"(],"color":"red","width":3}}})";
+    return message;
+}
+
+static const char* const POSITION_COLUMNS[] = {"longitude", "latitude", "height"};
+static const double POSITION_DEFAULTS[] = {0, 0, 0};
+
+// The loop addPolyline used: three key lookups per vertex
+static size_t positions_per_vertex(const JsonNode* args, double* rows) {
+    const JsonNode* positions = json_find(args, "positions");
+    if (positions == nullptr || positions->type != JsonType::Array) return 0;
+    const JsonNode* position = positions + 1;
+    for (uint32_t i = 0; i < positions->count; i++, position = json_next(position)) {
+        double* row = rows + i * 3;
+        row[0] = row[1] = row[2] = 0;
+        json_get_number(position, "longitude", row[0]);
+        json_get_number(position, "latitude", row[1]);
+        json_get_number(position, "height", row[2]);
+    }
+    return positions->count;
+}
+
+int main() {
+    JsonDocument document;
+
+    printf("JSON message benchmark (tools/call, 4 envelope + 9 argument fields)\n");
+    bench::print_header("field extraction");
+    for (size_t padding : {size_t(0), size_t(2048), size_t(16384)}) {
+        std::string message = route_message(padding);
+        size_t iterations = padding > 4096 ? 20000 : 200000;
+        char label[64];
+        snprintf(label, sizeof(label), "%zu-byte message", message.size());
+        // The scans copy arguments into 4 KB, so past that they lose fields
+        size_t scan_found = extract_scan(message.c_str());
+        size_t tape_found = extract_tape(message.c_str(), document);
+        if (scan_found != tape_found) {
+            printf("  (%s: key scans found %zu of %zu fields)\n", label, scan_found, tape_found);
+        }
+        double before = bench::time_ns(iterations, [&](size_t) { return extract_scan(message.c_str()); });
+        double after = bench::time_ns(iterations, [&](size_t) { return extract_tape(message.c_str(), document); });
+        bench::print_row(label, before, after);
+    }
+
+    std::vector<std::string> messages = {route_message(0), route_message(16384), polyline_message(500)};
+    std::vector<uint32_t> structurals;
+    char title[96];
+    snprintf(title, sizeof(title), "structural index (scalar -> %s classifier)", get_json_scan_kernel());
+    bench::print_header(title);
+    for (const std::string& message : messages) {
+        size_t iterations = message.size() > 4096 ? 20000 : 200000;
+        char label[64];
+        snprintf(label, sizeof(label), "%zu-byte message", message.size());
+        double before = bench::time_ns(iterations, [&](size_t) {
+            json_find_structurals_scalar(message.data(), message.size(), structurals);
+            return structurals.size();
+        });
+        double after = bench::time_ns(iterations, [&](size_t) {
+            json_find_structurals(message.data(), message.size(), structurals);
+            return structurals.size();
+        });
+        bench::print_row(label, before, after);
+    }
+
+    printf("\nfull parse throughput (json_parse)\n");
+    for (const std::string& message : messages) {
+        size_t iterations = message.size() > 4096 ? 20000 : 200000;
+        double ns = bench::time_ns(iterations, [&](size_t) {
+            json_parse(message.data(), message.size(), document);
+            return document.nodes.size();
+        });
+        char label[64];
+        snprintf(label, sizeof(label), "%zu-byte message", message.size());
+        printf("  %-28s %14.1f ns %10.1f MB/s\n", label, ns, message.size() / ns * 1000.0);
+    }
+
+    bench::print_header("string fields (json_get_string copies -> json_get_string_view)");
+    {
+        std::string plain = route_message(0);
+        std::string escaped = plain;
+        size_t at = escaped.find("Louvre Museum");
+        escaped.replace(at, 13, "Mus\\u00e9e du Louvre \\\"aile Denon\\\"");
+        for (const std::string* message : {&plain, &escaped}) {
+            json_parse(message->data(), message->size(), document);
+            const JsonNode* args = json_find(json_find(json_root(document), "params"), "arguments");
+            double before = bench::time_ns(1000000, [&](size_t) { return strings_copy(args); });
+            double after = bench::time_ns(1000000, [&](size_t) { return strings_view(args); });
+            bench::print_row(message == &plain ? "4 fields" : "4 fields, one escaped", before, after);
+        }
+    }
+
+    bench::print_header("positions (per-vertex lookups -> json_get_number_rows)");
+    for (size_t vertices : {size_t(10), size_t(500)}) {
+        std::string message = polyline_message(vertices);
+        json_parse(message.data(), message.size(), document);
+        const JsonNode* args = json_find(json_find(json_root(document), "params"), "arguments");
+        std::vector<double> rows(vertices * 3);
+        size_t iterations = vertices > 100 ? 20000 : 500000;
+        char label[64];
+        snprintf(label, sizeof(label), "%zu vertices", vertices);
+        double before = bench::time_ns(iterations, [&](size_t) { return positions_per_vertex(args, rows.data()); });
+        double after = bench::time_ns(iterations, [&](size_t) {
+            return json_get_number_rows(args, "positions", POSITION_COLUMNS, POSITION_DEFAULTS, 3, rows.data(),
+                                        vertices);
+        });
+        bench::print_row(label, before, after);
+    }
+
+    bench::print_header("tool calls (one message each -> one batch)");
+    static char response[MAX_RESPONSE_SIZE];
+    for (size_t calls : {size_t(4), size_t(16)}) {
+        std::vector<std::string> singles;
+        std::string batch = "[";
+        char call[256];
+        for (size_t i = 0; i < calls; i++) {
+            snprintf(call, sizeof(call),
+                     R"({"jsonrpc":"2.0","id":%zu,"method":"tools/call","params":{"name":"addPoint",)"
+                     R"("arguments":{"longitude":%.4f,"latitude":%.4f,"color":"red"}}})",
+                     i, 2.2945 + i * 0.01, 48.8584 - i * 0.01);
+            singles.push_back(call);
+            batch += i ? "," : "";
+            batch += call;
+        }
+        batch += "]";
+        char label[64];
+        snprintf(label, sizeof(label), "%zu addPoint calls", calls);
+        double before = bench::time_ns(20000, [&](size_t) {
+            size_t length = 0;
+            for (const std::string& single : singles) length += handle_message(single.c_str(), response, sizeof(response));
+            return length;
+        });
+        double after = bench::time_ns(20000, [&](size_t) {
+            return handle_message(batch.c_str(), response, sizeof(response));
+        });
+        bench::print_row(label, before, after);
+    }
+    return 0;
+}
@@ -0,0 +1,679 @@
+/**
+ * Location Lookup Benchmark
+ *
+ * Compares the indexed location queries against the linear scans they
+ * replaced. Build natively in Release mode and run:
+ *   ./scripts/build-native.sh && ./build-native/location-bench
+ */
+
+#include "bench_util.h"
+#include "location_database.h"
+#include "location_index.h"
+#include "location_trie.h"
+#include "location_qgram.h"
+#include "location_symspell.h"
+#include "location_store.h"
+#include "location_places.h"
+#include "location_rank.h"
+#include "location_metadata.h"
+#include "location_cache.h"
+#include "location_scan.h"
+#include "location_suffix.h"
+#include "location_tables.h"
+#include "mcp_server.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace cesium::mcp;
+
+// The pre-index resolve_location(): normalize, then strcmp every entry
+static bool resolve_location_scan(const char* name, double& longitude, double& latitude) {
+    char normalized[256];
+    normalize_location_name(name, normalized, sizeof(normalized));
+
+    const Location* locations = get_all_locations();
+    size_t count = get_location_count();
+    for (size_t i = 0; i < count; i++) {
+        if (locations[i].name != nullptr && std::strcmp(normalized, locations[i].name) == 0) {
+            longitude = locations[i].longitude;
+            latitude = locations[i].latitude;
+            return true;
+        }
+    }
+    return false;
+}
+
+// The pre-index search_locations(): strncmp every entry, database order
+static size_t search_locations_scan(const char* prefix, const Location** results,
+                                    size_t max_results) {
+    char normalized[256];
+    normalize_location_name(prefix, normalized, sizeof(normalized));
+    size_t prefix_len = std::strlen(normalized);
+
+    const Location* locations = get_all_locations();
+    size_t count = get_location_count();
+    size_t found = 0;
+    for (size_t i = 0; i < count && found < max_results; i++) {
+        if (locations[i].name != nullptr &&
+            std::strncmp(normalized, locations[i].name, prefix_len) == 0) {
+            results[found++] = &locations[i];
+        }
+    }
+    return found;
+}
+
+// The pre-Myers levenshtein_distance(): two heap-allocated DP rows per call
+static int levenshtein_distance_dp(const char* s1, const char* s2, int max_distance) {
+    size_t len1 = std::strlen(s1);
+    size_t len2 = std::strlen(s2);
+    int len_diff = static_cast<int>(len1) - static_cast<int>(len2);
+    if (len_diff < 0) len_diff = -len_diff;
+    if (max_distance >= 0 && len_diff > max_distance) {
+        return max_distance + 1;
+    }
+
+    std::vector<int> prev_row(len2 + 1);
+    std::vector<int> curr_row(len2 + 1);
+    for (size_t j = 0; j <= len2; j++) {
+        prev_row[j] = static_cast<int>(j);
+    }
+    for (size_t i = 1; i <= len1; i++) {
+        curr_row[0] = static_cast<int>(i);
+        int row_min = curr_row[0];
+        for (size_t j = 1; j <= len2; j++) {
+            int cost = (s1[i-1] == s2[j-1]) ? 0 : 1;
+            curr_row[j] = std::min({prev_row[j] + 1, curr_row[j-1] + 1, prev_row[j-1] + cost});
+            if (curr_row[j] < row_min) row_min = curr_row[j];
+        }
+        if (max_distance >= 0 && row_min > max_distance) {
+            return max_distance + 1;
+        }
+        std::swap(prev_row, curr_row);
+    }
+    return prev_row[len2];
+}
+
+// The pre-Myers fuzzy_resolve_location() scan
+static bool fuzzy_resolve_scan_dp(const char* name, int max_distance) {
+    char normalized[256];
+    normalize_location_name(name, normalized, sizeof(normalized));
+
+    const Location* locations = get_all_locations();
+    size_t count = get_location_count();
+    int best_distance = max_distance + 1;
+    for (size_t i = 0; best_distance > 0 && i < count; i++) {
+        int dist = levenshtein_distance_dp(normalized, locations[i].name, best_distance - 1);
+        if (dist < best_distance) best_distance = dist;
+    }
+    return best_distance <= max_distance;
+}
+
+// The pre-filter fuzzy_search_locations(): edit distance against every name
+static size_t fuzzy_search_scan(const char* name, const Location** results, int* scores,
+                                size_t max_results, int max_distance) {
+    char normalized[256];
+    normalize_location_name(name, normalized, sizeof(normalized));
+
+    const Location* locations = get_all_locations();
+    size_t count = get_location_count();
+    std::vector<std::pair<const Location*, int>> matches;
+    for (size_t i = 0; i < count; i++) {
+        int dist = levenshtein_distance(normalized, locations[i].name, max_distance);
+        if (dist <= max_distance) matches.push_back({&locations[i], dist});
+    }
+    std::sort(matches.begin(), matches.end(),
+              [](const auto& a, const auto& b) { return a.second < b.second; });
+    size_t found = std::min(matches.size(), max_results);
+    for (size_t i = 0; i < found; i++) {
+        results[i] = matches[i].first;
+        scores[i] = matches[i].second;
+    }
+    return found;
+}
+
+// Population-ranked completion without the trie: filter every entry by
+// prefix, then keep the most populous
+static size_t autocomplete_scan(const char* prefix, const Location** results, size_t max_results) {
+    char normalized[256];
+    normalize_location_name(prefix, normalized, sizeof(normalized));
+    size_t prefix_len = std::strlen(normalized);
+
+    const Location* locations = get_all_locations();
+    size_t count = get_location_count();
+    std::vector<const Location*> matches;
+    for (size_t i = 0; i < count; i++) {
+        if (std::strncmp(normalized, locations[i].name, prefix_len) == 0) {
+            matches.push_back(&locations[i]);
+        }
+    }
+    size_t found = std::min(matches.size(), max_results);
+    std::partial_sort(matches.begin(), matches.begin() + found, matches.end(),
+                      [](const Location* a, const Location* b) {
+                          if (a->population != b->population) return a->population > b->population;
+                          return std::strcmp(a->name, b->name) < 0;
+                      });
+    std::copy(matches.begin(), matches.begin() + found, results);
+    return found;
+}
+
+// Filtered top-k without the rank index: test every entry, then keep the
+// most populous (no reliance on the table's order)
+static size_t top_by_population_scan(const PopulationFilter& filter, const Location** results,
+                                     size_t max_results) {
+    const Location* locations = get_all_locations();
+    size_t count = get_location_count();
+    std::vector<const Location*> matches;
+    for (size_t i = 0; i < count; i++) {
+        const Location& loc = locations[i];
+        if (loc.population <= 0 || loc.population < filter.min_population) continue;
+        if (filter.has_bbox && (loc.longitude < filter.west || loc.longitude > filter.east ||
+                                loc.latitude < filter.south || loc.latitude > filter.north)) {
+            continue;
+        }
+        matches.push_back(&loc);
+    }
+    size_t found = std::min(matches.size(), max_results);
+    std::partial_sort(matches.begin(), matches.begin() + found, matches.end(),
+                      [](const Location* a, const Location* b) {
+                          return a->population > b->population;
+                      });
+    std::copy(matches.begin(), matches.begin() + found, results);
+    return found;
+}
+
+// Infix search without the suffix array: strstr every name, one entry per
+// place, then keep the most populous
+static size_t containing_by_population_scan(const char* needle, const Location** results,
+                                            size_t max_results) {
+    const Location* locations = get_all_locations();
+    size_t count = get_location_count();
+    std::vector<bool> seen(count, false);
+    std::vector<uint32_t> places;
+    for (size_t i = 0; i < count; i++) {
+        if (locations[i].name == nullptr || std::strstr(locations[i].name, needle) == nullptr) continue;
+        uint32_t canonical = get_canonical_location_id(static_cast<uint32_t>(i));
+        if (seen[canonical]) continue;
+        seen[canonical] = true;
+        places.push_back(canonical);
+    }
+    size_t found = std::min(places.size(), max_results);
+    std::partial_sort(places.begin(), places.begin() + found, places.end(), [locations](uint32_t a, uint32_t b) {
+        if (locations[a].population != locations[b].population) {
+            return locations[a].population > locations[b].population;
+        }
+        return a < b;
+    });
+    for (size_t i = 0; i < found; i++) results[i] = &locations[places[i]];
+    return found;
+}
+
+static void bench_resolve(const char* label, const std::vector<std::string>& queries,
+                          size_t iterations) {
+    double before = bench::time_ns(iterations, [&](size_t i) {
+        double lon, lat;
+        return resolve_location_scan(queries[i % queries.size()].c_str(), lon, lat);
+    });
+    double after = bench::time_ns(iterations, [&](size_t i) {
+        double lon, lat, heading;
+        return resolve_location(queries[i % queries.size()].c_str(), lon, lat, heading);
+    });
+    bench::print_row(label, before, after);
+}
+
+int main() {
+    printf("Location Lookup Benchmark (%zu locations)\n", get_location_count());
+    printf("Prebuilt index tables: %s\n", get_prebuilt_location_tables() != nullptr ? "yes" : "no");
+
+    build_location_indexes();
+    build_location_store();
+    build_location_place_index();
+    build_population_rank_index();
+    build_location_metadata_index();
+    build_location_trie();
+    build_location_qgram_index();
+
+    const Location* locations = get_all_locations();
+    size_t count = get_location_count();
+
+    // Hits spread across the whole table, in mixed case to exercise normalization
+    std::vector<std::string> hits;
+    for (size_t i = 0; i < count; i += 97) {
+        std::string name = locations[i].name;
+        if (!name.empty() && name[0] >= 'a' && name[0] <= 'z') {
+            name[0] = static_cast<char>(name[0] - 'a' + 'A');
+        }
+        hits.push_back(name);
+    }
+
+    // Misses that share a prefix with real names
+    std::vector<std::string> misses;
+    for (size_t i = 0; i < count; i += 97) {
+        misses.push_back(std::string(locations[i].name) + " zz");
+    }
+
+    std::vector<std::string> aliases = {
+        "beantown", "the big apple", "chi-town", "sin city", "the windy city",
+        "motor city", "emerald city", "the big easy", "city of angels", "frisco"
+    };
+
+    // Rows other than the cache's own measure the resolvers, not the cache
+    set_location_cache_enabled(false);
+
+    bench::print_header("resolve_location (linear scan -> hash index)");
+    bench_resolve("hits", hits, 2000);
+    bench_resolve("misses", misses, 2000);
+    bench_resolve("colloquial aliases", aliases, 2000);
+
+    // A session repeating a few names vs. a stream of distinct ones that
+    // always miss the cache (and pay for the insert and eviction)
+    std::vector<std::string> cold_typos;
+    for (size_t i = 0; i < count && cold_typos.size() < LOCATION_CACHE_CAPACITY * 16; i += 13) {
+        cold_typos.push_back(std::string(locations[i].name) + "q");
+    }
+    std::vector<std::string> hot_typos(cold_typos.begin(), cold_typos.begin() + 16);
+    std::vector<std::string> hot_hits(hits.begin(), hits.begin() + 16);
+
+    bench::print_header("repeated queries (distinct stream -> 16 hot names, LRU cache)");
+    set_location_cache_enabled(true);
+    {
+        double before = bench::time_ns(2000, [&](size_t i) {
+            double lon, lat, heading;
+            return resolve_location(hits[i % hits.size()].c_str(), lon, lat, heading);
+        });
+        double after = bench::time_ns(2000, [&](size_t i) {
+            double lon, lat, heading;
+            return resolve_location(hot_hits[i % hot_hits.size()].c_str(), lon, lat, heading);
+        });
+        bench::print_row("resolve_location", before, after);
+
+        before = bench::time_ns(200, [&](size_t i) {
+            double lon, lat, heading;
+            return fuzzy_resolve_location(cold_typos[i % cold_typos.size()].c_str(), lon, lat, heading, 2);
+        });
+        after = bench::time_ns(2000, [&](size_t i) {
+            double lon, lat, heading;
+            return fuzzy_resolve_location(hot_typos[i % hot_typos.size()].c_str(), lon, lat, heading, 2);
+        });
+        bench::print_row("fuzzy_resolve_location, k=2", before, after);
+    }
+    LocationCacheStats cache_stats = get_location_cache_stats();
+    printf("Cache: %llu hits, %llu misses, %llu evictions\n",
+           static_cast<unsigned long long>(cache_stats.hits),
+           static_cast<unsigned long long>(cache_stats.misses),
+           static_cast<unsigned long long>(cache_stats.evictions));
+    set_location_cache_enabled(false);
+
+    // Names typed without their accents ("sao paulo", "zurich"): before the
+    // folded column these missed the hash index and fell through to fuzzy
+    // matching
+    const LocationStore& store = get_location_store();
+    std::vector<std::string> variants;
+    for (size_t i = 0; i < count; i += 7) {
+        if (locations[i].name != nullptr && store.folded_offsets[i] != store.name_offsets[i]) {
+            variants.push_back(store_folded_name(store, static_cast<uint32_t>(i)));
+        }
+    }
+    size_t variant_exact = 0;
+    for (const std::string& q : variants) {
+        variant_exact += find_location_id(q.c_str()) != INVALID_LOCATION_ID ? 1 : 0;
+    }
+
+    printf("\nUnaccented names: %zu queries, %zu of them also exact names\n", variants.size(), variant_exact);
+    bench::print_header("unaccented names (fuzzy fallback -> folded exact)");
+    double fuzzy_ns = bench::time_ns(200, [&](size_t i) {
+        const Location* results[1];
+        int scores[1];
+        return fuzzy_search_locations(variants[i % variants.size()].c_str(), results, scores, 1, 2);
+    });
+    double folded_ns = bench::time_ns(2000, [&](size_t i) {
+        double lon, lat, heading;
+        return resolve_location(variants[i % variants.size()].c_str(), lon, lat, heading);
+    });
+    bench::print_row("fuzzy fallback vs folded exact", fuzzy_ns, folded_ns);
+
+    bench::print_header("search_locations (linear scan -> sorted index), max 50");
+    const char* prefixes[] = {"san", "new", "port", "mount", "zz"};
+    for (const char* prefix : prefixes) {
+        const Location* results[50];
+        double before = bench::time_ns(500, [&](size_t) {
+            return search_locations_scan(prefix, results, 50);
+        });
+        double after = bench::time_ns(500, [&](size_t) {
+            return search_locations(prefix, results, 50);
+        });
+        char label[64];
+        snprintf(label, sizeof(label), "prefix \"%s\"", prefix);
+        bench::print_row(label, before, after);
+    }
+
+    // Delete index: build once vs. attach a serialized copy
+    auto build_start = std::chrono::steady_clock::now();
+    build_symspell_index();
+    auto build_end = std::chrono::steady_clock::now();
+    std::vector<uint8_t> symspell_data(get_symspell_index_size());
+    serialize_symspell_index(symspell_data.data(), symspell_data.size());
+    auto attach_start = std::chrono::steady_clock::now();
+    attach_symspell_index(symspell_data.data(), symspell_data.size());
+    auto attach_end = std::chrono::steady_clock::now();
+    printf("\nSymSpell index (max distance %d): %zu bytes, build %.1f ms, attach %.2f ms\n",
+           get_symspell_max_distance(), symspell_data.size(),
+           std::chrono::duration<double, std::milli>(build_end - build_start).count(),
+           std::chrono::duration<double, std::milli>(attach_end - attach_start).count());
+
+    // Typos resolve after a full scan; misses are the worst case
+    bench::print_qps_header("fuzzy_resolve_location (vector DP scan -> SymSpell, then bigram filter)");
+    struct FuzzyCase {
+        const char* label;
+        const char* query;
+    };
+    const FuzzyCase fuzzy_cases[] = {
+        {"typo \"seatle\"", "seatle"},
+        {"typo \"tokio\"", "tokio"},
+        {"typo \"san fransisco\"", "san fransisco"},
+        {"short \"qwxz\"", "qwxz"},
+        {"miss, 40 bytes", "xq international ferry terminal building"},
+        {"miss, 90 bytes (blocked)",
+         "xq international ferry terminal building and maritime museum of the northern coastline"},
+    };
+    for (const FuzzyCase& fc : fuzzy_cases) {
+        double before = bench::time_ns(3, [&](size_t) {
+            return fuzzy_resolve_scan_dp(fc.query, 3);
+        });
+        double after = bench::time_ns(20, [&](size_t) {
+            double lon, lat, heading;
+            return fuzzy_resolve_location(fc.query, lon, lat, heading, 3);
+        });
+        bench::print_qps_row(fc.label, before, after);
+    }
+
+    bench::print_qps_header("fuzzy_search_locations (full scan -> bigram count filter), k=2");
+    for (const FuzzyCase& fc : fuzzy_cases) {
+        const Location* results[50];
+        int scores[50];
+        double before = bench::time_ns(10, [&](size_t) {
+            return fuzzy_search_scan(fc.query, results, scores, 50, 2);
+        });
+        double after = bench::time_ns(200, [&](size_t) {
+            return fuzzy_search_locations(fc.query, results, scores, 50, 2);
+        });
+        bench::print_qps_row(fc.label, before, after);
+    }
+
+    // Packed columns vs. the Location array for full-table scans
+    printf("\nLocation storage: array + strings %zu bytes, plus packed store columns %zu bytes\n",
+           get_location_table_memory(), get_location_store_memory());
+    printf("Places: %zu distinct among %zu names\n", get_location_place_count(), count);
+
+    bench::print_header("full scans (Location array -> packed store)");
+    {
+        double before = bench::time_ns(200, [&](size_t) {
+            size_t n = 0;
+            for (size_t i = 0; i < count; i++) n += locations[i].population > 0 ? 1 : 0;
+            return n;
+        });
+        double after = bench::time_ns(200, [&](size_t) {
+            size_t n = 0;
+            for (size_t i = 0; i < store.count; i++) n += store.population[i] > 0 ? 1 : 0;
+            return n;
+        });
+        bench::print_row("population > 0 count", before, after);
+    }
+    {
+        double before = bench::time_ns(50, [&](size_t) {
+            size_t n = 0;
+            for (size_t i = 0; i < count; i++) n += std::strstr(locations[i].name, "berg") ? 1 : 0;
+            return n;
+        });
+        double after = bench::time_ns(50, [&](size_t) {
+            size_t n = 0;
+            for (uint32_t i = 0; i < store.count; i++) n += std::strstr(store_name(store, i), "berg") ? 1 : 0;
+            return n;
+        });
+        bench::print_row("substring \"berg\"", before, after);
+    }
+    {
+        // Alps bounding box; branch-free in both so only the layout differs
+        double before = bench::time_ns(200, [&](size_t) {
+            size_t n = 0;
+            for (size_t i = 0; i < count; i++) {
+                n += (locations[i].longitude >= 5.0) & (locations[i].longitude <= 16.0) &
+                     (locations[i].latitude >= 43.5) & (locations[i].latitude <= 48.5);
+            }
+            return n;
+        });
+        int32_t min_lon = location_coord_to_fixed(5.0), max_lon = location_coord_to_fixed(16.0);
+        int32_t min_lat = location_coord_to_fixed(43.5), max_lat = location_coord_to_fixed(48.5);
+        double after = bench::time_ns(200, [&](size_t) {
+            size_t n = 0;
+            for (size_t i = 0; i < store.count; i++) {
+                n += (store.longitude_e7[i] >= min_lon) & (store.longitude_e7[i] <= max_lon) &
+                     (store.latitude_e7[i] >= min_lat) & (store.latitude_e7[i] <= max_lat);
+            }
+            return n;
+        });
+        bench::print_row("bounding box count", before, after);
+    }
+
+    // Exhaustive substring search: strstr per name vs. the vectorized
+    // first/last-byte kernel over the padded blob
+    build_location_scan_blob();
+    {
+        char title[96];
+        snprintf(title, sizeof(title), "substring scan (strstr per name -> %s blob kernel), all matches",
+                 get_location_scan_kernel());
+        bench::print_header(title);
+        std::vector<uint32_t> scan_ids(count);
+        const char* needles[] = {"berg", "san", "x", "ville", "international airport", "qqq"};
+        for (const char* needle : needles) {
+            double before = bench::time_ns(50, [&](size_t) {
+                return scan_locations_containing_scalar(needle, scan_ids.data(), scan_ids.size());
+            });
+            double after = bench::time_ns(50, [&](size_t) {
+                return scan_locations_containing(needle, scan_ids.data(), scan_ids.size());
+            });
+            char label[64];
+            snprintf(label, sizeof(label), "\"%s\"", needle);
+            bench::print_row(label, before, after);
+        }
+    }
+
+    // Infix search ranked by population: strstr over every name vs. the
+    // suffix array range (short needles take the vectorized scan instead)
+    {
+        auto build_start = std::chrono::steady_clock::now();
+        build_location_suffix_array();
+        auto build_end = std::chrono::steady_clock::now();
+        printf("\nSuffix array: %zu suffixes, %zu bytes, build %.1f ms\n",
+               get_location_suffix_count(), get_location_suffix_memory(),
+               std::chrono::duration<double, std::milli>(build_end - build_start).count());
+
+        bench::print_header("infix search, top 20 by population (strstr + sort -> suffix array)");
+        const char* needles[] = {"berg", "spring", "port", "ville", "international airport", "a", "qqq"};
+        for (const char* needle : needles) {
+            const Location* results[20];
+            double before = bench::time_ns(50, [&](size_t) {
+                return containing_by_population_scan(needle, results, 20);
+            });
+            double after = bench::time_ns(2000, [&](size_t) {
+                return search_locations_containing(needle, LocationFilter(), results, 20);
+            });
+            char label[64];
+            snprintf(label, sizeof(label), "\"%s\"", needle);
+            bench::print_row(label, before, after);
+        }
+    }
+
+    bench::print_header("top-k by population (scan + sort -> rank index)");
+    {
+        struct RankCase {
+            const char* label;
+            PopulationFilter filter;
+            size_t k;
+        };
+        PopulationFilter europe;
+        europe.has_bbox = true;
+        europe.west = -25.0;
+        europe.south = 34.0;
+        europe.east = 45.0;
+        europe.north = 72.0;
+        PopulationFilter alps = europe;
+        alps.west = 5.0;
+        alps.south = 43.5;
+        alps.east = 16.0;
+        alps.north = 48.5;
+        PopulationFilter megacities;
+        megacities.min_population = 10000000;
+        const RankCase rank_cases[] = {
+            {"top 10", PopulationFilter(), 10},
+            {"top 50 in Europe", europe, 50},
+            {"top 10 in the Alps", alps, 10},
+            {"top 100, >= 10M", megacities, 100},
+        };
+        for (const RankCase& rc : rank_cases) {
+            const Location* results[100];
+            double before = bench::time_ns(200, [&](size_t) {
+                return top_by_population_scan(rc.filter, results, rc.k);
+            });
+            double after = bench::time_ns(20000, [&](size_t) {
+                return find_top_locations_by_population(rc.filter, results, rc.k);
+            });
+            bench::print_row(rc.label, before, after);
+        }
+        double before = bench::time_ns(200, [&](size_t) {
+            size_t n = 0;
+            for (size_t i = 0; i < count; i++) n += locations[i].population >= 1000000 ? 1 : 0;
+            return n;
+        });
+        double after = bench::time_ns(20000, [&](size_t) {
+            return count_locations_by_population(1000000);
+        });
+        bench::print_row("count >= 1M", before, after);
+    }
+
+    // Without sub-indexes a filtered prefix search walks the whole name run
+    // and checks each entry; fuzzy search would filter after scoring
+    bench::print_header("type/country filters (filter after -> sub-index / filter before)");
+    {
+        struct FilterCase {
+            const char* label;
+            const char* query;
+            const char* types;
+            const char* country;
+            bool fuzzy;
+        };
+        const FilterCase filter_cases[] = {
+            {"prefix \"s\", airports", "s", "airport", "", false},
+            {"prefix \"\", cities in fr", "", "city", "fr", false},
+            {"prefix \"new\", us", "new", "", "us", false},
+            {"fuzzy \"pari\", cities", "pari", "city", "", true},
+            {"fuzzy \"seatle\", us", "seatle", "", "us", true},
+        };
+        size_t sorted_count;
+        const uint32_t* sorted = get_locations_by_name(sorted_count);
+        for (const FilterCase& fc : filter_cases) {
+            LocationFilter filter;
+            filter.types = parse_location_types(fc.types);
+            filter.country = parse_country_code(fc.country);
+            const Location* results[50];
+            int scores[50];
+            double before, after;
+            if (fc.fuzzy) {
+                before = bench::time_ns(200, [&](size_t) {
+                    const Location* all[1024];
+                    int all_scores[1024];
+                    size_t n = fuzzy_search_locations(fc.query, all, all_scores, 1024, 2);
+                    size_t kept = 0;
+                    for (size_t i = 0; i < n && kept < 50; i++) {
+                        if (location_matches_filter(static_cast<uint32_t>(all[i] - locations), filter)) {
+                            results[kept++] = all[i];
+                        }
+                    }
+                    return kept;
+                });
+                after = bench::time_ns(200, [&](size_t) {
+                    return fuzzy_search_locations_filtered(fc.query, filter, results, scores, 50, 2);
+                });
+            } else {
+                size_t prefix_len = std::strlen(fc.query);
+                before = bench::time_ns(200, [&](size_t) {
+                    size_t n = 0;
+                    for (size_t i = lower_bound_location_name(fc.query); i < sorted_count && n < 50; i++) {
+                        if (std::strncmp(fc.query, locations[sorted[i]].name, prefix_len) != 0) break;
+                        if (location_matches_filter(sorted[i], filter)) results[n++] = &locations[sorted[i]];
+                    }
+                    return n;
+                });
+                after = bench::time_ns(20000, [&](size_t) {
+                    return search_locations_filtered(fc.query, filter, results, 50);
+                });
+            }
+            bench::print_row(fc.label, before, after);
+        }
+    }
+
+    // Typing a name one character at a time, top 10 after each keystroke
+    bench::print_header("autocomplete per keystroke (scan + sort -> trie cursor), top 10");
+    const char* typed[] = {"san francisco", "new york", "london", "kathmandu"};
+    for (const char* word : typed) {
+        size_t len = std::strlen(word);
+        const Location* results[10];
+        double before = bench::time_ns(50, [&](size_t) {
+            size_t total = 0;
+            std::string prefix;
+            for (size_t i = 0; i < len; i++) {
+                prefix.push_back(word[i]);
+                total += autocomplete_scan(prefix.c_str(), results, 10);
+            }
+            return total;
+        });
+        double after = bench::time_ns(50, [&](size_t) {
+            size_t total = 0;
+            AutocompleteCursor cursor = autocomplete_begin();
+            for (size_t i = 0; i < len; i++) {
+                autocomplete_advance(cursor, word + i, 1);
+                total += autocomplete_top(cursor, results, 10);
+            }
+            return total;
+        });
+        char label[64];
+        snprintf(label, sizeof(label), "\"%s\" (%zu keys)", word, len);
+        bench::print_row(label, before / len, after / len);
+    }
+
+    // A route through many cities: one tools/call per name (JSON parse,
+    // dispatch, text formatting each time) vs. one resolveLocations call
+    bench::print_header("route resolution (per-name tools/call -> resolveLocations), per name");
+    for (size_t route_length : {20, 100}) {
+        std::vector<std::string> single_messages;
+        std::string batch_message =
+            R"({"jsonrpc":"2.0","id":1,"method":"tools/call","params":{"name":"resolveLocations","arguments":{"names":[)";
+        for (size_t i = 0; i < route_length; i++) {
+            const char* name = locations[(i * 631) % count].name;
+            single_messages.push_back(
+                std::string(R"({"jsonrpc":"2.0","id":1,"method":"tools/call","params":{"name":"resolveLocation","arguments":{"location":")") +
+                name + R"("}}})");
+            batch_message += (i > 0 ? ",\"" : "\"") + std::string(name) + "\"";
+        }
+        batch_message += "]}}}";
+
+        double before = bench::time_ns(50, [&](size_t) {
+            size_t total = 0;
+            for (const std::string& message : single_messages) {
+                total += std::strlen(handleMessage(message.c_str()));
+            }
+            return total;
+        });
+        double after = bench::time_ns(50, [&](size_t) {
+            return std::strlen(handleMessage(batch_message.c_str()));
+        });
+        char label[64];
+        snprintf(label, sizeof(label), "%zu names", route_length);
+        bench::print_row(label, before / route_length, after / route_length);
+    }
+
+    return 0;
+}
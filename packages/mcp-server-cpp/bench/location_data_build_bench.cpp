@@ -0,0 +1,164 @@
+/**
+ * Location Table Build-Time Benchmark
+ *
+ * Compares compiling the location table as the 64k-entry aggregate
+ * initializer it used to be against the two ways data/location_table.bin
+ * is embedded now: .incbin (scripts/location_table_incbin.cpp.in) and the
+ * string-literal fallback (scripts/embed-binary.cmake). Each step runs as
+ * a child process; wall time and the child's peak memory are reported. Run through the location-data-build-bench target, which passes
+ * the toolchain paths.
+ *
+ * Usage:
+ *   location-data-build-bench <cmake> <c++ compiler> <source dir> <work dir>
+ */
+
+#include "location_database.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <spawn.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+extern char** environ;
+
+using namespace cesium::mcp;
+
+struct StepResult {
+    double seconds;
+    double peak_mb;
+    bool ok;
+};
+
+// Run a command (no shell) and measure it
+static StepResult run_step(const std::vector<std::string>& command) {
+    std::vector<char*> argv;
+    for (const std::string& arg : command) argv.push_back(const_cast<char*>(arg.c_str()));
+    argv.push_back(nullptr);
+
+    auto start = std::chrono::steady_clock::now();
+    pid_t pid;
+    if (posix_spawnp(&pid, argv[0], nullptr, nullptr, argv.data(), environ) != 0) {
+        return StepResult{0, 0, false};
+    }
+    int status = 0;
+    struct rusage usage = {};
+    wait4(pid, &status, 0, &usage);
+    auto end = std::chrono::steady_clock::now();
+
+    return StepResult{std::chrono::duration<double>(end - start).count(),
+                      usage.ru_maxrss / 1024.0,   // KiB on Linux
+                      WIFEXITED(status) && WEXITSTATUS(status) == 0};
+}
+
+// The table as the aggregate initializer it used to be compiled from
+static bool write_aggregate_source(const std::string& path) {
+    FILE* file = fopen(path.c_str(), "w");
+    if (file == nullptr) return false;
+
+    fprintf(file,
+            "#include \"location_database.h\"\n"
+            "\n"
+            "namespace cesium {\n"
+            "namespace mcp {\n"
+            "\n"
+            "const Location AGGREGATE_LOCATIONS[] = {\n");
+
+    const Location* locations = get_all_locations();
+    size_t count = get_location_count();
+    for (size_t i = 0; i < count; i++) {
+        fputs("    {\"", file);
+        for (const char* p = locations[i].name; *p; p++) {
+            if (*p == '"' || *p == '\\') fputc('\\', file);
+            fputc(*p, file);
+        }
+        fprintf(file, "\", %.17g, %.17g, %.17g, %d},\n", locations[i].longitude,
+                locations[i].latitude, locations[i].heading, locations[i].population);
+    }
+
+    fprintf(file,
+            "};\n"
+            "\n"
+            "}  // namespace mcp\n"
+            "}  // namespace cesium\n");
+    return fclose(file) == 0;
+}
+
+// The .incbin source, as CMake configures it
+static bool write_incbin_source(const std::string& source_dir, const std::string& path) {
+    std::ifstream in(source_dir + "/scripts/location_table_incbin.cpp.in");
+    if (!in) return false;
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    std::string text = buffer.str();
+
+    const std::string placeholder = "@LOCATION_TABLE_BIN@";
+    size_t at;
+    while ((at = text.find(placeholder)) != std::string::npos) {
+        text.replace(at, placeholder.size(), source_dir + "/data/location_table.bin");
+    }
+    std::ofstream out(path);
+    out << text;
+    return static_cast<bool>(out);
+}
+
+static void print_step(const char* label, const StepResult& result) {
+    printf("  %-36s %10.2f s %10.1f MB%s\n", label, result.seconds, result.peak_mb,
+           result.ok ? "" : "  (failed)");
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 5) {
+        fprintf(stderr, "Usage: %s <cmake> <c++ compiler> <source dir> <work dir>\n", argv[0]);
+        return 1;
+    }
+    std::string cmake = argv[1];
+    std::string cxx = argv[2];
+    std::string source_dir = argv[3];
+    std::string work_dir = argv[4];
+
+    std::string aggregate = work_dir + "/aggregate.cpp";
+    std::string incbin = work_dir + "/incbin.cpp";
+    std::string embedded = work_dir + "/embedded.cpp";
+    if (!write_aggregate_source(aggregate) || !write_incbin_source(source_dir, incbin)) {
+        fprintf(stderr, "Failed to write sources to %s\n", work_dir.c_str());
+        return 1;
+    }
+
+    std::vector<std::string> compile = {cxx, "-O2", "-std=c++17", "-I" + source_dir + "/include", "-c"};
+    auto compile_step = [&](const std::string& source) {
+        std::vector<std::string> command = compile;
+        command.push_back(source);
+        command.push_back("-o");
+        command.push_back(source + ".o");
+        return run_step(command);
+    };
+
+    printf("Location table build time (%zu locations, %s -O2)\n", get_location_count(), cxx.c_str());
+    printf("  %-36s %12s %13s\n", "step", "wall", "peak memory");
+
+    StepResult before = compile_step(aggregate);
+    print_step("aggregate initializer: compile", before);
+
+    StepResult incbin_compile = compile_step(incbin);
+    print_step(".incbin: compile", incbin_compile);
+
+    StepResult embed = run_step({cmake, "-DINPUT=" + source_dir + "/data/location_table.bin",
+                                 "-DOUTPUT=" + embedded, "-DFUNCTION=get_embedded_location_table",
+                                 "-P", source_dir + "/scripts/embed-binary.cmake"});
+    print_step("string literal: generate source", embed);
+    StepResult after = compile_step(embedded);
+    print_step("string literal: compile", after);
+
+    double literal_seconds = embed.seconds + after.seconds;
+    printf("  speedup: .incbin %.0fx; string literal %.1fx to compile, %.1fx including\n"
+           "  generation (reruns only when the .bin changes)\n",
+           incbin_compile.seconds > 0 ? before.seconds / incbin_compile.seconds : 0.0,
+           after.seconds > 0 ? before.seconds / after.seconds : 0.0,
+           literal_seconds > 0 ? before.seconds / literal_seconds : 0.0);
+    return before.ok && incbin_compile.ok && embed.ok && after.ok ? 0 : 1;
+}
@@ -0,0 +1,107 @@
+/**
+ * Number Conversion Benchmark
+ *
+ * Compares strtod against parse_double() on the numbers a tool call
+ * carries, and snprintf against format_fixed() / format_text() on the
+ * coordinate rows tool results are made of (number_format.h). Build
+ * natively in Release mode and run:
+ *   ./scripts/build-native.sh && ./build-native/number-bench
+ */
+
+#include "bench_util.h"
+#include "location_database.h"
+#include "number_format.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace cesium::mcp;
+
+int main() {
+    const Location* locations = get_all_locations();
+    size_t count = get_location_count();
+    if (count == 0) {
+        printf("No locations\n");
+        return 1;
+    }
+
+    // Numbers as clients send them: coordinates to 4-6 places, heights, ids
+    std::vector<std::string> texts;
+    char text[64];
+    for (size_t i = 0; i < 4096; i++) {
+        const Location& loc = locations[(i * 7919) % count];
+        switch (i % 4) {
+            case 0: snprintf(text, sizeof(text), "%.6f", loc.longitude); break;
+            case 1: snprintf(text, sizeof(text), "%.4f", loc.latitude); break;
+            case 2: snprintf(text, sizeof(text), "%.1f", loc.latitude * 37.5); break;
+            default: snprintf(text, sizeof(text), "%zu", i * 131); break;
+        }
+        texts.push_back(text);
+    }
+
+    printf("Number conversion benchmark (%zu values from the location table)\n", texts.size());
+    bench::print_header("parse (strtod -> parse_double)");
+    {
+        double sum = 0;
+        double before = bench::time_ns(texts.size() * 100, [&](size_t i) {
+            const std::string& number = texts[i % texts.size()];
+            double value = 0;
+            parse_double_strtod(number.data(), number.data() + number.size(), value);
+            sum += value;
+            return number.size();
+        });
+        double after = bench::time_ns(texts.size() * 100, [&](size_t i) {
+            const std::string& number = texts[i % texts.size()];
+            double value = 0;
+            parse_double(number.data(), number.data() + number.size(), value);
+            sum += value;
+            return number.size();
+        });
+        bench::print_row("coordinate / height / id", before, after);
+        bench::consume(static_cast<size_t>(sum));
+    }
+
+    bench::print_header("format (snprintf -> format_fixed / format_text)");
+    {
+        char output[128];
+        for (int precision : {1, 6}) {
+            char label[64];
+            snprintf(label, sizeof(label), "%%.%df", precision);
+            double before = bench::time_ns(count * 4, [&](size_t i) {
+                return format_fixed_snprintf(locations[i % count].longitude, precision, output, sizeof(output));
+            });
+            double after = bench::time_ns(count * 4, [&](size_t i) {
+                return format_fixed(locations[i % count].longitude, precision, output, sizeof(output));
+            });
+            bench::print_row(label, before, after);
+        }
+
+        // A polyline row and a location row, as the tool results print them
+        double before = bench::time_ns(count * 4, [&](size_t i) {
+            const Location& loc = locations[i % count];
+            return snprintf(output, sizeof(output), "\n%.6f,%.6f,%.1f", loc.longitude, loc.latitude,
+                            loc.heading);
+        });
+        double after = bench::time_ns(count * 4, [&](size_t i) {
+            const Location& loc = locations[i % count];
+            return format_text(output, sizeof(output), "\n%.6f,%.6f,%.1f", loc.longitude, loc.latitude,
+                               loc.heading);
+        });
+        bench::print_row("position row", before, after);
+
+        before = bench::time_ns(count * 4, [&](size_t i) {
+            const Location& loc = locations[i % count];
+            return snprintf(output, sizeof(output), "\n%s,%.6f,%.6f,%d", loc.name, loc.longitude,
+                            loc.latitude, loc.population);
+        });
+        after = bench::time_ns(count * 4, [&](size_t i) {
+            const Location& loc = locations[i % count];
+            return format_text(output, sizeof(output), "\n%s,%.6f,%.6f,%d", loc.name, loc.longitude,
+                               loc.latitude, loc.population);
+        });
+        bench::print_row("location row", before, after);
+    }
+    return 0;
+}
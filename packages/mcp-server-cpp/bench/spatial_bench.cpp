@@ -0,0 +1,161 @@
+/**
+ * Spatial Query Benchmark
+ *
+ * Compares the k-d tree nearest-neighbour, radius and bounding-box queries
+ * against full scans of the location table. Build natively in Release mode
+ * and run:
+ *   ./scripts/build-native.sh && ./build-native/spatial-bench
+ */
+
+#include "bench_util.h"
+#include "location_database.h"
+#include "location_index.h"
+#include "location_store.h"
+#include "location_places.h"
+#include "location_spatial.h"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+using namespace cesium::mcp;
+
+struct QueryPoint {
+    double longitude;
+    double latitude;
+};
+
+// The scan a nearest query replaces: distance to every place, partial sort
+static size_t nearest_scan(const QueryPoint& q, size_t k, double max_distance,
+                           std::vector<SpatialMatch>& matches) {
+    const Location* locations = get_all_locations();
+    size_t count = get_location_count();
+
+    matches.clear();
+    for (size_t i = 0; i < count; i++) {
+        if (locations[i].name == nullptr || !is_canonical_location(static_cast<uint32_t>(i))) continue;
+        double d = great_circle_distance(q.longitude, q.latitude,
+                                         locations[i].longitude, locations[i].latitude);
+        if (max_distance > 0 && d > max_distance) continue;
+        matches.push_back(SpatialMatch{static_cast<uint32_t>(i), d});
+    }
+
+    size_t shown = std::min(k, matches.size());
+    std::partial_sort(matches.begin(), matches.begin() + shown, matches.end(),
+                      [](const SpatialMatch& a, const SpatialMatch& b) {
+                          return a.distance < b.distance;
+                      });
+    matches.resize(shown);
+    return shown;
+}
+
+static size_t bbox_scan(double west, double south, double east, double north,
+                        std::vector<uint32_t>& ids) {
+    const Location* locations = get_all_locations();
+    size_t count = get_location_count();
+
+    ids.clear();
+    for (size_t i = 0; i < count; i++) {
+        const Location& loc = locations[i];
+        bool in_lon = west <= east ? (loc.longitude >= west && loc.longitude <= east)
+                                   : (loc.longitude >= west || loc.longitude <= east);
+        if (loc.name != nullptr && is_canonical_location(static_cast<uint32_t>(i)) && in_lon && loc.latitude >= south && loc.latitude <= north) {
+            ids.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    return ids.size();
+}
+
+int main() {
+    printf("Spatial Query Benchmark (%zu locations)\n", get_location_count());
+
+    build_location_indexes();
+    build_location_store();
+    build_location_place_index();
+
+    auto build_start = std::chrono::steady_clock::now();
+    build_location_spatial_index();
+    auto build_end = std::chrono::steady_clock::now();
+    printf("k-d tree build %.1f ms (%zu places)\n",
+           std::chrono::duration<double, std::milli>(build_end - build_start).count(),
+           get_location_place_count());
+
+    // Query points at real places (dense areas) plus open ocean
+    const Location* locations = get_all_locations();
+    size_t count = get_location_count();
+    std::vector<QueryPoint> points;
+    for (size_t i = 0; i < count; i += 211) {
+        points.push_back(QueryPoint{locations[i].longitude + 0.01, locations[i].latitude - 0.01});
+    }
+    points.push_back(QueryPoint{-140.0, -40.0});   // South Pacific
+    points.push_back(QueryPoint{179.9, 65.0});     // Antimeridian, Chukotka
+
+    std::vector<SpatialMatch> matches;
+    bench::print_header("nearest locations (full scan -> k-d tree)");
+    const size_t ks[] = {1, 10, 100};
+    for (size_t k : ks) {
+        double before = bench::time_ns(50, [&](size_t i) {
+            return nearest_scan(points[i % points.size()], k, 0, matches);
+        });
+        double after = bench::time_ns(5000, [&](size_t i) {
+            const QueryPoint& q = points[i % points.size()];
+            return find_nearest_locations(q.longitude, q.latitude, k, 0, matches);
+        });
+        char label[64];
+        snprintf(label, sizeof(label), "k=%zu", k);
+        bench::print_row(label, before, after);
+    }
+    {
+        double before = bench::time_ns(50, [&](size_t i) {
+            return nearest_scan(points[i % points.size()], static_cast<size_t>(-1), 50000, matches);
+        });
+        double after = bench::time_ns(2000, [&](size_t i) {
+            const QueryPoint& q = points[i % points.size()];
+            return find_locations_within_radius(q.longitude, q.latitude, 50000, matches);
+        });
+        bench::print_row("radius 50 km", before, after);
+    }
+
+    // Local reverse geocode: nearest populated place within 50 km, else anything
+    {
+        double before = bench::time_ns(50, [&](size_t i) {
+            const QueryPoint& q = points[i % points.size()];
+            nearest_scan(q, static_cast<size_t>(-1), REVERSE_GEOCODE_DISTANCE, matches);
+            for (const SpatialMatch& m : matches) {
+                if (locations[m.id].population > 0) return static_cast<size_t>(m.id);
+            }
+            return matches.empty() ? size_t(0) : static_cast<size_t>(matches[0].id);
+        });
+        double after = bench::time_ns(5000, [&](size_t i) {
+            const QueryPoint& q = points[i % points.size()];
+            SpatialMatch match;
+            return reverse_geocode_location(q.longitude, q.latitude, REVERSE_GEOCODE_DISTANCE, match)
+                       ? static_cast<size_t>(match.id) : size_t(0);
+        });
+        bench::print_row("reverse geocode 50 km", before, after);
+    }
+
+    struct BoxCase {
+        const char* label;
+        double west, south, east, north;
+    };
+    const BoxCase boxes[] = {
+        {"city view (Paris)", 2.2, 48.8, 2.5, 48.95},
+        {"region view (Alps)", 5.0, 43.5, 16.0, 48.5},
+        {"continent (Europe)", -25.0, 34.0, 45.0, 72.0},
+        {"antimeridian (Fiji)", 176.0, -20.0, -178.0, -15.0},
+    };
+    std::vector<uint32_t> ids;
+    bench::print_header("bounding box (full scan -> k-d tree)");
+    for (const BoxCase& box : boxes) {
+        double before = bench::time_ns(200, [&](size_t) {
+            return bbox_scan(box.west, box.south, box.east, box.north, ids);
+        });
+        double after = bench::time_ns(2000, [&](size_t) {
+            return find_locations_in_bbox(box.west, box.south, box.east, box.north, ids);
+        });
+        bench::print_row(box.label, before, after);
+    }
+
+    return 0;
+}
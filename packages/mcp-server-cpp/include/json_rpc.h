@@ -4,10 +4,21 @@
  *
  * Lightweight JSON-RPC 2.0 parser and serializer for MCP protocol.
  * Optimized for WebAssembly with minimal allocations.
+ *
+ * A message is tokenized once by json_parse() into a flat tape of nodes
+ * (JsonDocument), visiting only the offsets found by the vectorized
+ * structural scan (json_scan.h). Every node records how many nodes its
+ * subtree spans, so a key lookup walks only the members of one object,
+ * skipping nested values, instead of searching the message text again. Nodes point into
+ * the parsed text, which must outlive the document's use. Strings with escapes
+ * are decoded once, during the parse, into the document, so every string
+ * value can be read as a std::string_view without copying.
  */
 
 #include <cstdint>
 #include <cstddef>
+#include <string_view>
+#include <vector>
 
 namespace cesium {
 namespace mcp {
@@ -31,43 +42,156 @@ enum class ErrorCode : int32_t {
   InternalError = -32603
 };
 
+// Nesting deeper than this is rejected as a parse error
+constexpr size_t MAX_JSON_DEPTH = 64;
+
+enum class JsonType : uint8_t {
+  Null,
+  False,
+  True,
+  Number,
+  String,
+  Array,
+  Object
+};
+
+/**
+ * Tape node: objects are followed by alternating key (String) and value
+ * nodes, arrays by their elements
+ */
+struct JsonNode {
+  JsonType type;
+  bool escaped;             // String held backslash escapes: text is its decoded copy in JsonDocument::strings
+  uint32_t span;            // Nodes in this subtree, itself included: the next sibling is this + span
+  uint32_t count;           // Array elements / object members
+  uint32_t length;          // Unescaped string bytes, or the whole value's source bytes
+  const char* text;         // Unescaped string contents, or the value's first byte in the source
+  double number;            // Number value
+};
+
+/**
+ * Parsed JSON text; all vectors are reused across parses
+ */
+struct JsonDocument {
+  std::vector<JsonNode> nodes;
+  std::vector<uint32_t> structurals;  // Stage 1 index (json_scan.h)
+  std::vector<char> strings;          // Decoded strings that held escapes
+};
+
+/**
+ * Tokenize a JSON text
+ * @param json JSON text (need not be NUL-terminated)
+ * @param length Length of json in bytes
+ * @param document Output: tape, root first
+ * @return true if json is one well-formed value, optionally surrounded by
+ *         whitespace (on failure the document is empty)
+ */
+bool json_parse(const char* json, size_t length, JsonDocument& document);
+
 /**
- * Extract a string value from JSON by key
- * @param json JSON string
+ * Get the root value of a document
+ * @return Root node, or nullptr if the last parse failed
+ */
+const JsonNode* json_root(const JsonDocument& document);
+
+/**
+ * Find a member of an object (the first, if the key repeats)
+ * @param object Object node (anything else, including nullptr, finds nothing)
  * @param key Key to search for (without quotes)
- * @param value Output buffer for value
+ * @return Value node, or nullptr if missing
+ */
+const JsonNode* json_find(const JsonNode* object, const char* key);
+
+/**
+ * Step to the next sibling; the first element or key of a non-empty
+ * container is container + 1
+ */
+const JsonNode* json_next(const JsonNode* node);
+
+/**
+ * Copy a string node into a buffer (truncating to fit, never mid-character)
+ * @param string String node
+ * @param value Output buffer
  * @param value_size Size of output buffer
- * @return true if key found and value extracted
+ * @return Number of bytes written (excluding null terminator)
  */
-bool json_get_string(const char* json, const char* key, char* value, size_t value_size);
+size_t json_string_copy(const JsonNode* string, char* value, size_t value_size);
 
 /**
- * Extract a number value from JSON by key
- * @param json JSON string
- * @param key Key to search for
- * @param value Output for numeric value
- * @return true if key found and value parsed
+ * Extract a string member of an object
+ * @param object Object node (may be nullptr)
+ * @param key Key to search for (without quotes)
+ * @param value Output buffer for the unescaped value (emptied when not found)
+ * @param value_size Size of output buffer
+ * @return true if key found with a string value
+ */
+bool json_get_string(const JsonNode* object, const char* key, char* value, size_t value_size);
+
+/**
+ * View a string node's unescaped contents
+ * @param string String node
+ * @return View into the parsed text, or into the document for a string
+ *         that held escapes; not NUL-terminated
  */
-bool json_get_number(const char* json, const char* key, double& value);
+std::string_view json_string_view(const JsonNode* string);
 
 /**
- * Extract an integer value from JSON by key
- * @param json JSON string
+ * Extract a string member of an object without copying it
+ * @param object Object node (may be nullptr)
+ * @param key Key to search for (without quotes)
+ * @param value Output: view valid while the document and the parsed text
+ *        are (unchanged when not found)
+ * @return true if key found with a string value
+ */
+bool json_get_string_view(const JsonNode* object, const char* key, std::string_view& value);
+
+/**
+ * Extract a number member of an object
+ * @param object Object node (may be nullptr)
  * @param key Key to search for
- * @param value Output for integer value
- * @return true if key found and value parsed
+ * @param value Output for numeric value (unchanged when not found)
+ * @return true if key found with a number value
  */
-bool json_get_int(const char* json, const char* key, int64_t& value);
+bool json_get_number(const JsonNode* object, const char* key, double& value);
+
+// Returned by json_get_string_array() when the array does not fit
+constexpr size_t JSON_ARRAY_OVERFLOW = static_cast<size_t>(-1);
 
 /**
- * Extract a nested object from JSON by key
- * @param json JSON string
+ * Extract an array of strings member of an object
+ * Values are unescaped into storage, each NUL-terminated, one per element
+ * in order; non-string elements get a nullptr so positions still line up.
+ * Nothing is truncated: an array that does not fit is rejected whole.
+ * @param object Object node (may be nullptr)
  * @param key Key to search for
- * @param value Output buffer for nested JSON
- * @param value_size Size of output buffer
- * @return true if key found and object extracted
+ * @param storage Output buffer for the string bytes
+ * @param storage_size Size of storage
+ * @param values Output: pointers into storage (or nullptr), one per element
+ * @param max_values Capacity of values
+ * @return Number of elements (0 if the key is missing or not an array), or
+ *         JSON_ARRAY_OVERFLOW if there are more than max_values elements or
+ *         the strings do not fit in storage
+ */
+size_t json_get_string_array(const JsonNode* object, const char* key, char* storage, size_t storage_size,
+                             const char** values, size_t max_values);
+
+/**
+ * Extract an array of numeric records (e.g. positions) into row-major rows
+ * Object elements are matched against the column names in one pass over
+ * their members; array elements ([lon, lat, height]) are read positionally.
+ * Every element yields a row; a column that is missing or not a number
+ * takes its default.
+ * @param object Object node (may be nullptr)
+ * @param key Key of the array
+ * @param columns Column names, at most 32
+ * @param defaults Default value per column
+ * @param column_count Number of columns
+ * @param rows Output: max_rows x column_count values
+ * @param max_rows Capacity of rows, in rows
+ * @return Number of rows extracted (0 if the key is missing or not an array)
  */
-bool json_get_object(const char* json, const char* key, char* value, size_t value_size);
+size_t json_get_number_rows(const JsonNode* object, const char* key, const char* const* columns,
+                            const double* defaults, size_t column_count, double* rows, size_t max_rows);
 
 /**
  * Escape a string for JSON output
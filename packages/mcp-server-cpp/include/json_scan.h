@@ -0,0 +1,50 @@
+#pragma once
+/**
+ * JSON Structural Scanner
+ *
+ * First stage of json_parse() (json_rpc.h), after simdjson: the text is
+ * classified 64 bytes at a time with vector compares into bitmasks of
+ * quotes, backslashes, the operators {}[]:, and whitespace. Escaped
+ * characters follow from runs of backslashes, string interiors from a
+ * prefix XOR over the unescaped quotes, and what remains is the structural
+ * index: the offset of every operator and quote outside a string and of
+ * the first byte of every number or literal. The tokenizer then visits only
+ * those offsets instead of every byte, so long string values and
+ * whitespace cost a few vector operations per 64 bytes.
+ *
+ * Kernels follow location_scan.h: WASM SIMD128 under Emscripten, AVX2 when
+ * compiled with -mavx2 (CESIUM_MCP_AVX2), SSE2 otherwise on x86-64, and a
+ * portable scalar loop elsewhere or when CESIUM_MCP_SCALAR_SCAN is
+ * defined. The scalar classifier is always built, for verification.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cesium {
+namespace mcp {
+
+/**
+ * Build the structural index of a JSON text
+ * @param json JSON text (need not be NUL-terminated)
+ * @param length Length of json in bytes
+ * @param structurals Output: ascending offsets of operators, quotes (both
+ *        ends of every string) and number/literal starts
+ * @return false if a string is unterminated or holds a raw control
+ *         character; grammar is checked by the tokenizer
+ */
+bool json_find_structurals(const char* json, size_t length, std::vector<uint32_t>& structurals);
+
+/**
+ * Scalar reference for json_find_structurals() (byte-wise classification)
+ */
+bool json_find_structurals_scalar(const char* json, size_t length, std::vector<uint32_t>& structurals);
+
+/**
+ * Name of the compiled-in classifier: "simd128", "avx2", "sse2" or "scalar"
+ */
+const char* get_json_scan_kernel();
+
+}  // namespace mcp
+}  // namespace cesium
@@ -0,0 +1,51 @@
+#pragma once
+/**
+ * Bit-Parallel Levenshtein Distance
+ *
+ * Myers' bit-vector algorithm (Hyyrö's formulation): the DP column for the
+ * pattern is packed into 64-bit words, so each text byte costs a handful of
+ * word operations instead of a row of min() calls. Patterns longer than 64
+ * bytes are split into blocks. No heap allocation.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cesium {
+namespace mcp {
+
+// Longest pattern handled bit-parallel (4 blocks of 64 bytes)
+constexpr size_t LEVENSHTEIN_MAX_BLOCKS = 4;
+constexpr size_t LEVENSHTEIN_MAX_PATTERN = LEVENSHTEIN_MAX_BLOCKS * 64;
+
+/**
+ * Precomputed match masks for one pattern, reusable against many texts
+ */
+struct LevenshteinPattern {
+  uint64_t peq[LEVENSHTEIN_MAX_BLOCKS][256];  // Bit i set where pattern[block*64+i] == byte
+  size_t length;                              // Pattern length in bytes
+  size_t blocks;                              // Number of 64-bit blocks in use
+};
+
+/**
+ * Build match masks for a pattern
+ * @param pattern Null-terminated pattern (at most LEVENSHTEIN_MAX_PATTERN bytes)
+ * @param out Pattern to fill
+ * @return false if the pattern is too long for the bit-parallel path
+ */
+bool levenshtein_prepare(const char* pattern, LevenshteinPattern& out);
+
+/**
+ * Edit distance between a prepared pattern and a text
+ * Stops as soon as the distance is known to exceed max_distance.
+ * @param pattern Pattern from levenshtein_prepare()
+ * @param text Null-terminated text
+ * @param text_length Length of text in bytes
+ * @param max_distance Maximum distance before early termination (-1 = no limit)
+ * @return Edit distance, or max_distance+1 if exceeded threshold
+ */
+int levenshtein_distance(const LevenshteinPattern& pattern, const char* text,
+                         size_t text_length, int max_distance = -1);
+
+}  // namespace mcp
+}  // namespace cesium
@@ -0,0 +1,104 @@
+#pragma once
+/**
+ * Binary Location Database (LOCDB001)
+ *
+ * Reader for the format written by scripts/build-binary-locations.mjs:
+ * a 64-byte header followed by fixed 148-byte records sorted by name.
+ * The file is mapped (native) or handed over as a buffer (WASM) and
+ * queried in place; nothing is copied or parsed up front beyond checking
+ * that every record name is NUL-terminated.
+ *
+ * When a database is attached, resolve_location() consults it first and
+ * falls back to the compiled-in table; prefix queries go to
+ * search_binary_locations() first (records, not Location entries).
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cesium {
+namespace mcp {
+
+constexpr size_t LOCDB_HEADER_SIZE = 64;
+constexpr size_t LOCDB_RECORD_SIZE = 148;
+constexpr size_t LOCDB_NAME_SIZE = 128;
+
+// Type flags stored in LocdbRecord::type
+constexpr uint16_t LOCDB_TYPE_STATE = 1;
+constexpr uint16_t LOCDB_TYPE_CITY = 2;
+constexpr uint16_t LOCDB_TYPE_LANDMARK = 4;
+constexpr uint16_t LOCDB_TYPE_COUNTRY = 8;
+constexpr uint16_t LOCDB_TYPE_REGION = 16;
+constexpr uint16_t LOCDB_TYPE_AIRPORT = 32;
+
+/**
+ * One on-disk record (little-endian)
+ */
+struct LocdbRecord {
+  char name[LOCDB_NAME_SIZE];   // Normalized, NUL-terminated
+  float longitude;
+  float latitude;
+  float heading;                // -1 = not set
+  uint32_t population;          // 0 = unknown
+  uint16_t type;                // LOCDB_TYPE_* flags
+  uint16_t reserved;
+};
+
+static_assert(sizeof(LocdbRecord) == LOCDB_RECORD_SIZE, "LOCDB001 record layout");
+
+/**
+ * Use an in-memory LOCDB001 image (e.g. a fetched ArrayBuffer in WASM)
+ * The data is referenced, not copied, and must stay alive while attached.
+ * @param data Start of the file image (4-byte aligned)
+ * @param size Size in bytes
+ * @return false if the header or size is invalid, or a record name is not
+ *         NUL-terminated within LOCDB_NAME_SIZE
+ */
+bool attach_location_database(const uint8_t* data, size_t size);
+
+/**
+ * Map a LOCDB001 file and attach it (native builds only)
+ * @param path File path
+ * @return false if the file cannot be mapped or is invalid
+ */
+bool open_location_database(const char* path);
+
+/**
+ * Detach the current database, unmapping it if it was opened from a file
+ */
+void detach_location_database();
+
+/**
+ * Get the number of records in the attached database (0 if none)
+ */
+size_t get_binary_location_count();
+
+/**
+ * Find a record by name
+ * @param name Location name (any case/punctuation; normalized the same way
+ *             as the database builder)
+ * @return Record, or nullptr if not found or no database is attached
+ */
+const LocdbRecord* find_binary_location(const char* name);
+
+/**
+ * Find records whose name starts with a prefix, in name order
+ * @param prefix Prefix (normalized the same way as the database builder)
+ * @param results Output array of records
+ * @param max_results Maximum number of results to return
+ * @return Number of results written
+ */
+size_t search_binary_locations(const char* prefix, const LocdbRecord** results,
+                               size_t max_results);
+
+/**
+ * Normalize a name the way scripts/build-binary-locations.mjs does:
+ * lowercase, keep only [a-z0-9] and spaces, collapse and trim spaces
+ * @param input Raw name
+ * @param output Output buffer
+ * @param output_size Size of output buffer
+ */
+void normalize_binary_location_name(const char* input, char* output, size_t output_size);
+
+}  // namespace mcp
+}  // namespace cesium
@@ -0,0 +1,69 @@
+#pragma once
+/**
+ * Location Resolution Cache
+ *
+ * Bounded LRU cache in front of resolve_location() and the fuzzy resolvers,
+ * keyed on the raw query string plus the lookup variant (exact, or fuzzy
+ * with its distance and filter). Both found and not-found results are kept.
+ * Storage is a fixed array of entries with an intrusive recency list and
+ * hash chains, so lookups and inserts never allocate.
+ *
+ * Not thread-safe, like the rest of the server's static state.
+ */
+
+#include "location_database.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace cesium {
+namespace mcp {
+
+constexpr size_t LOCATION_CACHE_CAPACITY = 256;
+
+// Longest cached query in bytes; longer queries bypass the cache
+constexpr size_t LOCATION_CACHE_KEY_SIZE = 63;
+
+struct LocationCacheStats {
+  uint64_t hits;
+  uint64_t misses;
+  uint64_t evictions;
+  size_t entries;
+  size_t capacity;
+};
+
+/**
+ * Look up a cached resolution and mark it most recently used
+ * Counts a hit or a miss.
+ * @param query Raw query as passed to the resolver
+ * @param variant Resolver variant (exact / fuzzy parameters), opaque here
+ * @param result Output: cached result (if found)
+ * @return true on a cache hit
+ */
+bool location_cache_get(const char* query, uint64_t variant, LocationResolution& result);
+
+/**
+ * Store a resolution, evicting the least recently used entry when full
+ * Queries longer than LOCATION_CACHE_KEY_SIZE are not stored.
+ */
+void location_cache_put(const char* query, uint64_t variant, const LocationResolution& result);
+
+/**
+ * Drop every entry (counters are kept); called when the data behind the
+ * resolvers changes, e.g. a binary database is attached or detached
+ */
+void clear_location_cache();
+
+/**
+ * Turn the cache on or off (on by default); while off, lookups miss
+ * without being counted and nothing is stored. Used to profile the
+ * resolvers themselves.
+ */
+void set_location_cache_enabled(bool enabled);
+
+/**
+ * Get hit/miss/eviction counters and occupancy
+ */
+LocationCacheStats get_location_cache_stats();
+
+}  // namespace mcp
+}  // namespace cesium
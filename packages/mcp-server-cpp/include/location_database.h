@@ -7,6 +7,7 @@
  */
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 
 namespace cesium {
@@ -20,8 +21,18 @@ struct Location {
   int population;     // Population count, 0 = unknown
 };
 
+// Outcome of resolving one name (batch results, cache entries)
+struct LocationResolution {
+  double longitude;
+  double latitude;
+  double heading;     // -1 = not set
+  bool found;
+};
+
 /**
  * Resolve a location name to coordinates
+ * An attached binary database (location_binary.h) is consulted first.
+ * Results, including misses, are kept in the LRU cache (location_cache.h).
  * @param name Location name (case-insensitive)
  * @param longitude Output: longitude in degrees
  * @param latitude Output: latitude in degrees
@@ -30,6 +41,20 @@ struct Location {
  */
 bool resolve_location(const char* name, double& longitude, double& latitude, double& heading);
 
+/**
+ * Resolve many names in one call, in order
+ * Each name goes through resolve_location(); with max_distance > 0, names
+ * that miss fall back to fuzzy_resolve_location(). A name repeated in the
+ * batch is resolved once.
+ * @param names Location names; a nullptr entry is reported as not found
+ * @param count Number of names
+ * @param results Output: one resolution per name (count entries)
+ * @param max_distance Fuzzy fallback distance (0 = exact only)
+ * @return Number of names found
+ */
+size_t resolve_locations(const char* const* names, size_t count, LocationResolution* results,
+                         int max_distance = 0);
+
 /**
  * Get all known locations
  * @return Pointer to array of Location structs
@@ -42,8 +67,26 @@ const Location* get_all_locations();
  */
 size_t get_location_count();
 
+/**
+ * Get the name bytes every Location::name points into
+ * @param size Output: bytes in the block (NUL-terminated names)
+ * @return Start of the block, or nullptr if the table is empty
+ */
+const char* get_location_names(size_t& size);
+
+/**
+ * Fingerprint of the embedded location table (first 32 bits of the
+ * SHA-256 of data/location_table.bin, computed by CMake), so tables built
+ * offline (prebuilt indexes, SymSpell files) can be matched in O(1)
+ * @return Fingerprint of the compiled-in table
+ */
+uint32_t get_location_fingerprint();
+
 /**
  * Search for locations matching a prefix
+ * Results are returned in alphabetical (byte-wise) name order and point
+ * into get_all_locations(). An attached binary database is searched
+ * separately, through search_binary_locations().
  * @param prefix Prefix to search for
  * @param results Output array of matching locations
  * @param max_results Maximum number of results to return
@@ -53,6 +96,7 @@ size_t search_locations(const char* prefix, const Location** results, size_t max
 
 /**
  * Normalize a location name for lookup (lowercase, trim whitespace)
+ * Lowercasing covers Latin, Greek, Cyrillic and Armenian capitals (utf8_fold.h).
  * @param input Input string
  * @param output Output buffer (must be at least as large as input)
  * @param output_size Size of output buffer
@@ -61,7 +105,8 @@ void normalize_location_name(const char* input, char* output, size_t output_size
 
 /**
  * Fuzzy search for a location name using Levenshtein distance
- * Efficiently finds close matches when exact matching fails
+ * Efficiently finds close matches when exact matching fails; results are
+ * cached per query and max_distance (location_cache.h)
  * @param name Location name to search for (case-insensitive)
  * @param longitude Output: longitude in degrees (if found)
  * @param latitude Output: latitude in degrees (if found)
@@ -86,7 +131,8 @@ size_t fuzzy_search_locations(const char* name, const Location** results,
 
 /**
  * Calculate Levenshtein edit distance between two strings
- * Uses early termination when distance exceeds threshold for efficiency
+ * Bit-parallel (see levenshtein.h) with early termination when the distance
+ * is known to exceed the threshold
  * @param s1 First string
  * @param s2 Second string
  * @param max_distance Maximum distance before early termination (-1 = no limit)
@@ -96,6 +142,7 @@ int levenshtein_distance(const char* s1, const char* s2, int max_distance = -1);
 
 /**
  * Check if string contains another string (substring match)
+ * Uses the vectorized scan kernel (location_scan.h).
  * @param haystack String to search in
  * @param needle String to search for
  * @return true if needle is found in haystack
@@ -104,6 +151,8 @@ bool contains_substring(const char* haystack, const char* needle);
 
 /**
  * Get top cities sorted by population
+ * Served from the population rank index; see location_rank.h for
+ * bounding-box filters.
  * @param results Output array of location pointers
  * @param max_results Maximum number of results to return
  * @param min_population Minimum population threshold (default: 0)
@@ -113,7 +162,7 @@ size_t get_top_cities_by_population(const Location** results, size_t max_results
                                      int min_population = 0);
 
 /**
- * Get total number of cities with known population
+ * Get total number of cities with known population (O(1))
  * @return Count of cities with population > 0
  */
 size_t get_cities_with_population_count();
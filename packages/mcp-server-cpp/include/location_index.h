@@ -0,0 +1,79 @@
+#pragma once
+/**
+ * Location Name Index
+ *
+ * Lookup structures built once over the location database so that name
+ * queries do not have to scan every entry. Indexes are built lazily on first
+ * use; call build_location_indexes() from init() to pay the cost up front.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cesium {
+namespace mcp {
+
+// Sentinel returned when a name is not in the database
+constexpr uint32_t INVALID_LOCATION_ID = 0xFFFFFFFFu;
+
+/**
+ * Build all location indexes (safe to call more than once)
+ */
+void build_location_indexes();
+
+/**
+ * Hash a normalized location name (32-bit FNV-1a)
+ * @param name Null-terminated name
+ * @return Hash value
+ */
+uint32_t hash_location_name(const char* name);
+
+/**
+ * Find a location by exact normalized name using the hash index
+ * @param normalized Name already passed through normalize_location_name()
+ * @return Index into get_all_locations(), or INVALID_LOCATION_ID if not found
+ */
+uint32_t find_location_id(const char* normalized);
+
+/**
+ * Find a location by folded name (case, diacritics and typographic quotes
+ * ignored) using the folded-key hash index
+ * @param folded Name already passed through utf8_fold()
+ * @return Index into get_all_locations() (first entry with that key), or
+ *         INVALID_LOCATION_ID if not found
+ */
+uint32_t find_location_id_folded(const char* folded);
+
+/**
+ * Find the compiled-in entry resolve_location() uses for a raw name: the
+ * exact normalized name, else the folded key ("SAO PAULO" -> "são paulo")
+ * @param name Location name as given by the caller
+ * @return Index into get_all_locations(), or INVALID_LOCATION_ID if not found
+ */
+uint32_t find_location_id_any_spelling(const char* name);
+
+/**
+ * Get location IDs sorted by name (byte-wise strcmp order)
+ * @param count Output: number of IDs in the array
+ * @return Array of IDs into get_all_locations()
+ */
+const uint32_t* get_locations_by_name(size_t& count);
+
+/**
+ * Binary search the name-sorted index
+ * @param key Normalized name or prefix
+ * @return Position of the first entry in get_locations_by_name() whose name
+ *         is not less than key; every entry starting with key follows it
+ *         contiguously
+ */
+size_t lower_bound_location_name(const char* key);
+
+/**
+ * Get name lengths in bytes, parallel to get_all_locations()
+ * Lets scans reject candidates by length without touching the name strings.
+ * @return Array of get_location_count() lengths (0 for unnamed entries)
+ */
+const uint16_t* get_location_name_lengths();
+
+}  // namespace mcp
+}  // namespace cesium
@@ -0,0 +1,123 @@
+#pragma once
+/**
+ * Location Type and Country Metadata
+ *
+ * Per-location type flags (city, airport, landmark, ...) and ISO 3166-1
+ * alpha-2 country codes, generated offline by
+ * scripts/build-location-metadata.mjs into location_metadata_data.cpp and
+ * exposed as compact columns of the packed store. Sub-indexes list the IDs
+ * of each type and each country in name order, so filtered prefix searches
+ * only walk matching names and filtered fuzzy lookups skip every candidate
+ * of the wrong kind before computing an edit distance.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include "location_database.h"
+
+namespace cesium {
+namespace mcp {
+
+// Type flags (same values as LOCDB_TYPE_* in location_binary.h)
+constexpr uint8_t LOCATION_TYPE_STATE = 1;
+constexpr uint8_t LOCATION_TYPE_CITY = 2;
+constexpr uint8_t LOCATION_TYPE_LANDMARK = 4;
+constexpr uint8_t LOCATION_TYPE_COUNTRY = 8;
+constexpr uint8_t LOCATION_TYPE_REGION = 16;
+constexpr uint8_t LOCATION_TYPE_AIRPORT = 32;
+constexpr uint8_t LOCATION_TYPE_ALL = 63;
+
+// Country code for locations without one
+constexpr uint16_t LOCATION_COUNTRY_UNKNOWN = 0;
+
+/**
+ * Restrictions on type and country; a default-constructed filter keeps
+ * every location
+ */
+struct LocationFilter {
+  uint8_t types = 0;        // LOCATION_TYPE_* flags, any of which must be set (0 = any)
+  uint16_t country = 0;     // Packed country code (0 = any)
+};
+
+/**
+ * Generated tables (location_metadata_data.cpp), parallel to LOCATIONS
+ */
+const uint8_t* get_generated_location_types();
+const char* get_generated_location_countries();
+size_t get_generated_location_metadata_count();
+
+/**
+ * Pack a two-letter country code ("us", "FR") into a uint16_t
+ * @param code Country code
+ * @return Packed code, or LOCATION_COUNTRY_UNKNOWN if not two letters
+ */
+uint16_t parse_country_code(const char* code);
+
+/**
+ * Unpack a country code
+ * @param country Packed code
+ * @param output Output buffer (at least 3 bytes); empty if unknown
+ */
+void format_country_code(uint16_t country, char* output);
+
+/**
+ * Parse a comma-separated list of type names ("city,airport")
+ * Accepts state, city, landmark, country, region and airport (any case).
+ * @param names Type names
+ * @param unrecognized Optional output: number of names that are not types
+ * @return LOCATION_TYPE_* flags; 0 if no name was recognized
+ */
+uint8_t parse_location_types(const char* names, size_t* unrecognized = nullptr);
+
+/**
+ * Write the names of the set type flags, comma-separated
+ * @param types LOCATION_TYPE_* flags
+ * @param output Output buffer
+ * @param output_size Size of output buffer
+ */
+void format_location_types(uint8_t types, char* output, size_t output_size);
+
+/**
+ * Check a location against a filter (O(1), reads the store columns)
+ */
+bool location_matches_filter(uint32_t id, const LocationFilter& filter);
+
+/**
+ * Build the per-type and per-country sub-indexes (safe to call more than once)
+ */
+void build_location_metadata_index();
+
+/**
+ * Count the locations passing a filter
+ */
+size_t count_locations_by_metadata(const LocationFilter& filter);
+
+/**
+ * Prefix search restricted to a filter, in name order
+ * The narrowest sub-index (a type list or a country's range) is walked
+ * instead of the full name index.
+ * @param prefix Prefix to search for
+ * @param filter Restrictions to apply
+ * @param results Output array of matching locations
+ * @param max_results Maximum number of results to return
+ * @return Number of matching locations found
+ */
+size_t search_locations_filtered(const char* prefix, const LocationFilter& filter,
+                                 const Location** results, size_t max_results);
+
+/**
+ * Fuzzy resolve restricted to a filter (see fuzzy_resolve_location)
+ */
+bool fuzzy_resolve_location_filtered(const char* name, const LocationFilter& filter,
+                                     double& longitude, double& latitude, double& heading,
+                                     int max_distance = 3);
+
+/**
+ * Fuzzy search restricted to a filter (see fuzzy_search_locations)
+ */
+size_t fuzzy_search_locations_filtered(const char* name, const LocationFilter& filter,
+                                       const Location** results, int* scores,
+                                       size_t max_results, int max_distance = 3);
+
+}  // namespace mcp
+}  // namespace cesium
@@ -0,0 +1,60 @@
+#pragma once
+/**
+ * Location Places (Alias Index)
+ *
+ * Groups the names of the location table into places. Names at the same
+ * fixed-point coordinates with the same heading ("paris", "city of light")
+ * are one place, except that two unpopulated landmarks there only merge
+ * when one name's words contain the other's ("louvre", "the louvre").
+ * Populated names sharing a GeoNames population within
+ * PLACE_MERGE_DISTANCE ("bogota", "bogotá") are one place too. Each place is
+ * represented by its canonical name ID (the most populous member, ties
+ * to the lowest ID), whose store row holds the place's coordinates and
+ * metadata; alias rows defer to it.
+ *
+ * Place-level indexes (spatial, population rank) hold canonical IDs only,
+ * so their results list each place once.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cesium {
+namespace mcp {
+
+// Populated names with equal populations merge when this close (meters)
+constexpr double PLACE_MERGE_DISTANCE = 25000.0;
+
+/**
+ * Build the alias index (safe to call more than once)
+ */
+void build_location_place_index();
+
+/**
+ * Get the number of distinct places
+ */
+size_t get_location_place_count();
+
+/**
+ * Get the canonical name ID of the place a name belongs to (O(1))
+ * @param id Index into get_all_locations()
+ * @return Canonical ID (id itself for canonical and unaliased names)
+ */
+uint32_t get_canonical_location_id(uint32_t id);
+
+/**
+ * Check whether a name is its place's canonical name
+ */
+bool is_canonical_location(uint32_t id);
+
+/**
+ * Get every name of the place a name belongs to (O(log n), no scan)
+ * @param id Index into get_all_locations()
+ * @param count Output: number of names (1 for unaliased names)
+ * @return IDs of the place's names, canonical first, then by ID; stays
+ *         valid for the lifetime of the program
+ */
+const uint32_t* get_location_aliases(uint32_t id, size_t& count);
+
+}  // namespace mcp
+}  // namespace cesium
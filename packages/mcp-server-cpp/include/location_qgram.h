@@ -0,0 +1,36 @@
+#pragma once
+/**
+ * Fuzzy Match Candidate Filter
+ *
+ * Inverted lists of padded bigrams over the normalized location names,
+ * ordered by name length, plus a length-bucketed ID list. A name within
+ * edit distance k of the query must share at least max(m, n) + 1 - 2k
+ * bigrams with it (each edit destroys at most two), so only names passing
+ * that count filter need the edit-distance kernel. The filter is lossless.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cesium {
+namespace mcp {
+
+/**
+ * Build the bigram index (safe to call more than once)
+ */
+void build_location_qgram_index();
+
+/**
+ * Collect every location that may lie within max_distance of a query
+ * Not reentrant: the bigram counters are static scratch reused across calls
+ * @param normalized Query already passed through normalize_location_name()
+ * @param max_distance Edit distance threshold (negative yields no candidates)
+ * @param candidates Output: IDs into get_all_locations(), ascending
+ * @return Number of candidates
+ */
+size_t find_fuzzy_candidates(const char* normalized, int max_distance,
+                             std::vector<uint32_t>& candidates);
+
+}  // namespace mcp
+}  // namespace cesium
@@ -0,0 +1,62 @@
+#pragma once
+/**
+ * Population Rank Index
+ *
+ * Canonical IDs of every place with a known population (location_places.h),
+ * ordered by population (largest first, ties by ID). Counts come straight from the index, and
+ * filtered top-k queries walk it in rank order and stop at the k-th match,
+ * so they never depend on how the location table itself is ordered.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include "location_database.h"
+#include "location_metadata.h"
+
+namespace cesium {
+namespace mcp {
+
+/**
+ * Restrictions for a ranked query; a default-constructed filter keeps every
+ * populated location
+ */
+struct PopulationFilter {
+  int min_population = 0;   // Keep locations with at least this population
+  bool has_bbox = false;    // Restrict to west/south/east/north below
+  double west = -180.0;     // Degrees; west > east wraps across the antimeridian
+  double south = -90.0;
+  double east = 180.0;
+  double north = 90.0;
+  LocationFilter metadata;  // Type and country restrictions (location_metadata.h)
+};
+
+/**
+ * Build the rank index (safe to call more than once)
+ */
+void build_population_rank_index();
+
+/**
+ * Get the number of locations with a known population (O(1))
+ */
+size_t get_ranked_location_count();
+
+/**
+ * Count locations with at least min_population (binary search)
+ * @param min_population Population threshold (values below 1 count every
+ *                       populated location)
+ * @return Number of locations
+ */
+size_t count_locations_by_population(int min_population);
+
+/**
+ * Find the most populous locations passing a filter, largest first
+ * @param filter Restrictions to apply
+ * @param results Output array of location pointers
+ * @param max_results Maximum number of results to return
+ * @return Number of results written
+ */
+size_t find_top_locations_by_population(const PopulationFilter& filter,
+                                        const Location** results, size_t max_results);
+
+}  // namespace mcp
+}  // namespace cesium
@@ -0,0 +1,76 @@
+#pragma once
+/**
+ * Vectorized Name Scan
+ *
+ * Exhaustive substring search for paths no index covers. Names are copied
+ * in ID order into one contiguous, NUL-separated blob with zero padding at
+ * the end, so the kernel can issue full-width unaligned loads anywhere in
+ * it. Each block compares the needle's first byte at every position and
+ * its last byte needle_length - 1 further on; only positions passing both
+ * are compared in full.
+ *
+ * Kernels: WASM SIMD128 under Emscripten (-msimd128), AVX2 when compiled
+ * with -mavx2 (CESIUM_MCP_AVX2), SSE2 otherwise on x86-64, and a portable
+ * scalar loop elsewhere or when CESIUM_MCP_SCALAR_SCAN is defined. The
+ * scalar variants below are always built, for verification.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cesium {
+namespace mcp {
+
+/**
+ * Build the scan blob (safe to call more than once)
+ */
+void build_location_scan_blob();
+
+/**
+ * Get the scan blob's text (shared with the suffix array, location_suffix.h)
+ * @param length Output: bytes of names and separators, excluding padding
+ * @return Names in ID order, each NUL-terminated
+ */
+const char* get_location_scan_text(size_t& length);
+
+/**
+ * Map a blob offset to the ID whose name covers it (O(log n))
+ * @param offset Offset into get_location_scan_text(), < length
+ * @return ID into get_all_locations()
+ */
+uint32_t get_location_scan_id(size_t offset);
+
+/**
+ * Name of the compiled-in scan kernel: "simd128", "avx2", "sse2" or "scalar"
+ */
+const char* get_location_scan_kernel();
+
+/**
+ * Find locations whose name contains a substring (vectorized scan)
+ * @param needle Bytes to look for, matched as-is against stored names
+ *        (pass it through normalize_location_name() for user input)
+ * @param ids Output: matching IDs into get_all_locations(), ascending
+ * @param max_ids Capacity of ids
+ * @return Number of IDs written
+ */
+size_t scan_locations_containing(const char* needle, uint32_t* ids, size_t max_ids);
+
+/**
+ * Scalar reference for scan_locations_containing() (strstr per name)
+ */
+size_t scan_locations_containing_scalar(const char* needle, uint32_t* ids, size_t max_ids);
+
+/**
+ * Find a substring in arbitrary (unpadded) text with the same kernel;
+ * blocks that would read past the end fall back to a scalar compare
+ * @param text Text to search
+ * @param text_length Bytes in text
+ * @param needle Bytes to look for
+ * @param needle_length Bytes in needle
+ * @return Pointer to the first occurrence, or nullptr
+ */
+const char* scan_find_substring(const char* text, size_t text_length,
+                                const char* needle, size_t needle_length);
+
+}  // namespace mcp
+}  // namespace cesium
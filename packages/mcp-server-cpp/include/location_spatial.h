@@ -0,0 +1,102 @@
+#pragma once
+/**
+ * Spatial Location Index
+ *
+ * Static 2-d tree over the packed store's fixed-point longitude/latitude,
+ * one point per place (location_places.h), so aliases never repeat a result.
+ * Points are arranged in place by recursive median splits on alternating
+ * axes, so the tree needs no node storage: a node is a range of the point
+ * array and its split point is the middle element.
+ *
+ * Nearest-neighbour queries walk the tree best-first on great-circle
+ * distance, using the exact distance from the query to each node's
+ * longitude/latitude rectangle as the lower bound, so results are exact
+ * across the antimeridian and near the poles.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cesium {
+namespace mcp {
+
+// Mean Earth radius used for all distances
+constexpr double EARTH_RADIUS_METERS = 6371008.8;
+
+// Default search radius for reverse_geocode_location()
+constexpr double REVERSE_GEOCODE_DISTANCE = 50000.0;
+
+/**
+ * A location returned by a distance query
+ */
+struct SpatialMatch {
+  uint32_t id;          // Index into get_all_locations()
+  double distance;      // Great-circle distance in meters
+};
+
+/**
+ * Build the spatial index (safe to call more than once)
+ */
+void build_location_spatial_index();
+
+/**
+ * Find the locations closest to a point, nearest first
+ * @param longitude Query longitude in degrees
+ * @param latitude Query latitude in degrees
+ * @param max_results Maximum number of matches
+ * @param max_distance Ignore locations farther than this many meters
+ *                     (0 or negative = no limit)
+ * @param matches Output: matches ordered by distance
+ * @param min_population Skip locations with a smaller population (0 = keep all)
+ * @return Number of matches
+ */
+size_t find_nearest_locations(double longitude, double latitude, size_t max_results,
+                              double max_distance, std::vector<SpatialMatch>& matches,
+                              int min_population = 0);
+
+/**
+ * Find every location within a radius of a point, nearest first
+ * @param longitude Query longitude in degrees
+ * @param latitude Query latitude in degrees
+ * @param radius Radius in meters
+ * @param matches Output: matches ordered by distance
+ * @return Number of matches
+ */
+size_t find_locations_within_radius(double longitude, double latitude, double radius,
+                                    std::vector<SpatialMatch>& matches);
+
+/**
+ * Find every location inside a longitude/latitude rectangle
+ * A west edge greater than the east edge wraps across the antimeridian.
+ * @param west West edge in degrees
+ * @param south South edge in degrees
+ * @param east East edge in degrees
+ * @param north North edge in degrees
+ * @param ids Output: IDs into get_all_locations(), in no particular order
+ * @return Number of matches
+ */
+size_t find_locations_in_bbox(double west, double south, double east, double north,
+                              std::vector<uint32_t>& ids);
+
+/**
+ * Name the place at a coordinate without a network lookup
+ * The nearest populated place within max_distance wins; failing that, the
+ * nearest named location of any kind (landmark, airport, ...) within it.
+ * @param longitude Longitude in degrees
+ * @param latitude Latitude in degrees
+ * @param max_distance Search radius in meters
+ * @param match Output: the chosen location and its distance
+ * @return false if nothing lies within max_distance
+ */
+bool reverse_geocode_location(double longitude, double latitude, double max_distance,
+                              SpatialMatch& match);
+
+/**
+ * Great-circle distance between two points
+ * @return Distance in meters
+ */
+double great_circle_distance(double lon1, double lat1, double lon2, double lat2);
+
+}  // namespace mcp
+}  // namespace cesium
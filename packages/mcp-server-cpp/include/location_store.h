@@ -0,0 +1,98 @@
+#pragma once
+/**
+ * Packed Location Store
+ *
+ * Struct-of-arrays columns of the location table for scan-heavy code.
+ * Coordinates are fixed-point int32 (1e-7 degree, ~1 cm) in parallel arrays,
+ * and the rarely scanned heading, population, type and country sit in
+ * separate cold arrays. IDs are the same as indexes into get_all_locations().
+ *
+ * The columns are a second, scan-friendly copy of the numeric fields: the
+ * Location array stays resident beside them, so the store adds memory
+ * rather than saving it. Names are not copied; 32-bit offsets address the
+ * table's own name bytes (get_location_names()).
+ *
+ * Each name also has a folded key (utf8_fold(): no case, diacritics or
+ * typographic quotes). A key equal to some name shares that name's bytes;
+ * the others live in a small blob of their own, interned.
+ *
+ * The store is a set of pointer views, so tables can come from the
+ * compiled-in data (built once at startup) or from prebuilt images.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cesium {
+namespace mcp {
+
+// Fixed-point scale for coordinates: degrees * 1e7 fits int32 for +/-180
+constexpr double LOCATION_COORD_SCALE = 1e7;
+
+// Set in a folded offset that points into folded_names instead of names
+constexpr uint32_t STORE_FOLDED_KEY = 1u << 31;
+
+struct LocationStore {
+  // Hot: touched by name and coordinate scans
+  const char* names;              // The location table's name bytes (not owned)
+  const char* folded_names;       // Folded keys that match no name, interned
+  const uint32_t* name_offsets;   // Per ID, offset into names
+  const uint32_t* folded_offsets; // Per ID, offset of the folded key (see STORE_FOLDED_KEY)
+  const int32_t* longitude_e7;
+  const int32_t* latitude_e7;
+
+  // Cold
+  const float* heading;           // -1 = not set
+  const int32_t* population;      // 0 = unknown
+  const uint8_t* type;            // LOCATION_TYPE_* flags (location_metadata.h), 0 = unknown
+  const uint16_t* country;        // Packed country code, 0 = unknown
+
+  size_t count;
+  size_t folded_names_size;       // Bytes in folded_names
+};
+
+/**
+ * Get the packed store (built from the compiled-in table on first use)
+ */
+const LocationStore& get_location_store();
+
+/**
+ * Build the packed store (safe to call more than once)
+ */
+void build_location_store();
+
+inline const char* store_name(const LocationStore& store, uint32_t id) {
+  return store.names + store.name_offsets[id];
+}
+
+inline const char* store_folded_name(const LocationStore& store, uint32_t id) {
+  uint32_t offset = store.folded_offsets[id];
+  return offset & STORE_FOLDED_KEY ? store.folded_names + (offset & ~STORE_FOLDED_KEY) : store.names + offset;
+}
+
+inline double store_longitude(const LocationStore& store, uint32_t id) {
+  return store.longitude_e7[id] / LOCATION_COORD_SCALE;
+}
+
+inline double store_latitude(const LocationStore& store, uint32_t id) {
+  return store.latitude_e7[id] / LOCATION_COORD_SCALE;
+}
+
+/**
+ * Convert degrees to the store's fixed-point representation (rounded)
+ */
+int32_t location_coord_to_fixed(double degrees);
+
+/**
+ * Bytes owned by the packed store (columns and folded keys; the names are
+ * the location table's)
+ */
+size_t get_location_store_memory();
+
+/**
+ * Bytes used by the compiled-in Location array plus its name strings
+ */
+size_t get_location_table_memory();
+
+}  // namespace mcp
+}  // namespace cesium
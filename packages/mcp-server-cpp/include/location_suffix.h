@@ -0,0 +1,65 @@
+#pragma once
+/**
+ * Location Suffix Array (Infix Search)
+ *
+ * Every suffix of every name, as offsets into the scan blob
+ * (location_scan.h), sorted byte-wise with each suffix ending at its
+ * name's NUL. The suffixes starting with a needle form one contiguous
+ * range, found with two binary searches, so infix queries cost
+ * O(m log n) plus the matches instead of a pass over all names.
+ *
+ * Matches are reported per place (location_places.h) and ranked by the
+ * place's population. Needles so common that their range holds more
+ * than a sixteenth as many suffixes as there are names ("a", "port") fall
+ * back to the vectorized scan, which is cheaper at that point. Only the
+ * built-in table is indexed; an attached binary database
+ * (location_binary.h) is not searched.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include "location_database.h"
+#include "location_metadata.h"
+
+namespace cesium {
+namespace mcp {
+
+/**
+ * Build the suffix array (safe to call more than once)
+ */
+void build_location_suffix_array();
+
+/**
+ * Get the number of suffixes in the array
+ */
+size_t get_location_suffix_count();
+
+/**
+ * Get the memory held by the suffix array in bytes (excluding the scan blob)
+ */
+size_t get_location_suffix_memory();
+
+/**
+ * Find the places with a name containing a substring, most populous first
+ * @param substring Text to look for (case-insensitive, normalized with
+ *        normalize_location_name(); diacritics are not folded)
+ * @param filter Type and country restrictions (location_metadata.h)
+ * @param results Output: canonical location of each place (ties in
+ *        population go to the lower ID)
+ * @param max_results Maximum number of results to return
+ * @return Number of results written
+ */
+size_t search_locations_containing(const char* substring, const LocationFilter& filter,
+                                   const Location** results, size_t max_results);
+
+/**
+ * Collect the IDs of every name containing a substring via the suffix array
+ * @param needle Bytes to look for, matched as-is (already normalized)
+ * @param ids Output: matching IDs, ascending
+ * @param max_ids Capacity of ids
+ * @return Number of IDs written (every match when max_ids allows)
+ */
+size_t suffix_locations_containing(const char* needle, uint32_t* ids, size_t max_ids);
+
+}  // namespace mcp
+}  // namespace cesium
@@ -0,0 +1,77 @@
+#pragma once
+/**
+ * Symmetric-Delete Typo Index
+ *
+ * SymSpell-style dictionary: every string obtainable by deleting up to D
+ * bytes from the first P bytes of a normalized name is hashed and mapped to
+ * the names that produce it. Two strings within edit distance k <= D share
+ * at least one such delete, so a typo is resolved by generating the
+ * query's deletes and verifying the few names they point to.
+ *
+ * The index is built lazily with the defaults below, or can be serialized
+ * once (see tools/symspell_index.cpp) and attached at startup so WASM does
+ * not pay the build cost.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cesium {
+namespace mcp {
+
+constexpr int SYMSPELL_DEFAULT_MAX_DISTANCE = 2;
+constexpr int SYMSPELL_DEFAULT_PREFIX_LENGTH = 7;
+
+/**
+ * Build (or rebuild) the delete index
+ * @param max_distance Largest edit distance the index can answer (1-4)
+ * @param prefix_length Name bytes that deletes are generated from
+ *                      (max_distance+1 to 32)
+ * @return false if the parameters are out of range
+ */
+bool build_symspell_index(int max_distance = SYMSPELL_DEFAULT_MAX_DISTANCE,
+                          int prefix_length = SYMSPELL_DEFAULT_PREFIX_LENGTH);
+
+/**
+ * Get the largest edit distance the current index answers
+ * Builds the default index if none has been built or attached.
+ */
+int get_symspell_max_distance();
+
+/**
+ * Collect every location that may lie within max_distance of a query
+ * @param normalized Query already passed through normalize_location_name()
+ * @param max_distance Edit distance threshold, at most get_symspell_max_distance()
+ * @param candidates Output: IDs into get_all_locations(), ascending
+ * @return false if max_distance exceeds what the index answers
+ */
+bool find_symspell_candidates(const char* normalized, int max_distance,
+                              std::vector<uint32_t>& candidates);
+
+/**
+ * Size in bytes of the serialized index
+ */
+size_t get_symspell_index_size();
+
+/**
+ * Serialize the current index (little-endian, 4-byte aligned)
+ * @param output Output buffer
+ * @param output_size Size of output buffer
+ * @return Bytes written, or 0 if the buffer is too small
+ */
+size_t serialize_symspell_index(uint8_t* output, size_t output_size);
+
+/**
+ * Use a serialized index in place of building one
+ * The tables are referenced, not copied, when data is 4-byte aligned, so
+ * the buffer must stay alive while the index is in use.
+ * @param data Serialized index
+ * @param size Size of data in bytes
+ * @return false if the data is malformed or was built from different
+ *         location data
+ */
+bool attach_symspell_index(const uint8_t* data, size_t size);
+
+}  // namespace mcp
+}  // namespace cesium
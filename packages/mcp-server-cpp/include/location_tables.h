@@ -0,0 +1,86 @@
+#pragma once
+/**
+ * Prebuilt Location Tables
+ *
+ * The name hash tables, the name-sorted order and the autocomplete trie
+ * depend only on the compiled-in LOCATIONS, so they can be computed when
+ * the server is built rather than in init(). The location-tables tool
+ * (tools/location_tables.cpp) builds them natively and writes them out as
+ * constant arrays in location_tables_data.cpp, which the compiler places in
+ * read-only data (the data segment of the WASM module); the indexes then
+ * serve lookups straight from those arrays.
+ *
+ * Builds without generated tables link location_tables_none.cpp instead
+ * and build every index on first use. The remaining indexes (packed store,
+ * places, spatial, q-gram, suffix array) are still built at runtime.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cesium {
+namespace mcp {
+
+/**
+ * Open-addressing hash slot: full hash is kept alongside the ID so probes
+ * only touch the name string when the hashes already agree
+ */
+struct LocationHashSlot {
+  uint32_t hash;
+  uint32_t id;              // INVALID_LOCATION_ID marks an empty slot
+};
+
+/**
+ * Autocomplete trie node (location_trie.cpp); nodes are stored
+ * breadth-first so the children of a node are contiguous
+ */
+struct LocationTrieNode {
+  uint32_t first_child;
+  uint32_t range_begin;     // Subtree covers name-sorted ranks [range_begin, range_end)
+  uint32_t range_end;
+  uint16_t child_count;
+  uint16_t depth;           // Length of the prefix spelled out at this node
+};
+
+/**
+ * Views of every prebuildable table
+ */
+struct LocationTables {
+  size_t location_count;                  // Entries of LOCATIONS the tables were built from
+  uint32_t fingerprint;                   // get_location_fingerprint() of that table
+
+  const LocationHashSlot* name_slots;     // Exact-name hash table (power-of-two size)
+  size_t name_slot_count;
+  const LocationHashSlot* folded_slots;   // Folded-name hash table (power-of-two size)
+  size_t folded_slot_count;
+
+  const uint32_t* sorted_ids;             // Named IDs in byte-wise name order
+  size_t sorted_count;
+
+  const LocationTrieNode* trie_nodes;
+  const uint8_t* trie_first_bytes;        // First edge byte of each node, parallel to trie_nodes
+  size_t trie_node_count;
+  const uint32_t* trie_best;              // Population segment tree, 2 * trie_leaves entries
+  size_t trie_leaves;
+};
+
+/**
+ * Get the tables compiled into this binary
+ * @return Tables, or nullptr if none were generated or they were generated
+ *         for a different location table (size or fingerprint)
+ */
+const LocationTables* get_prebuilt_location_tables();
+
+/**
+ * Get the tables in use, building any that are not prebuilt (used by the
+ * generator); views stay valid for the lifetime of the program
+ */
+LocationTables get_location_tables();
+
+/**
+ * Fill in the trie fields of a LocationTables (location_trie.cpp)
+ */
+void get_location_trie_tables(LocationTables& tables);
+
+}  // namespace mcp
+}  // namespace cesium
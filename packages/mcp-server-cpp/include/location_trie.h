@@ -0,0 +1,74 @@
+#pragma once
+/**
+ * Location Name Autocomplete
+ *
+ * Path-compressed trie over the normalized location names. Every subtree
+ * covers a contiguous run of the name-sorted index, so the top-k completions
+ * of a prefix are a range-maximum query on population rather than a scan.
+ *
+ * Lookups are incremental: a cursor remembers the trie position for the
+ * prefix typed so far and can be advanced one keystroke at a time.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include "location_database.h"
+
+namespace cesium {
+namespace mcp {
+
+/**
+ * Position in the autocomplete trie for a prefix typed so far
+ */
+struct AutocompleteCursor {
+  uint32_t node;     // Trie node whose incoming edge contains the position
+  uint16_t depth;    // Number of prefix bytes matched
+  bool valid;        // False once the prefix matches no location
+};
+
+/**
+ * Build the autocomplete trie (safe to call more than once)
+ */
+void build_location_trie();
+
+/**
+ * Get a cursor positioned at the empty prefix
+ */
+AutocompleteCursor autocomplete_begin();
+
+/**
+ * Advance a cursor by additional prefix bytes
+ * @param cursor Cursor to advance in place
+ * @param bytes Normalized bytes to append to the prefix
+ * @param length Number of bytes
+ * @return true if the extended prefix still matches at least one location
+ */
+bool autocomplete_advance(AutocompleteCursor& cursor, const char* bytes, size_t length);
+
+/**
+ * Get the top completions for a cursor ranked by population
+ * Ties (including unknown population) are broken alphabetically.
+ * @param cursor Cursor from autocomplete_begin()/autocomplete_advance()
+ * @param results Output array of matching locations
+ * @param max_results Maximum number of results to return
+ * @return Number of results written
+ */
+size_t autocomplete_top(const AutocompleteCursor& cursor, const Location** results,
+                        size_t max_results);
+
+/**
+ * Count the locations under a cursor
+ */
+size_t autocomplete_count(const AutocompleteCursor& cursor);
+
+/**
+ * One-shot autocomplete for a raw (unnormalized) prefix
+ * @param prefix Prefix typed by the user
+ * @param results Output array of matching locations
+ * @param max_results Maximum number of results to return
+ * @return Number of results written
+ */
+size_t autocomplete_locations(const char* prefix, const Location** results, size_t max_results);
+
+}  // namespace mcp
+}  // namespace cesium
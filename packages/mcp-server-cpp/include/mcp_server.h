@@ -8,6 +8,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include "json_rpc.h"
 
 namespace cesium {
 namespace mcp {
@@ -25,10 +26,14 @@ void init();
 
 /**
  * Handle an incoming MCP message (JSON-RPC)
- * @param message Input JSON-RPC message
+ * A batch (array of requests) is parsed once and answered with one array
+ * holding a response per request that is not a notification, in order.
+ * Notifications (requests without an "id") are run but never answered.
+ * @param message Input JSON-RPC message or batch
  * @param response Output buffer for response
  * @param response_size Size of output buffer
- * @return Number of characters written to response (0 for notifications)
+ * @return Number of characters written to response (0 for notifications
+ *         and batches of only notifications)
  */
 size_t handle_message(const char* message, char* response, size_t response_size);
 
@@ -43,7 +48,7 @@ size_t get_tool_definitions(char* output, size_t output_size);
 /**
  * Handle initialize request
  */
-size_t handle_initialize(const char* id, const char* params, char* response, size_t response_size);
+size_t handle_initialize(const char* id, const JsonNode* params, char* response, size_t response_size);
 
 /**
  * Handle tools/list request
@@ -53,7 +58,7 @@ size_t handle_tools_list(const char* id, char* response, size_t response_size);
 /**
  * Handle tools/call request
  */
-size_t handle_tools_call(const char* id, const char* params, char* response, size_t response_size);
+size_t handle_tools_call(const char* id, const JsonNode* params, char* response, size_t response_size);
 
 /**
  * Handle resources/list request
@@ -63,7 +68,7 @@ size_t handle_resources_list(const char* id, char* response, size_t response_siz
 /**
  * Handle resources/read request
  */
-size_t handle_resources_read(const char* id, const char* params, char* response, size_t response_size);
+size_t handle_resources_read(const char* id, const JsonNode* params, char* response, size_t response_size);
 
 }  // namespace mcp
 }  // namespace cesium
@@ -96,10 +101,61 @@ const char* getToolDefinitions();
  */
 const char* resolveLocation(const char* name);
 
+/**
+ * Resolve many location names in one call
+ * @param names Newline-separated location names (up to 256)
+ * @param maxDistance Edit distance for a fuzzy fallback on names not found
+ *        exactly (0 = exact only, max 3)
+ * @return JSON object with count, found and, in input order, the columns
+ *         resolved (1/0), longitude, latitude and heading (null when
+ *         not found or not set); {"error": ...} if there are more than 256
+ *         names or more than 16383 bytes, rather than a truncated batch
+ */
+const char* resolveLocationsBatch(const char* names, int maxDistance);
+
 /**
  * List all known locations
  * @return JSON array of location objects
  */
 const char* listLocations();
 
+/**
+ * Autocomplete a location prefix, most populous matches first
+ * Successive calls that extend the previous prefix resume from where the
+ * last lookup stopped instead of starting over.
+ * @param prefix Prefix typed so far
+ * @param maxResults Maximum number of completions (default 10, max 100)
+ * @return JSON array of location objects
+ */
+const char* autocompleteLocations(const char* prefix, int maxResults);
+
+/**
+ * Name the place nearest a coordinate from the built-in database
+ * Populated places win over landmarks; no network request is made.
+ * @param lon Longitude in degrees
+ * @param lat Latitude in degrees
+ * @param maxDistance Search radius in meters (0 = default, 50 km)
+ * @return JSON object with found, name, distance (meters) and coordinates
+ */
+const char* reverseGeocode(double lon, double lat, double maxDistance);
+
+/**
+ * Attach a serialized SymSpell typo index (from the symspell-index tool)
+ * The buffer is referenced, not copied, and must not be freed afterwards.
+ * @param data Pointer to the serialized index
+ * @param size Size in bytes
+ * @return 1 if attached, 0 if the data is invalid or stale
+ */
+int attachSymSpellIndex(const uint8_t* data, size_t size);
+
+/**
+ * Attach a LOCDB001 binary location database (scripts/build-binary-locations.mjs)
+ * resolveLocation and prefix searches consult it before the compiled-in data.
+ * The buffer is referenced, not copied, and must not be freed afterwards.
+ * @param data Pointer to the file image (4-byte aligned, as from malloc)
+ * @param size Size in bytes
+ * @return 1 if attached, 0 if the data is invalid
+ */
+int attachLocationDatabase(const uint8_t* data, size_t size);
+
 }
@@ -0,0 +1,72 @@
+#pragma once
+/**
+ * Number Parsing and Formatting
+ *
+ * Decimal <-> double conversion for the JSON tokenizer and the tool result
+ * emitters, without strtod/printf's locale handling and multi-precision
+ * arithmetic on the common path.
+ *
+ * Parsing: a number with at most 15 significant digits and a decimal
+ * exponent within +/-22 (every coordinate a client sends) is an exact
+ * integer scaled by an exact power of ten, so one multiplication or
+ * division gives the correctly rounded double (Clinger's fast path).
+ * Anything else goes to std::from_chars, or strtod where the standard
+ * library lacks floating-point from_chars (libc++ under Emscripten).
+ *
+ * Formatting: %.Nf (N <= 9) scales by 10^N and rounds to an integer; the
+ * result is exact unless the scaled value lies within rounding error of a
+ * .5 tie, and those (rare) values, non-finite values and magnitudes past
+ * 2^53 / 10^N go to std::to_chars or snprintf. Output is byte-identical to
+ * snprintf in every case.
+ */
+
+#include <cstddef>
+
+#if defined(__GNUC__)
+#define CESIUM_MCP_PRINTF_FORMAT(format_index, first_arg) __attribute__((format(printf, format_index, first_arg)))
+#else
+#define CESIUM_MCP_PRINTF_FORMAT(format_index, first_arg)
+#endif
+
+namespace cesium {
+namespace mcp {
+
+/**
+ * Parse a JSON number (grammar already validated by the caller)
+ * @param first First character
+ * @param last One past the last character (no terminator needed)
+ * @param value Output: correctly rounded value, +/-inf or 0 out of range
+ * @return false if the text is not a number
+ */
+bool parse_double(const char* first, const char* last, double& value);
+
+/**
+ * Format a double as snprintf("%.*f", precision, value) would
+ * @param value Value to format
+ * @param precision Digits after the decimal point
+ * @param output Output buffer (always NUL-terminated when output_size > 0)
+ * @param output_size Size of output buffer
+ * @return Length of the full text, as snprintf returns
+ */
+size_t format_fixed(double value, int precision, char* output, size_t output_size);
+
+/**
+ * snprintf replacement for result emitters
+ * Handles %s, %.*s, %d, %zu, %llu and %.Nf directly (%.Nf via
+ * format_fixed()); a format with any other conversion is passed to
+ * vsnprintf whole.
+ * @param output Output buffer (always NUL-terminated when output_size > 0)
+ * @param output_size Size of output buffer
+ * @param format printf format
+ * @return Length of the full text, as snprintf returns
+ */
+int format_text(char* output, size_t output_size, const char* format, ...) CESIUM_MCP_PRINTF_FORMAT(3, 4);
+
+/**
+ * Reference paths (strtod / snprintf), for verification and benchmarks
+ */
+bool parse_double_strtod(const char* first, const char* last, double& value);
+size_t format_fixed_snprintf(double value, int precision, char* output, size_t output_size);
+
+}  // namespace mcp
+}  // namespace cesium
@@ -0,0 +1,56 @@
+#pragma once
+/**
+ * UTF-8 Case Folding and Diacritic Stripping
+ *
+ * Table-driven (no ICU): utf8_fold_table.cpp, generated by
+ * scripts/build-utf8-fold-table.mjs, lists the lowercase and folded forms
+ * of every Latin, Greek, Cyrillic and Armenian code point that has one,
+ * plus typographic punctuation. Code points outside the table (CJK, Arabic,
+ * ...) and invalid bytes are copied unchanged.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cesium {
+namespace mcp {
+
+/**
+ * One table entry; lower and folded are offsets into get_utf8_fold_strings()
+ */
+struct Utf8FoldEntry {
+  uint32_t codepoint;
+  uint16_t lower;     // Lowercase form ("Á" -> "á")
+  uint16_t folded;    // Lowercase without diacritics ("Á" -> "a", "«" -> "")
+};
+
+/**
+ * Generated table (utf8_fold_table.cpp), sorted by code point
+ */
+const Utf8FoldEntry* get_utf8_fold_entries(size_t& count);
+const char* get_utf8_fold_strings();
+
+/**
+ * Lowercase UTF-8 text ("SÃO PAULO" -> "são paulo")
+ * Output is truncated at a character boundary if it does not fit.
+ * @param input NUL-terminated input
+ * @param output Output buffer
+ * @param output_size Size of output buffer
+ * @return Bytes written, excluding the terminator
+ */
+size_t utf8_lowercase(const char* input, char* output, size_t output_size);
+
+/**
+ * Fold UTF-8 text to a lookup key: lowercase, strip diacritics and
+ * typographic quotes, map typographic apostrophes/dashes/spaces to ASCII,
+ * collapse whitespace runs and trim ("«Navoiy» Aéroport" -> "navoiy aeroport")
+ * Output is truncated at a character boundary if it does not fit.
+ * @param input NUL-terminated input
+ * @param output Output buffer
+ * @param output_size Size of output buffer
+ * @return Bytes written, excluding the terminator
+ */
+size_t utf8_fold(const char* input, char* output, size_t output_size);
+
+}  // namespace mcp
+}  // namespace cesium
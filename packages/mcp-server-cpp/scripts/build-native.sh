@@ -44,4 +44,4 @@ echo "============================================"
 echo ""
 echo "Running tests..."
 echo ""
-"${BUILD_DIR}/bin/cesium-mcp-wasm"
+"${BUILD_DIR}/cesium-mcp-wasm"
@@ -44,6 +44,15 @@ fi
 echo "Using Emscripten: $(emcc --version | head -1)"
 echo ""
 
+# Generate the prebuilt index tables with a native build of the generator
+# (location_tables.h); the WASM build compiles them in
+echo "Generating location tables (native)..."
+NATIVE_DIR="${PROJECT_DIR}/build-native"
+cmake -S "${PROJECT_DIR}" -B "${NATIVE_DIR}" -DCMAKE_BUILD_TYPE=Release > /dev/null
+cmake --build "${NATIVE_DIR}" --target location-tables-data -j$(nproc 2>/dev/null || sysctl -n hw.ncpu 2>/dev/null || echo 4)
+LOCATION_TABLES="${NATIVE_DIR}/generated/location_tables_data.cpp"
+echo ""
+
 # Create build directory
 BUILD_DIR="${PROJECT_DIR}/build"
 mkdir -p "${BUILD_DIR}"
@@ -54,6 +63,7 @@ echo "Configuring with CMake..."
 emcmake cmake \
     -DCMAKE_BUILD_TYPE=${BUILD_TYPE} \
     -DCMAKE_TOOLCHAIN_FILE="${EMSDK_DIR}/upstream/emscripten/cmake/Modules/Platform/Emscripten.cmake" \
+    -DCESIUM_MCP_LOCATION_TABLES="${LOCATION_TABLES}" \
     ..
 
 # Build
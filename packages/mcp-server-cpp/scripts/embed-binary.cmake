@@ -0,0 +1,65 @@
+# Embed a binary file in a generated C++ source (portable fallback for
+# toolchains without ELF .incbin, e.g. Emscripten)
+#
+# Usage:
+#   cmake -DINPUT=<file> -DOUTPUT=<source.cpp> -DFUNCTION=<name> -P scripts/embed-binary.cmake
+#
+# Defines `const unsigned char* FUNCTION(size_t& size)` in namespace
+# cesium::mcp, returning the 8-byte aligned, NUL-terminated bytes. They are
+# written as adjacent string literals of \x escapes, which compilers read
+# much faster, and in less memory, than an aggregate initializer.
+# `uint32_t FUNCTION_fingerprint()` returns the first 32 bits of the
+# file's SHA-256, so tables generated from it can be matched without
+# hashing at runtime.
+
+foreach(var INPUT OUTPUT FUNCTION)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "embed-binary.cmake: ${var} is required")
+    endif()
+endforeach()
+
+file(READ "${INPUT}" hex HEX)
+file(SHA256 "${INPUT}" digest)
+string(SUBSTRING "${digest}" 0 8 fingerprint)
+string(LENGTH "${hex}" hex_length)
+math(EXPR size "${hex_length} / 2")
+math(EXPR body_length "${hex_length} / 16 * 16")
+string(SUBSTRING "${hex}" 0 ${body_length} body)
+string(SUBSTRING "${hex}" ${body_length} -1 tail)
+
+# Eight bytes per match (and per line) keeps the regex passes few
+string(REGEX REPLACE "(..)(..)(..)(..)(..)(..)(..)(..)"
+       "    \"\\\\x\\1\\\\x\\2\\\\x\\3\\\\x\\4\\\\x\\5\\\\x\\6\\\\x\\7\\\\x\\8\"\n" body "${body}")
+if(tail)
+    string(REGEX REPLACE "(..)" "\\\\x\\1" tail "${tail}")
+    set(tail "    \"${tail}\"\n")
+endif()
+
+file(WRITE "${OUTPUT}"
+"/**
+ * Embedded ${INPUT} (${size} bytes)
+ *
+ * Generated by scripts/embed-binary.cmake - do not edit.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cesium {
+namespace mcp {
+
+alignas(8) static const unsigned char EMBEDDED_DATA[${size} + 1] =
+${body}${tail}    \"\";
+
+const unsigned char* ${FUNCTION}(size_t& size) {
+    size = ${size};
+    return EMBEDDED_DATA;
+}
+
+uint32_t ${FUNCTION}_fingerprint() {
+    return 0x${fingerprint}u;
+}
+
+}  // namespace mcp
+}  // namespace cesium
+")
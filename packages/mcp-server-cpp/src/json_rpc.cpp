@@ -3,6 +3,9 @@
  */
 
 #include "json_rpc.h"
+#include "json_scan.h"
+#include "number_format.h"
+#include <algorithm>
 #include <cstring>
 #include <cstdio>
 #include <cstdlib>
@@ -10,170 +13,432 @@
 namespace cesium {
 namespace mcp {
 
-// Skip whitespace in JSON
-static const char* skip_whitespace(const char* json) {
-    while (*json && (*json == ' ' || *json == '\t' || *json == '\n' || *json == '\r')) {
-        json++;
+// ============================================================================
+// Tokenizer
+// ============================================================================
+
+// Stage 2: walks the structural index (json_scan.h); every token starts at
+// an index entry and strings span two (their quotes)
+struct JsonParser {
+    const char* json;
+    size_t length;
+    const uint32_t* structurals;
+    size_t structural_count;
+    size_t next;
+    std::vector<JsonNode>& nodes;
+    std::vector<char>& strings;
+};
+
+static bool is_hex_digit(char c) {
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+static bool is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+// A number or literal must run up to whitespace, an operator or a quote
+static bool ends_token(const JsonParser& parser, size_t pos) {
+    if (pos == parser.length) return true;
+    switch (parser.json[pos]) {
+        case ' ': case '\t': case '\n': case '\r':
+        case '{': case '}': case '[': case ']': case ':': case ',': case '"':
+            return true;
+        default:
+            return false;
     }
-    return json;
 }
 
-// Find a key in JSON and return pointer to value start
-static const char* find_json_key(const char* json, const char* key) {
-    char search_key[256];
-    snprintf(search_key, sizeof(search_key), "\"%s\"", key);
-    size_t key_len = strlen(search_key);
-
-    const char* pos = json;
-    while ((pos = strstr(pos, search_key)) != nullptr) {
-        // Make sure it's actually a key (preceded by { or , or whitespace)
-        if (pos > json) {
-            const char* before = pos - 1;
-            while (before > json && (*before == ' ' || *before == '\t' || *before == '\n' || *before == '\r')) {
-                before--;
-            }
-            if (*before != '{' && *before != ',') {
-                pos++;
-                continue;
+static size_t push_node(JsonParser& parser, JsonType type, const char* text) {
+    JsonNode node = {};
+    node.type = type;
+    node.span = 1;
+    node.text = text;
+    parser.nodes.push_back(node);
+    return parser.nodes.size() - 1;
+}
+
+static bool is_hex_quad(const char* p, const char* end) {
+    return end - p >= 4 && is_hex_digit(p[0]) && is_hex_digit(p[1]) && is_hex_digit(p[2]) && is_hex_digit(p[3]);
+}
+
+static unsigned hex_value(const char* p) {
+    unsigned value = 0;
+    for (int i = 0; i < 4; i++) {
+        char c = p[i];
+        value = value << 4 | static_cast<unsigned>(c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10);
+    }
+    return value;
+}
+
+static size_t encode_utf8(unsigned code_point, char* out) {
+    if (code_point < 0x80) {
+        out[0] = static_cast<char>(code_point);
+        return 1;
+    }
+    if (code_point < 0x800) {
+        out[0] = static_cast<char>(0xC0 | code_point >> 6);
+        out[1] = static_cast<char>(0x80 | (code_point & 0x3F));
+        return 2;
+    }
+    if (code_point < 0x10000) {
+        out[0] = static_cast<char>(0xE0 | code_point >> 12);
+        out[1] = static_cast<char>(0x80 | (code_point >> 6 & 0x3F));
+        out[2] = static_cast<char>(0x80 | (code_point & 0x3F));
+        return 3;
+    }
+    out[0] = static_cast<char>(0xF0 | code_point >> 18);
+    out[1] = static_cast<char>(0x80 | (code_point >> 12 & 0x3F));
+    out[2] = static_cast<char>(0x80 | (code_point >> 6 & 0x3F));
+    out[3] = static_cast<char>(0x80 | (code_point & 0x3F));
+    return 4;
+}
+
+// Validate and decode the escapes of a string's contents into out, which
+// needs end - p bytes (decoding never lengthens a string)
+// Returns the decoded length, or SIZE_MAX on an invalid escape
+static size_t unescape(const char* p, const char* end, char* out) {
+    char* o = out;
+    while (p < end) {
+        const char* backslash = static_cast<const char*>(memchr(p, '\\', static_cast<size_t>(end - p)));
+        if (backslash == nullptr) backslash = end;
+        memcpy(o, p, static_cast<size_t>(backslash - p));
+        o += backslash - p;
+        p = backslash;
+        if (p == end) break;
+
+        // The closing quote follows, so p[1] is readable
+        char c = p[1];
+        p += 2;
+        switch (c) {
+            case '"': case '\\': case '/': *o++ = c; break;
+            case 'b': *o++ = '\b'; break;
+            case 'f': *o++ = '\f'; break;
+            case 'n': *o++ = '\n'; break;
+            case 'r': *o++ = '\r'; break;
+            case 't': *o++ = '\t'; break;
+            case 'u': {
+                if (!is_hex_quad(p, end)) return SIZE_MAX;
+                unsigned code_point = hex_value(p);
+                p += 4;
+                // Surrogate pair; a lone surrogate becomes U+FFFD
+                if (code_point >= 0xD800 && code_point <= 0xDBFF && end - p >= 6 && p[0] == '\\' &&
+                    p[1] == 'u' && is_hex_quad(p + 2, end)) {
+                    unsigned low = hex_value(p + 2);
+                    if (low >= 0xDC00 && low <= 0xDFFF) {
+                        code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+                        p += 6;
+                    }
+                }
+                if (code_point >= 0xD800 && code_point <= 0xDFFF) code_point = 0xFFFD;
+                o += encode_utf8(code_point, o);
+                break;
             }
+            default:
+                return SIZE_MAX;
         }
+    }
+    return static_cast<size_t>(o - out);
+}
 
-        // Find the colon after the key
-        const char* colon = pos + key_len;
-        colon = skip_whitespace(colon);
-        if (*colon == ':') {
-            return skip_whitespace(colon + 1);
-        }
-        pos++;
+// String whose opening quote is at pos; the next index entry is its
+// closing quote (stage 1 rejected unterminated strings and raw control
+// characters). A string with escapes is decoded once, here, into the
+// document's arena; every other string is used in place.
+static bool parse_string(JsonParser& parser, size_t pos) {
+    size_t close = parser.structurals[parser.next++];
+    const char* start = parser.json + pos + 1;
+    const char* end = parser.json + close;
+    const char* text = start;
+    size_t length = static_cast<size_t>(end - start);
+    bool escaped = memchr(start, '\\', length) != nullptr;
+    if (escaped) {
+        // Reserved to the text length by json_parse(), so never reallocated
+        std::vector<char>& strings = parser.strings;
+        size_t offset = strings.size();
+        strings.resize(offset + length);
+        length = unescape(start, end, strings.data() + offset);
+        if (length == SIZE_MAX) return false;
+        strings.resize(offset + length);
+        text = strings.data() + offset;
     }
-    return nullptr;
+
+    size_t index = push_node(parser, JsonType::String, text);
+    parser.nodes[index].escaped = escaped;
+    parser.nodes[index].length = static_cast<uint32_t>(length);
+    return true;
 }
 
-bool json_get_string(const char* json, const char* key, char* value, size_t value_size) {
-    if (value_size == 0) return false;
-    value[0] = '\0';
+static bool parse_number(JsonParser& parser, size_t pos) {
+    const char* start = parser.json + pos;
+    const char* p = start;
+    const char* end = parser.json + parser.length;
+    if (p < end && *p == '-') p++;
+    if (p == end || !is_digit(*p)) return false;
+    if (*p == '0') {
+        p++;
+    } else {
+        while (p < end && is_digit(*p)) p++;
+    }
+    if (p < end && *p == '.') {
+        if (++p == end || !is_digit(*p)) return false;
+        while (p < end && is_digit(*p)) p++;
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        p++;
+        if (p < end && (*p == '+' || *p == '-')) p++;
+        if (p == end || !is_digit(*p)) return false;
+        while (p < end && is_digit(*p)) p++;
+    }
+    size_t length = static_cast<size_t>(p - start);
+    double value;
+    if (!ends_token(parser, pos + length) || !parse_double(start, p, value)) return false;
 
-    const char* val_start = find_json_key(json, key);
-    if (!val_start || *val_start != '"') {
+    size_t index = push_node(parser, JsonType::Number, start);
+    parser.nodes[index].length = static_cast<uint32_t>(length);
+    parser.nodes[index].number = value;
+    return true;
+}
+
+static bool parse_literal(JsonParser& parser, size_t pos, const char* literal, JsonType type) {
+    size_t length = strlen(literal);
+    if (parser.length - pos < length || memcmp(parser.json + pos, literal, length) != 0 ||
+        !ends_token(parser, pos + length)) {
         return false;
     }
+    size_t index = push_node(parser, type, parser.json + pos);
+    parser.nodes[index].length = static_cast<uint32_t>(length);
+    return true;
+}
 
-    val_start++;  // Skip opening quote
-    size_t i = 0;
-    bool escaped = false;
-
-    while (*val_start && i < value_size - 1) {
-        if (escaped) {
-            switch (*val_start) {
-                case 'n': value[i++] = '\n'; break;
-                case 'r': value[i++] = '\r'; break;
-                case 't': value[i++] = '\t'; break;
-                case '\\': value[i++] = '\\'; break;
-                case '"': value[i++] = '"'; break;
-                default: value[i++] = *val_start; break;
+// Next index entry, if it holds the given operator
+static bool take_operator(JsonParser& parser, char op, size_t& pos) {
+    if (parser.next == parser.structural_count) return false;
+    pos = parser.structurals[parser.next];
+    if (parser.json[pos] != op) return false;
+    parser.next++;
+    return true;
+}
+
+static bool parse_value(JsonParser& parser, size_t depth);
+
+// Array or object whose opening bracket is at pos
+static bool parse_container(JsonParser& parser, size_t pos, size_t depth, bool is_object) {
+    if (depth >= MAX_JSON_DEPTH) return false;
+    const char close = is_object ? '}' : ']';
+    size_t index = push_node(parser, is_object ? JsonType::Object : JsonType::Array, parser.json + pos);
+
+    uint32_t count = 0;
+    size_t end;
+    if (!take_operator(parser, close, end)) {
+        while (true) {
+            if (is_object) {
+                size_t key;
+                size_t colon;
+                if (!take_operator(parser, '"', key) || !parse_string(parser, key) ||
+                    !take_operator(parser, ':', colon)) {
+                    return false;
+                }
             }
-            escaped = false;
-        } else if (*val_start == '\\') {
-            escaped = true;
-        } else if (*val_start == '"') {
-            break;
-        } else {
-            value[i++] = *val_start;
+            if (!parse_value(parser, depth + 1)) return false;
+            count++;
+
+            size_t separator;
+            if (take_operator(parser, close, end)) break;
+            if (!take_operator(parser, ',', separator)) return false;
         }
-        val_start++;
     }
 
-    value[i] = '\0';
+    JsonNode& node = parser.nodes[index];
+    node.count = count;
+    node.span = static_cast<uint32_t>(parser.nodes.size() - index);
+    node.length = static_cast<uint32_t>(end + 1 - pos);
     return true;
 }
 
-bool json_get_number(const char* json, const char* key, double& value) {
-    const char* val_start = find_json_key(json, key);
-    if (!val_start) return false;
+static bool parse_value(JsonParser& parser, size_t depth) {
+    if (parser.next == parser.structural_count) return false;
+    size_t pos = parser.structurals[parser.next++];
+    switch (parser.json[pos]) {
+        case '{': return parse_container(parser, pos, depth, true);
+        case '[': return parse_container(parser, pos, depth, false);
+        case '"': return parse_string(parser, pos);
+        case 't': return parse_literal(parser, pos, "true", JsonType::True);
+        case 'f': return parse_literal(parser, pos, "false", JsonType::False);
+        case 'n': return parse_literal(parser, pos, "null", JsonType::Null);
+        default: return parse_number(parser, pos);
+    }
+}
 
-    // Handle null
-    if (strncmp(val_start, "null", 4) == 0) {
+bool json_parse(const char* json, size_t length, JsonDocument& document) {
+    document.nodes.clear();
+    document.strings.clear();
+    // Node offsets are 32-bit
+    if (length > UINT32_MAX || !json_find_structurals(json, length, document.structurals)) {
         return false;
     }
 
-    char* end;
-    value = strtod(val_start, &end);
-    return end != val_start;
+    // Decoded strings are no longer than their source, so this is enough
+    document.strings.reserve(length);
+    JsonParser parser = {json, length, document.structurals.data(), document.structurals.size(), 0,
+                         document.nodes, document.strings};
+    if (!parse_value(parser, 0) || parser.next != parser.structural_count) {
+        document.nodes.clear();
+        return false;
+    }
+    return true;
 }
 
-bool json_get_int(const char* json, const char* key, int64_t& value) {
-    const char* val_start = find_json_key(json, key);
-    if (!val_start) return false;
+// ============================================================================
+// Lookups
+// ============================================================================
 
-    // Handle null
-    if (strncmp(val_start, "null", 4) == 0) {
-        return false;
+const JsonNode* json_root(const JsonDocument& document) {
+    return document.nodes.empty() ? nullptr : document.nodes.data();
+}
+
+const JsonNode* json_next(const JsonNode* node) {
+    return node + node->span;
+}
+
+static bool json_key_equals(const JsonNode* key_node, const char* key, size_t key_length) {
+    return key_node->length == key_length && memcmp(key_node->text, key, key_length) == 0;
+}
+
+const JsonNode* json_find(const JsonNode* object, const char* key) {
+    if (object == nullptr || object->type != JsonType::Object) return nullptr;
+
+    size_t key_length = strlen(key);
+    const JsonNode* member = object + 1;
+    for (uint32_t i = 0; i < object->count; i++) {
+        const JsonNode* value = member + 1;
+        if (json_key_equals(member, key, key_length)) return value;
+        member = json_next(value);
     }
+    return nullptr;
+}
 
-    // Handle string ID (quoted number)
-    if (*val_start == '"') {
-        val_start++;
+// ============================================================================
+// Value extraction
+// ============================================================================
+
+size_t json_string_copy(const JsonNode* string, char* value, size_t value_size) {
+    if (value_size == 0) return 0;
+    size_t length = std::min(static_cast<size_t>(string->length), value_size - 1);
+    // Never split a character when truncating
+    if (length < string->length) {
+        while (length > 0 && (static_cast<unsigned char>(string->text[length]) & 0xC0) == 0x80) length--;
     }
+    memcpy(value, string->text, length);
+    value[length] = '\0';
+    return length;
+}
 
-    char* end;
-    value = strtoll(val_start, &end, 10);
-    return end != val_start;
+std::string_view json_string_view(const JsonNode* string) {
+    return std::string_view(string->text, string->length);
 }
 
-bool json_get_object(const char* json, const char* key, char* value, size_t value_size) {
+bool json_get_string(const JsonNode* object, const char* key, char* value, size_t value_size) {
     if (value_size == 0) return false;
     value[0] = '\0';
 
-    const char* val_start = find_json_key(json, key);
-    if (!val_start) return false;
+    const JsonNode* node = json_find(object, key);
+    if (node == nullptr || node->type != JsonType::String) {
+        return false;
+    }
+
+    json_string_copy(node, value, value_size);
+    return true;
+}
 
-    // Handle null
-    if (strncmp(val_start, "null", 4) == 0) {
-        strcpy(value, "null");
-        return true;
+bool json_get_string_view(const JsonNode* object, const char* key, std::string_view& value) {
+    const JsonNode* node = json_find(object, key);
+    if (node == nullptr || node->type != JsonType::String) {
+        return false;
     }
+    value = json_string_view(node);
+    return true;
+}
 
-    if (*val_start != '{') {
+bool json_get_number(const JsonNode* object, const char* key, double& value) {
+    const JsonNode* node = json_find(object, key);
+    if (node == nullptr || node->type != JsonType::Number) {
         return false;
     }
+    value = node->number;
+    return true;
+}
 
-    // Find matching closing brace
-    int depth = 1;
-    const char* pos = val_start + 1;
-    bool in_string = false;
-    bool escaped = false;
-
-    while (*pos && depth > 0) {
-        if (in_string) {
-            if (escaped) {
-                escaped = false;
-            } else if (*pos == '\\') {
-                escaped = true;
-            } else if (*pos == '"') {
-                in_string = false;
-            }
-        } else {
-            if (*pos == '"') {
-                in_string = true;
-            } else if (*pos == '{') {
-                depth++;
-            } else if (*pos == '}') {
-                depth--;
-            }
+size_t json_get_string_array(const JsonNode* object, const char* key, char* storage, size_t storage_size,
+                             const char** values, size_t max_values) {
+    const JsonNode* array = json_find(object, key);
+    if (array == nullptr || array->type != JsonType::Array) {
+        return 0;
+    }
+    if (array->count > max_values) {
+        return JSON_ARRAY_OVERFLOW;
+    }
+
+    size_t used = 0;
+    const JsonNode* element = array + 1;
+    for (uint32_t i = 0; i < array->count; i++, element = json_next(element)) {
+        if (element->type != JsonType::String) {
+            values[i] = nullptr;
+            continue;
+        }
+        if (element->length >= storage_size - used) {
+            return JSON_ARRAY_OVERFLOW;
         }
-        pos++;
+        values[i] = storage + used;
+        used += json_string_copy(element, storage + used, storage_size - used) + 1;
     }
+    return array->count;
+}
 
-    size_t obj_len = pos - val_start;
-    if (obj_len >= value_size) {
-        obj_len = value_size - 1;
+size_t json_get_number_rows(const JsonNode* object, const char* key, const char* const* columns,
+                            const double* defaults, size_t column_count, double* rows, size_t max_rows) {
+    const JsonNode* array = json_find(object, key);
+    if (array == nullptr || array->type != JsonType::Array || column_count == 0 || column_count > 32) {
+        return 0;
     }
 
-    memcpy(value, val_start, obj_len);
-    value[obj_len] = '\0';
-    return true;
+    size_t lengths[32];
+    for (size_t c = 0; c < column_count; c++) lengths[c] = strlen(columns[c]);
+
+    size_t count = 0;
+    const JsonNode* element = array + 1;
+    for (uint32_t i = 0; i < array->count && count < max_rows; i++, element = json_next(element)) {
+        double* row = rows + count++ * column_count;
+        memcpy(row, defaults, column_count * sizeof(double));
+        if (element->type == JsonType::Object) {
+            // First occurrence of a key wins, as in json_find()
+            uint32_t seen = 0;
+            const JsonNode* member = element + 1;
+            for (uint32_t m = 0; m < element->count; m++) {
+                const JsonNode* value = member + 1;
+                for (size_t c = 0; c < column_count; c++) {
+                    if ((seen >> c & 1) == 0 && json_key_equals(member, columns[c], lengths[c])) {
+                        seen |= 1u << c;
+                        if (value->type == JsonType::Number) row[c] = value->number;
+                        break;
+                    }
+                }
+                member = json_next(value);
+            }
+        } else if (element->type == JsonType::Array) {
+            const JsonNode* value = element + 1;
+            for (uint32_t c = 0; c < element->count && c < column_count; c++, value = json_next(value)) {
+                if (value->type == JsonType::Number) row[c] = value->number;
+            }
+        }
+    }
+    return count;
 }
 
+// ============================================================================
+// Serialization
+// ============================================================================
+
 size_t json_escape_string(const char* input, char* output, size_t output_size) {
     if (output_size == 0) return 0;
 
@@ -209,7 +474,8 @@ size_t json_escape_string(const char* input, char* output, size_t output_size) {
                 output[j++] = 't';
                 break;
             default:
-                if (c < 32) {
+                // Unsigned: bytes of multi-byte UTF-8 characters pass through
+                if (static_cast<unsigned char>(c) < 32) {
                     // Control character - encode as \uXXXX
                     if (j + 6 > output_size - 1) goto done;
                     j += snprintf(output + j, output_size - j, "\\u%04x", (unsigned char)c);
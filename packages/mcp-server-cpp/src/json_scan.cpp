@@ -0,0 +1,247 @@
+/**
+ * JSON Structural Scanner Implementation
+ */
+
+#include "json_scan.h"
+#include <cstring>
+
+#if defined(CESIUM_MCP_SCALAR_SCAN)
+#define CESIUM_MCP_SCAN_SCALAR 1
+#elif defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#define CESIUM_MCP_SCAN_SIMD128 1
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#define CESIUM_MCP_SCAN_AVX2 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define CESIUM_MCP_SCAN_SSE2 1
+#else
+#define CESIUM_MCP_SCAN_SCALAR 1
+#endif
+
+namespace cesium {
+namespace mcp {
+
+constexpr size_t BLOCK_SIZE = 64;
+
+// Bit i describes byte i of a block
+struct BlockMasks {
+    uint64_t quote;
+    uint64_t backslash;
+    uint64_t op;            // { } [ ] : ,
+    uint64_t whitespace;
+    uint64_t control;       // Bytes below 0x20
+};
+
+// ============================================================================
+// Kernels: classify 64 bytes
+// ============================================================================
+
+// Brackets and braces differ from their 0x20-cleared forms by bit 5 only:
+// '[' | 0x20 == '{', ']' | 0x20 == '}'
+static inline BlockMasks classify_block_scalar(const char* p) {
+    BlockMasks masks = {0, 0, 0, 0, 0};
+    for (size_t i = 0; i < BLOCK_SIZE; i++) {
+        unsigned char c = static_cast<unsigned char>(p[i]);
+        uint64_t bit = uint64_t(1) << i;
+        if (c == '"') masks.quote |= bit;
+        if (c == '\\') masks.backslash |= bit;
+        if ((c | 0x20) == '{' || (c | 0x20) == '}' || c == ':' || c == ',') masks.op |= bit;
+        if (c == ' ' || c == '\t' || c == '\n' || c == '\r') masks.whitespace |= bit;
+        if (c < 0x20) masks.control |= bit;
+    }
+    return masks;
+}
+
+#if defined(CESIUM_MCP_SCAN_SIMD128)
+
+static const char* const JSON_SCAN_KERNEL = "simd128";
+
+static inline void classify_16(const char* p, size_t shift, BlockMasks& masks) {
+    v128_t v = wasm_v128_load(p);
+    v128_t folded = wasm_v128_or(v, wasm_i8x16_splat(0x20));
+    v128_t op = wasm_v128_or(
+        wasm_v128_or(wasm_i8x16_eq(folded, wasm_i8x16_splat('{')), wasm_i8x16_eq(folded, wasm_i8x16_splat('}'))),
+        wasm_v128_or(wasm_i8x16_eq(v, wasm_i8x16_splat(':')), wasm_i8x16_eq(v, wasm_i8x16_splat(','))));
+    v128_t whitespace = wasm_v128_or(
+        wasm_v128_or(wasm_i8x16_eq(v, wasm_i8x16_splat(' ')), wasm_i8x16_eq(v, wasm_i8x16_splat('\t'))),
+        wasm_v128_or(wasm_i8x16_eq(v, wasm_i8x16_splat('\n')), wasm_i8x16_eq(v, wasm_i8x16_splat('\r'))));
+    masks.quote |= uint64_t(wasm_i8x16_bitmask(wasm_i8x16_eq(v, wasm_i8x16_splat('"')))) << shift;
+    masks.backslash |= uint64_t(wasm_i8x16_bitmask(wasm_i8x16_eq(v, wasm_i8x16_splat('\\')))) << shift;
+    masks.op |= uint64_t(wasm_i8x16_bitmask(op)) << shift;
+    masks.whitespace |= uint64_t(wasm_i8x16_bitmask(whitespace)) << shift;
+    masks.control |= uint64_t(wasm_i8x16_bitmask(wasm_u8x16_lt(v, wasm_i8x16_splat(0x20)))) << shift;
+}
+
+static inline BlockMasks classify_block(const char* p) {
+    BlockMasks masks = {0, 0, 0, 0, 0};
+    for (size_t i = 0; i < BLOCK_SIZE; i += 16) classify_16(p + i, i, masks);
+    return masks;
+}
+
+#elif defined(CESIUM_MCP_SCAN_AVX2)
+
+static const char* const JSON_SCAN_KERNEL = "avx2";
+
+static inline uint64_t mask_32(__m256i eq) {
+    return static_cast<uint32_t>(_mm256_movemask_epi8(eq));
+}
+
+static inline void classify_32(const char* p, size_t shift, BlockMasks& masks) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    __m256i folded = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+    __m256i op = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(folded, _mm256_set1_epi8('{')), _mm256_cmpeq_epi8(folded, _mm256_set1_epi8('}'))),
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(':')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8(','))));
+    __m256i whitespace = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\t'))),
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\r'))));
+    __m256i control = _mm256_cmpeq_epi8(_mm256_and_si256(v, _mm256_set1_epi8(static_cast<char>(0xE0))),
+                                        _mm256_setzero_si256());
+    masks.quote |= mask_32(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('"'))) << shift;
+    masks.backslash |= mask_32(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\'))) << shift;
+    masks.op |= mask_32(op) << shift;
+    masks.whitespace |= mask_32(whitespace) << shift;
+    masks.control |= mask_32(control) << shift;
+}
+
+static inline BlockMasks classify_block(const char* p) {
+    BlockMasks masks = {0, 0, 0, 0, 0};
+    classify_32(p, 0, masks);
+    classify_32(p + 32, 32, masks);
+    return masks;
+}
+
+#elif defined(CESIUM_MCP_SCAN_SSE2)
+
+static const char* const JSON_SCAN_KERNEL = "sse2";
+
+static inline uint64_t mask_16(__m128i eq) {
+    return static_cast<uint32_t>(_mm_movemask_epi8(eq));
+}
+
+static inline void classify_16(const char* p, size_t shift, BlockMasks& masks) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    __m128i folded = _mm_or_si128(v, _mm_set1_epi8(0x20));
+    __m128i op = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(folded, _mm_set1_epi8('{')), _mm_cmpeq_epi8(folded, _mm_set1_epi8('}'))),
+        _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(':')), _mm_cmpeq_epi8(v, _mm_set1_epi8(','))));
+    __m128i whitespace = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\t'))),
+        _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\r'))));
+    __m128i control = _mm_cmpeq_epi8(_mm_and_si128(v, _mm_set1_epi8(static_cast<char>(0xE0))),
+                                     _mm_setzero_si128());
+    masks.quote |= mask_16(_mm_cmpeq_epi8(v, _mm_set1_epi8('"'))) << shift;
+    masks.backslash |= mask_16(_mm_cmpeq_epi8(v, _mm_set1_epi8('\\'))) << shift;
+    masks.op |= mask_16(op) << shift;
+    masks.whitespace |= mask_16(whitespace) << shift;
+    masks.control |= mask_16(control) << shift;
+}
+
+static inline BlockMasks classify_block(const char* p) {
+    BlockMasks masks = {0, 0, 0, 0, 0};
+    for (size_t i = 0; i < BLOCK_SIZE; i += 16) classify_16(p + i, i, masks);
+    return masks;
+}
+
+#else
+
+static const char* const JSON_SCAN_KERNEL = "scalar";
+
+static inline BlockMasks classify_block(const char* p) {
+    return classify_block_scalar(p);
+}
+
+#endif
+
+const char* get_json_scan_kernel() {
+    return JSON_SCAN_KERNEL;
+}
+
+// ============================================================================
+// Block arithmetic
+// ============================================================================
+
+// Characters preceded by an odd run of backslashes. A run starting at an
+// even bit ends (one past its last backslash) on an odd bit when its
+// length is odd, and vice versa; adding the run starts to the odd-bit mask
+// carries through each run and leaves exactly those end bits flipped.
+// prev_escaped carries an escape across the block boundary.
+static inline uint64_t find_escaped(uint64_t backslash, uint64_t& prev_escaped) {
+    constexpr uint64_t ODD_BITS = 0xAAAAAAAAAAAAAAAAULL;
+    if (backslash == 0) {
+        uint64_t escaped = prev_escaped;
+        prev_escaped = 0;
+        return escaped;
+    }
+    uint64_t potential_escape = backslash & ~prev_escaped;
+    uint64_t maybe_escaped = potential_escape << 1;
+    uint64_t escape_and_terminal = ((maybe_escaped | ODD_BITS) - potential_escape) ^ ODD_BITS;
+    uint64_t escaped = escape_and_terminal ^ (backslash | prev_escaped);
+    prev_escaped = (escape_and_terminal & backslash) >> 63;
+    return escaped;
+}
+
+// Bit i = XOR of bits 0..i: set from an opening quote up to, not
+// including, its closing quote
+static inline uint64_t prefix_xor(uint64_t bits) {
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+}
+
+template <BlockMasks (*Classify)(const char*)>
+static bool find_structurals(const char* json, size_t length, std::vector<uint32_t>& structurals) {
+    structurals.clear();
+    uint64_t prev_escaped = 0;      // Bit 0: the next block starts with an escaped byte
+    uint64_t prev_in_string = 0;    // All ones: the previous block ended inside a string
+    uint64_t prev_scalar = 0;       // Bit 0: the previous block ended inside a number or literal
+    uint64_t control_in_string = 0;
+
+    // The last partial block is classified from a copy padded with spaces
+    char tail[BLOCK_SIZE];
+    for (size_t base = 0; base < length; base += BLOCK_SIZE) {
+        const char* block = json + base;
+        if (length - base < BLOCK_SIZE) {
+            memset(tail, ' ', sizeof(tail));
+            memcpy(tail, block, length - base);
+            block = tail;
+        }
+        BlockMasks masks = Classify(block);
+
+        uint64_t quote = masks.quote & ~find_escaped(masks.backslash, prev_escaped);
+        uint64_t in_string = prefix_xor(quote) ^ prev_in_string;
+        prev_in_string = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+        control_in_string |= masks.control & in_string;
+
+        // Numbers and literals: anything else outside strings; only the
+        // first byte of each run is structural
+        uint64_t outside = ~(in_string | quote);
+        uint64_t scalar = outside & ~(masks.op | masks.whitespace);
+        uint64_t scalar_start = scalar & ~(scalar << 1 | prev_scalar);
+        prev_scalar = scalar >> 63;
+
+        uint64_t bits = (masks.op & outside) | quote | scalar_start;
+        while (bits != 0) {
+            structurals.push_back(static_cast<uint32_t>(base + static_cast<size_t>(__builtin_ctzll(bits))));
+            bits &= bits - 1;
+        }
+    }
+    return prev_in_string == 0 && control_in_string == 0;
+}
+
+bool json_find_structurals(const char* json, size_t length, std::vector<uint32_t>& structurals) {
+    return find_structurals<classify_block>(json, length, structurals);
+}
+
+bool json_find_structurals_scalar(const char* json, size_t length, std::vector<uint32_t>& structurals) {
+    return find_structurals<classify_block_scalar>(json, length, structurals);
+}
+
+}  // namespace mcp
+}  // namespace cesium
@@ -0,0 +1,177 @@
+/**
+ * Bit-Parallel Levenshtein Distance Implementation
+ */
+
+#include "levenshtein.h"
+#include "location_database.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace cesium {
+namespace mcp {
+
+bool levenshtein_prepare(const char* pattern, LevenshteinPattern& out) {
+    size_t length = std::strlen(pattern);
+    if (length > LEVENSHTEIN_MAX_PATTERN) {
+        return false;
+    }
+
+    out.length = length;
+    out.blocks = length == 0 ? 1 : (length + 63) / 64;
+
+    // Only the blocks in use are cleared, so short patterns stay cheap
+    std::memset(out.peq, 0, out.blocks * sizeof(out.peq[0]));
+    for (size_t i = 0; i < length; i++) {
+        unsigned char c = static_cast<unsigned char>(pattern[i]);
+        out.peq[i / 64][c] |= uint64_t(1) << (i % 64);
+    }
+    return true;
+}
+
+// Advance one 64-row block of the DP column by one text byte.
+// hin is the horizontal delta entering the top of the block (+1 for the
+// first block, where D[0][j] = j); the return value is the delta leaving
+// the row selected by `high`.
+static inline int advance_block(uint64_t& pv, uint64_t& mv, uint64_t eq, int hin, uint64_t high) {
+    uint64_t xv = eq | mv;
+    if (hin < 0) eq |= 1;
+    uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+    uint64_t ph = mv | ~(xh | pv);
+    uint64_t mh = pv & xh;
+
+    int hout = (ph & high) ? 1 : ((mh & high) ? -1 : 0);
+
+    ph <<= 1;
+    mh <<= 1;
+    if (hin < 0) {
+        mh |= 1;
+    } else if (hin > 0) {
+        ph |= 1;
+    }
+    pv = mh | ~(xv | ph);
+    mv = ph & xv;
+    return hout;
+}
+
+int levenshtein_distance(const LevenshteinPattern& pattern, const char* text,
+                         size_t text_length, int max_distance) {
+    size_t m = pattern.length;
+
+    // Quick length check for early termination
+    size_t len_diff = m > text_length ? m - text_length : text_length - m;
+    if (max_distance >= 0 && len_diff > static_cast<size_t>(max_distance)) {
+        return max_distance + 1;
+    }
+    if (m == 0) {
+        return static_cast<int>(text_length);
+    }
+
+    // Score tracks D[m][j]; every remaining text byte can lower it by at
+    // most one, which gives the early-termination bound
+    int score = static_cast<int>(m);
+    uint64_t last_high = uint64_t(1) << ((m - 1) % 64);
+
+    if (pattern.blocks == 1) {
+        uint64_t pv = ~uint64_t(0);
+        uint64_t mv = 0;
+        for (size_t j = 0; j < text_length; j++) {
+            uint64_t eq = pattern.peq[0][static_cast<unsigned char>(text[j])];
+            score += advance_block(pv, mv, eq, 1, last_high);
+
+            if (max_distance >= 0 &&
+                score - static_cast<int>(text_length - j - 1) > max_distance) {
+                return max_distance + 1;
+            }
+        }
+    } else {
+        uint64_t pv[LEVENSHTEIN_MAX_BLOCKS];
+        uint64_t mv[LEVENSHTEIN_MAX_BLOCKS];
+        for (size_t b = 0; b < pattern.blocks; b++) {
+            pv[b] = ~uint64_t(0);
+            mv[b] = 0;
+        }
+
+        size_t last = pattern.blocks - 1;
+        for (size_t j = 0; j < text_length; j++) {
+            unsigned char c = static_cast<unsigned char>(text[j]);
+            int carry = 1;
+            for (size_t b = 0; b < last; b++) {
+                carry = advance_block(pv[b], mv[b], pattern.peq[b][c], carry,
+                                      uint64_t(1) << 63);
+            }
+            score += advance_block(pv[last], mv[last], pattern.peq[last][c], carry, last_high);
+
+            if (max_distance >= 0 &&
+                score - static_cast<int>(text_length - j - 1) > max_distance) {
+                return max_distance + 1;
+            }
+        }
+    }
+
+    if (max_distance >= 0 && score > max_distance) {
+        return max_distance + 1;
+    }
+    return score;
+}
+
+// Two-row DP, only reached when both strings exceed LEVENSHTEIN_MAX_PATTERN
+static int levenshtein_distance_dp(const char* s1, size_t len1, const char* s2, size_t len2,
+                                   int max_distance) {
+    std::vector<int> prev_row(len2 + 1);
+    std::vector<int> curr_row(len2 + 1);
+
+    for (size_t j = 0; j <= len2; j++) {
+        prev_row[j] = static_cast<int>(j);
+    }
+
+    for (size_t i = 1; i <= len1; i++) {
+        curr_row[0] = static_cast<int>(i);
+        int row_min = curr_row[0];
+
+        for (size_t j = 1; j <= len2; j++) {
+            int cost = (s1[i-1] == s2[j-1]) ? 0 : 1;
+            curr_row[j] = std::min({prev_row[j] + 1, curr_row[j-1] + 1, prev_row[j-1] + cost});
+            if (curr_row[j] < row_min) {
+                row_min = curr_row[j];
+            }
+        }
+
+        if (max_distance >= 0 && row_min > max_distance) {
+            return max_distance + 1;
+        }
+        std::swap(prev_row, curr_row);
+    }
+
+    if (max_distance >= 0 && prev_row[len2] > max_distance) {
+        return max_distance + 1;
+    }
+    return prev_row[len2];
+}
+
+int levenshtein_distance(const char* s1, const char* s2, int max_distance) {
+    size_t len1 = std::strlen(s1);
+    size_t len2 = std::strlen(s2);
+
+    // Quick length check for early termination
+    size_t len_diff = len1 > len2 ? len1 - len2 : len2 - len1;
+    if (max_distance >= 0 && len_diff > static_cast<size_t>(max_distance)) {
+        return max_distance + 1;
+    }
+
+    // Distance is symmetric: use the shorter string as the bit-parallel pattern
+    if (len1 > len2) {
+        std::swap(s1, s2);
+        std::swap(len1, len2);
+    }
+    if (len1 > LEVENSHTEIN_MAX_PATTERN) {
+        return levenshtein_distance_dp(s1, len1, s2, len2, max_distance);
+    }
+
+    LevenshteinPattern pattern;
+    levenshtein_prepare(s1, pattern);
+    return levenshtein_distance(pattern, s2, len2, max_distance);
+}
+
+}  // namespace mcp
+}  // namespace cesium
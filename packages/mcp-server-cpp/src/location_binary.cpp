@@ -0,0 +1,201 @@
+/**
+ * Binary Location Database Implementation
+ */
+
+#include "location_binary.h"
+#include "location_cache.h"
+#include <algorithm>
+#include <cstring>
+
+#if !defined(__EMSCRIPTEN__) && !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define CESIUM_MCP_HAS_MMAP 1
+#endif
+
+namespace cesium {
+namespace mcp {
+
+static const char LOCDB_MAGIC[8] = {'L', 'O', 'C', 'D', 'B', '0', '0', '1'};
+constexpr uint32_t LOCDB_VERSION = 1;
+
+struct BinaryDatabase {
+    const LocdbRecord* records = nullptr;
+    size_t count = 0;
+    void* mapping = nullptr;      // Set when the image was mapped from a file
+    size_t mapping_size = 0;
+};
+
+static BinaryDatabase binary_db;
+
+static uint32_t read_u32(const uint8_t* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+// Record names are NUL-padded to 128 bytes, so comparisons stay in bounds
+static int compare_record_name(const LocdbRecord& record, const char* key) {
+    return std::strncmp(record.name, key, LOCDB_NAME_SIZE);
+}
+
+bool attach_location_database(const uint8_t* data, size_t size) {
+    if (data == nullptr || size < LOCDB_HEADER_SIZE ||
+        reinterpret_cast<uintptr_t>(data) % alignof(LocdbRecord) != 0) {
+        return false;
+    }
+    if (std::memcmp(data, LOCDB_MAGIC, sizeof(LOCDB_MAGIC)) != 0 ||
+        read_u32(data + 8) != LOCDB_VERSION) {
+        return false;
+    }
+
+    size_t count = read_u32(data + 16);
+    if ((size - LOCDB_HEADER_SIZE) / LOCDB_RECORD_SIZE < count) {
+        return false;
+    }
+
+    // Readers treat record names as C strings, so a name that fills its
+    // field without a terminator rejects the whole image
+    const LocdbRecord* records = reinterpret_cast<const LocdbRecord*>(data + LOCDB_HEADER_SIZE);
+    for (size_t i = 0; i < count; i++) {
+        if (std::memchr(records[i].name, '\0', LOCDB_NAME_SIZE) == nullptr) {
+            return false;
+        }
+    }
+
+    detach_location_database();
+    binary_db.records = records;
+    binary_db.count = count;
+    return true;
+}
+
+bool open_location_database(const char* path) {
+#ifdef CESIUM_MCP_HAS_MMAP
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(LOCDB_HEADER_SIZE)) {
+        close(fd);
+        return false;
+    }
+
+    size_t size = static_cast<size_t>(st.st_size);
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+
+    if (!attach_location_database(static_cast<const uint8_t*>(mapping), size)) {
+        munmap(mapping, size);
+        return false;
+    }
+    binary_db.mapping = mapping;
+    binary_db.mapping_size = size;
+    return true;
+#else
+    (void)path;
+    return false;
+#endif
+}
+
+void detach_location_database() {
+#ifdef CESIUM_MCP_HAS_MMAP
+    if (binary_db.mapping != nullptr) {
+        munmap(binary_db.mapping, binary_db.mapping_size);
+    }
+#endif
+    binary_db = BinaryDatabase();
+
+    // Cached resolutions may have come from the old records
+    clear_location_cache();
+}
+
+size_t get_binary_location_count() {
+    return binary_db.count;
+}
+
+void normalize_binary_location_name(const char* input, char* output, size_t output_size) {
+    if (output_size == 0) return;
+
+    size_t j = 0;
+    bool pending_space = false;
+    for (size_t i = 0; input[i] != '\0' && j < output_size - 1; i++) {
+        char c = input[i];
+        if (c >= 'A' && c <= 'Z') {
+            c = static_cast<char>(c + ('a' - 'A'));
+        }
+
+        if (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v') {
+            pending_space = j > 0;
+        } else if ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9')) {
+            if (pending_space) {
+                output[j++] = ' ';
+                pending_space = false;
+                if (j >= output_size - 1) break;
+            }
+            output[j++] = c;
+        }
+        // Everything else (punctuation, non-ASCII) is dropped
+    }
+
+    output[j] = '\0';
+}
+
+const LocdbRecord* find_binary_location(const char* name) {
+    if (binary_db.count == 0) return nullptr;
+
+    char normalized[LOCDB_NAME_SIZE * 2];
+    normalize_binary_location_name(name, normalized, sizeof(normalized));
+
+    const LocdbRecord* begin = binary_db.records;
+    const LocdbRecord* end = binary_db.records + binary_db.count;
+    const LocdbRecord* it = std::lower_bound(begin, end, normalized,
+                                             [](const LocdbRecord& record, const char* key) {
+                                                 return compare_record_name(record, key) < 0;
+                                             });
+    if (it != end && compare_record_name(*it, normalized) == 0) {
+        return it;
+    }
+    return nullptr;
+}
+
+size_t search_binary_locations(const char* prefix, const LocdbRecord** results,
+                               size_t max_results) {
+    if (binary_db.count == 0) return 0;
+
+    char normalized[LOCDB_NAME_SIZE * 2];
+    normalize_binary_location_name(prefix, normalized, sizeof(normalized));
+    size_t prefix_len = std::min(std::strlen(normalized), LOCDB_NAME_SIZE);
+
+    // A prefix made only of characters the format drops (e.g. non-ASCII)
+    // cannot match anything here; it must not turn into "match everything"
+    if (prefix_len == 0 && prefix[0] != '\0') {
+        return 0;
+    }
+
+    const LocdbRecord* begin = binary_db.records;
+    const LocdbRecord* end = binary_db.records + binary_db.count;
+    const LocdbRecord* it = std::lower_bound(begin, end, normalized,
+                                             [](const LocdbRecord& record, const char* key) {
+                                                 return compare_record_name(record, key) < 0;
+                                             });
+
+    // Matches form a contiguous run starting at the lower bound
+    size_t count = 0;
+    for (; it != end && count < max_results; ++it) {
+        if (std::strncmp(it->name, normalized, prefix_len) != 0) {
+            break;
+        }
+        results[count++] = it;
+    }
+    return count;
+}
+
+}  // namespace mcp
+}  // namespace cesium
@@ -0,0 +1,174 @@
+/**
+ * Location Resolution Cache Implementation
+ */
+
+#include "location_cache.h"
+#include "location_index.h"
+#include <cstring>
+
+namespace cesium {
+namespace mcp {
+
+// Index type for entry links; NO_ENTRY terminates lists and chains
+constexpr uint16_t NO_ENTRY = 0xFFFF;
+
+// Power of two, twice the capacity so chains stay short
+constexpr size_t CACHE_BUCKET_COUNT = LOCATION_CACHE_CAPACITY * 2;
+
+static_assert(LOCATION_CACHE_CAPACITY < NO_ENTRY, "entry links are 16-bit");
+static_assert((CACHE_BUCKET_COUNT & (CACHE_BUCKET_COUNT - 1)) == 0, "bucket count must be a power of two");
+
+struct CacheEntry {
+    char key[LOCATION_CACHE_KEY_SIZE + 1];
+    uint32_t hash;
+    uint64_t variant;
+    LocationResolution result;
+    uint16_t prev;          // Recency list, most recent at head
+    uint16_t next;
+    uint16_t chain;         // Next entry in the same hash bucket
+};
+
+struct LocationCache {
+    CacheEntry entries[LOCATION_CACHE_CAPACITY];
+    uint16_t buckets[CACHE_BUCKET_COUNT];
+    uint16_t head;
+    uint16_t tail;
+    size_t used;
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+};
+
+static LocationCache cache;
+static bool cache_enabled = true;
+
+static void reset_cache() {
+    for (uint16_t& bucket : cache.buckets) bucket = NO_ENTRY;
+    cache.head = NO_ENTRY;
+    cache.tail = NO_ENTRY;
+    cache.used = 0;
+}
+
+// Statics are zero-initialized, but the empty markers are not zero
+static LocationCache& get_cache() {
+    static bool initialized = false;
+    if (!initialized) {
+        reset_cache();
+        initialized = true;
+    }
+    return cache;
+}
+
+static uint32_t bucket_of(uint32_t hash, uint64_t variant) {
+    uint32_t mixed = static_cast<uint32_t>(variant ^ (variant >> 32));
+    return (hash ^ (mixed * 0x9E3779B1u)) & (CACHE_BUCKET_COUNT - 1);
+}
+
+static void unlink_recency(LocationCache& c, uint16_t index) {
+    CacheEntry& entry = c.entries[index];
+    if (entry.prev != NO_ENTRY) c.entries[entry.prev].next = entry.next;
+    else c.head = entry.next;
+    if (entry.next != NO_ENTRY) c.entries[entry.next].prev = entry.prev;
+    else c.tail = entry.prev;
+}
+
+static void push_front(LocationCache& c, uint16_t index) {
+    CacheEntry& entry = c.entries[index];
+    entry.prev = NO_ENTRY;
+    entry.next = c.head;
+    if (c.head != NO_ENTRY) c.entries[c.head].prev = index;
+    c.head = index;
+    if (c.tail == NO_ENTRY) c.tail = index;
+}
+
+static void unlink_chain(LocationCache& c, uint16_t index) {
+    const CacheEntry& entry = c.entries[index];
+    uint16_t* link = &c.buckets[bucket_of(entry.hash, entry.variant)];
+    while (*link != index) {
+        link = &c.entries[*link].chain;
+    }
+    *link = entry.chain;
+}
+
+static uint16_t find_entry(const LocationCache& c, const char* query, uint32_t hash, uint64_t variant) {
+    for (uint16_t i = c.buckets[bucket_of(hash, variant)]; i != NO_ENTRY; i = c.entries[i].chain) {
+        const CacheEntry& entry = c.entries[i];
+        if (entry.hash == hash && entry.variant == variant && std::strcmp(entry.key, query) == 0) {
+            return i;
+        }
+    }
+    return NO_ENTRY;
+}
+
+bool location_cache_get(const char* query, uint64_t variant, LocationResolution& result) {
+    if (!cache_enabled) return false;
+
+    LocationCache& c = get_cache();
+    uint16_t index = NO_ENTRY;
+    if (std::strlen(query) <= LOCATION_CACHE_KEY_SIZE) {
+        index = find_entry(c, query, hash_location_name(query), variant);
+    }
+    if (index == NO_ENTRY) {
+        c.misses++;
+        return false;
+    }
+
+    if (index != c.head) {
+        unlink_recency(c, index);
+        push_front(c, index);
+    }
+    result = c.entries[index].result;
+    c.hits++;
+    return true;
+}
+
+void location_cache_put(const char* query, uint64_t variant, const LocationResolution& result) {
+    size_t length = std::strlen(query);
+    if (!cache_enabled || length > LOCATION_CACHE_KEY_SIZE) return;
+
+    LocationCache& c = get_cache();
+    uint32_t hash = hash_location_name(query);
+    uint16_t index = find_entry(c, query, hash, variant);
+    if (index != NO_ENTRY) {
+        c.entries[index].result = result;
+        return;
+    }
+
+    if (c.used < LOCATION_CACHE_CAPACITY) {
+        index = static_cast<uint16_t>(c.used++);
+    } else {
+        // Reuse the least recently used entry
+        index = c.tail;
+        unlink_recency(c, index);
+        unlink_chain(c, index);
+        c.evictions++;
+    }
+
+    CacheEntry& entry = c.entries[index];
+    std::memcpy(entry.key, query, length + 1);
+    entry.hash = hash;
+    entry.variant = variant;
+    entry.result = result;
+
+    uint16_t& bucket = c.buckets[bucket_of(hash, variant)];
+    entry.chain = bucket;
+    bucket = index;
+    push_front(c, index);
+}
+
+void clear_location_cache() {
+    get_cache();
+    reset_cache();
+}
+
+void set_location_cache_enabled(bool enabled) {
+    cache_enabled = enabled;
+}
+
+LocationCacheStats get_location_cache_stats() {
+    const LocationCache& c = get_cache();
+    return LocationCacheStats{c.hits, c.misses, c.evictions, c.used, LOCATION_CACHE_CAPACITY};
+}
+
+}  // namespace mcp
+}  // namespace cesium
@@ -0,0 +1,260 @@
+/**
+ * Location Name Index Implementation
+ */
+
+#include "location_index.h"
+#include "location_database.h"
+#include "location_store.h"
+#include "location_tables.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace cesium {
+namespace mcp {
+
+// ============================================================================
+// Exact-match hash table
+// ============================================================================
+
+// Slots point either at prebuilt tables (location_tables.h) or at storage
+struct NameHashTable {
+    std::vector<LocationHashSlot> storage;
+    const LocationHashSlot* slots = nullptr;
+    uint32_t mask = 0;
+};
+
+static NameHashTable prebuilt_hash_table(const LocationHashSlot* slots, size_t count) {
+    NameHashTable table;
+    table.slots = slots;
+    table.mask = static_cast<uint32_t>(count - 1);
+    return table;
+}
+
+// Keyed by name(id) for every named ID; equal keys keep their first ID
+template <typename NameFn>
+static NameHashTable build_hash_table(size_t count, NameFn name) {
+    NameHashTable table;
+
+    // Power-of-two capacity at <= 50% load keeps linear probe chains short
+    size_t capacity = 16;
+    while (capacity < count * 2) {
+        capacity <<= 1;
+    }
+    table.storage.assign(capacity, LocationHashSlot{0, INVALID_LOCATION_ID});
+    table.mask = static_cast<uint32_t>(capacity - 1);
+    std::vector<LocationHashSlot>& slots = table.storage;
+
+    for (size_t i = 0; i < count; i++) {
+        const char* key = name(static_cast<uint32_t>(i));
+        if (key == nullptr) continue;
+
+        uint32_t hash = hash_location_name(key);
+        uint32_t pos = hash & table.mask;
+
+        while (slots[pos].id != INVALID_LOCATION_ID) {
+            // Keep the first occurrence of a name, matching the old linear scan
+            if (slots[pos].hash == hash && std::strcmp(name(slots[pos].id), key) == 0) {
+                break;
+            }
+            pos = (pos + 1) & table.mask;
+        }
+        if (slots[pos].id == INVALID_LOCATION_ID) {
+            slots[pos] = LocationHashSlot{hash, static_cast<uint32_t>(i)};
+        }
+    }
+
+    table.slots = slots.data();
+    return table;
+}
+
+template <typename NameFn>
+static uint32_t find_in_hash_table(const NameHashTable& table, const char* key, NameFn name) {
+    uint32_t hash = hash_location_name(key);
+    uint32_t pos = hash & table.mask;
+
+    while (table.slots[pos].id != INVALID_LOCATION_ID) {
+        const LocationHashSlot& slot = table.slots[pos];
+        if (slot.hash == hash && std::strcmp(name(slot.id), key) == 0) {
+            return slot.id;
+        }
+        pos = (pos + 1) & table.mask;
+    }
+
+    return INVALID_LOCATION_ID;
+}
+
+static NameHashTable load_name_hash_table() {
+    if (const LocationTables* prebuilt = get_prebuilt_location_tables()) {
+        return prebuilt_hash_table(prebuilt->name_slots, prebuilt->name_slot_count);
+    }
+    return build_hash_table(get_location_count(), [](uint32_t id) {
+        return get_all_locations()[id].name;
+    });
+}
+
+static const NameHashTable& name_hash_table() {
+    static const NameHashTable table = load_name_hash_table();
+    return table;
+}
+
+// ============================================================================
+// Folded-name hash table
+// ============================================================================
+
+// Keys come from the store's folded column, so "sao paulo", "São Paulo"
+// and "SAO PAULO" all land on the same entry
+static NameHashTable load_folded_hash_table() {
+    if (const LocationTables* prebuilt = get_prebuilt_location_tables()) {
+        return prebuilt_hash_table(prebuilt->folded_slots, prebuilt->folded_slot_count);
+    }
+    return build_hash_table(get_location_count(), [](uint32_t id) {
+        const LocationStore& store = get_location_store();
+        return get_all_locations()[id].name != nullptr ? store_folded_name(store, id) : nullptr;
+    });
+}
+
+static const NameHashTable& folded_hash_table() {
+    static const NameHashTable table = load_folded_hash_table();
+    return table;
+}
+
+// ============================================================================
+// Name-sorted ID index
+// ============================================================================
+
+struct SortedNameIndex {
+    std::vector<uint32_t> storage;
+    const uint32_t* ids = nullptr;
+    size_t count = 0;
+};
+
+static SortedNameIndex build_sorted_name_index() {
+    SortedNameIndex index;
+    if (const LocationTables* prebuilt = get_prebuilt_location_tables()) {
+        index.ids = prebuilt->sorted_ids;
+        index.count = prebuilt->sorted_count;
+        return index;
+    }
+
+    const Location* locations = get_all_locations();
+    size_t count = get_location_count();
+
+    std::vector<uint32_t>& ids = index.storage;
+    ids.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        if (locations[i].name != nullptr) {
+            ids.push_back(static_cast<uint32_t>(i));
+        }
+    }
+
+    // Stable so equal names keep database order
+    std::stable_sort(ids.begin(), ids.end(), [locations](uint32_t a, uint32_t b) {
+        return std::strcmp(locations[a].name, locations[b].name) < 0;
+    });
+    index.ids = ids.data();
+    index.count = ids.size();
+    return index;
+}
+
+static const SortedNameIndex& sorted_name_index() {
+    static const SortedNameIndex index = build_sorted_name_index();
+    return index;
+}
+
+// ============================================================================
+// Name lengths
+// ============================================================================
+
+static std::vector<uint16_t> build_name_lengths() {
+    const Location* locations = get_all_locations();
+    size_t count = get_location_count();
+
+    std::vector<uint16_t> lengths(count, 0);
+    for (size_t i = 0; i < count; i++) {
+        if (locations[i].name != nullptr) {
+            lengths[i] = static_cast<uint16_t>(std::min<size_t>(std::strlen(locations[i].name), 0xFFFF));
+        }
+    }
+    return lengths;
+}
+
+static const std::vector<uint16_t>& name_lengths() {
+    static const std::vector<uint16_t> lengths = build_name_lengths();
+    return lengths;
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+void build_location_indexes() {
+    name_hash_table();
+    sorted_name_index();
+    name_lengths();
+
+    // Reads the packed store, which is itself built from the tables above
+    folded_hash_table();
+}
+
+uint32_t hash_location_name(const char* name) {
+    uint32_t hash = 2166136261u;
+    for (const unsigned char* p = reinterpret_cast<const unsigned char*>(name); *p; p++) {
+        hash ^= *p;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+uint32_t find_location_id(const char* normalized) {
+    const Location* locations = get_all_locations();
+    return find_in_hash_table(name_hash_table(), normalized,
+                              [locations](uint32_t id) { return locations[id].name; });
+}
+
+uint32_t find_location_id_folded(const char* folded) {
+    const LocationStore& store = get_location_store();
+    return find_in_hash_table(folded_hash_table(), folded,
+                              [&store](uint32_t id) { return store_folded_name(store, id); });
+}
+
+const uint32_t* get_locations_by_name(size_t& count) {
+    const SortedNameIndex& index = sorted_name_index();
+    count = index.count;
+    return index.ids;
+}
+
+size_t lower_bound_location_name(const char* key) {
+    const SortedNameIndex& index = sorted_name_index();
+    const Location* locations = get_all_locations();
+
+    const uint32_t* it = std::lower_bound(index.ids, index.ids + index.count, key,
+                                          [locations](uint32_t id, const char* k) {
+                                              return std::strcmp(locations[id].name, k) < 0;
+                                          });
+    return static_cast<size_t>(it - index.ids);
+}
+
+const uint16_t* get_location_name_lengths() {
+    return name_lengths().data();
+}
+
+LocationTables get_location_tables() {
+    LocationTables tables = {};
+    tables.location_count = get_location_count();
+    tables.fingerprint = get_location_fingerprint();
+
+    const NameHashTable& names = name_hash_table();
+    tables.name_slots = names.slots;
+    tables.name_slot_count = static_cast<size_t>(names.mask) + 1;
+    const NameHashTable& folded = folded_hash_table();
+    tables.folded_slots = folded.slots;
+    tables.folded_slot_count = static_cast<size_t>(folded.mask) + 1;
+
+    tables.sorted_ids = get_locations_by_name(tables.sorted_count);
+    get_location_trie_tables(tables);
+    return tables;
+}
+
+}  // namespace mcp
+}  // namespace cesium
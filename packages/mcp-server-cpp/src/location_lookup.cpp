@@ -0,0 +1,352 @@
+/**
+ * Location Lookup Implementation
+ *
+ * Name resolution, prefix search and fuzzy matching over the location
+ * database. The data itself lives in data/location_table.bin, which is
+ * written by scripts/fetch-geonames.mjs and decoded by location_database.cpp.
+ */
+
+#include "location_database.h"
+#include "location_index.h"
+#include "location_binary.h"
+#include "location_cache.h"
+#include "location_store.h"
+#include "location_rank.h"
+#include "location_scan.h"
+#include "location_metadata.h"
+#include "location_places.h"
+#include "levenshtein.h"
+#include "location_qgram.h"
+#include "location_symspell.h"
+#include "utf8_fold.h"
+#include <cctype>
+#include <cstring>
+#include <algorithm>
+#include <vector>
+
+namespace cesium {
+namespace mcp {
+
+void normalize_location_name(const char* input, char* output, size_t output_size) {
+    if (output_size == 0) return;
+
+    // Skip leading whitespace
+    while (*input == ' ' || *input == '\t') {
+        input++;
+    }
+
+    // Lowercase, including accented and non-Latin capitals ("SÃO" -> "são")
+    size_t j = utf8_lowercase(input, output, output_size);
+
+    // Remove trailing whitespace
+    while (j > 0 && (output[j - 1] == ' ' || output[j - 1] == '\t')) {
+        j--;
+    }
+
+    output[j] = '\0';
+}
+
+// Exact lookup, falling back to the folded key so spelling variants in
+// case, accents or quotes ("Sao Paulo", "«Navoiy» aeroporti") still hit
+static uint32_t find_exact_or_folded(const char* name, const char* normalized) {
+    uint32_t id = find_location_id(normalized);
+    if (id == INVALID_LOCATION_ID) {
+        char folded[256];
+        utf8_fold(name, folded, sizeof(folded));
+        id = find_location_id_folded(folded);
+    }
+    return id;
+}
+
+uint32_t find_location_id_any_spelling(const char* name) {
+    char normalized[256];
+    normalize_location_name(name, normalized, sizeof(normalized));
+    return find_exact_or_folded(name, normalized);
+}
+
+// Cache variant of a lookup: 0 for exact resolution; fuzzy resolution sets
+// the top bit and packs the full max_distance, the type flags and the
+// country code, so no distance can alias another or the exact variant
+static uint64_t fuzzy_cache_variant(const LocationFilter* filter, int max_distance) {
+    uint64_t variant = (1ull << 63) | static_cast<uint32_t>(max_distance);
+    if (filter != nullptr) {
+        variant |= static_cast<uint64_t>(filter->types) << 32;
+        variant |= static_cast<uint64_t>(filter->country) << 40;
+    }
+    return variant;
+}
+
+// Serve a resolution from the LRU cache, or run it and remember the outcome
+// (found or not)
+template <typename Resolve>
+static bool resolve_cached(const char* name, uint64_t variant, double& longitude, double& latitude,
+                           double& heading, Resolve resolve) {
+    LocationResolution cached;
+    if (!location_cache_get(name, variant, cached)) {
+        cached.found = resolve(cached.longitude, cached.latitude, cached.heading);
+        location_cache_put(name, variant, cached);
+    }
+    if (cached.found) {
+        longitude = cached.longitude;
+        latitude = cached.latitude;
+        heading = cached.heading;
+    }
+    return cached.found;
+}
+
+static bool resolve_location_impl(const char* name, double& longitude, double& latitude, double& heading) {
+    // An attached binary database takes precedence over the compiled-in table
+    if (const LocdbRecord* record = find_binary_location(name)) {
+        longitude = record->longitude;
+        latitude = record->latitude;
+        heading = record->heading;
+        return true;
+    }
+
+    const Location* locations = get_all_locations();
+
+    char normalized[256];
+    normalize_location_name(name, normalized, sizeof(normalized));
+
+    uint32_t id = find_exact_or_folded(name, normalized);
+    if (id == INVALID_LOCATION_ID) {
+        return false;
+    }
+
+    // Aliases report their place's coordinates
+    id = get_canonical_location_id(id);
+    longitude = locations[id].longitude;
+    latitude = locations[id].latitude;
+    heading = locations[id].heading;
+    return true;
+}
+
+bool resolve_location(const char* name, double& longitude, double& latitude, double& heading) {
+    return resolve_cached(name, 0, longitude, latitude, heading,
+                          [name](double& lon, double& lat, double& head) {
+                              return resolve_location_impl(name, lon, lat, head);
+                          });
+}
+
+size_t resolve_locations(const char* const* names, size_t count, LocationResolution* results,
+                         int max_distance) {
+    // Routes revisit places ("a -> b -> a"); later copies reuse the first
+    // result. Batches are small, so a hash of each name plus a linear probe
+    // over earlier hashes is cheaper than a set.
+    std::vector<uint32_t> hashes(count);
+    size_t found = 0;
+    for (size_t i = 0; i < count; i++) {
+        LocationResolution& result = results[i];
+        if (names[i] == nullptr) {
+            hashes[i] = 0;
+            result = LocationResolution{0.0, 0.0, -1.0, false};
+            continue;
+        }
+        hashes[i] = hash_location_name(names[i]);
+
+        size_t earlier = 0;
+        while (earlier < i && (names[earlier] == nullptr || hashes[earlier] != hashes[i] ||
+                               std::strcmp(names[earlier], names[i]) != 0)) {
+            earlier++;
+        }
+
+        if (earlier < i) {
+            result = results[earlier];
+        } else {
+            result = LocationResolution{0.0, 0.0, -1.0, false};
+            result.found = resolve_location(names[i], result.longitude, result.latitude, result.heading);
+            if (!result.found && max_distance > 0) {
+                result.found = fuzzy_resolve_location(names[i], result.longitude, result.latitude,
+                                                      result.heading, max_distance);
+            }
+        }
+        if (result.found) found++;
+    }
+    return found;
+}
+
+size_t search_locations(const char* prefix, const Location** results, size_t max_results) {
+    const Location* locations = get_all_locations();
+
+    char normalized[256];
+    normalize_location_name(prefix, normalized, sizeof(normalized));
+    size_t prefix_len = std::strlen(normalized);
+
+    // Matches form a contiguous run in name order starting at the lower bound
+    size_t sorted_count;
+    const uint32_t* sorted = get_locations_by_name(sorted_count);
+
+    size_t count = 0;
+    for (size_t i = lower_bound_location_name(normalized);
+         i < sorted_count && count < max_results; i++) {
+        const Location& loc = locations[sorted[i]];
+        if (std::strncmp(normalized, loc.name, prefix_len) != 0) {
+            break;
+        }
+        results[count++] = &loc;
+    }
+
+    return count;
+}
+
+bool contains_substring(const char* haystack, const char* needle) {
+    return scan_find_substring(haystack, std::strlen(haystack), needle, std::strlen(needle)) != nullptr;
+}
+
+// Shared by the plain and filtered fuzzy lookups; candidates failing the
+// filter (if any) are dropped before their edit distance is computed
+static bool fuzzy_resolve_impl(const char* name, const LocationFilter* filter,
+                               double& longitude, double& latitude,
+                               double& heading, int max_distance) {
+    const Location* locations = get_all_locations();
+
+    char normalized[256];
+    normalize_location_name(name, normalized, sizeof(normalized));
+
+    const Location* best_match = nullptr;
+    int best_distance = max_distance + 1;
+
+    // An exact (or folded-exact) hit is always the best candidate
+    uint32_t exact_id = find_exact_or_folded(name, normalized);
+    if (exact_id != INVALID_LOCATION_ID &&
+        (filter == nullptr || location_matches_filter(exact_id, *filter))) {
+        best_match = &locations[exact_id];
+        best_distance = 0;
+    }
+
+    // Normalized names fit the bit-parallel pattern limit, so the match
+    // masks are built once and reused against every candidate
+    LevenshteinPattern pattern;
+    levenshtein_prepare(normalized, pattern);
+    const LocationStore& store = get_location_store();
+    const uint16_t* name_lengths = get_location_name_lengths();
+
+    // Candidates come back in database order, so ties still go to the
+    // first entry as with the full scan. Matches beyond a candidate set's
+    // limit are left to the next, wider set, which sees every such name.
+    auto scan_candidates = [&](const std::vector<uint32_t>& candidates, int limit) {
+        for (size_t c = 0; best_distance > 0 && c < candidates.size(); c++) {
+            uint32_t i = candidates[c];
+            if (filter != nullptr && !location_matches_filter(i, *filter)) continue;
+            int dist = levenshtein_distance(pattern, store_name(store, i), name_lengths[i],
+                                            std::min(best_distance - 1, limit));
+            if (dist < best_distance && dist <= limit) {
+                best_distance = dist;
+                best_match = &locations[i];
+            }
+        }
+    };
+
+    if (best_distance > 0) {
+        // Every name within the delete index's reach is among its
+        // candidates, so a match found there is the overall best. Only
+        // when nothing is that close does the bigram filter take over.
+        int reach = std::min(max_distance, get_symspell_max_distance());
+        std::vector<uint32_t> candidates;
+        find_symspell_candidates(normalized, reach, candidates);
+        scan_candidates(candidates, reach);
+
+        if (best_distance > reach && reach < max_distance) {
+            find_fuzzy_candidates(normalized, max_distance, candidates);
+            scan_candidates(candidates, max_distance);
+        }
+    }
+
+    if (best_match != nullptr && best_distance <= max_distance) {
+        best_match = &locations[get_canonical_location_id(static_cast<uint32_t>(best_match - locations))];
+        longitude = best_match->longitude;
+        latitude = best_match->latitude;
+        heading = best_match->heading;
+        return true;
+    }
+
+    return false;
+}
+
+static size_t fuzzy_search_impl(const char* name, const LocationFilter* filter,
+                                const Location** results, int* scores,
+                                size_t max_results, int max_distance) {
+    const Location* locations = get_all_locations();
+
+    char normalized[256];
+    normalize_location_name(name, normalized, sizeof(normalized));
+
+    // Collect all matches within distance
+    struct Match {
+        const Location* loc;
+        int distance;
+    };
+    std::vector<Match> matches;
+
+    LevenshteinPattern pattern;
+    levenshtein_prepare(normalized, pattern);
+    const LocationStore& store = get_location_store();
+    const uint16_t* name_lengths = get_location_name_lengths();
+
+    // Only names passing the bigram count filter can be within max_distance
+    std::vector<uint32_t> candidates;
+    find_fuzzy_candidates(normalized, max_distance, candidates);
+
+    for (uint32_t i : candidates) {
+        if (filter != nullptr && !location_matches_filter(i, *filter)) continue;
+        int dist = levenshtein_distance(pattern, store_name(store, i), name_lengths[i], max_distance);
+        if (dist <= max_distance) {
+            matches.push_back({&locations[i], dist});
+        }
+    }
+
+    // Sort by distance
+    std::sort(matches.begin(), matches.end(),
+              [](const Match& a, const Match& b) { return a.distance < b.distance; });
+
+    // Return top results
+    size_t count = std::min(matches.size(), max_results);
+    for (size_t i = 0; i < count; i++) {
+        results[i] = matches[i].loc;
+        scores[i] = matches[i].distance;
+    }
+
+    return count;
+}
+
+bool fuzzy_resolve_location(const char* name, double& longitude, double& latitude,
+                            double& heading, int max_distance) {
+    return resolve_cached(name, fuzzy_cache_variant(nullptr, max_distance), longitude, latitude, heading,
+                          [name, max_distance](double& lon, double& lat, double& head) {
+                              return fuzzy_resolve_impl(name, nullptr, lon, lat, head, max_distance);
+                          });
+}
+
+bool fuzzy_resolve_location_filtered(const char* name, const LocationFilter& filter,
+                                     double& longitude, double& latitude, double& heading,
+                                     int max_distance) {
+    return resolve_cached(name, fuzzy_cache_variant(&filter, max_distance), longitude, latitude, heading,
+                          [name, &filter, max_distance](double& lon, double& lat, double& head) {
+                              return fuzzy_resolve_impl(name, &filter, lon, lat, head, max_distance);
+                          });
+}
+
+size_t fuzzy_search_locations(const char* name, const Location** results,
+                              int* scores, size_t max_results, int max_distance) {
+    return fuzzy_search_impl(name, nullptr, results, scores, max_results, max_distance);
+}
+
+size_t fuzzy_search_locations_filtered(const char* name, const LocationFilter& filter,
+                                       const Location** results, int* scores,
+                                       size_t max_results, int max_distance) {
+    return fuzzy_search_impl(name, &filter, results, scores, max_results, max_distance);
+}
+
+size_t get_top_cities_by_population(const Location** results, size_t max_results,
+                                     int min_population) {
+    PopulationFilter filter;
+    filter.min_population = min_population;
+    return find_top_locations_by_population(filter, results, max_results);
+}
+
+size_t get_cities_with_population_count() {
+    return get_ranked_location_count();
+}
+
+}  // namespace mcp
+}  // namespace cesium
\ No newline at end of file
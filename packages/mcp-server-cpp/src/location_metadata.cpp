@@ -0,0 +1,227 @@
+/**
+ * Location Type and Country Metadata Implementation
+ *
+ * The tables themselves are generated into location_metadata_data.cpp by
+ * scripts/build-location-metadata.mjs.
+ */
+
+#include "location_metadata.h"
+#include "location_index.h"
+#include "location_store.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace cesium {
+namespace mcp {
+
+struct TypeName {
+    const char* name;
+    uint8_t flag;
+};
+
+static const TypeName TYPE_NAMES[] = {
+    {"state", LOCATION_TYPE_STATE},
+    {"city", LOCATION_TYPE_CITY},
+    {"landmark", LOCATION_TYPE_LANDMARK},
+    {"country", LOCATION_TYPE_COUNTRY},
+    {"region", LOCATION_TYPE_REGION},
+    {"airport", LOCATION_TYPE_AIRPORT},
+};
+
+constexpr size_t TYPE_COUNT = sizeof(TYPE_NAMES) / sizeof(TYPE_NAMES[0]);
+
+static char to_lower_ascii(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c;
+}
+
+uint16_t parse_country_code(const char* code) {
+    if (code == nullptr) return LOCATION_COUNTRY_UNKNOWN;
+    char a = to_lower_ascii(code[0]);
+    char b = a != '\0' ? to_lower_ascii(code[1]) : '\0';
+    if (a < 'a' || a > 'z' || b < 'a' || b > 'z' || code[2] != '\0') {
+        return LOCATION_COUNTRY_UNKNOWN;
+    }
+    return static_cast<uint16_t>((a << 8) | b);
+}
+
+void format_country_code(uint16_t country, char* output) {
+    if (country == LOCATION_COUNTRY_UNKNOWN) {
+        output[0] = '\0';
+        return;
+    }
+    output[0] = static_cast<char>(country >> 8);
+    output[1] = static_cast<char>(country & 0xFF);
+    output[2] = '\0';
+}
+
+uint8_t parse_location_types(const char* names, size_t* unrecognized) {
+    uint8_t types = 0;
+    if (unrecognized != nullptr) *unrecognized = 0;
+    if (names == nullptr) return types;
+
+    const char* p = names;
+    while (*p != '\0') {
+        while (*p == ',' || *p == ' ') p++;
+        const char* start = p;
+        while (*p != '\0' && *p != ',' && *p != ' ') p++;
+
+        size_t len = static_cast<size_t>(p - start);
+        if (len == 0) continue;
+        bool known = false;
+        for (const TypeName& type : TYPE_NAMES) {
+            if (std::strlen(type.name) != len) continue;
+            size_t i = 0;
+            while (i < len && to_lower_ascii(start[i]) == type.name[i]) i++;
+            if (i == len) {
+                types |= type.flag;
+                known = true;
+            }
+        }
+        if (!known && unrecognized != nullptr) (*unrecognized)++;
+    }
+    return types;
+}
+
+void format_location_types(uint8_t types, char* output, size_t output_size) {
+    if (output_size == 0) return;
+    output[0] = '\0';
+
+    size_t used = 0;
+    for (const TypeName& type : TYPE_NAMES) {
+        if ((types & type.flag) == 0) continue;
+        int written = snprintf(output + used, output_size - used, "%s%s",
+                               used > 0 ? "," : "", type.name);
+        if (written < 0 || static_cast<size_t>(written) >= output_size - used) break;
+        used += static_cast<size_t>(written);
+    }
+}
+
+bool location_matches_filter(uint32_t id, const LocationFilter& filter) {
+    const LocationStore& store = get_location_store();
+    if (filter.types != 0 && (store.type[id] & filter.types) == 0) return false;
+    if (filter.country != 0 && store.country[id] != filter.country) return false;
+    return true;
+}
+
+// ============================================================================
+// Sub-indexes
+// ============================================================================
+
+struct MetadataIndex {
+    std::vector<uint32_t> by_type[TYPE_COUNT];  // IDs with each flag, name order
+    std::vector<uint32_t> by_country;           // IDs by country, name order within
+};
+
+static MetadataIndex build_metadata_index() {
+    MetadataIndex index;
+    const LocationStore& store = get_location_store();
+
+    size_t sorted_count;
+    const uint32_t* sorted = get_locations_by_name(sorted_count);
+
+    for (size_t i = 0; i < sorted_count; i++) {
+        uint32_t id = sorted[i];
+        for (size_t t = 0; t < TYPE_COUNT; t++) {
+            if (store.type[id] & TYPE_NAMES[t].flag) index.by_type[t].push_back(id);
+        }
+        if (store.country[id] != LOCATION_COUNTRY_UNKNOWN) index.by_country.push_back(id);
+    }
+
+    std::stable_sort(index.by_country.begin(), index.by_country.end(),
+                     [&store](uint32_t a, uint32_t b) {
+                         return store.country[a] < store.country[b];
+                     });
+    return index;
+}
+
+static const MetadataIndex& get_metadata_index() {
+    static const MetadataIndex index = build_metadata_index();
+    return index;
+}
+
+void build_location_metadata_index() {
+    get_metadata_index();
+}
+
+// IDs in name order that include every location passing the filter: the
+// filter's type list when it names a single type, its country's range, or
+// the whole name index, whichever is shortest
+static void narrowest_sublist(const LocationFilter& filter, const uint32_t*& begin,
+                              const uint32_t*& end) {
+    const MetadataIndex& index = get_metadata_index();
+    const LocationStore& store = get_location_store();
+
+    size_t sorted_count;
+    begin = get_locations_by_name(sorted_count);
+    end = begin + sorted_count;
+
+    auto narrow = [&](const uint32_t* b, const uint32_t* e) {
+        if (e - b < end - begin) {
+            begin = b;
+            end = e;
+        }
+    };
+
+    if (filter.types != 0 && (filter.types & (filter.types - 1)) == 0) {
+        for (size_t t = 0; t < TYPE_COUNT; t++) {
+            if (filter.types == TYPE_NAMES[t].flag) {
+                const std::vector<uint32_t>& ids = index.by_type[t];
+                narrow(ids.data(), ids.data() + ids.size());
+            }
+        }
+    }
+
+    if (filter.country != LOCATION_COUNTRY_UNKNOWN) {
+        const uint32_t* first = index.by_country.data();
+        const uint32_t* last = first + index.by_country.size();
+        const uint32_t* lo = std::lower_bound(first, last, filter.country,
+            [&store](uint32_t id, uint16_t country) { return store.country[id] < country; });
+        const uint32_t* hi = std::upper_bound(lo, last, filter.country,
+            [&store](uint16_t country, uint32_t id) { return country < store.country[id]; });
+        narrow(lo, hi);
+    }
+}
+
+size_t count_locations_by_metadata(const LocationFilter& filter) {
+    const uint32_t* begin;
+    const uint32_t* end;
+    narrowest_sublist(filter, begin, end);
+
+    size_t count = 0;
+    for (const uint32_t* p = begin; p != end; p++) {
+        if (location_matches_filter(*p, filter)) count++;
+    }
+    return count;
+}
+
+size_t search_locations_filtered(const char* prefix, const LocationFilter& filter,
+                                 const Location** results, size_t max_results) {
+    const Location* locations = get_all_locations();
+    const LocationStore& store = get_location_store();
+
+    char normalized[256];
+    normalize_location_name(prefix, normalized, sizeof(normalized));
+    size_t prefix_len = std::strlen(normalized);
+
+    const uint32_t* begin;
+    const uint32_t* end;
+    narrowest_sublist(filter, begin, end);
+
+    // Every sub-list is in name order, so matches are again a contiguous run
+    const uint32_t* p = std::lower_bound(begin, end, normalized,
+        [&store](uint32_t id, const char* key) {
+            return std::strcmp(store_name(store, id), key) < 0;
+        });
+
+    size_t count = 0;
+    for (; p != end && count < max_results; p++) {
+        if (std::strncmp(normalized, store_name(store, *p), prefix_len) != 0) break;
+        if (location_matches_filter(*p, filter)) results[count++] = &locations[*p];
+    }
+    return count;
+}
+
+}  // namespace mcp
+}  // namespace cesium
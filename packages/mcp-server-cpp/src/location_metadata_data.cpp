@@ -0,0 +1,3373 @@
+/**
+ * Location Metadata Tables
+ *
+ * Type flags and country codes parallel to the location table (data/location_table.bin).
+ * Generated by scripts/build-location-metadata.mjs; do not edit.
+ * Generated: 2026-10-16T01:48:58.191Z
+ * Total locations: 63969
+ */
+
+#include "location_metadata.h"
+
+namespace cesium {
+namespace mcp {
+
+// LOCATION_TYPE_* flags per location, 0 = unknown
+static const uint8_t LOCATION_TYPES[] = {
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,
+    2,2,2,34,2,2,34,2,34,2,2,2,2,2,34,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,34,2,2,2,2,2,2,2,6,2,2,2,2,2,2,2,2,2,2,6,34,2,2,2,2,2,
+    34,2,2,2,2,2,2,2,2,2,2,34,2,34,2,2,2,2,34,2,2,2,2,2,2,2,6,2,2,2,2,34,
+    2,34,2,2,2,2,2,2,2,2,2,2,2,2,2,2,34,2,2,2,34,34,2,6,2,34,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,6,34,2,2,2,2,2,2,34,2,34,2,2,34,2,2,34,2,2,2,2,2,34,
+    2,2,2,6,2,2,34,2,2,2,2,34,2,6,2,2,2,6,34,2,6,2,2,34,2,34,2,6,2,34,34,6,
+    2,34,2,2,2,2,34,2,2,6,34,2,6,34,6,34,6,2,34,6,34,2,2,34,34,2,6,6,6,6,2,34,
+    34,34,34,2,6,6,34,6,6,34,2,6,6,34,6,34,2,34,2,6,6,2,2,6,34,34,34,6,34,6,6,34,
+    6,2,6,34,34,6,34,34,34,34,6,34,2,6,34,34,6,34,6,34,34,2,34,2,34,2,34,34,34,6,6,6,
+    34,6,34,6,2,34,34,34,6,34,34,2,34,2,34,3,34,6,34,6,34,34,6,6,34,6,34,34,2,34,34,34,
+    6,34,6,6,34,34,6,6,6,6,6,34,34,2,34,34,6,6,2,34,2,34,34,2,6,34,34,6,34,34,34,34,
+    34,6,6,34,34,34,6,34,34,34,34,34,34,34,34,2,34,34,34,6,6,6,6,2,6,6,6,34,6,6,6,6,
+    34,34,2,34,34,34,6,6,34,34,34,6,34,34,34,34,2,34,34,34,2,34,6,2,34,34,6,2,6,34,6,6,
+    2,34,6,6,34,34,6,6,2,34,34,34,34,34,34,34,34,34,6,34,34,6,2,34,34,6,34,6,6,6,6,34,
+    6,34,6,34,34,34,6,34,34,2,34,34,34,2,34,6,34,34,34,34,34,34,6,34,34,34,3,6,6,34,34,6,
+    2,2,6,6,6,6,34,34,6,6,2,6,2,34,2,34,34,34,34,34,34,34,34,34,6,34,6,34,6,34,34,34,
+    6,2,34,6,34,34,6,34,34,6,6,34,6,34,2,34,6,6,6,6,6,34,6,34,6,34,2,2,2,2,2,2,
+    2,2,34,2,2,2,2,2,34,34,2,2,2,2,2,2,34,34,2,0,0,2,34,34,2,2,2,2,2,1,2,1,
+    2,1,2,2,34,32,2,2,2,2,2,2,2,2,34,2,2,32,1,1,1,1,0,0,1,1,1,1,1,1,1,2,
+    2,2,2,0,2,2,2,4,4,4,2,2,2,34,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,2,2,2,
+    2,34,0,2,0,6,2,2,0,0,0,0,0,0,2,2,2,2,2,0,0,0,0,0,4,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,2,2,0,0,2,0,
+    0,0,0,0,4,4,0,2,0,0,0,2,6,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,0,0,0,
+    0,0,4,4,0,0,0,0,0,0,0,0,0,0,0,32,32,4,0,0,0,0,0,0,0,2,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,4,4,34,34,0,0,0,0,2,
+    2,34,34,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,2,2,0,0,0,0,0,0,32,32,32,32,32,32,
+    0,0,0,0,32,32,32,32,2,32,32,32,32,32,0,0,0,0,32,32,0,0,0,32,32,32,0,0,0,0,0,32,
+    32,0,0,0,2,2,32,32,0,0,0,0,32,4,32,32,2,0,0,0,32,32,32,32,2,2,0,0,0,32,32,0,
+    0,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,2,2,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,36,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    36,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,36,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,
+};
+
+// Lowercase ISO 3166-1 alpha-2 code per location, two bytes each, "--" = unknown
+static const char LOCATION_COUNTRIES[] =
+    "cncncncncdtrngvncninbrmxinrukrjpegcnzacngbusidinvntwpecocohkirbrsgauruauthclzasaininkemlsaetusae"
+    "jpmatrdekreskrveartwcaecauaojpngussnbfjpitusauzmbrdotgcufrzaescocgjpghgndeaecahuplmxatesugusesph"
+    "uszwlrnzusseuspy--jpmyusmxetitmgusnecacmuydemzhtbrczfrdkrwmwnongiebecacaususususniilscjmitmxhnga"
+    "uscfslus--tzcamxnlarusidbatnususesgrhrcafiususususesgbusbmgbzaltsvtrptgbusgbusssgwtzil--skprchnz"
+    "uspaeeusnanzauitususlsmzusesqacrinitusidvnuspgbrci--siesbjtr--vebw--jpmegybsngbosrmxuschesmxinin"
+    "mxusmxesusmuusinintlgbcuboprcv----pecujpitmx--esbrtrchitituscr--iscdlkitbragitaubrbrusgbusesltus"
+    "ptbbesmz--us--cocuculbusfrdeinngcyconlskkefj--lupgszindk--aufiitcnmx--dekzetbruspt--brbiafbnmnus"
+    "phalusptprlagbfrusdebrmgar--sbussemxdear--brbeitesititphlrstusgaiqesesauitussattde--idplusinmgma"
+    "augtczmzbrcndenauspg--inbrmxbrws------itdedeitpaplsedegmbeptesus--mginuszwdebrescogf--ptveusrose"
+    "mcusbrusus--arussnjpskshfruysedkusrufruspkus--frusdo--uspkseidpeusetfr--ngesimskaupl--atususbaus"
+    "keskimusidpgnz--fjvc--aupebrbrnljpbrinkemg--alcopltzususfrcncdgbfkchgbdecopeitmwiedeadnllcgbusus"
+    "usjp----zamxegbrititiniddzpl----esuscnaxbrtratsacatzdemwgbaudm--esitdepldepgdebhfrmgglbzckfoknvg"
+    "fmmttvligqususususususususususususususususususususususususususususususususususususususususususus"
+    "usususususususususususususususgbfrfrdedeititititititesesnlbeatchczplrurudkgbgrptcnhkcnsgthmyvnin"
+    "inininzamabrarar----------clmxcucacacacafrfrususus--usususususususususususususususus--------usus"
+    "usnpnpgbgbgbgbgbititvavavavaitgrgrgrfrfrfrfrfrfrdededeesesrururutrtrcncncncncncncncnjpjpjpjpjpjp"
+    "krkrininkhjojoaeaesgsgauauauau----aubrbrpepeararbrbregegegegegzatztztzchchchusususususususususus"
+    "ususususususususususususususususususususususususususdededefrfrfrfrrukz--ininjpjpjpjpusususususus"
+    "ususususususususususususususususususususgbgbgbfrfrfrdedenlnlnlaeaejpjpjpjpjpcncncncnhkhksgsgsgkr"
+    "krthththauauauaubrbrarararcacacacacacauzuzuzuzususdkdkbsbskikicacaititsosotztz----gbgbusus----us"
+    "usususus--usussoso----omomustr------ususetetususauauusustrtrtrtr----ieieieieieieececmxmxieiebrbr"
+    "usarararararbrbrbrbrmemeeseshrhrmemememefrfrfrfrdjdjtdtdmgmgmg----mgmgmgmgnene----tdtdfrfrfrfrmg"
+    "mgdjdjfrfrfrfrgpgpmgmgfrfrfrfrfrfrgpgpdjdj----tdtdfrfrbibifrfr--------bibi--------frfrfrfrtdtd--"
+    "--tdtdgpgp----cdcd--------frfrfrfrpmpmgagakmkmfrfrdjdjfrfrfrfr----bfbfbjbjfrfrfrfrfrfr----frfrfr"
+    "fr----gpgpgfgfcacamgmgbjbjdjdj----frfr--------frfrfrfrtdtdmrmrfrfrfrfrmgmgfrfrfrfr----mxmxararcv"
+    "cvararbrbrbrbr----cococlclararclclclclclclarar----brbrmxmxarar--------bobo----mxmxararararcucuar"
+    "armxmxpepemxmxcucuarmzmzmxmxcvcvclcl----bobobrbrcvcv--------arclclarar----brbrmxmxmzmzcvcvmxmxcl"
+    "clclclmxmxbrbrbrbrbrbrmxmx----clclclcl----ararararararmxmxmxmxmxmxararbrmxmx--------brbrcucuarar"
+    "mxmx--------mxmx----mxmxmxmxpepemxmxcoco----clcl----clclmxmxbrbrararmxmxclclmxmxptptptptararptpt"
+    "ptptptptararararclclarmxmxclclmxmxararmxmxclclpepe----mxmxpapa----papaclclcucu----brbrmxmxmxmxmx"
+    "mxmxmxmxmxbrbr----clclararmxmxbrbrclclclclpepe--------ararfrfrdzdzmadzdzcacafrfrhthtfrfresesmama"
+    "dzdzfrfrmrmrcici----mrmrgagamrmrcacafrfrfrfrdzdzmgmgmgmg----frfrkmkmesesdzdzdzdzdzdzfrfrmamacdcd"
+    "--------dzdzcicicgcg--------dzdzsnsngaga--------cmcmcaca----cfcfcdcdcdcdcmcmfrfrdzdzdzdzmamamgmg"
+    "cfcffrfrcmcmfrfrfrfr----gagacdcdgngncdcd--------frfr----cfcfcicicicifrfrcfcffrfrfrfrcdcdfrfrfrfr"
+    "frfrfrfrsnsnfrfrcfcffrfrgf----bebecaca----frfrfrfr--------caca----frfrfrfrcicifrfrfrfrfrfr----bf"
+    "bfcacafrfrmgmggngnmrmr----cacagagacmcmgngncici----cgcgbfbf----dzdzrwrw----mlml----frfrmamacici--"
+    "--dzdz------------cd--------hthththtcmcmcdcdcdcdbjbj------------gngn----cici--------mlmlcdcdcdcd"
+    "gngncdcdcicigagacfcfcmcm----------------frfr----caca----cacagngndzdzgagagagafrfrcacaga----bebecd"
+    "cdcdcdlulufrfrcfcfcgcgcmcmcicimgmgmgmgcacanenefrfrdzdz------cdcddzdzesesfrfrgagacdcdcacafrfrfrfr"
+    "frfrncnctdtdcdcdcfcfgngnmlml----bjbjgagacdcdmrmr----cicicmcmfrfrfrfrmrmrncnc--------cgcgbfbffrfr"
+    "frfrfrsnsn----htht--------cdcd----frfr----brbresescacacacacacafrfrfrfrcacacdcdblblfrfrfrfrcacare"
+    "refrfr----gngnmgmgcicicici--------cicimrmrdzdzcacacgcggngncici----cicidzdzsn----gagadzdzgpgp----"
+    "------------dzdzdzdzdzdzmgmgmgmgmgmgdzdzfrfrfrfrcacacdcd----cacacamgmgfrfrmgmgwfwf--------cmcm--"
+    "cgcgmamacfcffrfrgpgpcgcgdzdzgngnfrfrsnsnhthtmgmgmamafrfrcmcmchchcdcdcdcdfrfrfrfrcdcdcmcmcacatdtd"
+    "cdcdbfbfgagascscmlmlpfpffrfrcicinenenenecicicacagaganeneytytmqmqcgcgbibicacacamlmlfrfrfrfr------"
+    "----frfrcaeses----frfrma----cacadzdzmamadzdzmamafrfrfrfrcgcgmlmlmgmgsnsnfrfrcacacacamfmf----mama"
+    "cicimamafrfralalalalaoaoaoaoaoaobrbraobrbrbrbrtltlititbrbrbrbrbrbrbrbrmzmzbrbrbrbraoaobrbrbrbres"
+    "es----mzmzmzmzmzmzmzmzbrbr----brbr----aoaomzmzbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrtltlbrbrbrbrbrbrbr"
+    "brbrbrbrptptbrbrbrbrbrbrgwgwaoaobrbrbrbrmzmzbrbraoaobrbrbrbrbrbrbrbrbrbr----brbraoaobrbrbrbrbrbr"
+    "brbraoaobrbraoaomzmzbrbrbrbrbrbrbrbrmzmzaoao----brbrbrbrnanabrbrbrbrbr----brbrbrbrbrbrbrbrbrbrbr"
+    "brbrbrbrbrmzmzbrbrbrbrbrbrbrmzmzbrbrbrbrbrbrbrbrbrbrbrbrbrbr----brbrbrbrbrbrbrbrbrbrbrbrbrbr----"
+    "brbrbrbrbrbrbrbraoaoaoaoaoaoaoaobrbrmzmzaoaobrbrbrbrmzmzbrbrmzmzaoaoaoaobrbrbrbrbrbraoaoaoaobrbr"
+    "brbrbrbrbrbrbrbrbrbrbrbrbrbrmzmzbrbrbrbrbrbrbrbrbrbrbrbrbrbraoaobrbrbrbrbrbrmzmzbrbrbrbrptpteses"
+    "----brbrbrbrbrbrbrbrbrbraoaoaoaobrbr----brbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbresesbrbrmz"
+    "mztltlmzmzaoaoaoaoitititititititititititit----chchitititititititititittntnititititititititititit"
+    "ititbrbraoaoaoaomzmzmzmzaoaoaoaobrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrptptptpt"
+    "ititbrbrbrbrbrbrbrbrbrbrbrbrptptbrbraoaobrbrcvcvcvcvcvcvbrbrmzmzptptaoaoararbrbrbrbrbrbrbrbrbrbr"
+    "brbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrmzmzididbrbrmzmzbrbrststbrbrbrbrbrbrbrbrbrbraoaobrbrcvcvtltlbrbr"
+    "aoaotltlmzmzititititititit----brbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrititbrbrititaoaobrbrbrbrbrbrbrbrbr"
+    "brbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrititbrbr----aoaobrbrbrbrbrbrbrbrbrbrbrbrbrbrbr"
+    "brbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrbrititbrbrbrbrbrbrbrbrbrbrititbrbraoaobrbrrorororo"
+    "rorororororororororororororororororororororororororororododococoesescocovevecucupepe----pepecoco"
+    "cocoararcocoveveararcocoprprpepecocoararclclcrcr----cocoprprarar----vevepepevevepapabobopepepepe"
+    "boboboboboboararcucupypy----coco----esesececararprcocopepeararpapa----esesesescocope------------"
+    "esescrcr----bobonininini----crcresesdodoveveararcocovevegtgtcrcrpapaveve----clclhnhncrcrbobogtgt"
+    "----esesgtgtgtgtcrcr----papaesesninihnhnararcocoeses----vevesvsvesespapaararcrcrvevebobovevegtgt"
+    "brpepecocopapapapapepe----arar----esescococrcreseshnhncocoeseshnhnecechnhneseshnhnesescrcrvevees"
+    "esarar----arar----cococrcrcrcrcococococo----crcresesvevearar----ttttcocogtgtgtgtgtpapa----cocogt"
+    "gtarargtgtbobo--ninigtgtboboesescrcr----crcrbobo--------cocomxmxbrbrpapaveveveveararesesararnini"
+    "crcrcrcrmxmxececesesesesvevepepecrcrhnhn----vevegtgtcrcr--------hnhnvevehnhnarar--------bobo----"
+    "esesvevegtgtuyuyuyuyclclprprveveprpr----cocohnhnararcocococoarargtgtcocoararclclcococlclcocopeco"
+    "covevevevemxmxarar--ararcocoararcocobobocococococucucococococococucuesesmxmxcucumxmxcocopepecomx"
+    "mxmxmxvevecucuveveararveveararninipapabobopepepepepepepepepemxmx--------ececpepepepeniniececmxmx"
+    "crcrbododouymxmxpapaararuyuymxmxmxmxmxmxmxmxmxmxgagamxmxsvsvararesesvevemxmxesesmxmxvevegqgqmxmx"
+    "uyuymxmxgtgtmxmxhnhnararmxmxmxmxdodoececmxmxececveveesespapamxmxmxmxmxmxararesesvevedodomxmxgqgq"
+    "clclararpypypypycococococococlclcocomxmxveveveveveveececararmxmxmxmxdovemxmxmxmxmxmxmxmxmxmxarar"
+    "ararhnhncococucumxmxararcucupepeececcococucuveveveve----cucuvevecrcrececdododococovevemxmxdodoec"
+    "ecprprcrcrcocopapadodododoprprcocohnhnawawarcucucocoararararararararcrcrhnhnararmxmxmxmxmxmxmxmx"
+    "mxmxmxmxmxmxmxmxmxmxmxmxececcucucoco----cocoprprcocoveveararcocococlclhnhnclclvevecrcrcococococo"
+    "cococomxmxprprecec----vevecocopepecuececcucuvevecoco----mxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxvevemx"
+    "mxvevecumxmxcocovevevevecocococovevevevearececclclarar------------cococrcr--cucuarar----hnhnarar"
+    "----gtgtcocococococo----cocococovevepypyececbobobrbrararboboclcl----pepearcocoarar----cocoveveie"
+    "iepgpgusus----trtr----------------coco------------usus------------pgpgususmnmn------------pgpgin"
+    "inngng--------------ininususususngngisis------omom----usususususauaucacaususususususcacocodedeus"
+    "usauaugggg----br----bobonono----usisis--------usus----bzbzusus----usauau----phph----cazazaususde"
+    "de----us------------usnofrfrfrfrfrfrfrfr----ususususetet--------mgmg----trtr--------mgmg----tztz"
+    "----usususus--------mgmglklkininusus--------ngngbrbrpgpg----mgmgguguususususuzuznonomgmgbsbs----"
+    "--------ususus----ususpgpg------usus----mgmgusus----us--usususus----ususmzmzmzmzcucuususguguusus"
+    "mgmgmgmgmg----usus----cocousususus------------nanaususus----ususauauzaza----etet--------nznzusus"
+    "usussesepepepepeececpepe----vcvcbfbfususususbfbf----ususpgpg------------usususus----tztz--------"
+    "pgpgwswspgpgtmtmnznzususususpgpg----ererusususus------------usususususususus------------usususus"
+    "lala----us----usususususususususus----------------usus--------usususus--------auauusususususus--"
+    "--coco----auininruruetetphphnanaususininus----etet----pgpgauaunpnpnpnp----------------ususphphnp"
+    "np----cmcm--------trtruspgpgauau----in----kekecmcmcaca----phphididididididididididididididididid"
+    "idididididididididididididididididididid--------idid----idid----idid----idididididididididididid"
+    "idididididididid----idid----idididididididididididididididididididididididididididididididididid"
+    "ididid----idid--------ididididididididididididididididididididididididididididididididididididid"
+    "idididididididididididid----ididtltlidididididididididididididid----idididid--------idididididid"
+    "idid------------idididididid----idid----idididididididid--------idid------------------------idid"
+    "------------idididididididid----idididididid----idididididididididid----idididididididididid----"
+    "idid--------idididididid----idididid----idid----idididid----idid----idid----idididididididididid"
+    "idididididididididid----idididididididididididid----------------idididid----idididididididididid"
+    "--------idid----idid--idididididididid--------idid--------ididididididididididididlklkususcacaca"
+    "bfbfusus----gmgmususieiepgpg--------agag----ussoso----ususus----uscocousus----usus----gygyususus"
+    "ususmncdcdinin----cucu----clclbrbr----ususususbtbtauauauaucacatrtrusus----lklkngng----vuvuususus"
+    "usnznzususmgmg------------usus----usususususus----usus------------cacaususininetetmgmgetetgbgbin"
+    "in----us------------inin----ususmgususus----auausosoauaungnggugu----ususlklksoso--------usususus"
+    "----mgmg----co--------zazamgmg--------ususididnpnpininzazanpnpininininpgpg----phphususcacausus--"
+    "--gtgtusususus----bsinininineses--usus----ususdkdk--------npnp------------ususususcaususphphusus"
+    "--------gbgbgbgb--usususususus----cacausus------------ususcacaususususfjfjniniususususslslidid--"
+    "------------usustrtrbfbfusus------------pgpgususbqbqmxmxtdtd------kiki----usussoso--------sesese"
+    "seusus--------usus--------causususus----bfbfcncncacacgcg----gbgbtdtd----usususususususususususus"
+    "pgpgususzazaauaucacausususususus----ususbr--------ususususgbgb----gbgbgbgb--------cacaususauau--"
+    "--usususus----mxmxusususususususca----ususususbebeusususususus----zwzwususpgpg----tztz----pgpgza"
+    "zacdcdzmzmauauaupgpg----ididomsosousus------ususauau--------trag----auaucdcdrwrw----usususususus"
+    "ususcacaphph----auauususphphusphphcacaususcacacacaininususususususususauauusus--------gbgbususau"
+    "auusus------------afafcacagbgbtrtrmxmxauau----dmdm----vcvc----usus--------usus------------usus--"
+    "--ususlrlr--------zaza----ususususvgvg----ususgbgbcaca----gbgb----------------mxususususca------"
+    "--usususus----phphauauusus----brbrfjfjususlklkusus----brbrususphusus----usus----trtrbzbzbzbzusus"
+    "usus----trtrusususus----usususususususus----ususcacaarphphususauaucaca----------------ususususus"
+    "ususus----usus----viviususususcaca----ususususcacaususininususususnpnpcaca----ususmwmwusus----in"
+    "inusus----ususauau----usususus----caca----ininininusus----ususzaza----------------ususmwmw------"
+    "--cacaususpgpg----ususzmzmzwzwcacausus----------------ininnznzvivi------cxcx--bsbs--------------"
+    "------coco--------dedemxtrtrususbsbsauauususnznzphph----ususaiai----usus--------ususca----ususus"
+    "ususususususus------ususmwmw------------usus----ininususcacaca----cccc----ususususauauininauau--"
+    "--------usususususus--------auau----------gbgbus--------usususususususususususus----usus----pepe"
+    "mxcacacausususususus------------papausus----inin--------------------auau------------usus--------"
+    "----------------ieiecacanznz----auaumxmxususauaucacaususususususphphgbgbusus----usususususcacagb"
+    "gb--------cacaauauususzaza----usus------------cacaususcaca--------usus--------usususus----ususgb"
+    "----usususususus----trtr----usus--------mxmxcwcwusususus----usus----viviususpkpkphph--------trau"
+    "auusususususus--------ususlklkbzbzususphphususininnpnpnznzpgpgpgpg----auautmtminin----ususususus"
+    "us----------cacausus----------------etetetetususususususcacacaca----ususininususususmxmxusususus"
+    "ususususus----auauus----ususetetususnlnlauauscscusustrtrininpkpk----pgpgusus----ususinin----auau"
+    "usus----ininnpnp----ininus----bfbf----ususcabfbfcacausus----usususus----ininususpgpgphph------in"
+    "brbr----lklkcgcgbfbjbjmgmg----usususustztz----usus----ususauausdsd----eses--------usbfbf----pgpg"
+    "----ususcacaususdmdmusus----ininininphphususususcacaus------------ususcaca--------auauususususus"
+    "uszaza----ususphph--------gbgbnznz----ususauauusus--------dedemwmw----srsrusus--------usususus--"
+    "--usususus----usususususususus----usususus--------auau----gbcaca----------------usus----usus----"
+    "pgpgsoso------------------idid--------cocoveveususphphcousususvevetrtr----keke----------------us"
+    "us----kekeus----usususususus----usus----ususzazausus--ususpgpg------------pgpgzazausussdsd------"
+    "--ititpgpg----mxmxugugusus------------ususususpgpgcycyusus----ususcaca----trtrtrtr----dkdktrtrse"
+    "setrtr----auauusus------------------ususgygyus----fr----auauususususphphusus----ususgbgb--------"
+    "sosoknkn----wsws--------ususususususcacausus----------------ususwswsusus----usus------------usus"
+    "ususgbgb----mgmg----ususususbrbrmxmxus----usususzazafrfrmgmg----etetusus----auaupgpgusus--------"
+    "usususus----usus--------usus----usususususus------ususdedededechchdedededededededededededededeat"
+    "atdedeplplatatdedededededeatatdedededeatatdedededededededededeatatdededkdkdedededededededededenl"
+    "nlchchdedededededededededeatatdedededededededededededededededededededeatatdedededededededkdkusus"
+    "usus----usus----usus----causus--------ususdedeau----usus--------usus------------usususus----caca"
+    "cacacacaususcaca----------------usus------------usususususususus--------------ususlrlrususphphph"
+    "phecec----usus----usus----ususususcacaususususususususususususususcacacaca----usus----ususususus"
+    "us--------tvtvusususus--------azaz------------usususus----ususseseususetet----------------cacaaz"
+    "azmgmgpg----sosousus----afafususususkekeussosousususus----pgpgeses----usus--------seseinusus----"
+    "trtrtrtrslslcycytztzetetbtbtcdcd----phphususzazaususususususususauau----ususususususauau--------"
+    "usus----pgpgbwbwetet----usus----ususcaca----ususpgpgnznzzaza------------ususauauususgbgbususgbgb"
+    "----auauauusus----------------ususininnanaetetphph------------trtrnonousus----usus----ngng----et"
+    "etususus--------gbgb------------usus----ususetet----cacapgpgbfbfususseseauau--------ususbsbsusus"
+    "ususususususzazalrlrcacausususususus----usususus----caca----usususususus----bbbbusususususususus"
+    "----usus----ususbsbsauauusususususususususususususus--caca--------usususususus--------ususususlr"
+    "lr----usususus----lklk----ususususisis----nlnl----usus--------coco------------ggggpkpk--------ug"
+    "uginauauusus----soso----pgusususususususzwzwususauauusus----pgpgusussese--------------usususus--"
+    "--ususfifi------sesenonodedenznzauaunonousususususus--------dkusus----ususususususususususususza"
+    "zaususususzmzmusususususususus------ususususslslususnonotrtr----cocoususususgbgb----pgpggbgbusus"
+    "nznz----usus----usus--------pgpgususususususzaza----------------ususbzbzpgpgusus----fifiususus--"
+    "--usus----ususviviusus--------ususauauusushuhulclcazazusus--------us----ususususususus----ininza"
+    "za----auauusus--------sese----keke--------usususus------------sbsb--------nznz--------usus----ca"
+    "ca----usus----------------------ususaunanapgpg----cacausus----ininsese----ususcaca--------------"
+    "sesegb----ususetdede----usususususususus----ususususzwzw----------------fifijmjmngbobomz----usus"
+    "ususususcdcd------------trtr------------usus--------------------ususphngngpgpg----usus----ususcg"
+    "cgcupgpggtgtususususususususmhmhususauaumz----------------auaubebebebebebe----nznzauaugbgb----za"
+    "zaususpgpgususususususphph--------ieietztz--------mgmgcdcd----mxmx----gbgbimimtrtrtrtrtrininusus"
+    "pgpg------------vcvcinin--------brbrususususususususususususpgpgusus----lklkususinintctcinininin"
+    "----ususlrlrususininininnpnpauau----ususususinintmtmusususususus--------ususjejeininetetusususus"
+    "etet----ininugugfifisrsrmsms--caca--usususbzbzususususususususususphphnpnpusususus--cocococo----"
+    "zwzwpepesxsxpepebrbr----tznpnp--------bwbwfifi----slslcdcd----etetpgpgpkpkinin----ngngpgpgtztztr"
+    "trusus--nznz----ininpgpg----fifikeke--------pgpgzmzmininususususpkusus--auau----seseke----------"
+    "--bdbd----auau----rwrw----pgpgcdcdcaca--------mwmwususpgpgpgpgbzbzpgpgininpgpginincdcdininininus"
+    "usbfbfzmzmpgpgususnznz----pgpg----------------------zwzwpgpgususfifisesese--------mwmw----------"
+    "--zmzm----zmzmzwzwpgpg----zmzmugug--zmzmmwmw----nana--------ngng----fifififi------------usus----"
+    "bfbf----ininusussnsntztznana--pgpgetet----caca----idid----fifi----ininauaujmjm------slslusususus"
+    "zmzmususcacaususususususauau--------kekekeketmususieiein--------usus----ususininzazaininmnmntjtj"
+    "----pgpgusustztz----tztztztz----tztzieieususzmzmtztzza----usus----cacacgcg------------szsz----za"
+    "zaauau----usus------------cacacdcdusus------------usus----cacausus----usseseininususkekekeke----"
+    "fifi--------------------soso----usus--------zaza----ususususdkdk----------lklklkpgpg----pgpgusus"
+    "pgpgsnsn--------pgpgzazaetetpgpgpgpgpgtltl----pgpgpgpg----cdcdtrtr----------------------------fj"
+    "fjusus--------inincdcd----ghgh------------sesezaza------------------------------------fifi------"
+    "----------inin------------ususususco----usus--------usus----------fjfjphph--------azazusus----za"
+    "za----pgdkdkususususcgcg----ususkekekeusususus----usus----usus----usustztz--------usus----ususke"
+    "kecacausus------------ususnonoininetet--------lrlr----npnpususkekeususususgbgbus--pgpg--------za"
+    "zabnbnmymymymymymy--------mymymymymymymymymymymymymymymymymymy------------mymymymymymymymymymymy"
+    "mymymymymymymymymymymymymymymymymymymymymyfifiususususus----mxcocoususcoco----usussysyauau----us"
+    "usauau----usus----ususgdgd--------ususususususususususususususususfrfrusus--------phphlslsususus"
+    "usususususususphphususdede----nlnl--------ususpgpg--------lsls----lslssisisisisisicaca----cosksk"
+    "skskczczczczczczczczczczczczczczczcz----fjfjusususus----azaz----cdcdusus----mxmxseseusus--------"
+    "--------mwmwininusus----zaza----ususbwbwauauususcdauau--------usususususus--------caca--------cd"
+    "cdkekeusususus----kekeinindkdkususzazagbgbgbgbgbgbcacagbgbgbgbgbgbususususus--usus----usus------"
+    "----ususpkpk--------caca--------ususususco--------pl----ususzaususususususpgpgususmymyphphusussk"
+    "nana----zmzmusus--------slslususidcdcdzaza--------caca----gbgb----ususbsbs--------ususususgaga--"
+    "--bebe------------ecec----gngnauau----caca----ususususpgpgusususus----ususininbrbr----lslstztz--"
+    "--dedeususmgmginininin----npnpzwzwzazakikingngmgmgau----cacaususmwmw--------pgpg----cgcgngng----"
+    "zazatoto------------phphususmgmg----pgpgtrtrininususzazakeke----ngngsese----fjfj----phph----mgmg"
+    "fjfjmgmgnpnppgpgususususmgmgkekeco----mgmg----ininmwidid--------usus--------usus----ususcaca----"
+    "ususmgmgauauusus--------inin----cdcdzmzmususgbgbpepepgpgwswscacausus----mxmxkekekikiphph----usus"
+    "----sbsbpgpg--------usususustrtrauaumxmxngng----auauzazaphphaxaxususphphusususususus----usususus"
+    "--------usususmgmg----usus----keke----mhmhusususususususususustmtm--------auaupgpgtztzcdcdugug--"
+    "--ususerercaca----etetzwzw--nznzfjfjususphphlslsszszlklkbzbz--------bwbwgdgdususususcdcdlklkcaca"
+    "----bzbz----cacagagaugugtztzusususususus------------usususususususus--usus----usususus----ususca"
+    "cababababask----ususnpnp--------etet----bzbzususetetususpgpgusususus----------ususcacamymy----us"
+    "ususus----nonoususetet--ususususczczususususususususmgmgusususustctcusus--------ususnanausususus"
+    "dkdkplplplplususfifitrtrauau--------usus------------usus----auauusususus----brbrususpgpgususauau"
+    "ngngusus----ususususususcaca------------usususus--------------------------------glgl------------"
+    "------------etetzazazazanonogaga--------mzbrususgfgfususpepephphususpgpgnausus----ususvnvnzmzmmw"
+    "--------ususususususcacaususbobousususususususususus----usus------------auau----ususpfpf----sese"
+    "mgmg--------------------usus--------pgpgmgmgususususususususauau--------tztzlslsnonozazacgcg----"
+    "nznz--------uspgpg------nanaauau----pgpg----auau----au--------usususus------------usususus----cg"
+    "cgkekeugugtztzzazatztz----auau------------keke----auau--------------------dedeusus--------ngngtr"
+    "truszazaususcaca----tztzvcvczwzw----pkpkinintztztztzcdcdpepeususininisismwmwtztzfjpgpgphph------"
+    "------kekepgpgauau----nono----pgpgnanacacacacainintztz----ususfjfj----kekeusus--------usus------"
+    "------auau----auauau----ususininususfjfj------------nrnrfjfjininpkpkazazususpgpgetetjmjmusus----"
+    "etetetetnznz----zazaususususnpnpususininusustrtrgygyusus----usususususus--------ususnznz----usus"
+    "usus----usususususususzazagbgb----usususususus------ususususininzazafjfjzmzm----ususmgmg--------"
+    "----ngng----------------lrlr--------cdcdbrbr----nunutztzlslscdcd----ususinin----pgpg------------"
+    "--auau----ususnfnfususjmjm----bsbs----sese------cacacacatctcususususbsbsusususus----cacausususus"
+    "----usus----usus----ususususususususcacausususususususcacausus--------usususususususus----ususno"
+    "noncncbfbf----mx----------------------------------pkusus--------keke----zaza----ususauauususnznz"
+    "gbgb----usususususus----usus--------ususpgpg----ngngususca--------ususususcgcg----keke--------ca"
+    "caca----mnmnususkekekeusususus----ususus--------usus----pgpgnanatrtrusus--------pgpg--------usus"
+    "us--------pgpgpgpgauauusususus----bwbwauauususauau----trtr--------ususususphphseseususauaunono--"
+    "----------nana----usussesenonoininididdedengngnanananacacaususzazafifibr--------uskykyususgbgb--"
+    "----------ususdedephphususasas----us----uguginintdtdususbwbwususususususususauauauautznznzusus--"
+    "--brbr----ususpgpg--------usus----inin--------afafusus------------------------usauauususeeeecaca"
+    "----ininpkpkususnpnp----usus----irirusus------------huhu--------tztzcacacacacacausus----ususcaca"
+    "----usus----usususus----usususus----auaucaususcaca----zazanpnpusususususususus----bzbzbwbwzazaus"
+    "usttttusus----nznzskzaza----usus----zaza--------pgpgcacapgpgtctcusus----------------ususcocococo"
+    "coco----vevevevebrbr----bfbfbfbfbfbf----inusus----usususususgtgtususeses----usus----zazaususbfbf"
+    "ususususususfmfm----------------frfrnpnpnpnp----lklkzazausususus----ininusus--------ususskskinau"
+    "aufifi------------gbgb----zaza--------------------mgmg----ngng----cacaauau----------------------"
+    "--plplplplplplplplplplplplplplplplplplplplplauau----usus----usus------------zazafkfk------------"
+    "--cacaususususauauususususbrusus----zazaususcaca----cacaususscscususkhkhghghususbrcaca----cacaca"
+    "ca------mfmfusus--------usus--------tctcusususususususus----cocococophph----nznz------------usus"
+    "----------------mxmxgtgtususlsls----azaz----uzuzususcacausus------------usus----usus----lslsauau"
+    "au--------fjfj----nznz--------ininnpnpininininusususususus------------------mymyinin--------zaza"
+    "usus----us--------ususckckkhkhinin----------------usususus----usus--------------------ususususus"
+    "usususcacacacabrbrususzazapkpk--------frfrususususususbrbr--------usus----isisininususususususza"
+    "za----usus----ususususususus----------------ususpapalrlrcaca----usus--trtretetususknknusus----lr"
+    "lrzaza------------auaucacagbgbusususus----cacaauau----ususususcacausus----ususususususususnpnp--"
+    "--pwpw------seseusus----------------ususususususauau--------usususus----dkdk--------dedeususnznz"
+    "nlnlauau--------ususininususfifiphph----ususzmzm----ssss----npnpnanaininusus----ususpgpg----usus"
+    "nznzzaza------------ususususngng------------phphpkpkininpgpgpgpgusus----shshususcaca----usususus"
+    "----usususus----ususbrbrmpmp----lalaususininusus----mwmwusus----ususususcacatctcusususkeketrtrus"
+    "usbsbsususvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvn"
+    "vnvnvnvnvnusususususususphphusus------phphususpepe----coususmxmx----co----usus--------phph------"
+    "--nonoususnono------------ususphphidididphphjmjm----trtrnpnpcaca----ususususususususbobo----usus"
+    "----brbrpgpgpepefjfj----ususinincocacamxmx----cacacilrlrininpgpgcaca----ususfifi----fjfj----phph"
+    "----usususus----auau----usususus------------usususususnenecacazazaususususus----lsls----fifilsls"
+    "id--------trtr----bwbwsgsgisisususmymyetetzmzmpgpgusustztzzmzmlsls------------us--pkpk----etet--"
+    "------ieie----ususus----usus----usus--------auauauauususslslususetetetinininintztzininetet----in"
+    "in--------usus----pgpg----pkpkphususdedekhkhususususlklkisistrtruspgpgcacapgpgnpnppg--snsn----zm"
+    "zmdkdkininsgzazaauautrtrusususus----bzbzmumubwbwzazaususmymytrtrpgpgvuvutrtr----gygysesedkdksese"
+    "----ususususus----usus----usus--ususcacacacaauau--------mgusetetse----inin------------ususzmzmau"
+    "audkdkdedededetztzusus----nonougug--brusususususustctc----------------usususus----ususgbgbzmzmus"
+    "us----ususauau----ususususususususususususususususbzbzusususususus----usususus--------causususus"
+    "usus----cacainininin----caca----auaugbgb----cacacaususususususcaca----usususus----usus----auauus"
+    "usususdkdkauau----------------ususcacausus----usususus--------ususususseseseseseseusus----nono--"
+    "------usus----------caca----------ususususcacacacakhkh----usus----bwbw--------phphcacausususpkpk"
+    "----sasa----usususususustztz------caca----usus----casemymyususauaughghomomininusussjsjnonona----"
+    "inin--------gbgbcacaauususususgbgb----------phph----cocotztz--------usus------------nznznene----"
+    "mymyececnznz--------ghgh----ususpgpg--------ususeeee----ghgh----mgmgusususus----fifiauau----idid"
+    "----phphtztzauau----usus----npnp----pgpg------------auaupgpg----eeeeuzuz--------nznznznzpgpg----"
+    "ususlrlr----ususgbgbususpgpg----trtr--------cacausus------------usus----ususbfbf--------pgpg----"
+    "--uscaca----vgvgusususussdsd----mzpgpgususpfpf----cacaususususzazalslslalanznzauau--------------"
+    "----------usus----inindkdkzazausususususus----usus----ususcaca----------------cmcmususnznz----co"
+    "copgpgcacacacamhmhpgpg----mpmpjmjmususetet----inin----lsls----ususauaucacacaca--------trtr----nz"
+    "nz----pgpgpgpgusususus----us----vuvu----pgpgauauauau----pgpgugug--------sese--------bfbf----trtr"
+    "usus--------usususususususus----ususususususususititcosese----nonousususususus--------mgmgpgpgmg"
+    "ususnana--------usus------------usususususus----etet--------auauususcdcd------------usus--------"
+    "tmtmfjfjususususininusususus----ususususzaza------------------------uske------------zazazazapgpg"
+    "brbrse----------------brusus----vcususususususususpgpgzazausus----afafpgpgtrtr----------------ag"
+    "agfifirurufofo--------usus----usususustrususknknususidid------------fifisesefjfjfjfj----inininin"
+    "ususco----ususlvlvmxmxdedededededededededecacausus----cacausus----ususbrbrususngngzwzwcacaususlk"
+    "lk----ususinatatininbr----uyuy--------uauamxmxkekephphususvgvgzazausususus----usussese--------nl"
+    "nlczczmgmglrdkdk----zazazazazaza----ususususghgh------usussdsd--------nznzusus----nznzkekefjfj--"
+    "--auaucaca--------usus----ususgbgbusususnanapkpk------auau----pgpgpgpgpgpgininetetus--------auau"
+    "----usususauau----gbgbauau----ususususususpgpgpgpg--usus----ieie----usususususus----ususpgpgusus"
+    "usususususus----------------ususususususidid----usus--------usus--------zazausus--------bsbsusus"
+    "----nzusus----auau--------usususususus--------ususpgpgususnznz--------nznznznzusus----usus------"
+    "------cacausus----ususnznz----auau----cacaususususgbgb----usus----usususususususususususus------"
+    "--usususususususususususususususke----usus--------nanausus----cacaususususcacaususususususususus"
+    "us----pgpg----usus----au----------------auauzaza----pgpgusususus----usus------------------------"
+    "--------gbgb----frfrlalalala----ususng------------pgpg--------sbsb------------fjfj------------sl"
+    "slpgpgusus----pgpgfifingngpgpgininusus----pgpgauau----usususus----ususazazbfbf----trtrzmzmphphus"
+    "us----ususcocoazazususamamsksrsrhrhrhrhrhrhrhrhrhrhrhrhrhrhrhrhr----grgrtrtrtrtr----cycygrgrcycy"
+    "cycygrgrgrgrgrgrgrgrgrgrgrgr----grgrgrgrgrgr----grgr------grgr--------grgrgrgrgrgrgrgrrsrsrsrsrs"
+    "rsuauagegemnmn----rurumnmnkzbybybybybyby--------ruru----rurururu----ruru--------rurururururu----"
+    "----rurururururu----rurururu----ruru--------------ruruuaua------ruru----ruru----ruru----jpjpruru"
+    "--------rururururururururururu----ruru----rurururu----rurururu----rurururururu----rurururu------"
+    "ruru--------rurururu----rurururu----rurumnmnrurururururururu----ruru----mnmn----ruru--kzkzkzruru"
+    "bybykzkz----mnmnrurumn----rurururururururumnmnrurukzkz----kzkzruruuauarurukzkzrurururururukzkzbg"
+    "bgbgbgbgbgbgbgbgbgruruuauarurururu----uauarurumkmkrurukzkzrurururururururuuauarurururururuuauaua"
+    "uauauauauauauauauauauauauarurubybyrurukzkz----rurumnmn----mnmnkzkzkzkzkzkzrurururukzkzuauarurukz"
+    "kz----rurukzkz----rurururururu--------kzkztjtjtjtjrurukzkz--------mnmn----mnmnmnmnkzkzkgkgrurumn"
+    "mnrurugegegegeamamamililililililjojoililililililililililililililegegpkpksasatntnegeg----iqiqpkpk"
+    "iririrpkpkpkpkpkpkpkpkpkpkpkpkpkpkpkpksasaafafafafaftjtjafaf----afafpkpkpkpkpkpkpkpkpkpkpkpkpkpk"
+    "pkpkpkpk----pkpkiriririririrafafiriririririririririririririririririririririririrafafiriririririr"
+    "iriririririririririririririririririririririririririririrafafiriririririririririririririrafafirir"
+    "iriririrafafiririririririririririririririririrafafafafirir----afafirirafafiriririrafiriririririr"
+    "irirafafiririririririririqiqpkpkiqiqaeaeiqjojopkpkpkaeaetdtdeg----tdtdlylysdsdlylysdsdsasasasasa"
+    "sabhegeg----iqiqaeaeyeyeegegsdsdegeg------------sdsdqalblbsayeyeyeyelylyaeaesdsdegegegegsdsdsasa"
+    "aeaeegeg----sdsdegeglylysasasasalylykwkwililsasasasasasasasajojotntnegegiqiqiqiqtntnsasalylyegeg"
+    "----iqiqsdsdtdtdtdtdyeyesasasasasdyeyetntntntnomomtntndzdzsasadzdz----sysysdsdsdsdomomsasaaeaeae"
+    "aeaesysyaeaesdsdaeaelylyegegsdegeg--------egegtdtdomomyeyetntnomomyeyeaeaelylytntnlylysayeyesasa"
+    "sdsdjojo--------egegomom----sdsdsosoiqiqsdsd----lylylylyegeg----lylylylytdtdsasasdsd----lylysasa"
+    "----sssspkpkpkpkpkpkegegegegafafsamvmverernpnpnpnpnpnpnpnpnpnpnpnpnpnpnpnpnpnpnpnpnpnpbdbdbdbdbd"
+    "bdbdbdbdbdbdbdbdinininbdbdbdbdbdbdbdbdththththththththththththththththththththththththththththth"
+    "thththththththththththththththththththmmmmththththththththththththththththththththththlalaththla"
+    "lalalalalalalalalalalalammmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmm----mmmmththmmmmmmmmmmmmmmmm"
+    "mmmmmmmmththmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmkhkhkhkhkhkhkhkhkhkh----krkrkrkrkpkpkrkrkrkrkrkr"
+    "krkrkrkrkrkrkpkpkrkrkpkpjpjpjpjptwtwcncncncnjpjpcncn----jpjpcncncncnjpjpjpjp----cncncncncncncncn"
+    "cncn----jpjpjpjpcncncncncncncncncncnjpjpcncncncn----cncncncncncncncncncncncnjpjpcncncncnjpjpcncn"
+    "cncnjpjpjpjpjpjpcncncncnjpjpcncncncncncn----cncncncncncncncncncnjpjpjpjpjpjpcn----cncncncncncncn"
+    "----cncncncnjpjpcncncncncncncncncncncncncncncncncncncncnrurucncncncncncncncncncncncncncnjpjpcncn"
+    "cncncncn----cncnjpcncnjpjpcncnjpjpcncncncncncncncnjpjpcncncncnjpjpcncnjpjp----jpjpcncncncncncncn"
+    "cncncncncncncncncncncncncncnjpjpjpjpjpjpjpjpcncnjpjpjpjp----jpjpjpjpjpjpjpcncncncncncncncncncncn"
+    "cncncncncnjpjpjpjpcncncncncncncncncncncncncncncncncnjpjp----cncncncncncncncncncncncncncncncncncn"
+    "cncncncncncncncncncncncnjpjp----cncnjpjpcncncncn----cncnjpjpcncncncncncncncncncncncncntwtwcncnjp"
+    "jpcncn----cncnjpjpcncncncncncncncncncncncncncnjpjpcncncncncncncncncncncncncncn----cncncncncncnjp"
+    "jpcncncncncncnjpjpcncncncncncncncncncncncncncncncncncntwtwcncncncnjpjpcncncncncncnmomocncncncncn"
+    "----cncncncncncnjpjpjpjpcncncncnjpjpjpjpcncnjpjpjpjpjpjpjpjpjpjpcncnjpjpjpjpcncncncnjpjpjpjpjpjp"
+    "cncntwtwcncncncncncncnjpjpcncncncntwtwcncncncn----jpjpcncncncncncncncntwtwcncncncncncncncncncncn"
+    "cncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncnjpjpcncncncncncncncncncncncncncncn"
+    "cncncncncncncntwtwjpjpcncncncncncncncncncnjpjpcncncncncncncncncncncn--------cncncncncncncncnnpnp"
+    "cncncncnjpjpcncnjpjpcncncncncncncncncncnjpjpjpcncnjpjpcncncncncncncncncncnititititititititprmxmx"
+    "esesesmxesesithudedefrfrfresesptptptpttrtrmeitesmttrfresustrtritfrfresfrfrfrfrfrptdeuscycymkilil"
+    "nlrurururuususnlnlusnlususususususustrusususususustrusbdruruderuususruususesesesesnlltcadechdenl"
+    "nlnlnlnlusnlnlusnlnlitesesesesnlusgbusustrcadeusdenlghnldeazphcausdkdenldedenluslvfiusgbuscanlde"
+    "usnlusgbcaauusdenlhusgseusdeusgbnlusdedkgbdedededededededededededededededechdedededenlfisesenlde"
+    "ususususfifinlnlususususususfrfrfrusnlnlususgbnlsecadefiusinienlnldenlnlituspresusnlbeltaunlgbgb"
+    "atfrfrbefrfrfresesptusususbresdeusnlusnlnlgbnlhuusgbususcadeusdeusgbnousususususgbdeatchdededefi"
+    "fiususchgbgbgbusgbphusnlnlusde--dededeusbeusnonlnzdenlltgbususseltususltcagbnlusfrczususdenlusgb"
+    "usususnlusnlusnlgbgbdedebeususgbususususczusnlgbususdeusususnlusnlhuusususdenlususgbcaususdebenl"
+    "nousususnldeltaunlhugbusushuusgbnlusnlnlcanlusdeususnlusususususususcauscausnlnlphusltltdedegbus"
+    "gbusgbgbususgbusdenlgbdegbdecausususdeussenlnlnldenousaunogbususgbusisnogbczbedenldenlnlnlususus"
+    "nlbeusgbuscaauususnltrusdenlczdedeusdenlususususususususgbgbusususphusgbususususbeuscausususgbus"
+    "gbususbeusususiegbusususdededededepldeatatatdedededenlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnl"
+    "nlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlbenlbenlbenlnlnlbebebenlde--ususdkdeus"
+    "usbenlmyususnlnlnlusnldedeuscaususususususcacaususdegbnlusieusdeusdkusususususgbgbususnlususgbde"
+    "usususcaususususdecaususgbgbususcadeauususgbbadededegbdeusdenlusususususgbususgbusnlnlvnvnvnvnvn"
+    "vnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnbesggbusgbcznl--ususnlusususseuscacaczsk"
+    "siususgbcaususgbgbusususauususususnldeusgbcaczusgbgbusdeuscagbusususgbus--ususgbgbusczgbgbususus"
+    "auusnlustrususdkgbususgbgbusgbususnzusususususgbsggbdenzgbgbgbgbuscacagbtrtrbanlususussgususgbde"
+    "gbgbbenluscaususususususususcagbusdeusbegbauusususgbgbcanldeususnlususususgbgbusgbususnlusgbauus"
+    "usgbgbususususfiususususususgbcabausususdkuspldehrnlnlgbuschusiebenlbeususgbseltusdephnlcausnlbe"
+    "aunlbenlnlnlbegbusmxusususususnldkgbbegbusususususdededecaususplgbnllvnldenldecnuscanlnlgbnlnlus"
+    "seczatnlusnlnlnlnlhrususdedededeatdedeatatdeatdegbnlnldedeusgbaudeusbedeususnldenldedededededede"
+    "frchususnldksenlbaltususususcadenlnlusnlhunldeususnlgbgbusinmyusdenlnlcz--dklvusus--ususgbususus"
+    "usususcausususdededenlnlus--nlusnldkusbanldeatdededededededededededededechdededededeusdenodedede"
+    "dededededededededededeusdecanosgususdedeususdedenldegbgbdeususnldeauususdknldedefrfrfrfrnlatatde"
+    "defideesgbushuhuusdeseplplplczphusnlusdeatbenlauusgbgbdedesideusnzdeusdeusgbusauiebeietrusdedede"
+    "chchusdenzusbanonodechusaufiusczusususdkgbdedeusdeususauusgbusdededenlbephususususususususgbnous"
+    "noususususususususususususususnlatnlusdkbedkdkseseususus--usdedeatdededkususususdedededededegbde"
+    "causdksisenlnlnldelrbalvtrnlusususgbsesenonodedenldeitcagbnlatgbgbusgbususususltnlususnlltususus"
+    "beusauuscanlususususgbususcadenlnldeusdeusdeususdenlnlususususususdeauuschbaaude--ususgbgbususde"
+    "aubadedeuscausdedeususaucadenlnlnlusnlnlusnldeusususitususususususcagbieususususususususieusdeno"
+    "czdegbnlgbgbuscanlnlnlnlnldesesebegbdedegbnlnlnldededededededecndedeatnldeustrnlnldenlnlnldedenl"
+    "chsedefiuschgbfiusdedeususnonlnlusdedegbgbdedededeusnlnlusnldenltrnlusnochchnlnlnlnlususnlususus"
+    "gbusususnlgbnlususdedeususnlnldenlnlgbauauauususuzusdenlnlnlnlbedenldedenldenldeususdeusdeususgb"
+    "usnlgbusnlnlusususdenlbeusdeususdkusnodeusdededkfidenlgbusgbuscaususnzusususususnlusdedenldedecz"
+    "usdededededeaunlusdedecaseusnlnlnlnlatdedegbnoczdenlusnoususdegbchdededeususdeusdeususbenlusnlnl"
+    "cadedededeususnlusnodeusususgbingbsiczczdegbusususnldenlgbfidecagbdeusnznlchusdeususgbusgbuausus"
+    "usnlusdeuseeuanlnldedephusnlnlboususaunlatardeatatdeususcaususlkgbusgbcausnlnldegbieseususfiusgb"
+    "decz--nlauususususnlnlnzhrdedemymymymymymymymymymymymymymymymymymymymymymymymymymymycaususgbnlnl"
+    "nlnlnlnlnlnleecadenlfiusususnldeususididididididididusdknlnodeusczczsgususnlnlnlnlnldechususnlnl"
+    "ususususnlnlaunlususcaauususselvesdeusfiusgbauusususnlusnldedededenlnlhueechatnldedededeatdenofi"
+    "lkbehrczskczcznodenlsiltchnlltltfifidedesisicznldesenlnlnlnlnldedeltzwgbusnlfinldebzusdeusnlnlde"
+    "eenlususnlususdedenlgbiegbgbusgbgbgbusgbgbnllkususdenlchfiusfigbfiusplplplplplsedehudenlatnlatnl"
+    "usdedegbusdkdeusdeusdenlnlnlnlhudedenlnlskdkdkdededecwnlnlcwnlnldedeeedenlfifichhunldenlbahudede"
+    "denldedeskdedenlnldeususnlbabenldkdeeebedebebenlnlfidefidksefiaudedeussehugbdesemtmtbeusfrnlnlde"
+    "czczususgbgbnldegbusususususdegbnlususususdenldkdededeseusnoczaufifiususgbnldeususdeczczczczczus"
+    "ltczusgbcausususdedegbususgbgbnldededeususnlbeusdededeseusgbdedeauusdeusnlfidededeususus--usnlcz"
+    "ususdesenlltdeienlnlussedkgbusdkusdeusnldegbuscausbecausltesdededegbauusdenlbenldedefidedegbgbau"
+    "auususususcausiechchdeusdegbgbnlbecanlususnlficadeusususususghgbusnldebadededeatgbdebedeplsenogb"
+    "deltususususus--ususnlltnlnlnlnlnlusnlcagbusaunlususgbmmdeusgbusdededededededededededededededede"
+    "dedededededenlbephnzsakemynlczlkusussgczdeusususphnlnlnlusushuhunldededeusnlnlusususgbgbdenlgbus"
+    "ususnlgbusususdeusfiusnlieczhrdedenlgbusususnlatdedenlusususauusususususususbebegbusnlbededeiebe"
+    "ususgbdeustrbeusnlsiesdededegbcausususcaususususgbusfiusususususgbcausaubeusnononousdeincacausus"
+    "chdedecznlnlusbenlnldededeuschgbgbusususususushuczcanlususauususdenlusgbdededeusplplplplplplrspl"
+    "plplplplplczhrhrczczplplplplplplhrrsplplplplplczplplplplplplplplplplplplplczplhrplplskplplplplpl"
+    "plhrplczplplplczczhrplplplplhumeplbamebaplplplplplplplplplplbaplczplplplplplplczplplplplplplplpl"
+    "plplplplplplplplplplplplplhrplplplhrplczskczplplplplplplplplplplbauaplplplplplplplplplplbaczplpl"
+    "czczplplplplplplczplplskplczgbgbusauuscausdeusatdenlnlbededeusfidedededesedkchnlnlgbatusgbnldeba"
+    "fifinousgbnlnldenlgbgbinbecznlnlltusususdedededeusususnlusczgbusdepldenlusnldeltdenldeusnlnlusch"
+    "dededegbauususieusphusususususgbusgbgbusgbcaususususnzgbususatususdededebenlnlnlnlnlnlnlnlbedegb"
+    "trinusnldenldedenlnlbebeatatdededeseususseusficausususususgbgbusnoczczcznlclarcagbgbczdksenoieca"
+    "usdedededeuslkdknldededkdenlusususdenodebeseusbaaugbphphusnzgbususususisnlusatusnlnznzusnlnlnlnl"
+    "nlnlusnlsgususussecanldenltrgbgbdedeususnlnlnlnlbegbgbgbusfrgbnlcabeusnlnlususltususltczgbnlltus"
+    "seltphusnzustruseede----gbusdeusgbbyusdeaueseseshrusesfrfrfrbefrfrfrfrbefrfrfrfrfrbefrgbusnlphbe"
+    "nluscaususcadefrdeususbagbusgbgbususususgbgbhunzusingbusgbnlhuusdededededeusnlaunlnldenlnlnlnlnl"
+    "filtusmxusdenousususficahrnlusnlczusussiushrrororororonlususfiususlubefrfrfrfrbedefrfrfrfrfrfrch"
+    "frcachbefresfrfrcafrbeesesbefresbebefrfrfresbebefrfrfresfresesesbebeesesfrbebefresgpfresesfrdees"
+    "frbefrfresfrfrfrbebefrfrgpfrfresfrfresbebefrfresesfrfrfresesesesesbebeesbeesfresfrfrfrcafrusbefr"
+    "befrbefresfrfrfrbefrfrfrbefrchbebebeesesesesbebebefrfrfrbebefrfrbefrfrfrbebebefrbebefrcamqbefrfr"
+    "frchfrfrbefrfrfrfrfrfrfrfrlufrfrfrfrfrcacacalufrfrcafrcafrfrcacacafrbefrfrcafrfrfrfresfrfrfrcafr"
+    "becacafrfrfrfrfrmqfrfrbefrfrfrfrfrfrfrbebebefrbebefrfrfrfrcabefrfrfrfrfreslucalucabebefrfrfrfrbe"
+    "frfrfrbebebefrgbbeptptitititptitbrititvaititesptesbrbrbrptesesptbresesptptbrptptptptptptptesitit"
+    "ititititititititchvaitititvaititititititititititbritititititititititititvaititptptbrptbritptbres"
+    "brbrvaititvabrbritvavabrptbritbrbrptitesitbrptesvaititititptvabrbrvaitptitititititvaitvaitititit"
+    "vaititvaitititititptitititfrfrfrususdeca--causnlbenlfrdeususdeczusmxgbgbdedecagbaucagbnlnlnlnlnl"
+    "deskdkussiecuyvevepresclprpaespearpeclclpraresecprpaespresesesesesesesesesesesesbresesuyeseseses"
+    "esesaresesesesespaesesesesespresescoespeesesgteseseseseseseseseseseseseseseseseseseseseseseseses"
+    "esesesecespraresardovearpepypresprboveptcousveesdoclcrprprprclesveprprcldoesesarprpresvearprboco"
+    "ecdopeesesespeclprpresesarespeprprararpresususgbdeatchnldeususgbfiaunluscnchusimusususgbgbcagbau"
+    "uscagbcaiephfinldeateeusdeusfinzhudeuscadkususnlususchltusdeususcagbgbus--usususgbnlgbusnlnldede"
+    "atnlnlfieschnlnlcagbususdedechdededefrdededededegbsiususususgbusnldenlnlnlnlususdededebedkgbnlus"
+    "ususgbgbususususnlususussgusususususususdebadededenlusdedenophdededeusususnliecadeaunlauusdedede"
+    "deatususgbgbusnlnlnlnldedededededededenousgbusdegbnlnlusltdededededeusdeaufiuscaususususdedeusdk"
+    "fimyuslvdedeususieususesphususdeauussededenophusinusfinousfidedecahrdkususgbusdenlnldedebededede"
+    "nlnlusdenlchdedededenlnldedededededeusdedededeususnlatdecabenlnlnldeususususdededededededechdede"
+    "dedegbgbususgbususaucausaucaieiecadededededetzusdegbsiususussiusdegbusphusususgbususgbgbgbgbusus"
+    "ususgbususgbususgbushrusdedeincheeusltfigbinusauusnlusbedenlnldededenlnlnlnlnlbebebebecaltchusde"
+    "senosenosegbusdknocadenlusgbrubedeusnlnlnlnoususususnlusususnlsesenlnlitgbbmusdeeeeeusususususus"
+    "ususgbusnldedenlusnlnlnlauatbeusnlnlnlnlnlnlnlnlnlnlnlnlnlbenldechususususususdenlusnlnlatatnlse"
+    "dedegbsedegbusususauuscaususskusnlnonlusnlczdedededeatdenldededeusgbnlusgbdedeusgbgbusususdkauus"
+    "seczdeusdenoatdebededededeusdeususgbususususgbgbdkgbnldknousgbusususdegbgbczdehuhuhuhuhunlususlt"
+    "fiusiededededededededededededededededededededededededededededededededededededededededededededede"
+    "dedededededededededededededeusatatnzgbnlusautrdedeltltcausnzclfiusdegbdenlsegbusbefibenldededede"
+    "usbmususdeusnlusdedegbdeus--deusnlususususususgbgbususchchusgbchdkusltlvnlusgbhuhudesenliebenlee"
+    "usfinlgbusgbnlsedknlnldegbgbusdedenlltgbdecznousususdeususnlbebefiusgbnlfifiushuusususnlgbczatde"
+    "sedeatusnlbeususususdeususatseusususdedechusususususususgbltusnlnlltnlnleeltltgbfinlusbenlususus"
+    "lvfiusbeineenlltnosenogbdenlnldkfibebeusnousnlususitititititfrlubefrbefrfrfrfrbefrfrfrfrfrfrbefr"
+    "frlufrfrfrfrrededefrlufrfrfrfrfrfrbebefrfrlufrfrfrfrfrgpbefrfrfrfrfrbeludebebebeesesesesesespyar"
+    "desisidesidedefrdechptptbrdkusbeaugbgbnlarlvnlnlfrfrfifiusczeedkcaususltusfinlusinnlnlbebenlnlnl"
+    "cznldedeatnlbenlnlnlfifiltusnlusususdeusnlusbenlusaudegbususdeusaudeusgbususususnlnlusgbgbdedeus"
+    "usnldeususgbbegbususususgbusususnlnlusdedededededegbgbususdeusgbaubededenldedededeusdeususauusus"
+    "ususususnliegbnlnlnldenzcacausnlgbchnlgbusgbusususplpldedenldedededenlnldedenldeususnlususususus"
+    "auuscausususdeususgbusususususnlusdeusgbusdedegbnlchdedeusnlaunlgbususaudenlnluscndededegbnzusnl"
+    "ususaugbgbautrcafinlnlplplushultnlbephnlnlczczczskatcnczdenlnlnldededeltczsiatatdecndenlnlnlnlbe"
+    "ltdenlgrgrgrgrgrgrgrgrgralalgrgrrurubgruuabgrubgrururugerurururururursruruuarsuauauarubgrururuua"
+    "uarururururururuuauarubyrururorurursrurururuuabyrururururu--rurururubgruuarumkrurururubybyrururu"
+    "rurururururururuuarururururururuuauarsrsbgrursrurururururuuaruuauauauarubgbyrurururursrurubybyrs"
+    "rsrursrsbgbgbgrsmkrursrururursrsrurururururururururubgruuarsuarurururuuauaruuarurursrururubyruua"
+    "uarurururuuarururururururursrubguarururubyuarururururururuuauauaruruuauarururururuuarubyrugegege"
+    "gegegegegegegegegeamamilililililiqiririririqiqiqiqsaiqiqiqaeiqlbpsdziqdzdzlyirbdbdbdbdbdthththth"
+    "thththththththththththththththththththththththththththththththththththththththththththththththmm"
+    "mmkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkr"
+    "krkrkpkrkrkrkrkrkrkpkrkrkrkrjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpcnjpjpjpjpjpcnjptwjpjpjpjpjpjp"
+    "jpjpjpjpjpjpjpcncnjpjpcnjpcntwjpjptwkpcnjptwtwtwjpjpjpcncnjpjpjpjpcnjpjpjpjpjpjpjpjpjpjpjpjpjpcn"
+    "jpjpjpjpjptwjpjptwjptwjptwjpjpcncnjpjpjpjptwjpjpjpjpjptwtwcnjpjpjpjpjpjpjpjpcncncntwjpcnjpjpcnjp"
+    "jpjpjptwtwcncncnjpjpjpjpjpcnjpjpjpjpjpjptwjpjptwjpjpcnjpcnjpjptwjpjpjpcntwjpjpjpjpjpjpcnjpjpjpjp"
+    "jpjpjptwjpjpjpjpjpjpjptwtwjptwjpjpjpjpjpcnjpjpcncnjpjpjpjptwjpcnjpcnjpjpjpjpjpjpjpjpjpjpjpjpcncn"
+    "jpjpjpjpjpjpjphkjpjpjpjpjpjpjpjpjpjpjpcnjphkjpjpjpjpjpjptwjpjpjpjpcnjpjpjpjpcnjpcnjpjpjpcnjpjpjp"
+    "jpjpjphkcnjpjpjpcnjpjpjptwjpcnjptwjpjptwjpjpcnjpjpjpjpjpjpjpjpjpcnjpjpjpjpjpjpjpjpjpjpjpjpjpjpjp"
+    "cnjptwjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpcncncncnjpjpjpcnjpjpjpcnjpjpjpjpjpjpjpjpjpjpjpjp"
+    "jpcncncnjpjpjpjpjpjpjpjpjpjpjpcncncntwjptwjpjpjpjpjpjpjpcnjpjpjpjpcnjpjpcncnjpjpjptwjpjpjpjpjpcn"
+    "cnjpjpjpjpcnjpcnjpjphkcncncnhkcnjpjpjpjpjpcncncncnjpjpjpjpcncnjpjpjpjpjpjptwjpcncncnjpjpjpjpjpcn"
+    "jpjpjpjpjpjpjpjpjpjpjpcnjptwjpjpcncncnjpjpjptwcnjpjphkjpjpjpjpjpjpjpcncnjpjphkjpjpjpcncncnjpjpjp"
+    "jpjpjpjpcnjpcnjpjpjpjpjpjpjpcnjpjpjpjptwtwjpjpjpjpjpjpjpjpcnjpjpcnjpjptwtwtwjpjpjpjpjpjpjpjpjpjp"
+    "jpjpjpjptwjptwjpjpjpjpjphkjpjptwtwtwjpcnjpjptwcnjpjpjpjpjpjphkjptwtwtwjpjphkjpjpjpjpjpjpjpcncntw"
+    "jpjpcnjpjpcntwjpjpjpcncnjpjpjpjpjpjpjpjpjpjpjpcnjptwjpjptwjpjpjpjpcntwcncnjpjpcnhkjpjpjpjpjpjpjp"
+    "hkcnjpjpcncncnjpjpjptwjpjpjpjptwjptwjpjpjpjpjphkhkhkhkjptwjpjptwjpjpjphkjpjptwjpjpjpjptwjpjpjpjp"
+    "twjpcncnjpjpjpjpcncnjpjpjpjpjptwtwcnjpcnjpjptwcncngbnlatnlgbnlnlnlnldechdeesitnlnlnlfisedebesgus"
+    "dededenlbenlnlnlfrfrfruznlatatatfrfrfrfresesptesnlbreszazabeususgbnlhucabedenlfrusnlplnlnlnlbede"
+    "atnlnlnldedegbgbusuzuznlnluzuzdeusnlnlbebenlpldepkdeitgbgbgbdenldeusgbnlininnlnlnlnlnlnlnlnldenl"
+    "ususesesesbresfrfrfresesesfrfrfresfrfrcafrfrfrnlfrfrpafresfrfresadesgffrbrbefrfrfrfrfrclfrclfrfr"
+    "clfrclclbeclfrititititititititititititititititititititititititcagbusgbitititusnlusususbeusususnl"
+    "gbbebagbpegbdesefrususnlaubefrfrfrgbptptbeitdeusnlhuuzbebduznlsenlgbnlnlnlnlltnlgbushuskdegbhunl"
+    "esnldededededegbgbnlnlronldenlfrdkgb--desedehuitititnldeusdeititusdkatusfritgbgblvnldenldeplsemx"
+    "iedegbusgbdenlgbdedesidenlusatplnldechsedebebenlusnldenlnlnlnlnlfidenldehudedegbnldenlnldebenlgb"
+    "nlnousdeususususdeusnldeuggbgbgbfiiepluzfifiinfibedknlbebebenlbebenlbebebebenlnlnlnlbebebeplbypl"
+    "plplplplplplplplplplplplplplplplplplplpldeuzuzuzbedeatuzfihuusgbfinldebefififisecanldeatnldenlnl"
+    "nlnlnlnlnlfinldedefififrlufrfrfrfriegbnldedenlnlusnlusbefrfrnlfrfrfrgbusdefinlbebenlusdegbdedeie"
+    "nlbenlgbususlvnlhunlatcaindealgbnlnggynlczdedenlgbnlususnlgblvdenlplgbusdededefisenlpknlitititit"
+    "ititititnldenlfibededegbgbnlnlnlnlnlnlnlnlnlbenlnlnlnldededeus--usdefrpldkdedeususdedecanlnlnlnl"
+    "nlgbplnlnlzanlnldenlnlnlgbltinnlgbfrfrhunlitnlnldenlnlfrfrfrfrfrfrfrfrfrfrcaititnlusnlnlnlnlhrde"
+    "hrplgbfitmuzuzusnldenl--defirorogpesgbnl--dechgbcanlbeesbrbrititititititititaoesbritesbrbrititit"
+    "coimusgbnlititititnlnldededepliedegbfifigbdedefiitficauscacausgbltuschnlbenlbechdededededededeat"
+    "ususdeatatitnlesesesitdeusgbgbuzuzcasedeitdenlnlinnldknlplplplplbyplplplplplplplplplplplplplplpl"
+    "plplusnlsegbgbvnvnvnbefrfrusgbdedenlusgbcadedegbplbeusnlnlgbdededesedegbbedegbfiplusbegbididuzgb"
+    "figbcausnlmydenllvhugbgbgbgbnlitesdecacacaatdeczclclbrbralfrfrfrfrbenlnlgbdecanlgbsebenlnlfifinl"
+    "benldebefibefibeltnlnlnlnlfrczbe--usnlbeetgbplnlnldenlnlnlnlgbgbdenldebegbnlnlgbgbnldenlgbnlnlbe"
+    "cznlbenlplnlnlnlnlnlnlnlbenlatatnlnlgrgrtrrubyruuzuzrukzkgkgbyhrkzby--uauauzkzrukzruruuzkzrsrsru"
+    "rurursrurubyuzruuzuauzuzkzruuakzruruuzbgrurubyruuauzru--ruruuzuzruuauzkzuzrurururu--rurururubyru"
+    "ruuarurukz--rsruruuauaruruuzru--uabyruruuzrukgrurukzuarurukgrubybyruruuaamamamamamamamamamamamiq"
+    "egomsdaeegaeirpkththmmkrcnjpjpjpcncncncncnjpcncntwjpjpcncnjpjpcnjpjpjpcnjpjpjpcncnjppnpwlstrusus"
+    "lydebrustrtrtrfitrwstr--trtrtrtrtrtrtrtrtrtrustrtrtrtrtrtrtrtrtrphdeinzainpttrtrzachchchchamtrtr"
+    "trngustrtresesestrtrtrtrnztrtrtrtrestrattrngtrtrcncntrtrusiqininusrororororoususmama--mamafrchfr"
+    "cd--necmgnnenefrfrfrfrfrfrfrfrfrfrfrfrfrgnfrnegacafrfrfrfrfrfrfrcifrfrfr--cafrfrfr--frbecmfrfrfr"
+    "cgfrfrfrbefrgffrfrfrfrfrfrfrfrmlfrcmfrfrfrfrfrfrcafrfrfrfrcafrfrfrfrchitfrfr--frfrbefrfrfrfr--ma"
+    "mlhtcmmlfrca--cama--macamafrbrbrptptptptptptptptptptptbresptbrbrptesptptptaoptptptptptptbrptptpt"
+    "ptptbrptptesptptptptbrptesptptptbrptptptptptptptptptptptptptptptptptptptptptptptptptptptptptptes"
+    "brptptptptaoptptptptptptptptptptptbrbradustruscatrtrtrtrtrtrustrididididididididididididnztrtrtr"
+    "trtrtrtrtrtrinusustrususdezazaustrustrtr--trtrtrusmedeza--czauusitididtrus--ghtrus--ustrtrustrus"
+    "trustrtrtrtrauuslkususlktrtrtrtrtrtrarararcafrfritcatrpkususincnatfrartrtridtrauusca--us--trtr--"
+    "--usususauus--aucaaudeususustrusususususususdetrvnvnvnpkzatrauususustrtrtrtrtrtrtrtrtrustrindetr"
+    "chitititchchititchchchitchchititchitchititchchititititchititchititititititititititititititchchit"
+    "ititititititititititititit--bwtrtrararararararararatustrzatrustrdezausintrususfrzatrzaauatdeusco"
+    "pl--ustrclesesesesesesesesesesesesesptmymymymymymymymymymymymymymymymymydeusesesesesesesesesptes"
+    "eseseseseszacatraugbdetrtrtrtrtrde--usususususus--nabwcazauspaustrtrtrusittrtrtrhuetetke----trtr"
+    "trtrtrtrautrtrtrtrusususususususzauspktrtrtrtrtrtr--trtrtrtrtzsdtrtrususfiusustrtrtrtrdeustritde"
+    "zadesitrdedeususususgbczcz--us--trininngtrtrtrtrzatrincausustrusinplplplplplplplplplplusplususus"
+    "caautzautrcntrzainuzugintrtrtrtrtrtrtrtrtrtrtrintrsydetrngintrtriqtrtrtrtrtrtrmyfitr--ustrtrushu"
+    "ltintzzatrugzatrtrhutrtrtrtrlttrtrfiattrtrtrtrlktrtrtrtrtrghchchtrdezacztrtrtrtrtrtrtrtrtrphesph"
+    "gbchusus--caususinuslkdedededededededededeus--demyusus--causususus--ustrcnphtrinintrtrinauustrus"
+    "auauuskelkinlsdedeusustrustrustrtrtrfiustrtrususin--hr--uszapkuslkustrzauscaususbdinustraugetrtr"
+    "triqusinugtrzazatrusususususususvntrin--usususlkuszazausus--trususdenzdezanatrtrinseusugzatrustr"
+    "ususintzitesphinususinnzustrintrestrbrininitfiususcalvtrlklsittrroczmxarpaesesesesesesptesescoes"
+    "esesesesesesesadmxadescoesesesesesesesesesesmxmxmxbodoclaresesesesardecldedetritzacnaz--catrusin"
+    "--lklkusdepkdeus--usinpeecbrvecoco--pruycz--ususbrbruscaus--usdefrdeus--usususfrtrusptespteslkus"
+    "trtrintrtrtrtruscauslatrdeitattrfitrusinauittrtrtrtrtrususcnautrusinthincztrtrtrzaindeauusgbatat"
+    "deauidididczchatdechdedededededededededeusususplplczatnlnlnltrtrpkintrtr--trtrusgbustrtrdededede"
+    "dedetrtrgbetustrtrususdelabwvnusinushuususghtrtrtrususitzauszausketrususfibrtrtrtrlktrbrbrpybrbr"
+    "brbrtrtrzazarutrfi--trlk--skczczczczczczitczusinauuspkchphdeatatatdeatlsusbedeususgbususdeauzaau"
+    "usuztrustrcntrtrtrtrtrtrtrtrtr--trtrtrpgtrtrtrtrnoplplplplplplplplpltrtrdegrgrgrgrgrgrgrgrkguamk"
+    "mkrurubyruuarururuuarurukztjruuatjrukguaruruuatjruruuauauzruruuzrugegeilililegafafirafirirafiriq"
+    "amiriririrpkegsdafafafiriqiqsasyjojoiqiriririririririqiririririrtniriririqiririririririririririr"
+    "irtnirsasasasaiqafafpkpk--bdthththmmththlalammmmmmmmmmmmkrkrkrkrkrkrkrkpkrkrkrkrjpjpjpjpjpjpjpjp"
+    "jpjpjpcnjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpcnjpjpjpjpjpjpjpjpcncnjpjpjpcncnjpjpjpjpjpjpcnjpjpjpjpjpjp"
+    "jpjpjpjpcnjpjpjpjpcnjpjpjpjpjpjpjpjpjpjpcnjpjpjptwjpjpjpjpjp--jpjpjpjpjpjpcncncnjpjpjpjpjpjpjpcn"
+    "jpjpjpjp--jpjpjpjpjpjpjpjpjpjpjpjp--cncnjpjpjpjpjpcnjpjpjpjpjpjpjpjpcnjpcntwjpjpjpjpjpjpjpjpcnjp"
+    "jpjpjpcnjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpcnjpjpjpjpjpjpjpjpjpjpjpjpjpcnjpjpjpjpjpjpjp"
+    "jpjpjpjpcnjpjpjpjpjpcnjpcnjpjpjpjp--jpjpjpjpjpjpcnjpjpjpjpjpjpjpjpjpjpjpjpjpjpjptwjpjpcnjpjpjpjp"
+    "jpjpjpcnjpcnjpjpjpjpjpcnjpjpjpjpjpjpcnjpjpjpjpjptwjpjpjpjpjpjptwjpkpjpjpjpcnjpjpjpjpcnjpcnjpjpjp"
+    "jpjpjpjpjpjpjpcntwjpjpcnjpcncnjpjpcnjpjpjpjpjpjpjpcnjpjpjpjpcnjpjpjpjpjpjpjpjpjpcncncncnjpjpcnjp"
+    "jpjpjpjpjpjpjpjpjpjpjpjpjpjptwjpcnjpcnjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpcn--jpjp"
+    "jpjpjpjpjpjpjpjpjpjpjpjpjpjpcnjpjpjpjpjpjpjpjpjpjpjpcnjpjpcnjpjpcnjpjpjpcnjpjpjpjpcnjpjpjptwjpjp"
+    "jpjptwjpjpjpjptwjpjpjpjpjpjpjpjpjpcncnjpjpjpjpjpjpjpjpjpcnjpjpjpjpjpcn--cnderuatatdeusruuseecait"
+    "twtrruusesesfrfrfrfrbegbarusjoititesesclesesdededegbdeititusmamainitfrintrtrphittr--itesuzuscves"
+    "sehucachitvedededededechdededededechptdegbtrbrdeinmatrusfrfrfrfrfrfresfrfrfrfrfrfrfrfrfrfrfrfrfr"
+    "frfrfrfrrelucausdedetrtrtrrochgfptcuescaattresititveititititbr--trgbnlesusatesuszaitsedeindetzgb"
+    "deususesesesestrtr--pkesdefrmtmtdedechdedededechchdededeatgbazcachdededenlazgbaubeimesieesusgbcl"
+    "mxidalalalalalalalmkesingbdechgbdegbzaesfritesesfrfrhugbcazacazaphmylvtrieusdefrfruscztrsesedede"
+    "deusbratnldedeazgbcabeazininplmtde----itbndefimytrdededededededededededeazsenogbcachczchdeusdede"
+    "skpldebasxirfrfrfrin--hugbgbtrdeingbdeskczskusbegbseitsedehu--usingbdededededededededededechdede"
+    "atdedededededeatdededededededededededededededededededededeatdededededededededededededechdedechde"
+    "dedeatdedechdedededelidechdedeczdededeczdeitchdededededededechatdededededededededededededededede"
+    "dechdedeatdededededeatdedededechczdedededeatdedeitdedededededededededededepldechdededededechdede"
+    "dededechchatdechdededededededededechdechdedechdebedeatdedededechdedededededededededededechdedede"
+    "chdededededededededededededededededechchdedeatdedebedededededepldechdededeitdedededededechdedede"
+    "dededededededededededededededededeatdededenldededededededededeatatdeatatdedeatdeatdechatdededech"
+    "atdededededeatdeatatatchatchatdechdeatdeatatdedechchchatdedededededededechdechdeatdedechatdedede"
+    "dedededededededededededededesiczdedededededeatdedeatdedededeatatdechdedededeatchchchdechdeatdede"
+    "dedeatatatdeskdedeczdedeatdedededeatdedeatdeatatdededeatdededeatchatatatatdededeatdedechdeatdeat"
+    "dedededeatchatdedededededeatchdedededechatdedeatatdeatdedeatdedededededededeatdedededededededede"
+    "deatdededeatdedechchchchchchchdechchchchchdededeczgbgbnonogbatczphskchnlgb--itesusgbesescaidtrau"
+    "esesesmxesusesdegbgbesgb--caitesesesesitititesesesitusesesititititititititcheseseseseseseseseses"
+    "adesesesesesesesesesadesesadeseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseses"
+    "esesesesesesesesesesesesesesesesesesesesesadesesesesesesesesadeseseseseseseseseseseseseseseseses"
+    "esesadeseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseses"
+    "esesesesesesesesesesesesesesgbesesesititititesititititititititititititititititititititititititit"
+    "itititititchitititchitchitchitititititititititititititchitchitititititititititititesesptptptptpt"
+    "esesptptesptesptptptbrrorochchesesescleseseseseseseseseseseseseseseseseseseseseseseseseseseseses"
+    "esesesesesesesesesesesesesesgteseseseseseseseseceseseseseseseseseseseseseseseseseseseseseseseses"
+    "esesesesesptesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesescueseseseseseseses"
+    "esesesesesesesesesesesesesesesesesespeesesesesgbusgbieieptitesgbgbjpcacaesskusbeczczlvrororororo"
+    "roazfrgbfrgbmyfrmqfrfrfrchfrfrfrfrfrfrfrfrfrfrfrchfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrchchfrfrfrfrfrfr"
+    "frfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrbefrfrfrfrfrfrfrfrfrfrbe"
+    "frfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfr"
+    "frfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrbefr"
+    "frfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrbefrbefrfrfrfrfrfrfrfrfrfrfrfrfrfr"
+    "frdefrfrfrfrfrchfrfrfrfrfrfrfrfrdedefrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfr"
+    "frfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfr"
+    "frfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrbe"
+    "frfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrchfrfrfrfrfrfrfrfrfrfrbefrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfradfr"
+    "frfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrchfrfrfrfrfrfrfrbefr"
+    "frfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrchfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrchfrfrfrfrfrfrfrfrfrfrfrfrfrfrfr"
+    "frfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrdefrfrfrfrfrfrfrfrfrfrfrfrfr"
+    "frfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrbefrfrfrbebefrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfr"
+    "frfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrlufr"
+    "frdedefrfrfrfrbefrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfr"
+    "frfrfrfrfrfrfrfrfrfrfrfrfrdefrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrchfrchfrfrfrdefr"
+    "frfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrbefrfrfrfrfrfrfrfrdefritfrfrbelufrfr"
+    "frbdpkinescmusbdinususgbincacadeczinitskfritfrbeseadtrcacafrfrgbphplplplplplgb--frdeititititfrfr"
+    "rebeusmxcoesfrfrfrfrbemdroususbodeesesitesitfrfrieitnlgbgbdeusesesesesbocunisvespeptititfrfrchus"
+    "cuesrocapeskesesderuattrsgusphtndelvnlnlgbusinauitzaatgbgbatzadedehuczautrdefrfrfrfrfrfrfrfrfrfr"
+    "frfrfrfrfrfrfrfrfrfrfrfrfrfrrelufrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrdeesfrfrfrfrfrfrfr"
+    "frdelkieczdedeskdeskgbcz--nlgbieus--phplplphseczphphphphphplusgbdefrfrdeatzachbdtrfrhudedededede"
+    "dedededededededededededededededeus--desese--esesesesesdeesdedeesesnlczsscafrnlcadeplnaesdedeesin"
+    "itesdebresesbrbres--trusesdedecagbieazjpesczroitiededefrfrfrfrfrdedededededededededededededeatat"
+    "depl--usesdejpfrgbesesesesfrreitititititititchusususfritfrmlfrchchcadzca--camqfrdzus--srpt--eses"
+    "esititititititbrfrititchfrmzescllb----gbusescadecajedefrdedesecaplesesesesclhngbdededededegbzmcl"
+    "gbgbfrsidecausdeluskskchfrsifrdeczusgbussihuegesfmesitdedeazindedepsdeinsecausdededededephinusch"
+    "pldecahrtrtritsisihrsisisisisiitsihrsisisisibadegbseususdesedegbseatusroititdeseesdededechtrplgb"
+    "denlczhude--gbgbnlazsk--dededeitgbtrcztrhudedededededededededededededeesingbaejpca--gbdedededede"
+    "deususdeczdededeatusinshdedesivndedededededechdedededededechhudedechclesdeplusfrfrcmczczmadeesza"
+    "tresfrfrfrfrfrfrfrfrrefrfrskczczczczczczskhuusnlnlnlnlbadededeietrczczdehrczindecleenlitititmtit"
+    "argbgbinmtazmyidmymyitcznldededeinincznoskinesesgbcznlgbinczczczin--czchuscachgbgbclecdeimgbgbde"
+    "czhunlnlnlnlintrdededealalalalalalalalalalalalalxkalalalalalalalalalxkalczinskhrdeusludeplchdech"
+    "deususnlnlnlbenlnldenlnlnlnlnlnlnlnlbebechhrugvncausususususus--usususus--usususus--usususustrlt"
+    "rude--aluslkususgbgbgbalgbushuususdeinhuustr----usususltdedededehrususdeczususususdegb--ngngngng"
+    "ngngngngngngdeczee----czdede--czusplplplplushuseusskskusususdeltusdedelvhrusususltusus--usplusus"
+    "ususususususususskbamkdesedeczdelvhutrtrusususususususususghusus--ususdeskczusus--mtesfrfresfres"
+    "itfrfresfradfritbefrescmhnbeiteseschfrfrcafiindedecacaitcachdeinplplfrbefrhtdzfrfrfrskcadeseatch"
+    "chplplcahuhuususgbfiskskczskgbsegbgbesesitisfrfrfrfrfrfrfrfrfrfrfrfrfrczgbusdede--gbgbcadeuszade"
+    "chtrdenlnlgbusdedeczroesussefinlcausgbusinuzdeatchfrfrfrfrfrfrcafreshudemtcztrecsecofrfrfrfrfrfr"
+    "frfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfr"
+    "frfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfr"
+    "frfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrtritatnlczsedecagbusgbgbgbesczusinlvitplchdecagbbysebrusmq"
+    "brfrbrromydedenlmyfigbusltgbespwgbgbtrtresazdetrdebahultdeuzclazbresdehrindeeesoie--beesfrdeeshu"
+    "crfrgbititititcaididesesesesesesesfrfrbefrfrfrfrmgretgfrfrfrfrfrgrbilufrusgrbemtcaalalarcuitites"
+    "aritititescuessvesarcoesecclsvprcuitesesmxmxclesesescucuititbrititititititesesessvclaresesesitit"
+    "critcuititmxbrbrbobrarclmxbrmxitesititititverorororororororomdromdrororozaseusczdeusdeczczskptde"
+    "frcadededeusindeesesalalfrgbczjppltrususnonanlnlindecagbsiczitdegbalaltrlideatdedechdedeczcajpjp"
+    "jpjpjpjpltnotraztrsegbskdenldenocagifrczczczittrsejogbesititcuclbrvaitititcuveitbrroroczfrfrfrde"
+    "dedeskdedkjegbczcausususgbusnggbhuplusfrnlustratbrczesplitseseuzdeus--fruzus--zapefrskfiplplplpl"
+    "plplplplplczesesesesesesesesesesplplmamaesesitititititnlsktrsk--grltskestrazgbesczskauitushreshu"
+    "nlcdidzausbrgbgbbridnlgbczbeeeatbafrhudededeczgbbrsifreetrbratdepnesbjnefrdedeesescdhrviusplgbtr"
+    "eeplplplplplplplplczplplplplplplplplplplplplplplplplplplplplplplplplplplplplplplplplplplplplplpl"
+    "plplplplesesesesesesadfritchnldetresesesfrfrgbcaczczczesfrcasehunzrereredehumxesesboesboeeusfiua"
+    "ieskegegfrfregazcaaz--sygbgbptdededeesdedeczplhrplpldeintnskinazpkgbindeatesdedeltjpjpesuseseses"
+    "gbitdeesclnlchdeczdedefrfrfrfrfrfrgbuszafidedeplgbgbititititititgbgbdeesesgbde--denomxititgbskcz"
+    "czczdeczczdeczczczczczczczczczczczczczczczczczczczxkdedededeplplplplplczplplplitatuschesesesdeit"
+    "dechchchchdechchdeitchchdedechdedededededededechdedechdededechdedechchchdedechchdechchdechchchch"
+    "dededededechdechdededechczdechdedechdedededededededeitdechatdechdedechdedechchdeatatdechdechchde"
+    "chdedeatatatchchatdechchdededeatdedeatdechdeitdedechchdechdechdeitchdechchdechdeitchchdedededede"
+    "dedechdedefrfrbefrfrfrfrchfrchfrfrplplplplplplbejodetrdecadedecaczczczesesestrngde--de--esinjeca"
+    "causegaeinesdesegbazcatrfrmyesesitessksyitusdedetrtrjpjpjpdededededededeatdedechatdedededededech"
+    "dedechdedededededechdedededededechdededededededechdedededechdededeatchdedededededededededededede"
+    "dededechdedechdedechdedededechitdededededededechitdedeatdededededededededededededededededededede"
+    "dedechdedededededechdedededededededededeatdededechdeitchdedededededelichdededeczchchdededededech"
+    "dededededechbededechdedededechdeatdeatdechdechdededechdedededededechdedechdededecanaskusczczchat"
+    "fratdedededededeitdedeatdechdedededeatdededededeatatdedededeatatdededeatatdededededededezaititus"
+    "azazbdgbininingbalfiuslv--ingbdegbcdattrsegbgbinfrfrusgbtr--gbltzaskczczplplczseroususushugbhrde"
+    "gbczuscaatcabasibanlhrgbgbgbdeatplnldededebasiczczititsmititfrfrfrfrnofrrorova--deititsezachzacz"
+    "desegbgbczcaskplgbczczdenzczdegbdeskdederoczussephazgbchczdexkhuplcaxkingbusdegbhucfmyfrtrseczpl"
+    "idde--egegesnlcamxchvngbiegygbcagbgbgbgiususususcausgbgbgb--usincagbbwdesketamficagbusczseinitit"
+    "gbpldedebadeesesesitesbresclbrbresbresesesesptbresesesesesesesesesbresesescoeseseseseseseseseses"
+    "esesesesesesesesesesesesesesesitesesesesesitesitesesitesesitesesesesesesbritititbritesbritesbres"
+    "esititesesclesesbresesesesesesesesesesesclclesesbrgbfrfrfrfresfrfrchfrfrfrfrfrfrfrfrfrgpfritfrfr"
+    "frfrfrfrfresfrskdeltskususdegbinatskpldeididididid--fisefitr--tmchdededededeskcanoczhubababaczcz"
+    "czczczskplalustrususnlnlczitseegsedechdetrgbbhalalxkalsede--dedeusbacaficzhucobefrczfrusczgbgbus"
+    "lvfrfr--sieeitititfritfrfrititfrltczchdefiesczdeczskczsebeskskususgbgbdegbdedeusdeusgbdedededede"
+    "denldedededededededeielsusususprususus--ususususususdeusususgbusdedepsgbtm--atgb--ususususususus"
+    "gbgbusdedeplplplskplplplplplczplplplplussededechbedeususususzagbdecausdeususususususususprususus"
+    "usus--ususprususususususprcamtgbzagbcausususususprusprusususususpruscaususususususususususususus"
+    "usususususususususus--ususgbplesesesazusdetrgbtrnogbseczczplczczczczczczczczczczplplplczczczczcz"
+    "plczczplczczplczczplskczczplczczczplczczczczczczplczczczczplplplczczczczskskczczczdecznldeplsksk"
+    "czskde--czczczczczczczchgrgrgrgrgrgr--gr--grgrgrgrgrgrgrgrgrgrgrtrgrgrtrgrgrgr--grgrgrgrgrtrgrgr"
+    "grtrgrgrgrgrtrgrbggr--grgrgrgrtrgrgrgrgrgrgrgrgrkztjbybguauauaazuahruabgkzuauauauauauauarurubgua"
+    "uauarumkuauageuakzuauarsrsuauaruruuzuapluarurururuuauauaruuauabyruuaruuauameuarumeuaruuarurursua"
+    "bgbguauabgrurukgrsuauauauauaruuamktjruuamersualtruuauamebguauauauauauauaruruuarururubyrursrururu"
+    "ruuarsmeuauauauabybyuauauauauauauauauauauauauabgmduarurururururururururuuamkruuarurursrururururu"
+    "bguauauamkuarsuauauarsrursrsrsrsrsrsrsrsrsrsrsrsrsrsrsrsrsrsrsrsrsmkrsrsrsrsrsrsrsrsrsrsrsrsrsrs"
+    "uauauauauauauzuauauzuarsrsrumkbyrsrurumkrsruuabgrsuagerubgbyuz--gegegegegegegeamamamamamamamamam"
+    "amampsililililililpsililililpsililpsililpsiliririqiqiqtntnsysysasatnjoirsymadzirtnirsairpspkafir"
+    "irtntnsyiqircnegegiriregsajodzegsajojoye--lbsysysasyiririririririririririrpkiregsyiririqiqiririr"
+    "inlbsypketbdbdbdbdbdbdthththththmmkrkpkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrjpjpjpjpcn"
+    "cncncncnjpjpcnjpcn--cncncncncncnjpcnjpcnjpjpcnjpjpjpcncncncnjpjpcnjpjpjptwjptwtwjpjpcncncnjphkjp"
+    "cncncncncncntwtwjpjpjpjpjpjpcnjpcncncnkpcnjpcncncncncnjpcnjp--cnjpcnjpjpjpcncnjpcncnjpcncnjpcnjp"
+    "cnjpjpjpjpjpjpjpjpjpjpjpjpjpjptwjpjpcnjpcncnjpjpjpjpjpcncnjpcnjpcntwjpjpjpcncnjpjpjpcncnjpjpjpjp"
+    "jpjpjpjpcnjpjpjpjpjpcnjpjpjpjpjpcnjpcnjp--jpcncnjpjpjpjpcnjpcnjpcncnjphkcncnjpjpjpjptwjptwcnjpjp"
+    "--jpjpjpjpcntwcncncnjpjpcnjpjpjpcnjpjpjpcncnhkhkjpcncnjptwjpjpjpcnjpjpcncnjptwjpjpjpjpcntwcncnjp"
+    "jpjpjpcncncncntwjptwjpjpjpjpjpjpjptwcnjpjpjpjpjpjpcnjpjpjpcncntwcncncncncn----inusussetrarkpus--"
+    "------------nznzususseussekzkzgfesusgfusinkzseusususususgfususkzkrkrdznutmazromdsmgtdjvndkmhkmso"
+    "tdtovuxkmalvkijegdaluzgrcykzrskgtjuabymkbgmngeamilpksdsabhiqlbtnsypsyelyjoafkwommrmveternpbdthla"
+    "btmmkhkpjphuinzazapltrplplplituszadzhninphfrkrinzarugrbringbtrgbitzainingbbrbrcainbrtrbr--trusin"
+    "plinthfrmguszaeeeetrmxinmxruininplinthinininplmxininbginbgkrkrmxphphfrrebgtrbrplitcncnkrkrplkpau"
+    "gbmxgbcacaphphbrfrbrplauplplplzammphplbobrpygbtrininusphbrphkrbrbrcatrmmbykpcnrudzphruphmxcncncn"
+    "cninmxzainbyrukrindjphtrmxcnbytwmmcncnmmcncnmmuscameusbresesinfraddz----fr--frares--mxmxmxmxcumx"
+    "armxmxmxmxesmxmxptbresmx--mxmxarptmxmxclmxmxmxmxbrbrbrmxpemxmx--brmxcumxmxmxmxmxmxmxmxmxbrbrmxmx"
+    "ptesptmxmxmxmxmxmxesmxmxdzmadzdzbfbf--dzdjcmtgsnmamadz----xkitbrbraobritititbrititititititititit"
+    "clmxsvarsv--arcunicuescocuzacm--brroin--dzaegbinzainzazazazaininingbsygbnc--inidususustmtrtrtriq"
+    "bruscygb--in--usitgbinphphuseeeeinusitbr--syfrbdbdmgdzescopephgbnpafafarnpmxuyboinpe--cocophusus"
+    "gbgbusnggbgbgbnplkgbpkgbusususpkaugbgbaugbseusit--mxmxauauitinpkamazazphafpkphusgbgbvnvnvnididid"
+    "pkbdphphphphphininususingbtrphvebruyclcoesesbresbrbresesesptesesesitclveeccopecleccomxsvmxmxmxmx"
+    "ptmxaoaopeclclveespavecoesdzfrcmfrfrfrfrfrfrfrfrfrfrfrfrfrncfrgffrfrfrfr--frdzdzdzbj--cdchbebemx"
+    "paesesfresbrpe--------eshtpa--pabrcodz--pacacacaesitml--mlmlptcoescovecocoitmwdocopaclpehnespepe"
+    "ptmzespemxardomx--bo--arpacmhtbjga--phgbphgncmrorocobopaaridididididididididroroalalalroplplplhr"
+    "gbusbeinusmapsusmminbdpkininusin--usinnpin--intrhrhrbaseusussebdbdbdvnvnvnvnvnvnvnvnvnvnvnbdphus"
+    "tjmwingbgbususphnouycofrciidgbgbsgus--usus--usinpkgb--atgbusua--czczgbgbphcousirphususesgbphdeph"
+    "iqphusphkwususesusaecdphkrusmlphus----ususphphusphphbjfrkrnlphphuscdgnuskeiq--auusnomxbrbrbrbrmx"
+    "mxca----caca--vnususus--------itit--cl--ecbr--pegbgbcoph--ititititititfrtnfrdzgbinininininbrmlci"
+    "frfrptptptmxptesmxca--caca----kpdjinpksgsginauusgbus--usthbeinlkinintrsobrbruscagbbrsglkgrininus"
+    "us--phusphuscaphusususususptcoptsvveptgtbrbdfrdzgbfrgnlrbrbrbrarmxmxmxpeusptbrusec--ususinininin"
+    "peclmxpevepe--usvn--adushuketrtrphinauphinus--ususzagbmxmxmxmxmxmxmxgbgb--cygbgbgbzagbusbrdkuybr"
+    "pt--bzecbzarroididid--ididididbr--rocycyidininbetrbdesgbitbrzaidtrsvpkvnvnvnvnvnvnaugbvnvnvnvnvn"
+    "--aeusususususgbgb--zaplgbgbbrusxkinauinafsyus--uskgfrdzusphususdededechusveni--mxuszatrcuitusus"
+    "audjbrpearmxararcoboptptptmxmx--ecesclmxpepepemxhntrititititarfritsehnzwinustjusususpkususeeniie"
+    "gb--dkdkgrdededededededededededesededechchdeusdkdkruusmg--mlgbcanz--seususgbususususpainuscaroro"
+    "gbphususno--uspeve--clpepevevevevenisvnisvmxcncngbkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrrw--aupfincnkzca"
+    "augbidkeusgbnefr--ustrtrususgiusususgbgbusbwclususususiningbphdeaubsus--ca--ususususussyususnape"
+    "bobo--arbrromd--cubdbrarcuitmxmxmx--clphtr--injocajoiqiqeekehuussevncnininininsdvnusetuzphgbusin"
+    "inustrazusphdedededededeidhr--frcogbusgbphmxususfigbususinpkalgbgbgbgbgbgiauauauauauauauaucacaca"
+    "cagbnznzgbgbgbgbgbgbgbgbdeau--usususususin--pycy--deustrininin--in----usususingbiqin--ininininin"
+    "gbroptptmzususauuslkirtrinbotruseeinpkin--plgt--auincninususgb--incaiqsyngfieeeeeeeekpin--sslkss"
+    "usinus--eetrinin--ltseininbabababababababababababababahrskde--jplkmmtrmyusgbusdeusmymymygbgbaltr"
+    "eexkvnvnvnvnpksaususcyusgbgbeephusinidididididididpkau--ididididididididididididididididididlkid"
+    "ididididsiinnlnlnlnlnlnlnlnlnlidididididid--ididididididididididididididididkpseessokptrjpmxnini"
+    "dzphus--uskecyususpkididususususpkusidididusauususmlfrcmintrususza--ushrsiskskczgbushuhuphlylvno"
+    "phusgbphba--usus--plplusususgbusvnvnvnvnvnusbeindenlusususususphauusususzaususus--zazausnonlidde"
+    "uszmididusphus--phselsusketrususgruscopkitititususususususcmmgdedebedenldepydkdkdebrbrbrawnlzamt"
+    "ididmyhrususpkushrdegbyezmusde--ususususauus--ususgbgbbn----auphusidid--ushuhupkususnlbenlnlchch"
+    "decnbntrtrtrtrgreszwgmbymmkhcommpk--usplinus----deslnlnlmmgbgbgbgbgb----------gbgbgbgbgbgbgbgbgb"
+    "gbkelszaususus--becausau--us--ususeginzmnlgbestrpkzasezwbdmmph--plbdhuuginkpcamrmmphnzususcaus--"
+    "nlbainuscausususieusususzaususphlkpk--usususususususususususususthmxphususitus--ususususlkidtzus"
+    "uszainza--usskususgbususaugbusintzng--mmususus--ususususususus--usgbseusgbusgugbususitmxvncdfrus"
+    "mxkeusinusususitplusnl--senaguuscanlomomomph--pkpkpkpkpkpkphltpkeeauuspaidmymyididididididididid"
+    "idididid--idididididididididididhrfiusmxbditusususususauinesphiddeinussgvnusmy--us--zminphusingb"
+    "ususususmxmxmxmxmxmx--mxmxmxcu--mx----cn--tzpkphpkgbxktritmezaptptinus--dzplfrplplroidid----gbcm"
+    "--brusczgbarpeeccu--kpauususmx--------pysginbdcupkinidlkusaziquzpkcnbrvnusbrfrgbgbaugbgbmx--eggb"
+    "auauau--au--au--au--skarsirugbgb--gbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbfkgbgbgb"
+    "gbgb--gbgbgbgbgbgbgbgbgbgbpkompkinhrdeusinpkpkinqakwlkpkuskpgbusususfrgbptptptptptptclgbgbgb--gb"
+    "gbnoblidecececmxgbusidus--slgbgbgbgbmygbgbusauusdeusruuauamygbusgibm--gbgbesingbptuseesaruususno"
+    "syitzauspkpk--tromtnkpcymxpkiqcntrzatrlkaucncncnvnvnvnvnvnvnvnvnvnvnpkususmxtrinzaseidsayeusroza"
+    "mx--mxmxmxkplkkrpemxidususussglstrfrrorodzmxbrtrtrpkbeusinegusus----usqauszwauusphusinbrpeuspktr"
+    "inusfk--trzaussiitlklklkin--mlzagbdedekpphinzazausssusde--uslklkaulklklklklklkinindeatvn--itauus"
+    "gb--auususgbusdevnvncngbinusussgingbusaegbeeussyusphkgtjaupkeemmee--gbauuspamxpegbfrusfiinbdinca"
+    "auusaubw--ingbvnvn--phusbrbrmyidcffj----ususzathusgb--cuvnvnvnvnvnvndebwususintrususususilprusbh"
+    "ususususususeruskwinhttrugtrrozamxcucupt--roromdrorororobhsyususususgbusgbfi--usususdeusjpususbe"
+    "beususus--us--usus--ususususususcausususususus--usususususususususususususususprususus--usus--us"
+    "ususususususususususprus--usususus--prprprusususususususususususus--usususususususususprususprus"
+    "ususususususususususususususususususususususususususprusususininuseeusnlfi--usar--ausevnmmbrpeit"
+    "ecdegbusfieemxnlnlbenlnlnlhrhrhrbahrhrhrhrhrhrhrbahrbahrhrbabahrhritsiitsisisisisisiitsisisisiit"
+    "siczmebausua----egjous--nlgbin--gbauussoususgblkgbdeususcnusus--ususjmusdenl--ususnz--us--gbmx--"
+    "autmusintrgbazkpcnidusgbusususususzmzmusinzagrgrgrgrcygrgrgrgrgrgrgrgrtrgrgrgrgrgr----grgrgrgrgr"
+    "grgrgrcyuauauakzrutjrururuuauarururursuarururururururururururururururururu--rururururururururuua"
+    "rururururururururururu--rururururururu--rururururu--uaru--rurururu--rurururururururuua--rurururu"
+    "rurururururururururururu--ruru--rururukzrururubybyrurururubgmkbgbgrurururururuuabyruuarururururu"
+    "uaua--rururubgbgrururururuuarururururururururururururumersrurururuua--rurururururururu--rurururu"
+    "rurururubyruuakgrursrsrsrsrsrsrsrsrsrsrsrsrsrsrsrsxkrsrsru--uarurururuuauarurururururu--rurubgru"
+    "rubyrubyrururubyrurururuuaru--mnmkkguarurururuuarurururururuuzrurururururururururugeruuarurururu"
+    "rurururururururururumeruua--rururuua--rururugegerugeru--rururururuuarurururururururukzrururugege"
+    "rugegegegeazazamilililililililililililillbilpsjoegpsilpsilpsjopspsilirsaiqsasy--bhdzsyegsdsy--ir"
+    "iriririririririririririririririririririririririririririririririrpkpkpkpkpkiqiriririririririririr"
+    "iririqegjoiririrtjtjafafirirsasairiririririririqpkiqiririraeirir--iriririririririrafiriqiqiqpkeg"
+    "lyegaekwiqiqsysasaiqlylyqaiqbhiqomqaqaiqbhiqqayeiqaesysajosasajolyiqegiqlylyqasysyiqiqkwiqiqkwiq"
+    "egiqiqkwsyegsysdsyegiqsdiqiq--saafiriririririqiqiqsyiriqiqiqiqiqiriqiqiqiqiqirsd--iregiqiqeglyiq"
+    "joegsy--dzsaiqsyiqiqsyegegegsdsysasaye--syegsyegomtnegyeegiqegsa--mriqaesdiqiqiqiqyeiqiriretnpnp"
+    "npbdinbdbdbdbdbdbdbdinbdthththththththththththththththththththththmmththththththlammmmmmmmmmmmmm"
+    "mmmmmmmmmmmmmmmmmmmmmmmmthmmmmmmmmmmmmmminmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmm--mmmmmmmminmmmmmm"
+    "mmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmmkhkhkpkrkpkpkrkrkpkpkrkrkrkrkrkpkrkrkrkrkrkrkpkpkrkrkpkpkr"
+    "krkrkrkrkpkrkrkrkpkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkpkrkpkrkrkrkrkpkr"
+    "kpkrkrkpkpkpkpkrkpkrkrkrkrkpkpjpcncncncncncncnjpcncncncncncncncncncncncncncncncncncncncncncncncn"
+    "cncncncncncncncnhktwcncncncncncncncntwcncncncnjpcncncncncntwjpcncncncncncncncncntwcncncncncncncn"
+    "cnjpcncncncncncnmocncncncncncncncncn--cncncncncncncncncncnjptwtwcnjptwcntwtwtw--cntwtwcn--cncncn"
+    "cncncncncntwcnjpjptwcncncn--cncn--cncncncncncntwcncncncncncncncncntwtwcncnjphktw--cnjpcntwcntwcn"
+    "jpcncncncncncncncncncncncncncncncncncncncncncn--cncncncncncncncncncncnjpjpjpjpjpjp--jpjpjpjpjpjp"
+    "jpjpjpjpjpcncncncncncncntwtwtwtwcn--cnjphktwcncncncncncncncncncncncncncncncncncncncncncncncncncn"
+    "cncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncn--cncncncncncncncncncncncncncncncn"
+    "cncncncn--cncncncncncncncncncncncncncncncncncncncncncncncncncnjpjpjptwhkjp--cncncncncncncncncncn"
+    "cntwtwtwcnjpcncnjpjpjpjpcnjpcntwcncncntwcnjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjptwjpcncncntwcncncn"
+    "hkcncntwtwcncncntwcncncntwcncncncncncnjpjpcncncnjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjp"
+    "jpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjptwcnjpjpvnjpcncnjpjpcntwjp--cnininrurucnrurukpkpcnrucnru"
+    "rucnrucncnustresesbebrbrbrusskdefriqaeaeidusfrfrfrfrfrfrbebeuscaushufrfrfrfrfrusfrgbgbgbgbususfr"
+    "frfrfrbrararesaresesarmxesrofrfrfrbefrfrfrfrfrfrfrfrfrfrfrfrfrclclcnpkfrfrfrfrbebeinfrususususus"
+    "frfrfrfrusfrfrfrfrcacausinusususbe--dkdkdkusczczczczususfrfrfrdedededesesesesejpususfrfrusfrfrfr"
+    "frfrfruscncnkrkrkrkrkrkrusgbususususususpkgbuscnususruuaruuauauabrkpkpuaskususinininininpkpkpkpk"
+    "benlchpkpkpkpkpkzainininininininititusesusususfififiitinususcausskskskjpusususinininhrusususfrfr"
+    "--seusjpjpjpjpfifififijpauusfrfrseususususususzafrfrususphcacacacacacacacacapkpkcaususcncncnusus"
+    "arininininindzmygbczgbgbgbgbararclclarararpeesroroplididbritfrusseseuskrkrusfrfrfrfrususfrfrfrfr"
+    "uscncnuskrjpjpususkrkrgbususussedeususususjpjpjpjpinczczbecngbhutrusfrfrfrfratjpjpbrususususuaua"
+    "ususususususfrushrbg--ruruby--uzuauauabgrururururururururuuaruuarurururururuuabguaruruamlyiqirae"
+    "lyiqbdkrkrkrkrkrkrkrkrkrkpkpkpkrkrkrkrkrkrkrjpjpcnjpcnjptwtwcncncnjpjpcncnjpjpjpjpcnjpcnjpjpjpjp"
+    "jpjpjpjpjpjpjpjpjpjpjpjpcncnjpjpjpjpjpcncnjpcntwtwcnjpcncnjpdeuz--usususus--usgbcn--degbdefrfres"
+    "fi--usgbnotrilphustrdedecanodedechatclplinphusmymychusararesca----uspheseshuusususfr--ususfrfrpl"
+    "plplplplplplplplplplplitfrchesnzaubrauskskskdedeatdehrsiususususususdechbeatcl------esususgb--me"
+    "hrusnphuphusmyfrph--usgb--usdegbusususushuushuusnzusmxcabemycanlus--gbauususnzhuphuszanpusususdk"
+    "usdecaushuususususususushuhuphusfrrorousphphusushuhuuscogbhuclphitdehuphnzhuuszanl--esfrghdzbedz"
+    "aresesitbresplplclclczbousincldeusgb--czczdeclitphususususfrfrusfrfrgbusususghuses--gbatphusfrde"
+    "ustrdefrfrfrdzhuhuhuhuitititititbrbrbrbrveveveveus--gbcausfrphusphvnvninusususcauscacanlbeususbr"
+    "brcl--deuscausphususfrauauusdedededeusphusus--usesustrusdeusdesjmxususdehuhuususetiddegbgbbrptit"
+    "esar--ar--esesvigrgr--inusdeauususinusdeithuhuusdkusnlususcausdeususdeususardeincaclphdedefruspt"
+    "deaucznzgbususinuszwus--causde--frusesfrgbauauaudeususesusincn--deusdenzgbdedededefiusususcl--az"
+    "azususushuusdedenlgrfitrusgbdecahuphnaususphusususdehuusfiskskskskskskskskczczczczczczczczczczcz"
+    "czczczczczczuszaphtresit--phitdefrmzropltrimfitritva--usfrmyusgbinusususgbgbinjpjpusgbususgbusde"
+    "dedededeatatusususdeusususchjpzanousplinngusususgbusgbgbficagbhnhudetrdegbindemyushudeskathudese"
+    "frmafritussefizanzdeus--phuscaclususfrfrfrus--phhugbatususauatususczlvdeususdeauclusesdeus--keus"
+    "usususauususph--gbusuzhrphecinnzusauhuususdeitusususmuusdeususus--gbus--de--traetzitronzpklkkeet"
+    "czskczde--trhrhrhrdekefigbbeus--gbuspeespehnpemxpemxesesesesesesadesescoecesesesesescosvececcoes"
+    "comxesbrbrbrchinususplplplnzusplcagbusfrfrdkususbrtm--nzmxusauusususauushuieauus----usit----skcl"
+    "us--ususdeczusgbatusnzgbdeusatclbegbgbususgbusususfrlbfrfisgsghufiususititbresescaeefrfrfrchfrfr"
+    "chfrfrfrrefrfrfrcafrbefrchfrfrpffrfrfrfrbefrfrfrfrfrfrbefrfrfrfrchfrcafrfrfradfrcafritfrfrfrfrch"
+    "cafrfrfrfrfrcabebegpgpmdesesesesesesesesesesesxkesesseititsimxbrbrmxaresmxesbrbresesesarptesescl"
+    "bresesbresesesesesesesesptespearbresescoespresptsvbrpeuyesesarcobocobrarptesesmxesesmxclclptclar"
+    "esptmxesespaesuyesespebrbrptptpebresuyptbrbobococlmxesesarmxmxsvbrbrbrbrptclptararbomxesptclbrbr"
+    "pepecoecpenlidnlchskdeatskskatromdrororororoususususususgbsaususplplplplplplplplplplplplplplbahu"
+    "dzplplplplususgbnzcainusaritititititititititititititititititchititititititititititititititititit"
+    "ititititititititititititititititititititititititititititchsmitititdknl--ususclatesitititititarco"
+    "brusdebrbrbrbrbrbrplmyesususauusususfiusauusbresitaratdeskplmydefrfrbrhufrfrfrhubrplusdeusidfrus"
+    "esususxkdedetrnlphhr--atmygb----gbgbitbrbresesitesatinusinusesdedecanzbaususinusususdeitusdeusph"
+    "nagbuscaphcagbususfijpsewsindkphittjbrphidggdemxhudeusdedeusdededededechdesgphdegbdehubrgbatinpe"
+    "cacncninususgbjpusinususustrphbefrusdeusczseskusauususauusdeauggususususthatdeusptuspf--initau--"
+    "caplpldeusususnzususususususdelvrocafrbesedzititititititititititdeatdedededededededededechdeatde"
+    "chdechdedeatatdedeatdeatchdededededeczdechchdededechdeatdedechdededeitdedechdechdeatdedechdedede"
+    "dededededechdechchchdedededechdededededededededechchdedededededededededebenlbenlnlnlnlnlmyusseau"
+    "usus--ususushuusus--ph----usauauhuhuhujpfrtrtrfrfrfrusesfiaueeauusdephgbfrcritititplplplplcanzus"
+    "pkususcagbgbaugbinusnzusdehunihuhuclusgbcabrvadeuscafrnzfivnvnvnauttcycaphdeauususgbusmnuzususus"
+    "uszaususdedeususgbusgbgbgbau--gbususnzauhudkatchfrfiuseeingbusitdeclusususdegbmyfrusdededededede"
+    "dededeczdedededededededededededededebebebenlnlnlbeinususdededenzusmuususnldeatnzczusitdkusdede--"
+    "usdeusussg--gbuskrusususgbusinamusushrphczdefrsihrhrhrbasihrgrgrgrgrgrgrgrbyuakzuaruruuarsrsbyby"
+    "byruruuauabgrsmk--uabyrsuabgrubyrururuuarsrururutjmkuarururuuakzmkruuauageilililirilsaiririririr"
+    "iriririririririrafiriririririririririqiqiqirsasasasasasairirlyiqthththththththkrkrkrkrkrkrkrkrkr"
+    "krkrkr--krkr--krkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkpkrjpjpjpjpjpjpjpjp--cncncncncncncn--jpcn"
+    "cnjpjpjpjpjpjpcnjpcncnjpcncnjpcncncntwcncncncncncncnjpjp--jpjpjptw--jpcncnjpcncncncncnjpjpjpjpcn"
+    "cncncncncncnjpcncnjpcnjpjptwjpcnjpjpjpcntwcnjpjpcncncncnjpjpjpcncncncncncncncnhkcncncncnjpcncncn"
+    "cncnjpjpcnjpcnjpjpcnjpcntwtwcnjpcnjpjpjptwcnjpcnjpcnjpjpjpjpcnjpjpjpcncnjpjpjpjpcnjpjpcntwtwdkde"
+    "chdeatusauusbeusustrtrgbgbgbgbususgbauusauesfrgbesusgbgbgbauusgbusfrgbauesdelvlvuscatrusgbgbcaca"
+    "causaugbtrdkhrgbdkusbrusdecausaucaplplplclesdenzususgbeslkdegbgbesfrbraugpbrptclhrimesgbgbgbgbus"
+    "iepldepldededeat--augbgbnluscagbsrgbaubrdeatgbgbgbrsjpjpjphkhkjphktwjpcnhkjphkhkhkhkjphkhkdkdetr"
+    "eedededesees--trnlggie--mxcatritinusdededeaudeinimrsidnldkdedesxdebegffrfriededededechfiaunogbmt"
+    "usidinfrinmysgfidededededefiinfiinfoineeiteededededkfingbeeedebahrdeusitnldelvnoineefinzdegbusde"
+    "dknzee--inid--idididididididididididididididididmyidididideefifrgpbeciesdzgpmafrfrdzbeytfrbebepl"
+    "plplplplplplplplplplplphaugblkphphphphtrtruszaglph--trgbcafrfrpltfescvbrbrbrbrbritititititititit"
+    "itititititbrititaotlroplbrespresdobrslfieeisitielv--pgdevntrgbtrtmussefritindeauplnlgrrurururu--"
+    "ruruuagegeilirsysyiqsaiqaeiqomaebdbdkrkr--jpcn--jpjpjpjp--hk--jpjpjpjpcnjpjpjpjpjpjpjpjpjpjp--jp"
+    "cnjpjpcnjpjpjpjphkhkjpjparesesussethdzkrfrruderucnesesdefrdefrcnfrdefrfrfrfiususfrusclcaphmymyxk"
+    "ptietrusphininatghusfringhuscifrmynznznpinintztzusususetcaininitczfrfrfrcocochchchmamymausdephde"
+    "usde----usitittzazazazazazususususdedegrfrbdpa--ingafrfrdededeazusfrzazaitusfrdkititititcausamus"
+    "itse--usfrgbinfrinrsphatusar--usbrfrfritcnskpenztmtnfrtninususca--huusnldedephfrbresautrazazitde"
+    "dedecncnididpltrauidididididididididididididchcausclinbdbdbdusinesesbrpebrususfr--usdeidusmybrat"
+    "deauusdefrustrfrfrplgrfresitdkptcadetfusskdeusrsusde--gbatpaususdedeusphfifrfrin--infrcabduspfbr"
+    "incakrhrusususugdedededededededeinititfrfrinfrcavnaresusususnzbrgfbrarptaritesbrfrfrfrdero--caus"
+    "usiqcanznzzafrinusmmbrnzbratfrfrarmxgbgytresbainusmydkusususdkusustndkdkpkptlrinininininusinauin"
+    "usininbeplfrfresfrfrfrfrfresremafrfresmlgnfrfrfrfrmalufrfrtnfrfrfrmymymymymymymymymymymyinmygbin"
+    "mymymyesinmyininingbmydeauinmymymymymycamymymyinmymymymymymyinmymycaincafrfrfrfrfrchfrfrfrmgfrbg"
+    "mymccacmmgcoveboesclarptesboaresptesmxclesmxarclesescuesesbresesboescobresptboespeescresmxmxeses"
+    "es--mxmxmxmxbocueses--armxmxcumxesbrbobrbrbobrarpeesbrbrititclbopyititbrmxitespeclcucuesclniesbo"
+    "mxbrbritpeesesmxitititititititarmxesesmxrorororoplplplskskplplplesbrbresbemasjczczat--bdcafrdeus"
+    "inphusususmgismynz--mxjpesmxmxecfrmxmxcufrinptpkmxus--caususususcainauaritititititititfrfrfrfrfr"
+    "frttghususmxusususghfrauphbopeatesin--usmyarusgbcresfrititghgrdeusus--cosvrwfrmmpkbdatusmxusmyit"
+    "itphcdinfr--inzainzaauauauauaufrbrincugbusincycyusdebdbritaunlingbdkusgbdeinmmdkdknlchusinincaaz"
+    "phesbrtnnephinmyusmxinfrzadededededevadededededefrjpatdemxinecinindedededeustruscadkinnlesususpk"
+    "pkpkfrmydeinnlininbbgbnldeatatdegbmyusususfrcadkfrlvmxmxmxmxmxmxmxmxmxcoptmxarineeeetrchse--nomx"
+    "crkeininusdzininitsigbczseazusecbrbrbrbrususbrusitgbtrpausbeusitgbgbgrfrdeitzacl--ptbrbrbrptclve"
+    "espamxar--esesptesarcresesclesesarpearessvarboescumxazesfrhumydededefritgbfrbe--nlseplbrinlkrode"
+    "azdecausitinbrbrgtmynlmyaubrrobephbrdedeusarmybjesbrdefodebecausgbghpkmgitititgrusauindedededede"
+    "dedeususdededededededededededededededeitdedeatdedededededededededededededededededededededededede"
+    "dededededededeauusdegbchchdegbjpesaresesboesdededeindedefrdephfrjpitinindephfrtridinfruzcaskdefr"
+    "uscadegeusususatatatatatatatdedejpghfrsiusauingbusnznaesuslkininnengususususmyciusmycafrdefrfrfr"
+    "itpldeitusjpdedecoustnfrdegbusincaususgbusseushrusitaubedededededede--cobodeuscadenlusususininir"
+    "usghgbususesfrdeatcausdenpusbrusarusgbus--dehucain--usdenzfrkrdzaresgbbrptarbrptdebrbrchinininin"
+    "cucugbroesusbrcachesesbrfresbrdebresesatdeesdefrpeininesdebrbrusfidedkmyusatfrfritesinininininin"
+    "ininininincaingrbfbfmxfritescuausiesitdedeusgrmamafrfrfrfrfrfrfrfrfrfrfritcafrpkuscucaescifreses"
+    "esfrfrbefrfresfresesesesfrfrfrfrfrfrfresesescafrfrfrcabemafrcmesfrnefrfrfrfrfrdkdkdkdkdkdkdechde"
+    "dedededeatdeatdededeatdedededeatdededeatdededededededeatdededededededededeatdededefrfrhrfrmyfrat"
+    "esrsfrfrfrsnfrfrmlmatnfrdzdzgfmymymymymyhrfrtgesmyeshrhrsisimyususcanlchnlatmyusaudemymymymymymy"
+    "iningbsginghnzininttbegbmyingbingbmyhtdebresarptbrcrcrbrbresesesesptesmxesboesesescucumxbrpebrmx"
+    "boboboboveesbresbrbrbrmxesesboesarbopemxmxesboesbopeesboesesboclclbocumxmxesarcumxbocubobobobobo"
+    "esesesbrescucuesesesbrbrbrbrbresesesmzesbresbrboesesclescoarbrespecresbrbobresbresbrbrcluycumxar"
+    "aovebrbrmxptarpyarbresbrcoecptesesrororororororomdromdroromdroromdrorororororororororororobeinpl"
+    "plplplplplplplplplplplplplplplplplplplplplplplplplplplplplplplplplplplplplplplplplplplnicrcrcrcr"
+    "arararararlugrinplfruskekecademymxmxatnpdebrsgsgsgdkbrazbritfrpflafrthitusespkchitititititititit"
+    "ititititititititititititititititititititititititititititzabetrtrbrinpededeectrauindedededeususin"
+    "uspkjpinjpjpuscagbingbcaususususdebefiitusdejpdedededemgusatusususpkfipl--ke--tr--krkrjpdenlsike"
+    "ininindeazvndetzcycykrnlususzakeusirtrtrdemymyhrnlfiegskskinininininkrkrkrdetrmyfiusetlkdeinfikr"
+    "frfrfrfrfrdedededefrdededededefrusesbzclmxinhuinidbrbrbecadefrfrfrfrfrmamafrfrfrfrfrfrfrfrfrfrfr"
+    "nepfnefrtnfrfrnenenefrmgfrfrfrnefrfrfrfrfrcacadzfrfrfrfrfrcafrfrfrfrfrfrfrfrbefrnemgfrcafrbefrfr"
+    "tntnfrcaroroitesitititbaitecsvcuessvaresesesarbrmxptmxcobocosvesescrcobrcrcrcumxbrmxbrbrbrbrbrcr"
+    "brmxitbrtlmxveptiteccresesnpcusvboarfrbrptecbrcoesbrcoididididididid--uschinusinbginbrbrbrfrbrbr"
+    "dedeat--uspgtgbrfrselvdeuslvesdededededededededededededededededededededemyididcaptususfrkrkrfrfr"
+    "atltbousfrfresptinroseplgb--usfiusnofrfrfrkrustgbrpldeatplplplfifi--luluinusfrusdededededededeee"
+    "fiphdegh--huusdefrfrfrfrmymytrususmyinusesfrusieusitusin----usilus--esdeinpkuscyseusdededededede"
+    "dededededededededededededededededededededededededededenzetgbtz--ininmycaininnpghbtatgbfrdedeus--"
+    "pgetjptrautrtrtruscadefrus--ghchinirirfridbrneuspausczgbusesususfrusfrusgbusfrusususdedegbgbatcy"
+    "aubrsisigbtrplplplusgmpgpginusinusususmgusinininininininmyphingbininjpininininnzinusususinininin"
+    "pgususgbbaplususnlusskdeustrmyusuggb--gbnoplusdeinnzusususususususus--itzasegbfr--usfrczdkcachin"
+    "bgjpjpsgbrbrbrinphbrfraudezanzusuzuzuzsiusussgfrpffrescocupepepear--plplfrfrtrdeatatpausdedeinbd"
+    "ussenldeustraudkusususgrcaesatusus--usplplatuszahugbghcauscafrfrinpeplplplus--cahnitbrcumxmxbres"
+    "pyarcausde--chdebrfimymyusfrfrgbnamymybrcaphtrvafrvnvnvndemamamamaphphphphphitvngbesgrindefrdefr"
+    "cacafrusfrhuinnznzcucucuesesaufrfrfrfrgbbrpgpgpgpgininininin--mgberoptbrbrplplmxitczdeplbrplplnl"
+    "indelvusbeusfrdenlbegrgabradtncysgplpluscneeeeidmymymymyidmyidididididididmymyidmymymymyidididmy"
+    "idinsefrptpech--krusphcaatsifrauusinbdinindegh--inusdenznpdeinphatussjusuzdkuscabtnoususgbdedeus"
+    "npusitde--ususgbzaindefiusgbdeitusplmxusinusdebrgbinus--ususpafrusususbr--myinnommdechchgbusfrit"
+    "bewsnzbe--usususettrtrtrtrtrtrtrkreslkusfrcadzaresusbrdetrdegbinthde--coatatatphnlcasgtrnousfrkr"
+    "kruskrsiuspebe--esbddezazaauusgbphus--usdepkusususfrfrjp--rsinnlcaatusindedeplplusidinauusaumv--"
+    "cafrcapfpf--rororororororoczititititususussldeseusmyususghpainderofrmxusaubrpgcainusfiusau------"
+    "--fkusus----fijpjp------ca----caisnzauusistfusbdbdusausjsesechghbrhudeininmysetriedeskskdefrdede"
+    "mxmxesititesdktrskususnzitmxaucadeusazusgbususgbjpcygbgbzwusgbgb--gbgbuscagbthgbgbususau--inusus"
+    "usingbnggbnzcamyplgbitmxvnvnvnvnindeaugbusnluscapajpcavnvnvnvnvnvnvnvnvnvnvnvntrideeietrdeuzustr"
+    "trtrinusgrfiususclcaususgbgbcrfrususgbmymymymybrtrtrtrtrsefrfrfrfrdedemxusdeboinmyesbffritesusin"
+    "ususususususususussiplbdtzptphfrusroususususususbeskskskskskczczczskusmyusususdeusfideindedegbse"
+    "trvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvn"
+    "vnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnin--caususpe--it"
+    "--deusbeitinskskskskczczcznlsgplbfusususdeinnlbddeghgbususususphnlpkususdeusdeetinmyinpkchususus"
+    "ususinusmyfrfiinusczczczczpldedededededededechusinbrdegrgrgrgrgrgrgrgrgrcygrgrgrcygrgrgrgrcngrgr"
+    "grgrbybybyrururuuarururuuarsruuarurukzuarukzrsuauauarururururururururururururururururururursruru"
+    "uarururururururuuauarurururukzuauabyrsrsrsrsrurururururururururururururururururururururururururs"
+    "rursrsrsrsrsrsrsrsrsrsrsrsrsrsrsrsrsrsrsrsrursrurururururururururururururubgbgbgrururururururukg"
+    "rurururururururururururursrururururururururururururururururururururururukzrursruruuauauauauauaua"
+    "uauauauauauauauauauauauauauauauauauauauauauauauabybybybybybybybybybymkrururuuarubgkzrubyruuaruby"
+    "ruuarursrurukgrururukzrururursruuauauauabgrsbgrurururururururururururururururururubgkzuauauauaua"
+    "uauarururururururururururururururururukzrururururururururururururururubybybguaruuarururursrururu"
+    "kguaruruuabyrurumkbybyuaruuarucnuauakzruuauauauauauauauauarurururururururururururururuuauauamkru"
+    "uarsrururururururururururururursrururururururururugegegegegegegegegeamamiliriririririririregmama"
+    "iriqegmadzsaiririririririririririririririririririririririririririririririririririrjosysaiqdzegly"
+    "tnsyegegiqsyiqiriririririririririrsdegiririririririrnpbdththmmthththththththththththmmththththth"
+    "ththththmmmmmmmmkpkrkrkrkrkrkrkrkrkrkrkrkrkpkrkrkrkpkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkr"
+    "krkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkr"
+    "krkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkpkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkr"
+    "krkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkr--krkrkrkrkrkrkrkrkrkrkrkrkr"
+    "jpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpcncnjpcnjpcncncncncncncncncncncncncncncncncncncncn"
+    "cncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncn"
+    "cncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncn"
+    "cncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncn--cncncncncncncncncncncncncn"
+    "cncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncnhkjptwtwcncncn"
+    "cncncncncncncncncncncncncncncncntwjpcncncnjpjpcncncnjpjpjpcncncncncncncncncncncncnjpcncncncncncn"
+    "--cncncnjpcncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncn"
+    "jpcncncnjpjpcncncncncncncncncnjpcncncn--cncncncncncnjpjpcntwcncncncnjpjprujpjpcncncncncncnhkcncn"
+    "cncncncncncncncncncncncncncncncncnjpjpjpcn--cncn--cncncncncncncncncncncncncncncncncnjpjpjpjpjpjp"
+    "jpjpjpjpjpjpjpjpjpjpcncnjpjptwtwtwcnjpcnjpcncncncncncnjpjpcncncncncncnjpjpcncncncncncncncncncncn"
+    "cnjpcncnjpcncncncncncncncncnjpjpcncncncncncnjpcnjpjpcncncnjpcncncnjptwtwcncncncnjpjpcncncncncncn"
+    "cncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncnjpjpcnjpcncncncncncncncncncncn"
+    "cncncncncncntwcncncncncncncncncntwcncncnjpjpjpjpjpjpjpcncncncnjpjpcncncncncncncncncncncncncncncn"
+    "jpjpjpjpjpjpjpjpcnjpjpjpcncncncntwcnjpjpjpjpjpcntwjpjpcncncncncncntwcnjpcnjpjpjpjpjpjpjpjpjpjpcn"
+    "cncncncncncncncncncncn--twcncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncncn"
+    "cnjpcncntwjpcnhkcncncncncncncncncncncncncncncncncncncntwcnjpcncncncnjpjpcnjpcncnjpjpjpcncncncncn"
+    "cncncnjpjpjpjpjpcncncnjpjpjpcncnjpcncnjpjpjpcncncncncncnjpcncnjpcnjpcncnjpjpcncncncncncncncncnjp"
+    "cntwcncncncnjpjpjpcnjptwcncnjpcntwcnjpcncncnjpcncncncncncncncnjptwcncncncntwjpcnjpcncncncnjpjptw"
+    "cncncncncnjpcncncncnjpcncncncncncncnjptw----jpcncncnjpjpjptwtwtwjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjp"
+    "cncncncncncncncncncncncncnjpjpcncncncnjpjpjpjpcncnjpcncncncncncncnjpjpjpjpjpcnjpjpjpcncncnjpjpcn"
+    "jpjpcncncncncnjpcncnjpcnjpcnjpcncncncncncncncncncncncndepldedefichplsedeatatplatchdenononodedeca"
+    "nonodedechchnodededededeseczczdesedededenosinodechdedededefidedeatnonofinofidededederurururusecz"
+    "rurucneerudeatdedeustrnodechplpldedenodeatnodechnoplbaplpldefifidedeatatnoatchatsiusdeatatfisefi"
+    "usdeatdefififiatdedeusdepl--sidedededededeatdedeatchathusiitsisisisisisisisibabacasiatdedeatatde"
+    "atatatdenoplplplplplplplplplplplplczczskczsisisisededeatatatatatatplatsideusdefrpldededepl--eeus"
+    "deatderoititititititfrfrfrfrfrfrfrfrfrfrnobadefififidededepldedekzrukrkrkrjpcncncncncncncnjpcncn"
+    "cncncncncnuscaaureuszaususau--phusinesptesesrofrfrsnbeaduscl----auzabehuzanlad----nlhuaudeczczau"
+    "kedemwphzaautrtrza----zaau----denzfrfr--rohuinusbi----usus--nzesesesitititeses--esdeesesesnzzade"
+    "rwmwusrozazausdedededededededededesesesesesihrhr----usazus--inususugrodede--cnnlnlnlnlnlnlnlrumd"
+    "uaruuauauauauailaeegjojoirjpjptwjptwjpjpcntwtwtwtwjpgb--gb------ususus--ususnonous----ca--ususus"
+    "usususususususususususususususususususususususususususgbgbuscaus--uscausirgbusbrbdcatruscacadepm"
+    "sesesemyuscainusauusususkrususususussgusgb--uskzusususususususususususususususus--rururururururu"
+    "ruruusususususususususususususususususususususus--us----usususususus--------us----us------------"
+    "------ususususususususususususususususususususususususususususususususususususususususususususus"
+    "ususususususususususususususususus--ususususus--------ususususususususususususususususususususus"
+    "usus--ususususususus----usus------------usususususususususususususususus----us--usususususususus"
+    "usususususususususususus--------ususususususususususususususus----ususususususus----------usus--"
+    "--------us----gbrurururururururu--gbususphkzkzkzkzkzkzusususcakeususususususususususususususkpus"
+    "ususcacalygrususususus--causususususus--nzusbgusegegegusususcmuschusinususususususususususususus"
+    "us--ususitin--usphegpeinauinininusruususususususususususususususususus--rukrjptwcncncnjpcn--cnlt"
+    "trseuseeususdkdkausecausnlususfraugbusususgbetaucvtrngbegbpegbnlczngusgbcaplustrngtrnotrusdeusus"
+    "psususitusususnzzaususdeuscausususitusbrfrgbusgbusususdetzrwgbusususgbususususfrgbusgbussrgbarus"
+    "usmuindzdzlauyesfjgbdenzcapkbrbrbrmxitbrbrbrbrbrbrbrbrbrbrplbrmxroskfrsibrhrdefrfrfrfrfrfrfrfrfr"
+    "frfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrtrususgbususususaztmgbgbit"
+    "nlusinfrustrau--zattusususcadkdoseiedechmyjppkfrdeetbhusazaztrusdkgbgbususindegbnzzafrbdnzhrtrar"
+    "usgbdecachususussgsehugbgbzaauustzusgbdedeususcausdecainsgnorwusgbitgbauuscadegbususdeetisdefius"
+    "ussetrgbdeusbebwgbgbgbusinusgbusgbgbnoususdedephgbttgbaugbnogbususdegbususdedegfgbusithuzazasgnl"
+    "beususushuususptgbusesesusauusitptptptesesesptitmzptptptesesesuycacacausgbususghususgbingbgbgbgb"
+    "usdedeusgbususgbfiauususgbususcagbchbresesbrdeusususfrgbininphzaususususzagbusindeustrusplnzusus"
+    "usususskkeuscasrclusgbusgbararararesesarclclarrogbcauscauszaesecveclprpresesusbrususaucausgbbept"
+    "ptbrususagaugbtrgbbrususgbclfrfrfrnlusgbusgbususususieskgbgbusphzadegbintrusbeusngususzadelcusus"
+    "npusatlvususususidnlcdnlusfrusgbususususgbgbgbususdedeustrgbiezaususdeatustrdeuszainusatveveusus"
+    "usgbczususususzaininsrtrzainusususgbgbusdeusieusgbtrhuauususalhr--usieingbcagbdegbdegbgbgbusmyus"
+    "dedededeitdeinfrusghalsebegbuszagbindeauplieusauusngzaususplusdeseatdedetrjpdkchtrfifreseseseses"
+    "esesesesesesesstarptbrcvarpemxecesarbrbrbrbrmxmxpemxecbrbrcrpevemxcoesptmxbrarbrarptpeescobrbrbr"
+    "brptbrcrbresbresbrcobruyarpybrptuypebrcumxveececbrmxecuybresarclclbrarvebrarvenipaecptaresclgtmx"
+    "gtcoararesaruymxecptptarpeararmxesarbrbrbrmxbrarbrcobrbrmxmxsvcvptbrptescvptbrgtargqbrbrcovevebr"
+    "espeesesespepeptgqgaaoecptptpycocoptptbrptptesptptptptptptbrcouyptuyvemxptbrbrptbrbrbrcrbrbrbrar"
+    "brmxbr--esclesesclbrmxptespecosvbrbrbrbrarclarclesmxclarbrbrardoesarcoclbrmxhnpycobrbrbrarbrecbr"
+    "brbrbrbouybrgtbrespebrbrmxbomxmxprclpepeesesbrmxpearbrbrbomxcobobrbrbrcvbrbrpeptbrveptaresarbrpt"
+    "brarmxbruyvepeesesarespamxarbrbrgtararpeesvegqesclaresarargtcubrmxbrarpypeclmxbrprbresuybrbrbrbr"
+    "arbrbrbrbrgqbocoarcvptbrargtbrpepemxaoarbrpypepeveveuypebrecbrclclecpepearararpeesarptbrbrclesbr"
+    "brbresbrbrcoclbrclarbrbrespebrbrbrbrbresesptptptptesptbrptbrpeesptpearboesespeclespeescrclesclcl"
+    "esbrptptaocvclbrbrbrbresclbrpebresbrbrbrbresbrbrbrbrecbrcobrespebrclbrbrbresbrbrbrbrclesesclescl"
+    "clpebrbrptaoesarniaraomzgthnclmxbrcomxarmxbrmxbrbrarararveesaresesesesmxbrecbodoecbrmxcovebohnve"
+    "brcobouybrbrpamxmxmxbrbrpyarcomxuyuyuyuybresbrvecuniarcobrarbrbrbrdoveboboaresaruyclclbrbrarpyar"
+    "pypyararbrveesespebrbrecbrbrpearbrbresbrbrbomxmxpepemxbrdoclmxmxbrararmxecbrbrbrbrgtecmxpemxcubr"
+    "mxbrmxmxmxbrbrclcaaegbusususnlgidedenzusgbgbitusplususussiieczustrgbusphgbgbusgbusususususczjpde"
+    "uszausushuggcausnzcacagbcznlveususgbienldeitgbusdkdkusususligbdedeusdemaskruusgbsesosousfigbusus"
+    "trdeuscanlzanlarusususzaatususgbbrbrbrbrtritzaplpldkgbgbaugbusauinaunzinngnlususususgbsepldebahr"
+    "hrbahrrsbababahrhresbsususmaususmtusinzazausdehufrdenlgbcoingyusdeusnzgbplaeaeseusgbusugdededede"
+    "ususgbuszazausgbttus--deususaugbusgbdededeusdeataodefifideususbedeususgbhufigbgbusgbususgbusclve"
+    "frususfidkiszahrususatusdeusczusdedegbusususczusgbusussgsedegbusgbuzzaususususususgbustrdkmtmttr"
+    "usfiatgbususinusininingbidusfousdenoitieususzaidittrtrplusususususususdedeidsgusustzussebeuyusin"
+    "ininzaususjpususpkusgbuszausauusgbusltusltnoususdeusindkdksdzagbintrtzdemwinuszaisdeinmwusgbalus"
+    "trgbltusususgbbbusinfifiususplinusgbusbegbgbusgbitkegdususrufiphltdesepkusfiusinplnlnlissehuvusk"
+    "nleedeusplnafififichususaritusesesesthusngfiusbdininususseusdegbttesauatusfrfrzausgbuscynaususgb"
+    "augbghzagbcaususususchltusususgbusgbgbgbplusnlzadeskbrgbgbgbgbusdeususzausbededenoinusnlusngusnl"
+    "ieiebdusesingbauinininingbuscyzainphustridgbgbmmugnlgbauittrauusauusauusgbusgbczususdeinltgbinza"
+    "uscagbauususususcagbgbusustrusisauususgbgbptbrdenzusatdeusatessiskskczskuausfideazskusindeususdk"
+    "plarususgbdeuzussogbtzuszacanguszaininkenaskgbcmdedebeatbresecgbusgbiezabrdedegbzapldeusgbgbesus"
+    "ngtrusindeususgbiehuusgbinfiesiningbinskskpluscaiettpkgbgbzwiebbpkpkususdedkuzususfrinzausbrinau"
+    "iedeitgbgbmugbgbiegbusgbvausnzusskphintmushrnggbgbgbhrindedenzgbcaususesfrususususinlkkeieusczus"
+    "usgbbwinphgbdkdezagbususususdenzvebalvusdedededebefiususesitzahrusfrieuszapldeplitnabeusseczdede"
+    "cadededegbgbgblkesesesesbdcaiegbieitititesesesesititititfrfrfritititititititititititititesesesit"
+    "itititititititgbgbusinauusfrfrgbhtgbdknlusiemxuybrmxuyseltusitusdereusesptuzusususieususauuscaus"
+    "auususususphnlushuzazagbeechusgbgbdeesespeesesesesesesesesesesesesesesesesesesesesesesesesescoes"
+    "esesesesesesesesesvemxmxmxusgbusczfinpusesarveusplplplusgbgbgbgbgbdegbesususptusgbdedegbusgbauza"
+    "gbdegbdkdezaatusfiusususdededepkhuuzqadeauaugbinlkfiinaugbusdededeltatinbdfiusustrzaeeltdenlusus"
+    "gbususiecaestrusgbdegbatususususdedeusususzacauscaiedkdkgbgbesphphusususaucacacacogbusgbususcaus"
+    "nzdeususdkzaardegbdeusususltseusjmgbjpjpusininieieusgbtrroususnausngitessmvnvnvnvnvnvnvnvnvnvnvn"
+    "vnvnvnvnvnusustrdeusdengusinincadeinzasesesededeusususdecacacagbusususususgbusususustrgbgbustrat"
+    "defrsglsgbitxkbdngustzehetieusususgbususslltfrdegbussggbmupggbaggbgbdksedklvnzuscausphgbusususus"
+    "cabeusomusgbuszauszausnzitdedenlusplustrdedeczdedeustmdeesdehrplusgbgbgbchgbdzdzfrdzsndzbecmdzfr"
+    "frfrcicgcifrfrfrfrcimufrcffrfrbjcifrfrfr--frmagafrbefrchfrcdgadzdzfrchchfrfrchgncifrrefrchfrfrlu"
+    "negadzdzchfrcgfrfrdzdzcdbedzfrdzdzdzmlfrfrfrbefrbedjcifrbecifrfrfrfrfrfrnefrfrmufrdzgadzgadzfrfr"
+    "relubelurecdredzcisnmqmcmlfrfrfrfrfrfrfrbefrcmdzfrfrfrdzdzmadzehfrmadzcmcmcmcicmtncglucmfrcmcmdz"
+    "tntndzfrcacichdzmrtndzdzdzdzcmcmdzpfmachfrmacafrfrcigpbefrdzcmmacadzcabedzititititititititititit"
+    "ititititititititititititititvaititititititititititititititititititititititititititititititititit"
+    "ititititvaititititititititsmititititititititititititititititvaititititititititititititititititit"
+    "itititititititititititititititititititititititititsmititititvaitvaititititititititititititititit"
+    "ititititititititititititititsmititititititititititititdeplpldedededededededededededeidropldedeid"
+    "baatidididplbanlnlnlnlpldeidczsiatskplsksksknlskdeidnlididididididididplplbahrbadeidatdehrplplpl"
+    "plplplidhridhrididdeplidhrplchhrplplchdemesihrplidididhrnlhrskplplplplplplplplplplplplplbabaskid"
+    "deskskplchdededeplplplplbaididhrskidbabaidplbabaplbaplplbadebahrskididskididplplskplhrplhrmemeid"
+    "idplididchididnlplplrororomdrororororororororororororomdrororoitmyusmyfrmymymymymygbfrmymybnmymy"
+    "gbmyidmymymymymymyfralalalalalalxkalatdegbgbgbsehrgbcausgbgbskgbdeusdecagbusdefihrischgbususfrde"
+    "delkusauptmxrozauscagbdechusususgbinusiegeeefigbgbfiplusgbltpluscauscausdktrdeseusingbusgbgbusgb"
+    "gbusgbgbgbgbgbgbnzauuszausinthuscausseseauausktrusazusieususdkatdemtgbplusgbgbazauuszadeusitgbus"
+    "ususususususrsusuzgbieusgbgbgbitusdeusususieususdetzngnosedezaususususmxzaititususcagbphieusgbus"
+    "ususltgbgbusnginhufigbnousgbclhucafiseuslttrfidkdkdeesnlfrfrfrfresitmxitclitcldefibeusususgbmtgb"
+    "gbusgbininiseeltltcagbinatdededededeauusdedeusususplinususknususngusieususaunlusdedeusnzusususus"
+    "usplusgbususdeusczususdeusplusdedeitdeazuslvusjpususustrusnlindetrtrtrtrtrtrsgsgfiphgbusgbinjpus"
+    "plustrlvegpkdeczczczczskskskskplpeitjpgrgrgrgrcygrgrgrgrgrgrgrgrgrcygrgrgrruuarurubgrurukzrukzrs"
+    "tjtjmdmkrsmkrururuuauauaruuauakzkzbgruruuamdruuauabyrumnuamkbyrsrururururururuuauarurursbgrsbgbg"
+    "rsbgrumdrururuuarumdmkrsmkrsbgbgmkrurskgrursrsbgrsrursbgrsbgrsbgrsrsbgrsrsuauauauauauauabybybyby"
+    "bybyuatjbyuamnruuakzruuarursrsrsrsuarsrsrsuarsbyuarururubyuauauabyuagegegegegegegeamamamamililil"
+    "ililililililililililiqaeegegsaegqaqaqasyaekwqasdsdqaqaaesyqasdqaaeiririromtntnsytnsasaegegaejoeg"
+    "egegegegegegegegaeaeegpkpkomomsatndzqadztnmatnegsysybhmaiqegsykwqasasyqatndzqaeglytntnkwdzsasasa"
+    "saqasdqairiririririririqiqmvnpbdbdbdbdbdbdbdbdbdbdbdthththththththththththththlammkhkhkrkrkrkrkr"
+    "krkrkrkrkrkrkpkrkrkrkrkpkpkrkrkrkrkpkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkpjpjpjpjpjpjpjpjpjpjpjp"
+    "jpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpcncncnjpcncnjpcncncn"
+    "hkcnjpjpjpjpjpjpjpjpjpcnjpjpjpjpjpjpcnhkjpjpjpcncncncncncnjpjpjpjpjpjpcnhkcncntwjptwcncncncncnjp"
+    "jpjpjpjpjpjpjpjpjpjpjpjptwcncncncncnjpjpjpjpjpjphkjpjpjpjpjptwcnjpjpjpjpjpjpjpjpjpcnjpjpcncncnjp"
+    "cntwhktwjptwjpjpjpjpjpjpjphkcnjpjpjpjpjpjpjpjpjptwtwjptwjpjpjpjpcnmocnjpcncncnjpjpjphkcncncncnjp"
+    "jpcncncncnhkcncncntwmomomohkjpjpjpjpcncnjpjpjpcnjpjpjpcnjpjpjpjpcnjpjpjpjpcnjpjpjpjptwtwcncncnjp"
+    "cncncnhkjpcncncncncncnhkjpjpjpjpcncnjpjpjpjpjpjpjpjpjpjpjpjpjpjpcnjpjpjpjphkjpjpcnjpcncnhkjpjpjp"
+    "jpjpjptwjpjpjpjpjpjpcncugbfrdeusgbauusauusitususptdegbusnlesfrfrngptesfrptususplnlczatusseincanl"
+    "ataunlmxfrfrpkusgbiddeusdefrgbbeusmybrgbususingbgbnobeczatnldkatseczdebeseuscausususgbuscauscaus"
+    "gbdkuscaitusfrusitusususmuuspeususdekyusplfrgbususdebrfritusfritgbusususfrgbusvnuschusitusgbrenz"
+    "gbusinnlfrusmyfrgbgbgbfrskczczdeusususususfrusdkususgbgbustrnlidusfidkfritdededevedeusususphfrus"
+    "dedededededetmitdeitczfrzaaudenlbeushuatclgbdkdeesnzfrusptdegbgbnousesdeatfrfrdededededeusususus"
+    "augbdeieusfrcagbdedeusdeususus----usdeplitgbsefrgbgbgbgbaufigbdechgbdecangfisefinzusbrfibrususus"
+    "fiususindedeczdedeesitczaujpfrariddkusfiusfinlplplinusdedeplususususdevnvnfridfrusususususplplin"
+    "denodededefrfrfrcamyitususnlusususgbprfrchfrchfrfruspldkusdeususdeusmyusgbfiitgbnonlfiusdzusveus"
+    "usmygbhuaupldedegbnlusus--cadeusitngplplmyphdedeusdebemyusinplusnlbrbetrdeatnlusitbrdknlbeusdeus"
+    "brcogbdedefiplplplplplplplplusdeadnlususfrfiusfrgbplfrusitatususfrfrdedefrusfresfrfrfrfrlufrfrfr"
+    "fritititdeplplplplplbresesescrbrarbrescrcobrptesgbusdeitusnlcamtdegbgbnlbebedemtptdeusdedefies--"
+    "ususaunzdedenldearnzdkusfrdedeuspldeusfiusususfideususdedeinusauusususususdemxdeususthususesusus"
+    "usususususmxususussaseplsesgususususgbnlusnznzusdededeususususatgbmyplchchplidididnzczararfresus"
+    "usauaugbgbgbgbgbgbdearinaudkdesesenlusiddenousgbfiususussgusdkczcacuusfiintrsccaitfrczusdeatdebe"
+    "nlfrfrfrfrauususfresusjpdedeusaucaususauusususdefrusgbptcaindeatgtmxnlplfrdearczplbytjuabyuarsua"
+    "uauabybyuabyrukguarsrurumnrsuageamililililpsilpsilaeaeirdzegiqiraeaeegiriraeaeirbdththkpkrkrkrkr"
+    "kpkrkrkpkrkpkrkrkrkrkrkrkpkrjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjp"
+    "jpjpjpjpjpjpjpjpjpjpjpjpjpjpjpcncncncntwjpcnjpjptwtwcntwcncncnjpjpcntwjptwjpcnjptwjpjpjpjpjpjpjp"
+    "twtwjpcncntwcnjpjpjpjpjpjpjpjpjpjptwcncnjpjpjpjptwjpjpjpcnjpjpjpcnjpjptwjptwjpcncnjpjpjpjptwtwjp"
+    "cntwjptwjpjptwtwjptwjpjptwcncnjpjpcncncnmojptwjpjpjpjptwhkjpjpnlrudetrkrcnchdekratrokrdetrkrdzch"
+    "nldearitdenzgbgiptgbgbesuscausatsedelvplplplplplplis--noitat--dededededeatusitluatgbdedemyusdede"
+    "mxtrtratdeititfrcafrfrfrfrptiedefratnoitgiarararusitatititindedenoesesvechfritfritalplesvecococo"
+    "arfrarpypyesesgbtrtrsgmdltdehudededede--frptgbazazusdedkgbinindegbadesesesadusustrtrusgbdeitnltr"
+    "frauusnonodesknlbebegbdetrdededegbgb--ususdehudenlsegbdedesenoghdebebecagbususdedeatbeit--ruusno"
+    "frfrmxmausgbiebeskgbatdeskskskno--nosedeatitatczgigbgbiscausususdesechdenodetrhudesgmeplgbgbdeie"
+    "deususususmdptesesusaoesitittrgbusesesesespeesvenzphitusmesgsgfrbeuschfrusgbgbusczusdeidususfrva"
+    "audkieususgbclfrauusgbgbbrmdusususbrbrititfrfrus--skgbitgbitusgbusdepldevnzazalvplnlnldeintrdebe"
+    "gbfrusataudeattrnlnlbegbieusve--gbtrplnlat--dedefrnousgbindktratxknzatiegidedesevnvnvnvnvnvnvnmd"
+    "depl--plusususususgbmyusususususususususdeusphusnldedededenonobeusdedenoczesesestrptgbdegbptdeat"
+    "itmydedenofrfrdeususbrbrbrfrdeseititclfrdefonodeusataldeno--atdenoatesititititititititititititch"
+    "ititititititititititititititititititititatititititvaitititesesesesesesseatdeitnodenodenousdedede"
+    "usaebeplbegbdedeititititgbbedeatdesededegbatdenodeitititititfrfrchptesesesptesdedecanodeitdesebe"
+    "fritititititititititititititfrititititititititititititititititititvavafrititititititchitititvait"
+    "ititititititititititititititititchnodesefrfobededeusatcadedeatetitdkchdeaudeuschauatitdeaupldede"
+    "degbnlgbpl--chdedededeitesfrususgbfritplimgiusgbususcagbdedechnlnodedebeitchgbdededechplusdearfi"
+    "debegbgbdedesegbsededeusvnvnvnvnvnvnvnvnvnvnvnjpfiatsedeatdegbatdegbdededenochnodeusgbnzgbgbgbgb"
+    "ischdedededededenlfide--dedeatchchchchchchchdedebedegbgbfideustrnoseusnldeussededetrnluschczsedk"
+    "seplbenlnlgbdedezafrdedeseatdeisfiisxkdedetrindedeusde--esnodkdetrtrdetrdedemyididididididididid"
+    "ididididididididididplbeplhu--lvinnlussedkdkczatnodeusjpjpjpjpjpjpjpjpjpjpjpjpjpjpgbdeplnzsgdede"
+    "dedepldepldedeatsesepldedeatchltdegijplkgbbeusgbfifiidusdeuspktrgbiedededeustrtrdesedededededepl"
+    "dedeatpkusdesecztrdedkdebeusdedesepldedenodededededepldeinnlsefitrfiegnofrfrbebefrbefrfrfrbebefr"
+    "frfrfrlufrfrfrfrbefrbebefrfrbefrfrfrbefrfrfrfrfrfrdegbdeusmymymydeatplatdegichdefrchltczesgbaumd"
+    "frdefrfrdebefrfrfrfrfrfrfrfrfrgbgbmygbczgbdeitplczbeczdefrfrfrfrfrfrfrfrfrfrfresfrfrfrfrfrfrfrfr"
+    "frchfrfrfrfrcanogbieusatusdeseveesescoveesclclesclaritararclaresesesesesitararararesitvevemxptbr"
+    "ptptptptptptptptptptbresdedechczgbdedeczbeusdegbgbgbgbusgbhrdemddeltusnosegbfrpkcamydegbplchdesk"
+    "ustrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrnldefrca--nzdededeba--lvesgbsebeitskhrtrusptsklvpldede"
+    "nzbegidefrnobefrfrfrfrfrvaititititvavavaitusczpepeususphititnzde--nogbusplphaz------trtrchplsipl"
+    "--uscaxkaudeptdechplgbusususnznzidfratchchdeisinitrodeusdesetrdegbdedkatdedeiech----trusdedeatde"
+    "dedeususplgbdeplczdededededese----fonoieseseseseusgbusgbgbususnocainusussggbususnoatczitdeseseno"
+    "gbatatczdeusde--deusnousauaudegbitatusbeplptusdedededeplat--nldzmamamamafrgbtrgbusfiplfififiusgb"
+    "gbadrorofrfrfrititderuusdegbmymygbmygbmafratfrdefratitgbaupldeinususatatpldeseauaugbdeienltrtrpl"
+    "fritfifritgbititplsiauskgbususczatsideatitdkdechchususdeplinusitatuzcafrclusususgbdephvnegegegeg"
+    "egegchititititvadeesdkgifisihuczptptptesptclclatgbgbfidenoro----mdmdususfresatatusdefrdedededede"
+    "deitdegbbrptatesesesesesesesithrdknosebrbrescobresec--brptptesesesbrcoesuspebrbrbrptesclaritbrbr"
+    "arptarclptnoesadesesesgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbdedebrbrbrchitnofresesdeusbegbdeatusitseptde"
+    "dededegbdedeczbefrlubefrfrbedeclclclesescl--noseseplplhrdemyususfrfrusgbcztrfouschmlusesgbgbnode"
+    "ususitdedeatdedededededenldedeatdedededededeatdededededeatdedededededededededeczchdetrindedebefr"
+    "itdegbtjesgbgbdeusatdeinpl--debezaatnlsenonoskieczskpldeplcz--usseseseseussevnnofiarhuususususus"
+    "auususususususususususgbusgbususdkczdeatusususnonosechdedeususczusnlnonodededededebeitatsedegbse"
+    "ititititititititititititititititititititisdegbdeatusdeusnodedenoiedeczgbieaxmymymymyfichitchsrus"
+    "ushrhrititdehuhutrtrczusnoitfiitatltnosksemymyididptczusgbgbczsggbdegbgbdedededenodeitseesaditit"
+    "itititititnoititfritititfrfrfrdedeesczdeclcrnodededeatclhrveveskptadbresfrespresesesadesesadeses"
+    "esesadesveesadczesclesadesclesskbrclveveskbrfrbrptclclesskczplboesskczplskplveveveclclczskbrbrcz"
+    "plskplczskskpebresclclbrbrskmebaplskarskplhrbrbrmeveplpldedebedefrfrfrfrbefrfrfrfrfrfrfrfrdzfrit"
+    "frfrfradfrfrfrdeludeludefrbedeatfrnzdeatatluusitfrdededeskusatnlgbiesegbatchdenlchatdeusdeatusgb"
+    "nodenoisfinocafiatfifisesedecanoplititesesitititititititvaitaritgbfrnonodenodebegbbeatitatficzsi"
+    "degbdeusgbplliusgbgbatatgbchdedededededededegbdede--ususususauususususususatnlgbiededeususgbgbpl"
+    "dededechnlnlgigbusdepldeplchdededede--uzuzinnlczsidechdetrbedeczcznldebedegrgrgrgrgrgrgrgrgrgrgr"
+    "grgrgrgralgrgrkgkgrururururubyrukzkzuauarururuuaruuarsruruuauaruuarubgruuarururururururuuauauabg"
+    "uarururururuuaruuabguarurururuuaruuabyuaruruuabyrururubgruru--rurukzrukzrubyuauabyuarurururururu"
+    "rururuuaruruuauarurururuuzkzrururumdkguarururu--rururuuauauaruuarururuua--ruruua--kzkzkzkz--ruru"
+    "uauaruruuarururukzuaruuabyrurutjrurururururu--rumdruuarururuuaruuaruuauauaruuarubyrubybguaruuaru"
+    "uageuaruuage--uamd--rurubyuauauauauarururu--ruuauarukzruru--ruuarsrursruuaruruuarurururururuuaru"
+    "rurukzrugeuarurubyrurururururuuarurukzkgruuakzbykzrubykzrukgruuauarugegegegeazgeruamamamamamamam"
+    "amamamamamamamamamilpsililililililpsilpsiregsdiriririqiqiririririraeaesapkpkiqjosyjojosabdbdbdth"
+    "thththlakrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkr"
+    "krkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkrkpkrkpkrkrkrkrkrkrkpkrkrkrjpjpjpjpjpjpjpjpjpjptwtwjp"
+    "jpjpjpjpjpjpjpcncnjpjpcncncncncncncncncncncncncncncncncnjpjpjpjpjpjpjpjpjpjpcntwtwjptwcnjpjptwjp"
+    "twjpjpcnjpjpcncnjpcncnjpjpjpjpjpcnjptwtwjptwjpjpjpjpcnjpjpjpjpjpjptwtwjpjpjpjpjpjpjpjpjptwcntwtw"
+    "jptwjpjpjpcnjpcncnjpjpjpjpjpjpjpcnjpcncncncncncncncncncncncncncnjpjpjpjptwcnjpcncncncncncncncnjp"
+    "jpjpjptwtwtwtwcncncnjpcnjpjpjpjpjpjpjpjpjpjpjpjpjpjptw--cncncncntwtwjpjpjpjpjpjpjpjpjpjpjpjpjpjp"
+    "jpjpjpjpjpjpjpjpjpjpjptwjphktw--jpjpcncncnjpcnjpjpjpjpjpcntwjpjpjpjpjptwjpjpjptwcnjpjpjpjpjptwjp"
+    "jpcncncncncncncncnjpcnjpjpcnjpjpjpjpjpcncnjpcncncncnjpjpjpjptwtwjpjptwjpcnjpjpjpcnjpjpjpjpjptwjp"
+    "jptwhkhkjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpcnjpjpcnjpcntwcncncncncncncncncncncn"
+    "cnjpjptwtwhkhkjpjpjpjpjpjptwjpjpjpjpcncncncncncncntwtwtwtwtwtwjpjpjpjpjpcnjpjptwcnjpjpjpjptwcncn"
+    "cnjpjpjpjpcnjpjpjpjpjpjpjpjpcncnjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjptwtwjpjpjpjptwcncnjptwjp"
+    "jpcncntwcnmotwjpjpjpjpjpjpcncncncnjpcnjpjpjpjpjpjpjpcncncnjpjpjpjpjpjpjpjptwcnhkjptwjpcncncncntw"
+    "twjpcncncnjphkhkhkhkjpcncnjpjpjpjpjpjpjpcncncntwcnjpjpjpjpjpjptwtwcncnjpjpcncnjpjpjpcncnjpjpjpjp"
+    "jpjpjpcnjpjpjpjpjptwjpjpjpjpjpjpjpjptwtwjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjptwcnjpcnjpjpjptwtwtwjpcn"
+    "cnjpjpjpjpjpcncnjptwtwtwjpjpjpjpcncncncnjpjpjptwcnjptwcnjpjpjpjpjpjpjpjpcnjptwjpjpjpjpjpjptwcncn"
+    "jpjpjpjpjpjptwjpjpjphkcnjpjpjpcntwjpjpjpcncncncncncncnjpjpcnjpjpjpjpjpjptwjpjpjpjpjpjpjpcncnjpjp"
+    "jpjptwjpcncncncncncncncnjpjpjpjpjpjpjpcntwjpjpjpjpjpjptwjpjpjpjpcntwjpjpjpjpjppldenlnlnldeesdede"
+    "dededededededededededededededededededededeesdededededededededededededededededeptdededededededede"
+    "dededededededeptdedededededededededededeptdedededededededeesdedeesdededeptdededeesdeptecptecuscn"
+    "gbusgbushuhuhuhuhuhuhuhuhuhuhuhuhuhuhuhuhuhuhuhuhuhuhuhuhuhuhuhuhuhudededehuhudedegbusgbusgbgbus"
+    "gbusgbusgbgbdededecnptecuscngbaugbgbgbatgbdedededededededededededededededededededededededededede"
+    "degbaugbdedededegbdedecnptcngbgbgbgbgbgbgbdededegbgbgbdedecnptcnauusgbatgbdeaudegbusgbusgbgbgbde"
+    "dededededegbdedecnptuscngbauauatatatauauauauauauaudecnptuscndededeatdecnptuscndededededecnptuscn"
+    "dedededededededededededededeptuscnskskskskskskskskskdedededeptcnskjpcnptecptcnesatatatesskhusksk"
+    "atatatptcndeptcnskatskskskskskskczczskskskskptcndededededededeptdedededededededecndededept--cnpt"
+    "cngbcnczczczgbuscngbcnjpcnptecdegbuscnesdeesesgbuscngbcngbcngbcngbcndedegbcngbcngbcngbuscnskgbjp"
+    "cnpteccngbuscnesesdedeesesdededegbcndedeatatatatatgbcnskskskskskskgbuscndedegbuscndeatatatatdeat"
+    "atdegbcngbcngbgbdedededegbusjpcnpteccngbusgbusgbgbgbgbgbgbgbdededegbcnpteccngbgbgbgbgbusgbusgbus"
+    "dedededededededededededegbusgbgbuscnpteccngbusdedededededededededededededededededededededededede"
+    "dedededededededededededegbusgbusgbusgbusgbusauusgbusgbusdededededededededededededededededededegb"
+    "usjpcnpteccncnauusdededegbusgbusdedededededededededededededededededkdededededededededededededede"
+    "dedededededededededededededededegbusgbgbgbusgbusdedegbusgbjpcnptecuscncngbusgbusgbusdededededede"
+    "degbusgbusgbusgbusgbusgbusgbjpcnnlnlnlnlnlnlnlnlnlnlnlnlnononononogbgbgbgbfrclclclgbgbgbgbgbgbgb"
+    "gbgbgbgbgbnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlfrdefrfrfresdededededeptptptptptptptptfreseseseseses"
+    "eseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseses"
+    "esesususususustrussesedededededededededededenlnlnlnlnlnldechsenlnlnlnlnlnlnlnlnleseseseseseseses"
+    "eseseseseseseseseseseseseseseseseseseseseseseses--esesesesptptptptptptptptptptptptptptptptptptpt"
+    "ptusususususfrbrbrptptptptptptptptptptptptbrbrbrbrbrbrbrbrbrptbrbrbrbrbrbrbrbrbrptbrbrbrbrbrbrbr"
+    "brbrbrbrbrbrbrbrbrbrbrbrbrptbrbresptbrbrbrbrbrbrbrbrbrbresptbrbrbrbrbrbrbrbrbrbresptbrbrbrbrbrbr"
+    "brbrbresptbrbrbrbrbrbrbrbrbrbresptbrbrbrbrbrbrbrbrbrbrptbrbrbrbrptptbrbrbrbrbrgbbresptususususus"
+    "ustrtrdeusususususususususususususususustrtraeususususususustrtrtrtrtrtrtrtrsefresesesesesesesse"
+    "esesesesesesesesesesesesesessedefrietrptptesseptdedecycycycycycycycycycycycycycycycycycycycycyus"
+    "usususususususususususususcaesesesesesesdenldedededededededeusususususususdedeusususususususfrfr"
+    "frdknonononononononononononononodeusususususususususususususususptususseusususususususususususus"
+    "usususususususes--frdecaiesedeseptfrfrfrfrfrfreseseseseseseseseseseseseseseseseseseseseseseseses"
+    "esesesesesesesesgbdeitititititususususususususususussenousususususususususesdededeusususususgbde"
+    "dededededededededededededeusususfrfrfrfrfrfrusesesesesesestrtrdedededededededededededededededede"
+    "dedededenonononononononogbptptptptptptgbgbgbgbgbgbgbgbgbptptptseseptbebebebebebebebebebebebebebe"
+    "bebebebebebebebebebebebebebebebebebebebebebebebebebebebebebebebebebebebebebebebebebebebebebebebe"
+    "bebebebebebebebebebebebebebebeptbebeptptptptdededededededegbcadedegbgbgbptsetrfotrnl--decadedeau"
+    "auauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauau"
+    "auauauauaugbdededededetrtrgbdenodegbdededededededededededededededededededededededededededededede"
+    "dededededededededededededededededededededededededededededededededededededededededededededededede"
+    "dedeesesesesesesesesesesnofrfrfrfrfrfrfrcagbususgbcacagbgbgbgbgbgbaugbsefrfrfrfrfrfrnlesestreses"
+    "eseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseses"
+    "esesesesesesesesesdedededededededededeestrdedede--dedededeititgbgbnonzusbebebebebebebebebebebebe"
+    "bebebebebebebebenlnlnlnlbenlnlbenlnlnlbebenlnlnlnlnlnlbebenlnlbebebebebebebebebebebebebebebebebe"
+    "bebebebebebebebebebebebebebebebebebebebebebebebebebebebebebebebebebededededededenlnlnlnlnlnlnlnl"
+    "nlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlcacacacahucacadedededededededegbauauauauauauauauauauauauauauauau"
+    "auauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauausenononononogbnonogbptgbgbgb"
+    "gbgbgbgbgbgbgbgbgbgbgbgbgbgbptgbgbgbptptptpteseseseseseseseseseseseseseseseseseseseseseseseseses"
+    "esesesesesesesesesesesesesesesesptesesesesesesesesesesesesesesesesesesesesesdetreseseseseseseses"
+    "esesesesesesesesesesesesesesesesesesesesesesesesesesesesesesestrtrtrcacaesptptitesuscacacagbgbgb"
+    "gbgbesesesdededefrcaiteshutrtrtrtrtrtrptzanlfrfrcadeeseseseseseseseseseseseseseseseseseseseseses"
+    "itgbfrgbeseseseseseseseseseseseseseseseseseseseseseseseseszafrfrcafrfrfrfrfrmlfrfrfrfrfrfrfreses"
+    "gbcabdgbcaushuesescaltdenlnlnlnononogbgbgbgbgbgbusgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgb"
+    "gbgbgbdedededededesesegbdkzazazazatrususnlnlnlnlnlnlnlnlnlbenlnlnldenlnlnldedededededededededede"
+    "dedededenlnlnlnlnlnlnlesesesesesesesesesesesesesesesesnlnlnlnlnlnlnlnlnlnlnldese--cncncnusususse"
+    "sesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesese"
+    "seseseseseseseseseseseseseseseseseseseseseseieusltfrptgbsedefrfrfrfrfrfrfrfrfrfrfrfrfrdefrdefrde"
+    "dededededefrdededededefrdededededededededededededededefrdedededenldededededededededenldedenldefr"
+    "denlfrdededededebedebededebedebededededebedededebededededededededefrfrfrfrfrfrfrfrfrfrfrfritfrfr"
+    "frfrfrfrfrfrgbgbgbgbgbgbgbgbfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrczcznonononodededenononononofrnononono"
+    "denonononononofrnonononononononononofrnodedededededededededefrdededededededededededefrvnatatatat"
+    "gbgbesesestrussedededededeseeseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseses"
+    "eseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseses"
+    "esesesesesesesesesesesesesesesesesesesesesesesesesusesesesesesesesesegegchplplplplsecadedededede"
+    "cncnitdese--bebydededededededededededededededededededebydedededenlitnlitdecacacacacacacacacacaca"
+    "cacacacacacacacacacacacacacacacacacacacacacacacacacacadedededededededebedeptdebemlittresdedeesfr"
+    "frfrbefrfrbefrfrfrfrfrbebefrbebefrfrfrfrfrfrfrfrfrfrfrfrfrfrbefrbebebebebebefrbebefrfrfrfrfrfrfr"
+    "frfrfrfrfrfrbebefrfrnc----dedehuesdededetrnlnlnlnlnlnlnlgbatsktrdedecagbnononononoptptptptptptpt"
+    "ptcnptgbgbgbgbgbgbgbgbgbgbgbcnptgbgbgbgbgbgbgbgbptptptptptptptnlnononononononononononononononono"
+    "nonoptgbesesesesesesesesesesesessefrusdedededededededededededededededededededededededededededede"
+    "dedededededededeeseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseses"
+    "esesesdedecacaptptptptptptptptptptptptptptptesesesusdeseesesesesesesesfrgbdedesesedededeesesdegb"
+    "ptptdededededededededepknononononononoplplplplplplgbgbgbgbgbgbgbgbgbgbgbnononononononononononono"
+    "nononogbesesesesesestr--sededededededetrdededededededededededededededesedededededededededededede"
+    "dedededededededededededededenlespe--dededecafrsegbdededecaus--dedegbdededeskdedegbzadededededede"
+    "dedegbcanononogbdedede--sedededecacasecasegbauauauauauauauauauauauauauauauauauauauauauauauauauau"
+    "auauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauaugb"
+    "trdededenlnlnlnlnlnlnlnlnlnlnlnlnlnldededededededededededededenonononononononogbgbgbgbgbgbgbgbgb"
+    "dedededededededededededesehunlcasefrgbtr--sededeusgbgbvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvn"
+    "vnvnvnvnvnvnvnvnvnvnvnvnvnvnvnvnbesesedesesesesesenldegbgbgbdedededevnvnvnvnvnvnvndevnvndevnvnvn"
+    "vndevnvndededededededededegbgbususususususususususususususususususususususususususususususususus"
+    "ususususususususususususususususususususususususususususususususususesesesesesescaesdededededede"
+    "dededededededededeatgbnonononononononononononononononononononononononononononononononodedesedede"
+    "nlnldededese--noseseususdedededeussegb----------------------nonlnlnlnlnlnlnlnlnlnleseseseseseses"
+    "esesesnonononoitititdehu--nidecadecatrdenononononogbnonogbzacacacagbjpfiususfoseesgbdenonononono"
+    "nodenodedenononononononodenonononononononononononononononononononodenonononononononodenodededede"
+    "dededetrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtr"
+    "trtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrtrfrtrtrtrtrtrtr"
+    "trtrtrse--dedesededededetrdededededededetrtrtrtrtrtrtrtrtrtrtrcausgbcagbdededededededededededede"
+    "dedededededededededededegbgbittrtrtrtrtrtrtrtrtrtrtrtrtrtr--dedededededesededededededenotrgrgrgr"
+    "grgrgratsksksesededehuazdetrnobechnonononononononoaunlgbauauauauauauauauauauauauauauauauauauauau"
+    "auauauauauauauauesesesesesesesesesesesfresesesesesesesesesesesesesesesesesesesesesesesesesfrfrfr"
+    "frfrfrfresesesesesesesesfrfrfrfrfresesesesesesesesesesesesesfrfreseseseseseseseseseseseseseseses"
+    "esesesesesesesesesesesesesesesesesesesesesesesesesesesesfrfresesesesesesesesiteseseseseseseseses"
+    "freseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseses"
+    "esiedeau--dede--denldefieseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseses"
+    "eseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseses"
+    "esesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesdebebefrfrit"
+    "frfrgbgbfibeusdeusgbgbnonononononononononononononononononononononononononononononono--gbdedeeses"
+    "esesesesesgbgbzaseseseseseseseeseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseses"
+    "esesesesesesesesesesararesesesesesesesesesesesesesesesesesesesesesesesesesbefrnlhugbgbgbusbenlse"
+    "bedebebebechgbsesedededededededededefrdedededededededegbdededededkdegbptdededededefrdedededkdedk"
+    "dededkdededebeuscaesesittresesesesesesesesesesesesdebecacatrtrtrdeptptptptptptptptptptptptptptpt"
+    "ptptptptptptptptptptptptptesesesesesesesesesesesesesesesptgbgbgbussegbgbdedededededefiususbebebe"
+    "cadededededededededededededededededededededehudenononononononononononodedededeplgb--trhubebebeus"
+    "usdedeusfrfigbititusgbgbdeauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauauau"
+    "auauauauauauauauauauauauauauauauauauauauauauauauauauauauauesesesesesesesplptnlnlnlesesesesesesni"
+    "esesnonohueseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseses"
+    "eseseseseseseseseseseseseseseseseseseseseseseseseseseseseschitit--pttrtrtrtrtrtrtrtrtrtrtrtrtrtr"
+    "frptptptptptptptptptptptptptptesesesesesesesesesesesesesesbrbrbrdeituscncndededededenlnldeptptde"
+    "nlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlitde----nodededededededede"
+    "dedededededededededededededededededededededededededededededededebydedededededegbdededededeptptpt"
+    "ptptptptptptptptvnauhuhuhuhuhuhuhuhuhuhuhuhudedenlnlnlnlsededededededededededededededededededede"
+    "dededededededededededededededededededededegbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgb"
+    "gbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbcncncncncncncncncncncncntwtwcntwtwtwtwcncn"
+    "twtwcntwcntwtwcntwtwtwtwtwtwtwcntwtwtwtwcncncncncngbdefrdedededededededeusgbgbusnononononononono"
+    "nonononononononononononononobebebebebebebebebebebebebebedeusgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgb"
+    "gbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgb"
+    "gbgbgbgbgbgbgbgbgbgbgbgbgbgbgbgbbebebebebebedededededededededededededededededededededededededede"
+    "dededededededededededededededededededenlchchchdedededededededededededededededededededededededede"
+    "dededededenonononononononononononononodeatatatdedededededededededededededededededededenlnlnlnlnl"
+    "nlnlnlnlnlnlnlnlnlnlnlnlnlnlfidededededededededededededededecacadedesedenlnlnlnlnlnlnlnlnlnlnlnl"
+    "nlnlnlnltrfidededededededededededededededenldeaxsehunlnlnlnlnlgbptptptptptptptpteseseseseseseses"
+    "esesesesesesesesesesesptptptptptptptptptptptptptptptptptptitsegrgrgrgrgrgrgrgrgrgrgrgrgrgrgrgrus"
+    "hufrfr--frfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfritititititititititititititititititititititititititbrpt"
+    "ptptptarcobrptmxesespttresesesesesesesesesesesesesesesnlptesesesesesesptptptptptsefrusdeiteseses"
+    "esesesesesesesesesptptptptmxus--skskskskusatatatatatczczczatatateseseseseseseseseseseseseseseses"
+    "esesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesfridieltptptcaatititittrtrtrgr"
+    "caesesesesesesesesesescanldeptptesgbptptptptptdefrfrfrfreseseseseseseseseseseseseseseseseseseses"
+    "esesesesesesesesesesesesespldededeesdedededededebeplnononononononononononononononononodenodenode"
+    "noitdededededededededededededededededeititdededeplesesesesesesesesesesesesesesesesesgbdedededefr"
+    "------------------------------finoseptptnononononononononononononononononononononononononononono"
+    "nononocanlnlnlnlnlnlnlnlnlnlnlnlnltrdedededededededededededededezadeusitmxptdedededeitdebetrfrgr"
+    "grgrgrgrgrgrgrgrgrgrgrnlnlnlnlnlnlnlnlnlnlnlnldedkescagbiteseskzdedede--dedededededeeseseseseses"
+    "eseseseseseseseseseseseseseseseses--dededededededededecanonononlnlnlnlnlnlnlnlnldededededededesk"
+    "pttrtrtrdedededeptptptnononononononononoptnonononononononononoptnonononononononononoptnonononoca"
+    "cacaptdedededegbbebepttrfrdetrtrtrtrtrtrtrtrtrtrtreseseseseseseseseseseseseseseseseseseseseseses"
+    "eseseseseseseseseseseseseseseseseseseseseseseses--nononononoeebrbrbrbrbrbrbrbrbrbreseseseseseses"
+    "esesesbrptptautrtrtrtrtrtrtrtrtrtrtrtrtrtrbeesesesesesesesususususususususdedegb--cncntrdeatatat"
+    "atatatatptititdedetrbeesesptbrbrbrbrbrbrbrbrbresgbgbbebeesesesesesesesbefrbeptptptptptpt--gbcn--"
+    "secncnatdeeseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseses"
+    "eseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseseses"
+    "esesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesusatustrcasedkdkgbnono"
+    "nononononononononononononononononononononononononononononononononononononononononononononononono"
+    "nononononononononononononononodefrca--itdesedeesesgbgbnlnlnlnlnlususususususdededeaugrgrgrgrgrgr"
+    "grgrgrgrgrcadeussedeficacacacacacanlnlnltrdededededegbgbpldedenldedenlhunonlnoitnlitnlitnlitnlno"
+    "nlnonlusnonlnogbnonononononononononononononogbitgbitititnononotrtrtrtrtrtrtrtrtrtrnotrtrnonogbno"
+    "nononononononononononononononononononononononononononononononotrtrgbdetrdetrdetrdetrdetrdetrdetr"
+    "denlgbnotrtrtrtrtrtrdkdkdkdknlgbdkdkdkdkdkdkdkdkdkdknlgbnononononononodkdkdkdkdkdkdkdkdkdknlgbdk"
+    "dkdkdkdkdkdkdkdkdknlgbdkdkdknlgbnlgbcaesesesessese--fresesesesesesesesesesesesbegbdedetrtrtrtrtr"
+    "trfrgb--trfrfrfrfrfrfrfrfrdeusdededededededegbgbgbgbeseseseseseseseseseseseseseseseseseseseseses"
+    "esesesesesesesesesesesesesesesesesesesesesfrdeesesesesesesgbgbcadededegbgbgbgbptsesehuptptesesmx"
+    "mxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmxmx"
+    "mxmxmxmxmxmxmxmxmxgrgrgrgrgrgrgrgrgrgrgrptptptptptptptptptptptptptptgbdedededegbsesevnvnvnvnvnvn"
+    "vnvnvnvnvnvnvnvnvnsese------------------------------ptptplplplplplplplplplplplplplvnvnvnvnvnvnvn"
+    "vnususvnususvnusvnusvnusususususususususususususususustrdkdededeatatatatatatatatattrdesefrfr--us"
+    "usususususususususususususususususususususususususususususususususususususususususususususususus"
+    "ususususususususususususususususususususususcn--cntrtrtrtrtrtrsedededededededededededededededede"
+    "dededededededededededededededededededededededededededededededededededededededededededededededede"
+    "dedededededededededededededededededededededededededededededededededededededeesdedededededeesdede"
+    "deesnononononononononofrnonodedenodenoesesesdenodedededenonodenonodedenochdedefrnodedededededeno"
+    "dedededenodedenlchnldedededenodedededededededededededededededededededededededenodededededededede"
+    "nodedededededededededededededededededenodededededededededededenononofrnonodedededenodedenononode"
+    "dedededenononofrnononodenodededededenononononofrnonononofrdefrdenonoeseseseseseseseseseseseseses"
+    "esesesesesesesesesesesesesesesesesesesesesesfiiteseseseseseseseseseseseseseseseseseseseseseseses"
+    "esesesesesesesesesesesesesesesfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrnononononononlnlnlnlnlzasefitrdkdede"
+    "deititesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesesfifi--eseseseseseseseseseses"
+    "esesbebebebehuprsesesesesesesedededeplplcydkdkgresesesititczczcznlnlseseseeseseseseseseseseseses"
+    "esesesesesesesesesesestreseseseseseseseshudedededededededededededededededededededededededededede"
+    "dedededededededededededededededededededededededededededededededeplplnlnlnlnlnlnlnlnlnlnlczplczcz"
+    "depldeczczpldedeplczczczczczczczczdedeplczczczdededededededededededededecn--cncn--dedededededede"
+    "dededededededededededededededededededededededededededededeczdededededededededededededededededede"
+    "dedededededededededeczczdededededededededededededededededededededededededededededededededededede"
+    "dededededededededededededededededededededededededededededededededededededededededededededededede"
+    "dededededededededededededededededededededededededededededededededededededeatatatdededededededede"
+    "dededededededededededededededededededededededededededededededededededededededededededededededede"
+    "dededededededededededededededededededededebabababababababababababababababababababababadede--nzgb"
+    "gbgbgbgbgbdedededededededededededeca--aucacaplseplfrfritph----segb----chdeskskdededededeetatdeat"
+    "atatatatatatatatdeatdeatatatatatatdeatdedededededededededededeptnzgratdedededededededededededede"
+    "dedededededededededeatdedeatdededededededededeatdedeatdededededededededededededeatdechdedededede"
+    "dedededededededechdededededeusbenlnlnlnlnldeatdededkitnldedededededededededenldechdedededededede"
+    "dededededededededededededededededededededededededededededededededededededededeatdededededededede"
+    "dedededededededededededededededededededeskskdededededededededededededededededededepldededededede"
+    "cacabebebebebebebenlbebebebebebebenlbebegbcadededededededededededededededededededededededededede"
+    "dedededededededededededededededededededededededededededededededededededededeatdededededededeatde"
+    "dededededededededededededededededededededeususdedededecaatatgbfrgbdedededededededededededededede"
+    "dedededededededededededededededededededededeskskskskskskskdedededededededededededededededededenl"
+    "nlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlbebenlcncncnnlnlnlnlnltheses"
+    "esesesesphesesesesesthesesesesesesesesesesesthesesthththththththththesththththththththththesesth"
+    "esesesxkxkxkxkxkxkxkxkxkxkxkxkxkxkusgrgrgrgrgrgrgrgrgrjogrgrgrgrgrgrgrcncngrgrgrcncncncncnjogrcn"
+    "cncngrgrgrgrgrgrgrgrgrjogrgrgrgrgrgrgrgrgrgrjogrgrjojocnjojojogbgbgbgbgbgbgbdecncngbgbgbgbgbgbau"
+    "auauauauauauauauauauauauautrtrtrtrtrtrtrtrtrtr------------------------------------gbgbegegegnlnl"
+    "nlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnl"
+    "nlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnlnltrdedeiqgbusdedededeltdedededededenlnlnlnlnlnl"
+    "nlnlnlnlnlnlgrbyuabyrurururururururururururururururururururururururururururururururururururururu"
+    "rurururururururururururururururururururururururururururururururururururururururururururururururu"
+    "rurururururururururururururururururururururururururururururururursuauakguairirbdbdthkrkrjpjpjpjp"
+    "jpjpjpjpjpjpjp----jpjpjpjpjpjpjpjpjpjpjpjp--jphkjpjpcnjpjpcncncncncncncncncncncnjpjpjpjpjpjpjpjp"
+    "jpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjptwjpjpjpjpjpjptwjpjpjpjpjpjptwcncncn"
+    "cnjpjpjpjpruderururururudemu--fifrfrfritarararesesdedkinsefiesitesdedededechdeinfrfrfrfrfrhuampt"
+    "ptagtrczitesesgresestritghdegbde--skskuadeuyesesesecitititititittrfrfrfrfrititnpdegbitfrfrbebefr"
+    "frfrbebebebebebebebebecznodedeghde--serorororororosiesgbdefrdkbenpnoczbrararbebebebegbgharititfr"
+    "arecesesmxesgbgbitpecucucotrecesesecesfrfrfrbefrfrfritfrfrfrfrfrhufrfrnefrecbobrptmxbritfrsnplua"
+    "uaplczrogmnpfrbebefrfrinmxitititaraumrinskskskczdkrofrlufresfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfr"
+    "frfrfrfrbefrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrbebedeecmx"
+    "deptfrfrfresesesgbfrfrdeesfrfres--rupeeslkdeuaarmygbclmyindefrfrtrghdzskfrdedesknlititgbfrfrfrfr"
+    "frfrfrfrfrfrfrfrfrbeecitittrfrfrfrfrfrfrfrfresessdectdessedeararbefrskhudeclseetmadededeesnlghgh"
+    "gmghkeghghghprbefrczauauesbocu--sedenodeitskgbittrdeskhuuaginlbefrcizwbebebefrfrfrdemymypldebeno"
+    "etdesktrdedetrczczbedededehudedeczdefrfrbebefrseczarindededearecesesesecclclclclclclclclclsnmzde"
+    "nlititititmtmtmtmtmtmtitdeininskskdkdktrdededededztrczuguaeede--dezwxkdededeczindeplplhutrplplpl"
+    "plplskplplplskplplczczskskbjskplmapgingmuaczmtfrecfreceslube--arbecdfrmucafrdenitgczskdeczchmypt"
+    "esarinpededelu--frfrfrcifrfrfrfrfrbezagrxkxkuaczdedemymydenlgmitmadedededefinosdtrdeitczbeecpe--"
+    "bo--boaritesfrmxitchitfrfrchchcimlcicicicicibaptptfrecclesdefi--inaddefrluestrdegbgbplbeindkptes"
+    "skin--bebehuit--mr--ececececcybjfrbjesititititititititititititititititititititititititititititit"
+    "ititsktrcyinltitititititmxcifrbees--mrhtesitititfrdedecobrbrbresuybehumyfiitficidedefrciititeses"
+    "esfrplfrfrfrfrgbitfiptititititititititititgmarczesczesfrfrfrarararesfrfidesdarcimymxgthuinesinit"
+    "esfr--bebebe--cv--noindede--dkdemguaarararararbrpypypypyararbfdzdztzczitititititititititghgbfrfr"
+    "frfrgbfigmesessd--adadadadadadadadesitmxitituaititdededededeatdedededenldemyateslv--indegmsgbebe"
+    "bebebebebebedepkfrbrbrititgm--iesebdbeskskusfrbebebebebebebedededeplplbadedezazachchde--itfiltlt"
+    "lvno--it--skskczuanpmyuauauauamymyeearzaititesesbofrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfrfr"
+    "frfrfrfrfrvnvnbegbde--etmxhumlmlmlesesesesesescucucuitititititititititititititititititititititit"
+    "itititititititititititititititititititititititititititititititititititititititititititititititmy"
+    "czdetr----beuajoitdedechdededehumx--aditlbdefiselvficztrfrfrfrskdkczitititititititititititititit"
+    "itititititititititititititfritfrmadefrfrfrmaomdededededeeedebeesmxesesmypluaczplpldedepl--mxmxmx"
+    "--mxsdgrgrgrgrgrgrgrgrgrgrtrgrgrgrgrgrgrgrgrcygrgr--grlygrcytrgrgrgrgrgrgrgrgrgrgrtrtrgrcygrgrkz"
+    "rubgrufiuamerururubgrukzbybgrsrsrsuarursrsruuabybgrurururursbgbgrursrururururuuarupluauauauauaru"
+    "rursuarugegerugegeamamamamamamamamililillbiqeg--irjopssabhjo--saegdz--sdegsdsdiqiririrafiqsdsair"
+    "yeomafegiririririrye--irpkyelbirbhomiriqtnegiririririrlyegjoirtnegomiq--yeegiqomegegpsly--innpin"
+    "lkthlakrkrkpkpkpkpkpkpkpkrkrkrkrkrkrkrkrkrkrkrkrkrkrjpjpcnjpjpjpjpjpjpjpcnjpjpjpjpjpcnjpjp--jpjp"
+    "jpjpjpjpcnjpjpjpjpjpjpjpjpjpcnjpcnjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpjpcncncnjpjpjpjpjpcnjpjpjpjpjpjp"
+    "jpjpcncnjpjpjpjpjpcnjpcnjpjpjpjpjpjpcnjpjpjpjpjpjpjpjpjpjpjpjpjpjp"
+    ;
+
+static constexpr size_t METADATA_COUNT = 63969;
+static_assert(sizeof(LOCATION_TYPES) == METADATA_COUNT, "one type per location");
+static_assert(sizeof(LOCATION_COUNTRIES) == METADATA_COUNT * 2 + 1, "one country per location");
+
+const uint8_t* get_generated_location_types() {
+    return LOCATION_TYPES;
+}
+
+const char* get_generated_location_countries() {
+    return LOCATION_COUNTRIES;
+}
+
+size_t get_generated_location_metadata_count() {
+    return METADATA_COUNT;
+}
+
+}  // namespace mcp
+}  // namespace cesium
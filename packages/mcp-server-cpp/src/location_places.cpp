@@ -0,0 +1,213 @@
+/**
+ * Location Places Implementation
+ */
+
+#include "location_places.h"
+#include "location_database.h"
+#include "location_metadata.h"
+#include "location_spatial.h"
+#include "location_store.h"
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+namespace cesium {
+namespace mcp {
+
+struct PlaceIndex {
+    std::vector<uint32_t> canonical;    // Per name ID
+    std::vector<uint32_t> grouped;      // Names of multi-name places, by place, canonical first
+    size_t place_count = 0;
+};
+
+static uint32_t find_root(std::vector<uint32_t>& parent, uint32_t id) {
+    while (parent[id] != id) {
+        parent[id] = parent[parent[id]];
+        id = parent[id];
+    }
+    return id;
+}
+
+static void merge(std::vector<uint32_t>& parent, uint32_t a, uint32_t b) {
+    a = find_root(parent, a);
+    b = find_root(parent, b);
+    if (a != b) parent[std::max(a, b)] = std::min(a, b);
+}
+
+static bool is_word_byte(char c) {
+    unsigned char u = static_cast<unsigned char>(c);
+    return (u >= 'a' && u <= 'z') || (u >= '0' && u <= '9') || u >= 0x80;
+}
+
+// Every word of `a` is also a word of `b` ("louvre" / "the louvre")
+static bool words_contained(const char* a, const char* b) {
+    const char* p = a;
+    while (*p != '\0') {
+        while (*p != '\0' && !is_word_byte(*p)) p++;
+        const char* word = p;
+        while (is_word_byte(*p)) p++;
+        size_t length = static_cast<size_t>(p - word);
+        if (length == 0) continue;
+
+        bool found = false;
+        const char* q = b;
+        while (!found && *q != '\0') {
+            while (*q != '\0' && !is_word_byte(*q)) q++;
+            const char* other = q;
+            while (is_word_byte(*q)) q++;
+            found = static_cast<size_t>(q - other) == length &&
+                    std::memcmp(word, other, length) == 0;
+        }
+        if (!found) return false;
+    }
+    return true;
+}
+
+static PlaceIndex build_place_index() {
+    PlaceIndex index;
+    const Location* locations = get_all_locations();
+    const LocationStore& store = get_location_store();
+
+    std::vector<uint32_t> parent(store.count);
+    std::iota(parent.begin(), parent.end(), 0);
+
+    std::vector<uint32_t> ids;
+    ids.reserve(store.count);
+    for (size_t i = 0; i < store.count; i++) {
+        if (locations[i].name != nullptr) ids.push_back(static_cast<uint32_t>(i));
+    }
+
+    // Same point, same heading: aliases such as "nyc" / "the big apple".
+    // Distinct structures sharing a point (bridge decks, rail tracks) differ
+    // in heading and stay separate.
+    auto same_point = [&store](uint32_t a, uint32_t b) {
+        return store.longitude_e7[a] == store.longitude_e7[b] &&
+               store.latitude_e7[a] == store.latitude_e7[b] &&
+               store.heading[a] == store.heading[b];
+    };
+    // Curated aliases sit on a city, state, airport or untyped entry; two
+    // unpopulated landmarks at one point are separate map features
+    // ("... railway bridge b" / "... railway bridge c", institutes sharing
+    // a campus point) unless one name's words contain the other's
+    auto same_place = [&store](uint32_t a, uint32_t b) {
+        bool landmarks = (store.type[a] & LOCATION_TYPE_LANDMARK) != 0 && store.population[a] == 0 &&
+                         (store.type[b] & LOCATION_TYPE_LANDMARK) != 0 && store.population[b] == 0;
+        if (!landmarks) return true;
+        const char* name_a = store_name(store, a);
+        const char* name_b = store_name(store, b);
+        return words_contained(name_a, name_b) || words_contained(name_b, name_a);
+    };
+    std::sort(ids.begin(), ids.end(), [&store](uint32_t a, uint32_t b) {
+        if (store.longitude_e7[a] != store.longitude_e7[b]) return store.longitude_e7[a] < store.longitude_e7[b];
+        if (store.latitude_e7[a] != store.latitude_e7[b]) return store.latitude_e7[a] < store.latitude_e7[b];
+        if (store.heading[a] != store.heading[b]) return store.heading[a] < store.heading[b];
+        return a < b;
+    });
+    // same_place is not transitive, so every pair of a run is checked
+    // (runs are a handful of names)
+    for (size_t begin = 0, end; begin < ids.size(); begin = end) {
+        for (end = begin + 1; end < ids.size() && same_point(ids[begin], ids[end]); end++) {}
+        for (size_t i = begin; i < end; i++) {
+            for (size_t j = i + 1; j < end; j++) {
+                if (same_place(ids[i], ids[j])) merge(parent, ids[i], ids[j]);
+            }
+        }
+    }
+
+    // Alternate spellings of one GeoNames city carry its population but may
+    // sit at slightly different coordinates ("bogota" / "bogotá")
+    std::vector<uint32_t> populated;
+    for (uint32_t id : ids) {
+        if (store.population[id] > 0) populated.push_back(id);
+    }
+    std::sort(populated.begin(), populated.end(), [&store](uint32_t a, uint32_t b) {
+        if (store.population[a] != store.population[b]) return store.population[a] < store.population[b];
+        return a < b;
+    });
+    for (size_t i = 0; i < populated.size(); i++) {
+        for (size_t j = i + 1; j < populated.size() &&
+                               store.population[populated[j]] == store.population[populated[i]]; j++) {
+            uint32_t a = populated[i];
+            uint32_t b = populated[j];
+            double distance = great_circle_distance(store_longitude(store, a), store_latitude(store, a),
+                                                    store_longitude(store, b), store_latitude(store, b));
+            if (distance <= PLACE_MERGE_DISTANCE) merge(parent, a, b);
+        }
+    }
+
+    // Canonical name: most populous member, ties to the lowest ID (the root)
+    std::vector<uint32_t> best(store.count);
+    std::vector<uint32_t> size(store.count, 0);
+    std::iota(best.begin(), best.end(), 0);
+    for (uint32_t id : ids) {
+        uint32_t root = find_root(parent, id);
+        size[root]++;
+        if (store.population[id] > store.population[best[root]] ||
+            (store.population[id] == store.population[best[root]] && id < best[root])) {
+            best[root] = id;
+        }
+    }
+
+    index.canonical.resize(store.count);
+    std::iota(index.canonical.begin(), index.canonical.end(), 0);
+    for (uint32_t id : ids) {
+        uint32_t root = find_root(parent, id);
+        index.canonical[id] = best[root];
+        if (size[root] > 1) index.grouped.push_back(id);
+        if (root == id) index.place_count++;
+    }
+
+    const std::vector<uint32_t>& canonical = index.canonical;
+    std::sort(index.grouped.begin(), index.grouped.end(), [&canonical](uint32_t a, uint32_t b) {
+        if (canonical[a] != canonical[b]) return canonical[a] < canonical[b];
+        bool a_first = canonical[a] == a;
+        bool b_first = canonical[b] == b;
+        if (a_first != b_first) return a_first;
+        return a < b;
+    });
+    return index;
+}
+
+static const PlaceIndex& get_place_index() {
+    static const PlaceIndex index = build_place_index();
+    return index;
+}
+
+void build_location_place_index() {
+    get_place_index();
+}
+
+size_t get_location_place_count() {
+    return get_place_index().place_count;
+}
+
+uint32_t get_canonical_location_id(uint32_t id) {
+    return get_place_index().canonical[id];
+}
+
+bool is_canonical_location(uint32_t id) {
+    return get_place_index().canonical[id] == id;
+}
+
+const uint32_t* get_location_aliases(uint32_t id, size_t& count) {
+    const PlaceIndex& index = get_place_index();
+    uint32_t place = index.canonical[id];
+
+    // The key is itself canonical, so both sides compare by their place
+    const std::vector<uint32_t>& canonical = index.canonical;
+    auto range = std::equal_range(index.grouped.begin(), index.grouped.end(), place,
+                                  [&canonical](uint32_t a, uint32_t b) {
+                                      return canonical[a] < canonical[b];
+                                  });
+    if (range.first == range.second) {
+        // Unaliased: the canonical entry holds the ID itself
+        count = 1;
+        return &index.canonical[id];
+    }
+    count = static_cast<size_t>(range.second - range.first);
+    return &*range.first;
+}
+
+}  // namespace mcp
+}  // namespace cesium
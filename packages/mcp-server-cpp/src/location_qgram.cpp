@@ -0,0 +1,185 @@
+/**
+ * Fuzzy Match Candidate Filter Implementation
+ */
+
+#include "location_qgram.h"
+#include "location_index.h"
+#include "location_database.h"
+#include <algorithm>
+#include <cstring>
+
+namespace cesium {
+namespace mcp {
+
+// Bigrams are keyed directly by their two bytes; names are padded with a
+// NUL on each side so the first and last characters get their own grams
+constexpr size_t GRAM_KEYS = 65536;
+
+// A posting packs the location ID with the number of times the gram occurs
+// in that name, so shared counts respect multiplicity
+constexpr uint32_t POSTING_ID_MASK = 0x00FFFFFFu;
+constexpr uint32_t POSTING_COUNT_SHIFT = 24;
+
+struct QGramIndex {
+    std::vector<uint32_t> gram_offsets;    // GRAM_KEYS + 1 offsets into postings
+    std::vector<uint32_t> postings;        // Per gram, ordered by (name length, ID)
+    std::vector<uint32_t> ids_by_length;   // All named IDs, ordered by (length, ID)
+    std::vector<uint32_t> length_offsets;  // Length L occupies [offsets[L], offsets[L+1])
+};
+
+// Padded bigram keys of a string, sorted so equal grams are adjacent
+static size_t collect_grams(const char* s, size_t length, uint16_t* grams) {
+    unsigned char prev = 0;
+    for (size_t i = 0; i < length; i++) {
+        unsigned char c = static_cast<unsigned char>(s[i]);
+        grams[i] = static_cast<uint16_t>((prev << 8) | c);
+        prev = c;
+    }
+    grams[length] = static_cast<uint16_t>(prev << 8);
+    std::sort(grams, grams + length + 1);
+    return length + 1;
+}
+
+static QGramIndex build_qgram_index() {
+    QGramIndex index;
+    const Location* locations = get_all_locations();
+    const uint16_t* lengths = get_location_name_lengths();
+    size_t count = get_location_count();
+
+    // Counting sort of IDs by name length
+    uint16_t max_length = 0;
+    for (size_t i = 0; i < count; i++) {
+        max_length = std::max(max_length, lengths[i]);
+    }
+    index.length_offsets.assign(static_cast<size_t>(max_length) + 2, 0);
+    for (size_t i = 0; i < count; i++) {
+        if (locations[i].name != nullptr) index.length_offsets[lengths[i] + 1]++;
+    }
+    for (size_t l = 1; l < index.length_offsets.size(); l++) {
+        index.length_offsets[l] += index.length_offsets[l - 1];
+    }
+    index.ids_by_length.resize(index.length_offsets.back());
+    std::vector<uint32_t> fill(index.length_offsets.begin(), index.length_offsets.end() - 1);
+    for (size_t i = 0; i < count; i++) {
+        if (locations[i].name != nullptr) {
+            index.ids_by_length[fill[lengths[i]]++] = static_cast<uint32_t>(i);
+        }
+    }
+
+    // Two passes over the names in length order: size each gram list, then
+    // fill it, which leaves every list ordered by (length, ID)
+    std::vector<uint16_t> grams(static_cast<size_t>(max_length) + 1);
+    index.gram_offsets.assign(GRAM_KEYS + 1, 0);
+    for (uint32_t id : index.ids_by_length) {
+        size_t n = collect_grams(locations[id].name, lengths[id], grams.data());
+        for (size_t g = 0; g < n; g++) {
+            if (g == 0 || grams[g] != grams[g - 1]) index.gram_offsets[grams[g] + 1]++;
+        }
+    }
+    for (size_t k = 1; k <= GRAM_KEYS; k++) {
+        index.gram_offsets[k] += index.gram_offsets[k - 1];
+    }
+
+    index.postings.resize(index.gram_offsets[GRAM_KEYS]);
+    std::vector<uint32_t> cursor(index.gram_offsets.begin(), index.gram_offsets.end() - 1);
+    for (uint32_t id : index.ids_by_length) {
+        size_t n = collect_grams(locations[id].name, lengths[id], grams.data());
+        for (size_t g = 0; g < n;) {
+            size_t run = g + 1;
+            while (run < n && grams[run] == grams[g]) run++;
+            uint32_t occurrences = static_cast<uint32_t>(std::min<size_t>(run - g, 255));
+            index.postings[cursor[grams[g]]++] = id | (occurrences << POSTING_COUNT_SHIFT);
+            g = run;
+        }
+    }
+
+    return index;
+}
+
+static const QGramIndex& qgram_index() {
+    static const QGramIndex index = build_qgram_index();
+    return index;
+}
+
+void build_location_qgram_index() {
+    qgram_index();
+}
+
+size_t find_fuzzy_candidates(const char* normalized, int max_distance,
+                             std::vector<uint32_t>& candidates) {
+    candidates.clear();
+    if (max_distance < 0) return 0;
+
+    const QGramIndex& index = qgram_index();
+    const uint16_t* lengths = get_location_name_lengths();
+    size_t m = std::strlen(normalized);
+    size_t k = static_cast<size_t>(max_distance);
+
+    // Only names whose length differs by at most k can match
+    size_t max_length = index.length_offsets.size() - 2;
+    size_t lo = m > k ? m - k : 0;
+    size_t hi = std::min(m + k, max_length);
+    if (lo > hi) return 0;
+
+    // Shared bigrams needed for a name of length n: max(m, n) + 1 - 2k.
+    // That grows with n, so the short end of the window where it is not
+    // positive is taken whole from the length buckets and the rest,
+    // [filter_lo, hi], goes through the count filter.
+    auto required = [&](size_t n) -> long {
+        return static_cast<long>(std::max(m, n)) + 1 - 2 * static_cast<long>(k);
+    };
+    size_t filter_lo = lo;
+    while (filter_lo <= hi && required(filter_lo) <= 0) filter_lo++;
+
+    for (size_t n = lo; n < filter_lo; n++) {
+        candidates.insert(candidates.end(),
+                          index.ids_by_length.begin() + index.length_offsets[n],
+                          index.ids_by_length.begin() + index.length_offsets[n + 1]);
+    }
+
+    if (filter_lo <= hi) {
+        // Count shared bigrams (with multiplicity) over the length window.
+        // The counters persist across queries and are kept all-zero between
+        // them: only the entries listed in touched are reset afterwards.
+        static std::vector<uint16_t> shared;
+        static std::vector<uint32_t> touched;
+        static std::vector<uint16_t> grams;
+        if (shared.size() < get_location_count()) shared.resize(get_location_count(), 0);
+        touched.clear();
+        grams.resize(m + 1);
+        size_t n_grams = collect_grams(normalized, m, grams.data());
+        for (size_t g = 0; g < n_grams;) {
+            size_t run = g + 1;
+            while (run < n_grams && grams[run] == grams[g]) run++;
+            uint32_t query_occurrences = static_cast<uint32_t>(run - g);
+
+            const uint32_t* begin = index.postings.data() + index.gram_offsets[grams[g]];
+            const uint32_t* end = index.postings.data() + index.gram_offsets[grams[g] + 1];
+            const uint32_t* p = std::lower_bound(begin, end, filter_lo,
+                                                 [lengths](uint32_t posting, size_t len) {
+                                                     return lengths[posting & POSTING_ID_MASK] < len;
+                                                 });
+            for (; p < end; p++) {
+                uint32_t id = *p & POSTING_ID_MASK;
+                if (lengths[id] > hi) break;
+                if (shared[id] == 0) touched.push_back(id);
+                shared[id] = static_cast<uint16_t>(
+                    shared[id] + std::min(query_occurrences, *p >> POSTING_COUNT_SHIFT));
+            }
+            g = run;
+        }
+
+        for (uint32_t id : touched) {
+            if (static_cast<long>(shared[id]) >= required(lengths[id])) {
+                candidates.push_back(id);
+            }
+            shared[id] = 0;
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+    return candidates.size();
+}
+
+}  // namespace mcp
+}  // namespace cesium
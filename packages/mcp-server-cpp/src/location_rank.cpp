@@ -0,0 +1,105 @@
+/**
+ * Population Rank Index Implementation
+ */
+
+#include "location_rank.h"
+#include "location_places.h"
+#include "location_store.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace cesium {
+namespace mcp {
+
+static std::vector<uint32_t> build_rank_index() {
+    const LocationStore& store = get_location_store();
+
+    std::vector<uint32_t> ranked;
+    for (size_t i = 0; i < store.count; i++) {
+        if (store.population[i] > 0 && is_canonical_location(static_cast<uint32_t>(i))) ranked.push_back(static_cast<uint32_t>(i));
+    }
+    std::sort(ranked.begin(), ranked.end(), [&store](uint32_t a, uint32_t b) {
+        if (store.population[a] != store.population[b]) {
+            return store.population[a] > store.population[b];
+        }
+        return a < b;
+    });
+    return ranked;
+}
+
+static const std::vector<uint32_t>& get_rank_index() {
+    static const std::vector<uint32_t> ranked = build_rank_index();
+    return ranked;
+}
+
+void build_population_rank_index() {
+    get_rank_index();
+}
+
+size_t get_ranked_location_count() {
+    return get_rank_index().size();
+}
+
+size_t count_locations_by_population(int min_population) {
+    const std::vector<uint32_t>& ranked = get_rank_index();
+    const int32_t* population = get_location_store().population;
+
+    // Populations descend along the index, so the qualifying IDs are a prefix
+    auto end = std::partition_point(ranked.begin(), ranked.end(), [&](uint32_t id) {
+        return population[id] >= min_population;
+    });
+    return static_cast<size_t>(end - ranked.begin());
+}
+
+// Box test on the store's fixed-point coordinates
+struct FixedBox {
+    int32_t west, south, east, north;
+    bool wraps;
+};
+
+static FixedBox make_fixed_box(const PopulationFilter& filter) {
+    FixedBox box;
+    box.south = location_coord_to_fixed(std::max(filter.south, -90.0));
+    box.north = location_coord_to_fixed(std::min(filter.north, 90.0));
+    if (filter.east - filter.west >= 360.0) {
+        box.west = location_coord_to_fixed(-180.0);
+        box.east = location_coord_to_fixed(180.0);
+        box.wraps = false;
+    } else {
+        box.west = location_coord_to_fixed(std::remainder(filter.west, 360.0));
+        box.east = location_coord_to_fixed(std::remainder(filter.east, 360.0));
+        box.wraps = box.west > box.east;
+    }
+    return box;
+}
+
+static bool in_fixed_box(const FixedBox& box, int32_t longitude, int32_t latitude) {
+    if (latitude < box.south || latitude > box.north) return false;
+    if (box.wraps) return longitude >= box.west || longitude <= box.east;
+    return longitude >= box.west && longitude <= box.east;
+}
+
+size_t find_top_locations_by_population(const PopulationFilter& filter,
+                                        const Location** results, size_t max_results) {
+    const std::vector<uint32_t>& ranked = get_rank_index();
+    const Location* locations = get_all_locations();
+    const LocationStore& store = get_location_store();
+
+    size_t limit = count_locations_by_population(filter.min_population);
+    FixedBox box = make_fixed_box(filter);
+
+    size_t count = 0;
+    for (size_t r = 0; r < limit && count < max_results; r++) {
+        uint32_t id = ranked[r];
+        if (filter.has_bbox && !in_fixed_box(box, store.longitude_e7[id], store.latitude_e7[id])) {
+            continue;
+        }
+        if (!location_matches_filter(id, filter.metadata)) continue;
+        results[count++] = &locations[id];
+    }
+    return count;
+}
+
+}  // namespace mcp
+}  // namespace cesium
@@ -0,0 +1,242 @@
+/**
+ * Vectorized Name Scan Implementation
+ */
+
+#include "location_scan.h"
+#include "location_database.h"
+#include "location_index.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#if defined(CESIUM_MCP_SCALAR_SCAN)
+#define CESIUM_MCP_SCAN_SCALAR 1
+#elif defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#define CESIUM_MCP_SCAN_SIMD128 1
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#define CESIUM_MCP_SCAN_AVX2 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define CESIUM_MCP_SCAN_SSE2 1
+#else
+#define CESIUM_MCP_SCAN_SCALAR 1
+#endif
+
+namespace cesium {
+namespace mcp {
+
+// ============================================================================
+// Kernel: bitmask of block positions matching the needle's first and last byte
+// ============================================================================
+
+#if defined(CESIUM_MCP_SCAN_SIMD128)
+
+constexpr size_t SCAN_WIDTH = 16;
+static const char* const SCAN_KERNEL = "simd128";
+
+static inline uint32_t candidate_mask(const char* p, size_t last_offset, char first, char last) {
+    v128_t first_eq = wasm_i8x16_eq(wasm_v128_load(p), wasm_i8x16_splat(first));
+    v128_t last_eq = wasm_i8x16_eq(wasm_v128_load(p + last_offset), wasm_i8x16_splat(last));
+    return wasm_i8x16_bitmask(wasm_v128_and(first_eq, last_eq));
+}
+
+#elif defined(CESIUM_MCP_SCAN_AVX2)
+
+constexpr size_t SCAN_WIDTH = 32;
+static const char* const SCAN_KERNEL = "avx2";
+
+static inline uint32_t candidate_mask(const char* p, size_t last_offset, char first, char last) {
+    __m256i first_eq = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)),
+                                         _mm256_set1_epi8(first));
+    __m256i last_eq = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + last_offset)),
+                                        _mm256_set1_epi8(last));
+    return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(first_eq, last_eq)));
+}
+
+#elif defined(CESIUM_MCP_SCAN_SSE2)
+
+constexpr size_t SCAN_WIDTH = 16;
+static const char* const SCAN_KERNEL = "sse2";
+
+static inline uint32_t candidate_mask(const char* p, size_t last_offset, char first, char last) {
+    __m128i first_eq = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)),
+                                      _mm_set1_epi8(first));
+    __m128i last_eq = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + last_offset)),
+                                     _mm_set1_epi8(last));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(first_eq, last_eq)));
+}
+
+#else
+
+constexpr size_t SCAN_WIDTH = 8;
+static const char* const SCAN_KERNEL = "scalar";
+
+static inline uint32_t candidate_mask(const char* p, size_t last_offset, char first, char last) {
+    uint32_t mask = 0;
+    for (size_t i = 0; i < SCAN_WIDTH; i++) {
+        mask |= static_cast<uint32_t>(p[i] == first && p[i + last_offset] == last) << i;
+    }
+    return mask;
+}
+
+#endif
+
+// Needles up to this long use the kernel; the blob's padding covers a
+// block load at the needle's last byte
+constexpr size_t MAX_KERNEL_NEEDLE = 256;
+constexpr size_t SCAN_PADDING = MAX_KERNEL_NEEDLE + SCAN_WIDTH;
+
+// Check a candidate whose first and last bytes already match
+static inline bool matches_at(const char* p, const char* needle, size_t needle_length) {
+    return needle_length <= 2 || std::memcmp(p + 1, needle + 1, needle_length - 2) == 0;
+}
+
+// ============================================================================
+// Scan blob
+// ============================================================================
+
+struct ScanBlob {
+    std::vector<char> text;         // Names in ID order, NUL-separated, then padding
+    std::vector<uint32_t> starts;   // Offset of each named ID's name
+    std::vector<uint32_t> ids;      // Parallel to starts
+    size_t text_length = 0;         // Bytes before the padding
+};
+
+static ScanBlob build_scan_blob() {
+    ScanBlob blob;
+    const Location* locations = get_all_locations();
+    const uint16_t* lengths = get_location_name_lengths();
+    size_t count = get_location_count();
+
+    size_t size = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (locations[i].name != nullptr) size += lengths[i] + 1;
+    }
+    blob.text.reserve(size + SCAN_PADDING);
+    for (size_t i = 0; i < count; i++) {
+        if (locations[i].name == nullptr) continue;
+        blob.starts.push_back(static_cast<uint32_t>(blob.text.size()));
+        blob.ids.push_back(static_cast<uint32_t>(i));
+        blob.text.insert(blob.text.end(), locations[i].name, locations[i].name + lengths[i] + 1);
+    }
+    blob.text_length = blob.text.size();
+    blob.text.resize(blob.text_length + SCAN_PADDING, '\0');
+    return blob;
+}
+
+static const ScanBlob& scan_blob() {
+    static const ScanBlob blob = build_scan_blob();
+    return blob;
+}
+
+void build_location_scan_blob() {
+    scan_blob();
+}
+
+const char* get_location_scan_text(size_t& length) {
+    const ScanBlob& blob = scan_blob();
+    length = blob.text_length;
+    return blob.text.data();
+}
+
+// Index into starts/ids of the name holding a blob offset
+static size_t name_at(const ScanBlob& blob, size_t offset) {
+    return static_cast<size_t>(
+        std::upper_bound(blob.starts.begin(), blob.starts.end(), static_cast<uint32_t>(offset)) -
+        blob.starts.begin()) - 1;
+}
+
+uint32_t get_location_scan_id(size_t offset) {
+    const ScanBlob& blob = scan_blob();
+    return blob.ids[name_at(blob, offset)];
+}
+
+const char* get_location_scan_kernel() {
+    return SCAN_KERNEL;
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+size_t scan_locations_containing(const char* needle, uint32_t* ids, size_t max_ids) {
+    size_t needle_length = std::strlen(needle);
+    if (needle_length == 0 || needle_length > MAX_KERNEL_NEEDLE) {
+        return scan_locations_containing_scalar(needle, ids, max_ids);
+    }
+
+    const ScanBlob& blob = scan_blob();
+    const char* text = blob.text.data();
+    size_t last_offset = needle_length - 1;
+    char first = needle[0];
+    char last = needle[last_offset];
+
+    size_t count = 0;
+    size_t pos = 0;
+    size_t name = 0;   // Cursor into starts; hits only move forward
+    while (pos < blob.text_length && count < max_ids) {
+        uint32_t mask = candidate_mask(text + pos, last_offset, first, last);
+        size_t next = pos + SCAN_WIDTH;
+        while (mask != 0) {
+            size_t hit = pos + static_cast<size_t>(__builtin_ctz(mask));
+            mask &= mask - 1;
+            if (hit >= blob.text_length || !matches_at(text + hit, needle, needle_length)) continue;
+
+            // A match never spans names (the needle has no NUL), so the name
+            // holding it starts at the last start <= hit. Resume after it.
+            while (name + 1 < blob.starts.size() && blob.starts[name + 1] <= hit) name++;
+            ids[count++] = blob.ids[name];
+            next = name + 1 < blob.starts.size() ? blob.starts[name + 1] : blob.text_length;
+            break;
+        }
+        pos = next;
+    }
+    return count;
+}
+
+size_t scan_locations_containing_scalar(const char* needle, uint32_t* ids, size_t max_ids) {
+    const Location* locations = get_all_locations();
+    size_t location_count = get_location_count();
+
+    size_t count = 0;
+    for (size_t i = 0; i < location_count && count < max_ids; i++) {
+        if (locations[i].name != nullptr && std::strstr(locations[i].name, needle) != nullptr) {
+            ids[count++] = static_cast<uint32_t>(i);
+        }
+    }
+    return count;
+}
+
+const char* scan_find_substring(const char* text, size_t text_length,
+                                const char* needle, size_t needle_length) {
+    if (needle_length == 0) return text;
+    if (needle_length > text_length) return nullptr;
+
+    size_t last_offset = needle_length - 1;
+    size_t end = text_length - last_offset;   // Candidate positions are < end
+    size_t pos = 0;
+
+    // Full blocks whose loads stay inside the text
+    while (pos + SCAN_WIDTH <= end) {
+        uint32_t mask = candidate_mask(text + pos, last_offset, needle[0], needle[last_offset]);
+        while (mask != 0) {
+            size_t hit = pos + static_cast<size_t>(__builtin_ctz(mask));
+            if (matches_at(text + hit, needle, needle_length)) return text + hit;
+            mask &= mask - 1;
+        }
+        pos += SCAN_WIDTH;
+    }
+
+    for (; pos < end; pos++) {
+        if (text[pos] == needle[0] && text[pos + last_offset] == needle[last_offset] &&
+            matches_at(text + pos, needle, needle_length)) {
+            return text + pos;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace mcp
+}  // namespace cesium
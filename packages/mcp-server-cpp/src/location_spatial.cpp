@@ -0,0 +1,322 @@
+/**
+ * Spatial Location Index Implementation
+ */
+
+#include "location_spatial.h"
+#include "location_database.h"
+#include "location_places.h"
+#include "location_store.h"
+#include <algorithm>
+#include <cmath>
+
+namespace cesium {
+namespace mcp {
+
+// Ranges this small are scanned rather than split further
+constexpr size_t SPATIAL_LEAF_SIZE = 16;
+
+constexpr double SPATIAL_PI = 3.14159265358979323846;
+constexpr double DEGREES_TO_RADIANS = SPATIAL_PI / 180.0;
+constexpr double FIXED_TO_RADIANS = DEGREES_TO_RADIANS / LOCATION_COORD_SCALE;
+
+struct SpatialPoint {
+    int32_t longitude;    // Fixed-point, as in the packed store
+    int32_t latitude;
+    uint32_t id;
+};
+
+static int32_t point_coord(const SpatialPoint& p, int axis) {
+    return axis == 0 ? p.longitude : p.latitude;
+}
+
+// Median split on alternating axes; [begin, mid) <= points[mid] <= [mid + 1, end)
+static void build_tree(SpatialPoint* points, size_t begin, size_t end, int axis) {
+    if (end - begin <= SPATIAL_LEAF_SIZE) return;
+
+    size_t mid = begin + (end - begin) / 2;
+    std::nth_element(points + begin, points + mid, points + end,
+                     [axis](const SpatialPoint& a, const SpatialPoint& b) {
+                         return point_coord(a, axis) < point_coord(b, axis);
+                     });
+    build_tree(points, begin, mid, 1 - axis);
+    build_tree(points, mid + 1, end, 1 - axis);
+}
+
+static std::vector<SpatialPoint> build_spatial_points() {
+    const Location* locations = get_all_locations();
+    const LocationStore& store = get_location_store();
+
+    std::vector<SpatialPoint> points;
+    points.reserve(store.count);
+    for (size_t i = 0; i < store.count; i++) {
+        if (locations[i].name == nullptr || !is_canonical_location(static_cast<uint32_t>(i))) continue;
+        points.push_back(SpatialPoint{store.longitude_e7[i], store.latitude_e7[i],
+                                      static_cast<uint32_t>(i)});
+    }
+    build_tree(points.data(), 0, points.size(), 0);
+    return points;
+}
+
+static const std::vector<SpatialPoint>& get_spatial_points() {
+    static const std::vector<SpatialPoint> points = build_spatial_points();
+    return points;
+}
+
+void build_location_spatial_index() {
+    get_spatial_points();
+}
+
+// ============================================================================
+// Rectangle queries
+// ============================================================================
+
+struct FixedRect {
+    int32_t west, south, east, north;
+};
+
+static void collect_in_rect(const SpatialPoint* points, size_t begin, size_t end, int axis,
+                            const FixedRect& rect, std::vector<uint32_t>& ids) {
+    if (end - begin <= SPATIAL_LEAF_SIZE) {
+        for (size_t i = begin; i < end; i++) {
+            const SpatialPoint& p = points[i];
+            if (p.longitude >= rect.west && p.longitude <= rect.east &&
+                p.latitude >= rect.south && p.latitude <= rect.north) {
+                ids.push_back(p.id);
+            }
+        }
+        return;
+    }
+
+    size_t mid = begin + (end - begin) / 2;
+    const SpatialPoint& p = points[mid];
+    if (p.longitude >= rect.west && p.longitude <= rect.east &&
+        p.latitude >= rect.south && p.latitude <= rect.north) {
+        ids.push_back(p.id);
+    }
+
+    int32_t split = point_coord(p, axis);
+    int32_t lo = axis == 0 ? rect.west : rect.south;
+    int32_t hi = axis == 0 ? rect.east : rect.north;
+    if (lo <= split) collect_in_rect(points, begin, mid, 1 - axis, rect, ids);
+    if (hi >= split) collect_in_rect(points, mid + 1, end, 1 - axis, rect, ids);
+}
+
+size_t find_locations_in_bbox(double west, double south, double east, double north,
+                              std::vector<uint32_t>& ids) {
+    ids.clear();
+    const std::vector<SpatialPoint>& points = get_spatial_points();
+    if (points.empty() || south > north) return 0;
+
+    south = std::max(south, -90.0);
+    north = std::min(north, 90.0);
+
+    FixedRect rect{0, location_coord_to_fixed(south), 0, location_coord_to_fixed(north)};
+    if (east - west >= 360.0) {
+        rect.west = location_coord_to_fixed(-180.0);
+        rect.east = location_coord_to_fixed(180.0);
+        collect_in_rect(points.data(), 0, points.size(), 0, rect, ids);
+        return ids.size();
+    }
+
+    west = std::remainder(west, 360.0);
+    east = std::remainder(east, 360.0);
+    if (west <= east) {
+        rect.west = location_coord_to_fixed(west);
+        rect.east = location_coord_to_fixed(east);
+        collect_in_rect(points.data(), 0, points.size(), 0, rect, ids);
+    } else {
+        // Crosses the antimeridian: [west, 180] and [-180, east]
+        rect.west = location_coord_to_fixed(west);
+        rect.east = location_coord_to_fixed(180.0);
+        collect_in_rect(points.data(), 0, points.size(), 0, rect, ids);
+        rect.west = location_coord_to_fixed(-180.0);
+        rect.east = location_coord_to_fixed(east);
+        collect_in_rect(points.data(), 0, points.size(), 0, rect, ids);
+    }
+    return ids.size();
+}
+
+// ============================================================================
+// Distance queries
+// ============================================================================
+
+// Distances are compared as haversines, h = sin^2(d / 2R), which grow with
+// distance and stay precise for nearby points
+
+struct QueryPoint {
+    double longitude;     // Radians
+    double latitude;
+    double sin_latitude;
+    double cos_latitude;
+};
+
+static double point_haversine(const QueryPoint& q, double longitude, double latitude) {
+    double s_lat = std::sin((latitude - q.latitude) * 0.5);
+    double s_lon = std::sin((longitude - q.longitude) * 0.5);
+    double h = s_lat * s_lat + q.cos_latitude * std::cos(latitude) * s_lon * s_lon;
+    return std::min(h, 1.0);
+}
+
+// Angular separation of two longitudes, in [0, pi]
+static double longitude_gap(double a, double b) {
+    double gap = std::fabs(a - b);
+    return gap > SPATIAL_PI ? 2.0 * SPATIAL_PI - gap : gap;
+}
+
+// Smallest haversine from the query to any point of a longitude/latitude
+// rectangle. For a fixed latitude the distance grows with the longitude gap,
+// so the closest point lies on the nearer meridian edge (or on the query's
+// own meridian when the rectangle spans it); along that meridian the
+// distance is minimised at an edge or at the foot of the perpendicular.
+static double rect_haversine(const QueryPoint& q, double west, double south,
+                             double east, double north) {
+    double gap = 0.0;
+    if (q.longitude < west || q.longitude > east) {
+        gap = std::min(longitude_gap(q.longitude, west), longitude_gap(q.longitude, east));
+    }
+
+    double s_lon = std::sin(gap * 0.5);
+    double lon_term = q.cos_latitude * s_lon * s_lon;
+    auto haversine_at = [&](double latitude) {
+        double s_lat = std::sin((latitude - q.latitude) * 0.5);
+        return s_lat * s_lat + lon_term * std::cos(latitude);
+    };
+
+    double best = std::min(haversine_at(south), haversine_at(north));
+    double foot = std::atan2(q.sin_latitude, q.cos_latitude * std::cos(gap));
+    if (foot > south && foot < north) {
+        best = std::min(best, haversine_at(foot));
+    }
+    return std::max(best, 0.0);
+}
+
+static double haversine_to_meters(double h) {
+    return 2.0 * EARTH_RADIUS_METERS * std::asin(std::sqrt(std::min(std::max(h, 0.0), 1.0)));
+}
+
+// A queued point (end == 0) or subtree [begin, end) with its bounds
+struct SearchItem {
+    double haversine;
+    uint32_t begin;
+    uint32_t end;
+    int axis;
+    double west, south, east, north;
+};
+
+size_t find_nearest_locations(double longitude, double latitude, size_t max_results,
+                              double max_distance, std::vector<SpatialMatch>& matches,
+                              int min_population) {
+    matches.clear();
+    const std::vector<SpatialPoint>& points = get_spatial_points();
+    const int32_t* population = get_location_store().population;
+    if (points.empty() || max_results == 0) return 0;
+
+    latitude = std::min(std::max(latitude, -90.0), 90.0);
+    QueryPoint q;
+    q.longitude = std::remainder(longitude, 360.0) * DEGREES_TO_RADIANS;
+    q.latitude = latitude * DEGREES_TO_RADIANS;
+    q.sin_latitude = std::sin(q.latitude);
+    q.cos_latitude = std::cos(q.latitude);
+
+    double max_haversine = 1.0;
+    if (max_distance > 0 && max_distance < SPATIAL_PI * EARTH_RADIUS_METERS) {
+        double s = std::sin(max_distance / EARTH_RADIUS_METERS * 0.5);
+        max_haversine = s * s;
+    }
+
+    auto heap_order = [](const SearchItem& a, const SearchItem& b) {
+        return a.haversine > b.haversine;
+    };
+    std::vector<SearchItem> heap;
+    heap.push_back(SearchItem{0.0, 0, static_cast<uint32_t>(points.size()), 0,
+                              -SPATIAL_PI, -SPATIAL_PI * 0.5, SPATIAL_PI, SPATIAL_PI * 0.5});
+
+    auto push_point = [&](uint32_t index) {
+        const SpatialPoint& p = points[index];
+        if (min_population > 0 && population[p.id] < min_population) return;
+        double h = point_haversine(q, p.longitude * FIXED_TO_RADIANS, p.latitude * FIXED_TO_RADIANS);
+        if (h > max_haversine) return;
+        heap.push_back(SearchItem{h, index, 0, 0, 0, 0, 0, 0});
+        std::push_heap(heap.begin(), heap.end(), heap_order);
+    };
+    auto push_node = [&](const SearchItem& node) {
+        if (node.begin >= node.end) return;
+        SearchItem item = node;
+        item.haversine = rect_haversine(q, node.west, node.south, node.east, node.north);
+        if (item.haversine > max_haversine) return;
+        heap.push_back(item);
+        std::push_heap(heap.begin(), heap.end(), heap_order);
+    };
+
+    // Items leave the heap in distance order, and a subtree's bound never
+    // exceeds the distance of anything inside it, so points come out sorted
+    while (!heap.empty() && matches.size() < max_results) {
+        std::pop_heap(heap.begin(), heap.end(), heap_order);
+        SearchItem item = heap.back();
+        heap.pop_back();
+
+        if (item.end == 0) {
+            matches.push_back(SpatialMatch{points[item.begin].id, haversine_to_meters(item.haversine)});
+            continue;
+        }
+
+        if (item.end - item.begin <= SPATIAL_LEAF_SIZE) {
+            for (uint32_t i = item.begin; i < item.end; i++) {
+                push_point(i);
+            }
+            continue;
+        }
+
+        uint32_t mid = item.begin + (item.end - item.begin) / 2;
+        push_point(mid);
+
+        double split = point_coord(points[mid], item.axis) * FIXED_TO_RADIANS;
+        SearchItem left = item;
+        SearchItem right = item;
+        left.end = mid;
+        right.begin = mid + 1;
+        left.axis = right.axis = 1 - item.axis;
+        if (item.axis == 0) {
+            left.east = split;
+            right.west = split;
+        } else {
+            left.north = split;
+            right.south = split;
+        }
+        push_node(left);
+        push_node(right);
+    }
+    return matches.size();
+}
+
+size_t find_locations_within_radius(double longitude, double latitude, double radius,
+                                    std::vector<SpatialMatch>& matches) {
+    matches.clear();
+    if (radius <= 0) return 0;
+    return find_nearest_locations(longitude, latitude, static_cast<size_t>(-1), radius, matches);
+}
+
+bool reverse_geocode_location(double longitude, double latitude, double max_distance,
+                              SpatialMatch& match) {
+    if (max_distance <= 0) return false;
+
+    std::vector<SpatialMatch> matches;
+    if (find_nearest_locations(longitude, latitude, 1, max_distance, matches, 1) == 0 &&
+        find_nearest_locations(longitude, latitude, 1, max_distance, matches) == 0) {
+        return false;
+    }
+    match = matches[0];
+    return true;
+}
+
+double great_circle_distance(double lon1, double lat1, double lon2, double lat2) {
+    QueryPoint q;
+    q.longitude = lon1 * DEGREES_TO_RADIANS;
+    q.latitude = lat1 * DEGREES_TO_RADIANS;
+    q.sin_latitude = std::sin(q.latitude);
+    q.cos_latitude = std::cos(q.latitude);
+    return haversine_to_meters(point_haversine(q, lon2 * DEGREES_TO_RADIANS, lat2 * DEGREES_TO_RADIANS));
+}
+
+}  // namespace mcp
+}  // namespace cesium
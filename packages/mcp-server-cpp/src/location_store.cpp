@@ -0,0 +1,142 @@
+/**
+ * Packed Location Store Implementation
+ */
+
+#include "location_store.h"
+#include "location_database.h"
+#include "location_index.h"
+#include "location_metadata.h"
+#include "utf8_fold.h"
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cesium {
+namespace mcp {
+
+struct LocationStoreData {
+    std::vector<char> folded_names;
+    std::vector<uint32_t> name_offsets;
+    std::vector<uint32_t> folded_offsets;
+    std::vector<int32_t> longitude_e7;
+    std::vector<int32_t> latitude_e7;
+    std::vector<float> heading;
+    std::vector<int32_t> population;
+    std::vector<uint8_t> type;
+    std::vector<uint16_t> country;
+    LocationStore view;
+};
+
+int32_t location_coord_to_fixed(double degrees) {
+    return static_cast<int32_t>(std::lround(degrees * LOCATION_COORD_SCALE));
+}
+
+static LocationStoreData build_store_data() {
+    LocationStoreData data;
+    const Location* locations = get_all_locations();
+    const uint16_t* lengths = get_location_name_lengths();
+    size_t count = get_location_count();
+
+    // Names are addressed in place; a missing name gets the block's last
+    // byte, a NUL
+    size_t names_size = 0;
+    const char* names = get_location_names(names_size);
+    uint32_t empty_name = names_size > 0 ? static_cast<uint32_t>(names_size - 1) : 0;
+
+    data.name_offsets.resize(count);
+    data.folded_offsets.resize(count);
+    data.longitude_e7.resize(count);
+    data.latitude_e7.resize(count);
+    data.heading.resize(count);
+    data.population.resize(count);
+    data.type.resize(count);
+    data.country.resize(count);
+
+    // Metadata generated for a different table is ignored rather than misaligned
+    const uint8_t* types = nullptr;
+    const char* countries = nullptr;
+    if (get_generated_location_metadata_count() == count) {
+        types = get_generated_location_types();
+        countries = get_generated_location_countries();
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        const Location& loc = locations[i];
+        data.name_offsets[i] = loc.name != nullptr ? static_cast<uint32_t>(loc.name - names) : empty_name;
+        data.folded_offsets[i] = data.name_offsets[i];
+
+        data.longitude_e7[i] = location_coord_to_fixed(loc.longitude);
+        data.latitude_e7[i] = location_coord_to_fixed(loc.latitude);
+        data.heading[i] = static_cast<float>(loc.heading);
+        data.population[i] = loc.population;
+        if (types != nullptr) {
+            const char code[3] = {countries[2 * i], countries[2 * i + 1], '\0'};
+            data.type[i] = types[i];
+            data.country[i] = parse_country_code(code);
+        }
+    }
+
+    // Folded keys that differ from their name reuse an identical name's bytes
+    // ("são paulo" -> "sao paulo") or go in the folded blob, interned among
+    // themselves
+    std::unordered_map<std::string, uint32_t> folded_keys;
+    char folded[256];
+    for (size_t i = 0; i < count; i++) {
+        if (locations[i].name == nullptr) continue;
+        size_t length = utf8_fold(locations[i].name, folded, sizeof(folded));
+        if (length == lengths[i] && std::memcmp(folded, locations[i].name, length) == 0) continue;
+
+        uint32_t same = find_location_id(folded);
+        if (same != INVALID_LOCATION_ID) {
+            data.folded_offsets[i] = data.name_offsets[same];
+            continue;
+        }
+        auto inserted = folded_keys.emplace(std::string(folded, length),
+                                            static_cast<uint32_t>(data.folded_names.size()) | STORE_FOLDED_KEY);
+        if (inserted.second) {
+            data.folded_names.insert(data.folded_names.end(), folded, folded + length + 1);
+        }
+        data.folded_offsets[i] = inserted.first->second;
+    }
+
+    data.view = LocationStore{
+        names, data.folded_names.data(), data.name_offsets.data(), data.folded_offsets.data(),
+        data.longitude_e7.data(), data.latitude_e7.data(),
+        data.heading.data(), data.population.data(),
+        data.type.data(), data.country.data(),
+        count, data.folded_names.size()
+    };
+    return data;
+}
+
+const LocationStore& get_location_store() {
+    static const LocationStoreData data = build_store_data();
+    return data.view;
+}
+
+void build_location_store() {
+    get_location_store();
+}
+
+size_t get_location_store_memory() {
+    const LocationStore& store = get_location_store();
+    return store.folded_names_size +
+           store.count * (2 * sizeof(uint32_t) + 2 * sizeof(int32_t) + sizeof(float) + sizeof(int32_t) +
+                          sizeof(uint8_t) + sizeof(uint16_t));
+}
+
+size_t get_location_table_memory() {
+    const uint16_t* lengths = get_location_name_lengths();
+    size_t count = get_location_count();
+
+    size_t bytes = count * sizeof(Location);
+    for (size_t i = 0; i < count; i++) {
+        bytes += lengths[i] + 1;
+    }
+    return bytes;
+}
+
+}  // namespace mcp
+}  // namespace cesium
@@ -0,0 +1,198 @@
+/**
+ * Location Suffix Array Implementation
+ */
+
+#include "location_suffix.h"
+#include "location_places.h"
+#include "location_scan.h"
+#include "location_store.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace cesium {
+namespace mcp {
+
+// Ranges longer than location count / ratio are served by the scan instead
+constexpr size_t SUFFIX_SCAN_RATIO = 16;
+
+// ============================================================================
+// Construction
+// ============================================================================
+
+// Suffix bytes from offset on, big-endian, zero past the name's NUL; equal
+// keys without a zero byte need the rest of the suffixes to order them
+static uint64_t suffix_key(const unsigned char* suffix, bool& complete) {
+    uint64_t key = 0;
+    size_t i = 0;
+    for (; i < 8 && suffix[i] != 0; i++) key = key << 8 | suffix[i];
+    complete = i < 8;
+    return i == 0 ? 0 : key << (8 * (8 - i));
+}
+
+struct KeyedSuffix {
+    uint64_t key;
+    uint32_t pos;
+    bool complete;
+};
+
+// Suffixes are bucketed by their first two bytes, then each bucket is sorted
+// on the next eight bytes, falling back to the full suffix on ties. Equal
+// suffixes ("ville" ending many names) keep blob order.
+static std::vector<uint32_t> build_suffix_array() {
+    size_t length = 0;
+    const unsigned char* text = reinterpret_cast<const unsigned char*>(get_location_scan_text(length));
+
+    std::vector<uint32_t> bucket_starts(65536 + 1, 0);
+    for (size_t i = 0; i < length; i++) {
+        if (text[i] != 0) bucket_starts[(text[i] << 8 | text[i + 1]) + 1]++;
+    }
+    for (size_t b = 0; b < 65536; b++) {
+        bucket_starts[b + 1] += bucket_starts[b];
+    }
+
+    std::vector<uint32_t> suffixes(bucket_starts[65536]);
+    std::vector<uint32_t> fill(bucket_starts.begin(), bucket_starts.end() - 1);
+    for (size_t i = 0; i < length; i++) {
+        if (text[i] != 0) suffixes[fill[text[i] << 8 | text[i + 1]]++] = static_cast<uint32_t>(i);
+    }
+
+    const char* chars = reinterpret_cast<const char*>(text);
+    std::vector<KeyedSuffix> keyed;
+    for (size_t b = 0; b < 65536; b++) {
+        // Second byte NUL: one-byte suffixes, all equal
+        if ((b & 0xFF) == 0 || bucket_starts[b + 1] - bucket_starts[b] < 2) continue;
+
+        keyed.clear();
+        for (uint32_t i = bucket_starts[b]; i < bucket_starts[b + 1]; i++) {
+            KeyedSuffix entry;
+            entry.pos = suffixes[i];
+            entry.key = suffix_key(text + entry.pos + 2, entry.complete);
+            keyed.push_back(entry);
+        }
+        std::sort(keyed.begin(), keyed.end(), [chars](const KeyedSuffix& a, const KeyedSuffix& c) {
+            if (a.key != c.key) return a.key < c.key;
+            if (!a.complete) {
+                int order = std::strcmp(chars + a.pos + 10, chars + c.pos + 10);
+                if (order != 0) return order < 0;
+            }
+            return a.pos < c.pos;
+        });
+        for (size_t i = 0; i < keyed.size(); i++) {
+            suffixes[bucket_starts[b] + i] = keyed[i].pos;
+        }
+    }
+    return suffixes;
+}
+
+static const std::vector<uint32_t>& get_suffix_array() {
+    static const std::vector<uint32_t> suffixes = build_suffix_array();
+    return suffixes;
+}
+
+void build_location_suffix_array() {
+    get_suffix_array();
+}
+
+size_t get_location_suffix_count() {
+    return get_suffix_array().size();
+}
+
+size_t get_location_suffix_memory() {
+    return get_suffix_array().capacity() * sizeof(uint32_t);
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+// Range of suffixes starting with needle
+static void find_suffix_range(const char* needle, const uint32_t*& first, const uint32_t*& last) {
+    const std::vector<uint32_t>& suffixes = get_suffix_array();
+    size_t text_length = 0;
+    const char* text = get_location_scan_text(text_length);
+    size_t needle_length = std::strlen(needle);
+
+    first = std::lower_bound(suffixes.data(), suffixes.data() + suffixes.size(), needle,
+                             [text, needle_length](uint32_t pos, const char* value) {
+        return std::strncmp(text + pos, value, needle_length) < 0;
+    });
+    last = std::upper_bound(first, suffixes.data() + suffixes.size(), needle,
+                            [text, needle_length](const char* value, uint32_t pos) {
+        return std::strncmp(text + pos, value, needle_length) > 0;
+    });
+}
+
+size_t suffix_locations_containing(const char* needle, uint32_t* ids, size_t max_ids) {
+    if (needle[0] == '\0') return scan_locations_containing_scalar(needle, ids, max_ids);
+
+    const uint32_t* first;
+    const uint32_t* last;
+    find_suffix_range(needle, first, last);
+
+    // A name matching more than once contributes several suffixes
+    std::vector<uint32_t> matches;
+    matches.reserve(static_cast<size_t>(last - first));
+    for (const uint32_t* it = first; it != last; ++it) {
+        matches.push_back(get_location_scan_id(*it));
+    }
+    std::sort(matches.begin(), matches.end());
+    matches.erase(std::unique(matches.begin(), matches.end()), matches.end());
+
+    size_t count = std::min(matches.size(), max_ids);
+    std::copy(matches.begin(), matches.begin() + count, ids);
+    return count;
+}
+
+size_t search_locations_containing(const char* substring, const LocationFilter& filter,
+                                   const Location** results, size_t max_results) {
+    char needle[256];
+    normalize_location_name(substring, needle, sizeof(needle));
+    if (needle[0] == '\0' || max_results == 0) return 0;
+
+    size_t location_count = get_location_count();
+    std::vector<uint32_t> ids;
+
+    const uint32_t* first;
+    const uint32_t* last;
+    find_suffix_range(needle, first, last);
+    if (static_cast<size_t>(last - first) > location_count / SUFFIX_SCAN_RATIO) {
+        // Each suffix costs a binary search to map back to its name; past
+        // a few thousand of them the linear scan is cheaper
+        ids.resize(location_count);
+        ids.resize(scan_locations_containing(needle, ids.data(), ids.size()));
+    } else {
+        ids.reserve(static_cast<size_t>(last - first));
+        for (const uint32_t* it = first; it != last; ++it) {
+            ids.push_back(get_location_scan_id(*it));
+        }
+    }
+
+    // One entry per place, checked against the filter once
+    std::vector<uint64_t> seen((location_count + 63) / 64, 0);
+    std::vector<uint32_t> places;
+    for (uint32_t id : ids) {
+        uint32_t canonical = get_canonical_location_id(id);
+        uint64_t bit = uint64_t(1) << (canonical & 63);
+        if (seen[canonical >> 6] & bit) continue;
+        seen[canonical >> 6] |= bit;
+        if (location_matches_filter(canonical, filter)) places.push_back(canonical);
+    }
+
+    const int32_t* population = get_location_store().population;
+    size_t count = std::min(places.size(), max_results);
+    std::partial_sort(places.begin(), places.begin() + count, places.end(),
+                      [population](uint32_t a, uint32_t b) {
+        if (population[a] != population[b]) return population[a] > population[b];
+        return a < b;
+    });
+
+    const Location* locations = get_all_locations();
+    for (size_t i = 0; i < count; i++) {
+        results[i] = &locations[places[i]];
+    }
+    return count;
+}
+
+}  // namespace mcp
+}  // namespace cesium
@@ -0,0 +1,274 @@
+/**
+ * Symmetric-Delete Typo Index Implementation
+ */
+
+#include "location_symspell.h"
+#include "location_index.h"
+#include "location_database.h"
+#include <algorithm>
+#include <cstring>
+
+namespace cesium {
+namespace mcp {
+
+// Serialized layout: SymSpellHeader, then keys[key_count],
+// offsets[key_count + 1] and ids[id_count], all uint32_t
+static const char SYMSPELL_MAGIC[8] = {'S', 'Y', 'M', 'S', 'P', 'L', '0', '1'};
+constexpr uint32_t SYMSPELL_VERSION = 1;
+constexpr size_t SYMSPELL_MAX_PREFIX = 32;
+
+struct SymSpellHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t max_distance;
+    uint32_t prefix_length;
+    uint32_t location_count;
+    uint32_t fingerprint;     // get_location_fingerprint(), rejects stale files
+    uint32_t key_count;
+    uint32_t id_count;
+    uint32_t reserved;
+};
+
+// Delete hashes in ascending order; the names producing keys[i] are
+// ids[offsets[i] .. offsets[i + 1]). Tables either point into `storage`
+// (built here) or into an attached buffer.
+struct SymSpellIndex {
+    int max_distance = 0;
+    int prefix_length = 0;
+    const uint32_t* keys = nullptr;
+    const uint32_t* offsets = nullptr;
+    const uint32_t* ids = nullptr;
+    size_t key_count = 0;
+    size_t id_count = 0;
+    std::vector<uint32_t> storage;
+};
+
+static SymSpellIndex symspell;
+
+// Append the hash of `word` and of everything reachable by deleting up to
+// `remaining` more bytes at positions >= start (each set generated once)
+static void collect_deletes(const char* word, size_t length, size_t start, int remaining,
+                            std::vector<uint32_t>& hashes) {
+    hashes.push_back(hash_location_name(word));
+    if (remaining == 0) return;
+
+    char shorter[SYMSPELL_MAX_PREFIX + 1];
+    for (size_t i = start; i < length; i++) {
+        std::memcpy(shorter, word, i);
+        std::memcpy(shorter + i, word + i + 1, length - i);  // Includes the NUL
+        collect_deletes(shorter, length - 1, i, remaining - 1, hashes);
+    }
+}
+
+// Distinct delete hashes of the first prefix_length bytes of a string
+static void delete_hashes(const char* s, size_t prefix_length, int max_distance,
+                          std::vector<uint32_t>& hashes) {
+    char prefix[SYMSPELL_MAX_PREFIX + 1];
+    size_t length = std::min(std::strlen(s), prefix_length);
+    std::memcpy(prefix, s, length);
+    prefix[length] = '\0';
+
+    hashes.clear();
+    collect_deletes(prefix, length, 0, max_distance, hashes);
+    std::sort(hashes.begin(), hashes.end());
+    hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+}
+
+bool build_symspell_index(int max_distance, int prefix_length) {
+    if (max_distance < 1 || max_distance > 4 ||
+        prefix_length <= max_distance || prefix_length > static_cast<int>(SYMSPELL_MAX_PREFIX)) {
+        return false;
+    }
+
+    const Location* locations = get_all_locations();
+    size_t count = get_location_count();
+
+    // (hash, id) pairs sorted by hash, then grouped into keys and ID runs
+    std::vector<uint64_t> pairs;
+    std::vector<uint32_t> hashes;
+    for (size_t i = 0; i < count; i++) {
+        if (locations[i].name == nullptr) continue;
+        delete_hashes(locations[i].name, static_cast<size_t>(prefix_length), max_distance, hashes);
+        for (uint32_t hash : hashes) {
+            pairs.push_back((static_cast<uint64_t>(hash) << 32) | i);
+        }
+    }
+    std::sort(pairs.begin(), pairs.end());
+
+    size_t key_count = 0;
+    for (size_t p = 0; p < pairs.size(); p++) {
+        if (p == 0 || (pairs[p] >> 32) != (pairs[p - 1] >> 32)) key_count++;
+    }
+
+    SymSpellIndex index;
+    index.max_distance = max_distance;
+    index.prefix_length = prefix_length;
+    index.key_count = key_count;
+    index.id_count = pairs.size();
+    index.storage.resize(key_count * 2 + 1 + pairs.size());
+
+    uint32_t* keys = index.storage.data();
+    uint32_t* offsets = keys + key_count;
+    uint32_t* ids = offsets + key_count + 1;
+    size_t k = 0;
+    for (size_t p = 0; p < pairs.size(); p++) {
+        uint32_t hash = static_cast<uint32_t>(pairs[p] >> 32);
+        if (p == 0 || hash != keys[k - 1]) {
+            keys[k] = hash;
+            offsets[k] = static_cast<uint32_t>(p);
+            k++;
+        }
+        ids[p] = static_cast<uint32_t>(pairs[p]);
+    }
+    offsets[key_count] = static_cast<uint32_t>(pairs.size());
+
+    index.keys = keys;
+    index.offsets = offsets;
+    index.ids = ids;
+    symspell = std::move(index);
+    return true;
+}
+
+int get_symspell_max_distance() {
+    if (symspell.keys == nullptr) {
+        build_symspell_index();
+    }
+    return symspell.max_distance;
+}
+
+bool find_symspell_candidates(const char* normalized, int max_distance,
+                              std::vector<uint32_t>& candidates) {
+    candidates.clear();
+    if (max_distance > get_symspell_max_distance()) {
+        return false;
+    }
+    if (max_distance < 0) {
+        return true;
+    }
+
+    // Deletes of the query only need to go as deep as the query distance;
+    // the index side already covers up to its own maximum
+    std::vector<uint32_t> hashes;
+    delete_hashes(normalized, static_cast<size_t>(symspell.prefix_length), max_distance, hashes);
+
+    const uint32_t* keys_end = symspell.keys + symspell.key_count;
+    for (uint32_t hash : hashes) {
+        const uint32_t* key = std::lower_bound(symspell.keys, keys_end, hash);
+        if (key == keys_end || *key != hash) continue;
+        size_t k = static_cast<size_t>(key - symspell.keys);
+        candidates.insert(candidates.end(), symspell.ids + symspell.offsets[k],
+                          symspell.ids + symspell.offsets[k + 1]);
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+    return true;
+}
+
+size_t get_symspell_index_size() {
+    get_symspell_max_distance();
+    return sizeof(SymSpellHeader) +
+           (symspell.key_count * 2 + 1 + symspell.id_count) * sizeof(uint32_t);
+}
+
+size_t serialize_symspell_index(uint8_t* output, size_t output_size) {
+    size_t size = get_symspell_index_size();
+    if (output_size < size) {
+        return 0;
+    }
+
+    SymSpellHeader header;
+    std::memcpy(header.magic, SYMSPELL_MAGIC, sizeof(header.magic));
+    header.version = SYMSPELL_VERSION;
+    header.max_distance = static_cast<uint32_t>(symspell.max_distance);
+    header.prefix_length = static_cast<uint32_t>(symspell.prefix_length);
+    header.location_count = static_cast<uint32_t>(get_location_count());
+    header.fingerprint = get_location_fingerprint();
+    header.key_count = static_cast<uint32_t>(symspell.key_count);
+    header.id_count = static_cast<uint32_t>(symspell.id_count);
+    header.reserved = 0;
+
+    uint8_t* out = output;
+    std::memcpy(out, &header, sizeof(header));
+    out += sizeof(header);
+    std::memcpy(out, symspell.keys, symspell.key_count * sizeof(uint32_t));
+    out += symspell.key_count * sizeof(uint32_t);
+    std::memcpy(out, symspell.offsets, (symspell.key_count + 1) * sizeof(uint32_t));
+    out += (symspell.key_count + 1) * sizeof(uint32_t);
+    std::memcpy(out, symspell.ids, symspell.id_count * sizeof(uint32_t));
+
+    return size;
+}
+
+// Lookups follow offsets[] into ids[] and ids[] into the location table
+// without bounds checks, so an attached index is checked once, up front
+static bool valid_symspell_tables(const SymSpellIndex& index, size_t location_count) {
+    if (index.offsets[0] != 0 || index.offsets[index.key_count] != index.id_count) {
+        return false;
+    }
+    for (size_t k = 0; k < index.key_count; k++) {
+        if (index.offsets[k] > index.offsets[k + 1]) return false;
+        if (k > 0 && index.keys[k - 1] >= index.keys[k]) return false;
+    }
+    for (size_t i = 0; i < index.id_count; i++) {
+        if (index.ids[i] >= location_count) return false;
+    }
+    return true;
+}
+
+bool attach_symspell_index(const uint8_t* data, size_t size) {
+    if (data == nullptr || size < sizeof(SymSpellHeader)) {
+        return false;
+    }
+
+    SymSpellHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, SYMSPELL_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != SYMSPELL_VERSION ||
+        header.max_distance < 1 || header.max_distance > 4 ||
+        header.prefix_length <= header.max_distance ||
+        header.prefix_length > SYMSPELL_MAX_PREFIX) {
+        return false;
+    }
+    if (header.location_count != get_location_count() ||
+        header.fingerprint != get_location_fingerprint()) {
+        return false;
+    }
+
+    // 64-bit: size_t is 32 bits under WASM, where this sum could wrap
+    uint64_t table_bytes =
+        (static_cast<uint64_t>(header.key_count) * 2 + 1 + header.id_count) * sizeof(uint32_t);
+    if (table_bytes > size - sizeof(header)) {
+        return false;
+    }
+    size_t table_words = static_cast<size_t>(table_bytes / sizeof(uint32_t));
+
+    SymSpellIndex index;
+    index.max_distance = static_cast<int>(header.max_distance);
+    index.prefix_length = static_cast<int>(header.prefix_length);
+    index.key_count = header.key_count;
+    index.id_count = header.id_count;
+
+    const uint8_t* tables = data + sizeof(header);
+    const uint32_t* words;
+    if (reinterpret_cast<uintptr_t>(tables) % alignof(uint32_t) == 0) {
+        words = reinterpret_cast<const uint32_t*>(tables);
+    } else {
+        index.storage.resize(table_words);
+        std::memcpy(index.storage.data(), tables, table_words * sizeof(uint32_t));
+        words = index.storage.data();
+    }
+    index.keys = words;
+    index.offsets = words + index.key_count;
+    index.ids = index.offsets + index.key_count + 1;
+
+    if (!valid_symspell_tables(index, header.location_count)) {
+        return false;
+    }
+
+    symspell = std::move(index);
+    return true;
+}
+
+}  // namespace mcp
+}  // namespace cesium
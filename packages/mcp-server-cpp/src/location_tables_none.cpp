@@ -0,0 +1,18 @@
+/**
+ * Prebuilt Location Tables: none
+ *
+ * Linked by builds without generated tables (and by the generator itself),
+ * so every index is built at runtime.
+ */
+
+#include "location_tables.h"
+
+namespace cesium {
+namespace mcp {
+
+const LocationTables* get_prebuilt_location_tables() {
+    return nullptr;
+}
+
+}  // namespace mcp
+}  // namespace cesium
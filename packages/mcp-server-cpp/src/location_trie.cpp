@@ -0,0 +1,286 @@
+/**
+ * Location Name Autocomplete Implementation
+ */
+
+#include "location_trie.h"
+#include "location_index.h"
+#include "location_tables.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace cesium {
+namespace mcp {
+
+// Trie nodes (LocationTrieNode, location_tables.h) are stored breadth-first
+// so the children of a node are contiguous, and their first edge bytes sit
+// in a parallel byte array that a keystroke lookup scans without touching
+// the node structs.
+//
+// Edge labels are not stored: a node's label is the slice
+// [parent depth, depth) of the first name in its range.
+struct LocationTrie {
+    // Filled when built at runtime; the views below point here or at the
+    // prebuilt tables
+    std::vector<LocationTrieNode> node_storage;
+    std::vector<uint8_t> first_byte_storage;
+    std::vector<uint32_t> best_storage;
+
+    const LocationTrieNode* nodes = nullptr;
+    const uint8_t* first_bytes = nullptr;
+    size_t node_count = 0;
+
+    // Segment tree over name ranks: each slot holds the best-ranked entry
+    // (highest population, then alphabetical) in its span
+    const uint32_t* best = nullptr;
+    size_t leaves = 0;
+};
+
+// Name of the entry at a position in the name-sorted index
+static const char* name_at_rank(const Location* locations, const uint32_t* sorted, uint32_t rank) {
+    return locations[sorted[rank]].name;
+}
+
+// Rank comparison used for top-k: population descending, then name order
+static bool outranks(const Location* locations, const uint32_t* sorted, uint32_t a, uint32_t b) {
+    if (b == INVALID_LOCATION_ID) return a != INVALID_LOCATION_ID;
+    if (a == INVALID_LOCATION_ID) return false;
+    int pop_a = locations[sorted[a]].population;
+    int pop_b = locations[sorted[b]].population;
+    if (pop_a != pop_b) return pop_a > pop_b;
+    return a < b;
+}
+
+static LocationTrie build_trie() {
+    LocationTrie trie;
+    if (const LocationTables* prebuilt = get_prebuilt_location_tables()) {
+        trie.nodes = prebuilt->trie_nodes;
+        trie.first_bytes = prebuilt->trie_first_bytes;
+        trie.node_count = prebuilt->trie_node_count;
+        trie.best = prebuilt->trie_best;
+        trie.leaves = prebuilt->trie_leaves;
+        return trie;
+    }
+
+    std::vector<LocationTrieNode>& nodes = trie.node_storage;
+    std::vector<uint8_t>& first_bytes = trie.first_byte_storage;
+    std::vector<uint32_t>& best = trie.best_storage;
+    const Location* locations = get_all_locations();
+    size_t count;
+    const uint32_t* sorted = get_locations_by_name(count);
+
+    std::vector<uint16_t> lengths(count);
+    for (size_t r = 0; r < count; r++) {
+        size_t len = std::strlen(name_at_rank(locations, sorted, static_cast<uint32_t>(r)));
+        lengths[r] = static_cast<uint16_t>(std::min<size_t>(len, 0xFFFF));
+    }
+
+    // In a sorted run the common prefix of the first and last name is
+    // shared by every name in between
+    auto common_prefix = [&](uint32_t a, uint32_t b) -> uint16_t {
+        const char* s1 = name_at_rank(locations, sorted, a);
+        const char* s2 = name_at_rank(locations, sorted, b);
+        uint16_t limit = std::min(lengths[a], lengths[b]);
+        uint16_t i = 0;
+        while (i < limit && s1[i] == s2[i]) i++;
+        return i;
+    };
+
+    uint32_t n = static_cast<uint32_t>(count);
+    uint16_t root_depth = n > 0 ? common_prefix(0, n - 1) : 0;
+    nodes.push_back(LocationTrieNode{0, 0, n, 0, root_depth});
+    first_bytes.push_back(0);
+
+    // Breadth-first: each node appends all of its children in one go
+    for (size_t i = 0; i < nodes.size(); i++) {
+        LocationTrieNode node = nodes[i];
+        uint32_t r = node.range_begin;
+
+        // Names that end exactly here sort first and have no child edge
+        while (r < node.range_end && lengths[r] == node.depth) r++;
+
+        uint32_t first_child = static_cast<uint32_t>(nodes.size());
+        uint16_t child_count = 0;
+        while (r < node.range_end) {
+            char c = name_at_rank(locations, sorted, r)[node.depth];
+            uint32_t g = r + 1;
+            while (g < node.range_end && name_at_rank(locations, sorted, g)[node.depth] == c) g++;
+
+            uint16_t depth = (g - r == 1) ? lengths[r] : common_prefix(r, g - 1);
+            nodes.push_back(LocationTrieNode{0, r, g, 0, depth});
+            first_bytes.push_back(static_cast<uint8_t>(c));
+            child_count++;
+            r = g;
+        }
+
+        nodes[i].first_child = first_child;
+        nodes[i].child_count = child_count;
+    }
+
+    // Range-maximum segment tree for population-ranked completion
+    trie.leaves = 1;
+    while (trie.leaves < count) trie.leaves <<= 1;
+    best.assign(trie.leaves * 2, INVALID_LOCATION_ID);
+    for (uint32_t r = 0; r < n; r++) {
+        best[trie.leaves + r] = r;
+    }
+    for (size_t i = trie.leaves - 1; i > 0; i--) {
+        uint32_t left = best[i * 2];
+        uint32_t right = best[i * 2 + 1];
+        best[i] = outranks(locations, sorted, right, left) ? right : left;
+    }
+
+    trie.nodes = nodes.data();
+    trie.first_bytes = first_bytes.data();
+    trie.node_count = nodes.size();
+    trie.best = best.data();
+    return trie;
+}
+
+static const LocationTrie& location_trie() {
+    static const LocationTrie trie = build_trie();
+    return trie;
+}
+
+// Best-ranked entry in name ranks [lo, hi)
+static uint32_t best_in_range(const LocationTrie& trie, const Location* locations,
+                              const uint32_t* sorted, uint32_t lo, uint32_t hi) {
+    uint32_t best = INVALID_LOCATION_ID;
+    size_t l = lo + trie.leaves;
+    size_t h = hi + trie.leaves;
+    while (l < h) {
+        if (l & 1) {
+            if (outranks(locations, sorted, trie.best[l], best)) best = trie.best[l];
+            l++;
+        }
+        if (h & 1) {
+            h--;
+            if (outranks(locations, sorted, trie.best[h], best)) best = trie.best[h];
+        }
+        l >>= 1;
+        h >>= 1;
+    }
+    return best;
+}
+
+void build_location_trie() {
+    location_trie();
+}
+
+void get_location_trie_tables(LocationTables& tables) {
+    const LocationTrie& trie = location_trie();
+    tables.trie_nodes = trie.nodes;
+    tables.trie_first_bytes = trie.first_bytes;
+    tables.trie_node_count = trie.node_count;
+    tables.trie_best = trie.best;
+    tables.trie_leaves = trie.leaves;
+}
+
+AutocompleteCursor autocomplete_begin() {
+    const LocationTrie& trie = location_trie();
+    return AutocompleteCursor{0, 0, trie.nodes[0].range_end > trie.nodes[0].range_begin};
+}
+
+bool autocomplete_advance(AutocompleteCursor& cursor, const char* bytes, size_t length) {
+    if (!cursor.valid) return false;
+
+    const LocationTrie& trie = location_trie();
+    const Location* locations = get_all_locations();
+    size_t count;
+    const uint32_t* sorted = get_locations_by_name(count);
+
+    for (size_t i = 0; i < length; i++) {
+        const LocationTrieNode& node = trie.nodes[cursor.node];
+        char c = bytes[i];
+
+        if (cursor.depth < node.depth) {
+            // Still inside this node's edge label
+            if (name_at_rank(locations, sorted, node.range_begin)[cursor.depth] != c) {
+                cursor.valid = false;
+                return false;
+            }
+        } else {
+            const uint8_t* labels = trie.first_bytes + node.first_child;
+            uint16_t child = 0;
+            while (child < node.child_count && labels[child] != static_cast<uint8_t>(c)) child++;
+            if (child == node.child_count) {
+                cursor.valid = false;
+                return false;
+            }
+            cursor.node = node.first_child + child;
+        }
+        cursor.depth++;
+    }
+
+    return true;
+}
+
+size_t autocomplete_count(const AutocompleteCursor& cursor) {
+    if (!cursor.valid) return 0;
+    const LocationTrieNode& node = location_trie().nodes[cursor.node];
+    return node.range_end - node.range_begin;
+}
+
+size_t autocomplete_top(const AutocompleteCursor& cursor, const Location** results,
+                        size_t max_results) {
+    if (!cursor.valid || max_results == 0) return 0;
+
+    const LocationTrie& trie = location_trie();
+    const Location* locations = get_all_locations();
+    size_t count;
+    const uint32_t* sorted = get_locations_by_name(count);
+    const LocationTrieNode& node = trie.nodes[cursor.node];
+
+    // Best-first expansion: pop the range whose maximum ranks highest, emit
+    // that entry, then push the two sub-ranges on either side of it
+    struct Span {
+        uint32_t best;
+        uint32_t lo;
+        uint32_t hi;
+    };
+    auto heap_order = [&](const Span& a, const Span& b) {
+        return outranks(locations, sorted, b.best, a.best);
+    };
+
+    std::vector<Span> heap;
+    heap.reserve(max_results * 2 + 1);
+    heap.push_back(Span{best_in_range(trie, locations, sorted, node.range_begin, node.range_end),
+                        node.range_begin, node.range_end});
+
+    size_t found = 0;
+    while (!heap.empty() && found < max_results) {
+        std::pop_heap(heap.begin(), heap.end(), heap_order);
+        Span span = heap.back();
+        heap.pop_back();
+        if (span.best == INVALID_LOCATION_ID) continue;
+
+        results[found++] = &locations[sorted[span.best]];
+
+        if (span.lo < span.best) {
+            heap.push_back(Span{best_in_range(trie, locations, sorted, span.lo, span.best),
+                                span.lo, span.best});
+            std::push_heap(heap.begin(), heap.end(), heap_order);
+        }
+        if (span.best + 1 < span.hi) {
+            heap.push_back(Span{best_in_range(trie, locations, sorted, span.best + 1, span.hi),
+                                span.best + 1, span.hi});
+            std::push_heap(heap.begin(), heap.end(), heap_order);
+        }
+    }
+
+    return found;
+}
+
+size_t autocomplete_locations(const char* prefix, const Location** results, size_t max_results) {
+    char normalized[256];
+    normalize_location_name(prefix, normalized, sizeof(normalized));
+
+    AutocompleteCursor cursor = autocomplete_begin();
+    if (!autocomplete_advance(cursor, normalized, std::strlen(normalized))) {
+        return 0;
+    }
+    return autocomplete_top(cursor, results, max_results);
+}
+
+}  // namespace mcp
+}  // namespace cesium
@@ -3,6 +3,7 @@
  */
 
 #include "mcp_server.h"
+#include "location_binary.h"
 #include <cstdio>
 #include <cstring>
 
@@ -15,6 +16,16 @@ int main(int argc, char* argv[]) {
     // Initialize
     init();
 
+    // Optional LOCDB001 file (scripts/build-binary-locations.mjs output)
+    if (argc > 1) {
+        if (cesium::mcp::open_location_database(argv[1])) {
+            printf("Mapped %s (%zu locations)\n\n", argv[1],
+                   cesium::mcp::get_binary_location_count());
+        } else {
+            printf("Could not map %s, using compiled-in locations\n\n", argv[1]);
+        }
+    }
+
     // Test resolve location
     printf("Testing resolveLocation:\n");
     const char* test_locations[] = {
@@ -26,6 +37,18 @@ int main(int argc, char* argv[]) {
         printf("  %s -> %s\n", loc, result);
     }
 
+    // Test autocomplete, one keystroke at a time
+    printf("\nTesting autocompleteLocations:\n");
+    const char* keystrokes[] = {"s", "sa", "san", "san f", "zzz"};
+    for (const char* prefix : keystrokes) {
+        printf("  %s -> %s\n", prefix, autocompleteLocations(prefix, 5));
+    }
+
+    // Test local reverse geocoding (the ocean point has nothing nearby)
+    printf("\nTesting reverseGeocode:\n");
+    printf("  -122.30,47.60 -> %s\n", reverseGeocode(-122.30, 47.60, 0));
+    printf("  -140.00,-40.00 -> %s\n", reverseGeocode(-140.0, -40.0, 0));
+
     printf("\nTesting handleMessage (initialize):\n");
     const char* init_msg = R"({"jsonrpc":"2.0","id":1,"method":"initialize","params":{}})";
     const char* response = handleMessage(init_msg);
@@ -56,6 +79,133 @@ int main(int argc, char* argv[]) {
     printf("  Request: %s\n", sphere_msg);
     printf("  Response: %s\n", response);
 
+    printf("\nTesting handleMessage (tools/call findNearbyLocations):\n");
+    const char* nearby_msg = R"({"jsonrpc":"2.0","id":6,"method":"tools/call","params":{"name":"findNearbyLocations","arguments":{"location":"cern","count":5}}})";
+    response = handleMessage(nearby_msg);
+    printf("  Request: %s\n", nearby_msg);
+    printf("  Response: %s\n", response);
+
+    printf("\nTesting handleMessage (tools/call findLocationsInView):\n");
+    const char* view_msg = R"({"jsonrpc":"2.0","id":7,"method":"tools/call","params":{"name":"findLocationsInView","arguments":{"west":2.2,"south":48.8,"east":2.5,"north":48.95,"count":5}}})";
+    response = handleMessage(view_msg);
+    printf("  Request: %s\n", view_msg);
+    printf("  Response: %s\n", response);
+
+    printf("\nTesting handleMessage (tools/call getTopCitiesByPopulation in Europe):\n");
+    const char* top_msg = R"({"jsonrpc":"2.0","id":8,"method":"tools/call","params":{"name":"getTopCitiesByPopulation","arguments":{"count":5,"west":-25,"south":34,"east":45,"north":72}}})";
+    response = handleMessage(top_msg);
+    printf("  Request: %s\n", top_msg);
+    printf("  Response: %s\n", response);
+
+    printf("\nTesting handleMessage (tools/call resolveLocation, cities only):\n");
+    const char* typed_msg = R"({"jsonrpc":"2.0","id":9,"method":"tools/call","params":{"name":"resolveLocation","arguments":{"location":"paris","type":"city"}}})";
+    response = handleMessage(typed_msg);
+    printf("  Request: %s\n", typed_msg);
+    printf("  Response: %s\n", response);
+    const char* typed_fuzzy_msg = R"({"jsonrpc":"2.0","id":23,"method":"tools/call","params":{"name":"resolveLocation","arguments":{"location":"pari","type":"city","maxDistance":1}}})";
+    response = handleMessage(typed_fuzzy_msg);
+    printf("  Request: %s\n", typed_fuzzy_msg);
+    printf("  Response: %s\n", response);
+
+    printf("\nTesting handleMessage (tools/call listLocations, airports in France):\n");
+    const char* list_msg = R"({"jsonrpc":"2.0","id":10,"method":"tools/call","params":{"name":"listLocations","arguments":{"prefix":"a","type":"airport","country":"fr"}}})";
+    response = handleMessage(list_msg);
+    printf("  Request: %s\n", list_msg);
+    printf("  Response: %s\n", response);
+
+    printf("\nTesting handleMessage (tools/call listLocations, unknown type and country):\n");
+    const char* bad_filter_msg = R"({"jsonrpc":"2.0","id":18,"method":"tools/call","params":{"name":"listLocations","arguments":{"prefix":"a","type":"town"}}})";
+    response = handleMessage(bad_filter_msg);
+    printf("  Request: %s\n", bad_filter_msg);
+    printf("  Response: %s\n", response);
+    bad_filter_msg = R"({"jsonrpc":"2.0","id":19,"method":"tools/call","params":{"name":"getTopCitiesByPopulation","arguments":{"country":"usa"}}})";
+    response = handleMessage(bad_filter_msg);
+    printf("  Request: %s\n", bad_filter_msg);
+    printf("  Response: %s\n", response);
+
+    printf("\nTesting handleMessage (tools/call resolveLocation, other spellings):\n");
+    const char* folded_msg = R"({"jsonrpc":"2.0","id":11,"method":"tools/call","params":{"name":"resolveLocation","arguments":{"location":"SAO PAULO"}}})";
+    response = handleMessage(folded_msg);
+    printf("  Request: %s\n", folded_msg);
+    printf("  Response: %s\n", response);
+    const char* folded_alias_msg = R"({"jsonrpc":"2.0","id":22,"method":"tools/call","params":{"name":"resolveLocation","arguments":{"location":"Zürich"}}})";
+    response = handleMessage(folded_alias_msg);
+    printf("  Request: %s\n", folded_alias_msg);
+    printf("  Response: %s\n", response);
+
+    printf("\nTesting handleMessage (tools/call resolveLocations batch):\n");
+    const char* batch_msg = R"({"jsonrpc":"2.0","id":13,"method":"tools/call","params":{"name":"resolveLocations","arguments":{"names":["paris","London","sao paulo","not a real place","paris","tokio"],"maxDistance":2}}})";
+    response = handleMessage(batch_msg);
+    printf("  Request: %s\n", batch_msg);
+    printf("  Response: %s\n", response);
+
+    printf("\nTesting handleMessage (tools/call resolveLocations with a non-string name):\n");
+    const char* mixed_batch_msg = R"({"jsonrpc":"2.0","id":21,"method":"tools/call","params":{"name":"resolveLocations","arguments":{"names":["paris",42,"not a place","london"]}}})";
+    response = handleMessage(mixed_batch_msg);
+    printf("  Request: %s\n", mixed_batch_msg);
+    printf("  Response: %s\n", response);
+
+    printf("\nTesting handleMessage (tools/call searchLocationsContaining):\n");
+    const char* infix_msg = R"({"jsonrpc":"2.0","id":14,"method":"tools/call","params":{"name":"searchLocationsContaining","arguments":{"text":"Berg","count":5}}})";
+    response = handleMessage(infix_msg);
+    printf("  Request: %s\n", infix_msg);
+    printf("  Response: %s\n", response);
+
+    printf("\nTesting handleMessage (tools/call addPolyline with positions):\n");
+    const char* polyline_msg = R"({"jsonrpc":"2.0","id":15,"method":"tools/call","params":{"name":"addPolyline","arguments":{"positions":[{"longitude":-122.4194,"latitude":37.7749},{"longitude":-118.2437,"latitude":34.0522,"height":100}],"color":"red","name":"Caf\u00e9 route"}}})";
+    response = handleMessage(polyline_msg);
+    printf("  Request: %s\n", polyline_msg);
+    printf("  Response: %s\n", response);
+
+    printf("\nTesting handleMessage (tools/call addPolygon with [lon, lat] positions):\n");
+    const char* polygon_msg = R"({"jsonrpc":"2.0","id":16,"method":"tools/call","params":{"name":"addPolygon","arguments":{"positions":[[2.2945,48.8584],[2.3499,48.8530],{"latitude":48.8606,"longitude":2.3376}],"color":"green"}}})";
+    response = handleMessage(polygon_msg);
+    printf("  Request: %s\n", polygon_msg);
+    printf("  Response: %s\n", response);
+
+    printf("\nTesting handleMessage (batch: two calls, a notification, an invalid element):\n");
+    const char* rpc_batch_msg = R"([{"jsonrpc":"2.0","id":17,"method":"ping"},{"jsonrpc":"2.0","method":"initialized"},)"
+                                R"({"jsonrpc":"2.0","id":"fly","method":"tools/call","params":{"name":"flyTo","arguments":{"longitude":2.35,"latitude":48.85}}},42])";
+    response = handleMessage(rpc_batch_msg);
+    printf("  Request: %s\n", rpc_batch_msg);
+    printf("  Response: %s\n", response);
+
+    printf("\nTesting handleMessage (batch of notifications, empty batch):\n");
+    const char* notify_batch_msg = R"([{"jsonrpc":"2.0","method":"initialized"}])";
+    response = handleMessage(notify_batch_msg);
+    printf("  Request: %s\n", notify_batch_msg);
+    printf("  Response: \"%s\"\n", response);
+    response = handleMessage("[]");
+    printf("  Request: []\n");
+    printf("  Response: %s\n", response);
+
+    printf("\nTesting handleMessage (notifications of any method, alone and in a batch):\n");
+    const char* call_notify_msg = R"({"jsonrpc":"2.0","method":"tools/call","params":{"name":"flyTo","arguments":{"longitude":2.35,"latitude":48.85}}})";
+    response = handleMessage(call_notify_msg);
+    printf("  Request: %s\n", call_notify_msg);
+    printf("  Response: \"%s\"\n", response);
+    const char* mixed_notify_msg = R"([{"jsonrpc":"2.0","method":"tools/call","params":{"name":"flyTo","arguments":{"longitude":2.35,"latitude":48.85}}},)"
+                                   R"({"jsonrpc":"2.0","method":"notifications/cancelled"},{"jsonrpc":"2.0","id":20,"method":"ping"}])";
+    response = handleMessage(mixed_notify_msg);
+    printf("  Request: %s\n", mixed_notify_msg);
+    printf("  Response: %s\n", response);
+
+    printf("\nTesting handleMessage (string id too long to echo):\n");
+    static char long_id_msg[512];
+    char long_id[301];
+    memset(long_id, 'x', 300);
+    long_id[300] = '\0';
+    snprintf(long_id_msg, sizeof(long_id_msg), R"({"jsonrpc":"2.0","id":"%s","method":"ping"})", long_id);
+    response = handleMessage(long_id_msg);
+    printf("  Request: ping with a 300-byte id\n");
+    printf("  Response: %s\n", response);
+
+    printf("\nTesting handleMessage (resources/read location cache statistics):\n");
+    const char* cache_msg = R"({"jsonrpc":"2.0","id":12,"method":"resources/read","params":{"uri":"cesium://locations/cache"}})";
+    response = handleMessage(cache_msg);
+    printf("  Request: %s\n", cache_msg);
+    printf("  Response: %s\n", response);
+
     printf("\nAll tests completed!\n");
     return 0;
 }
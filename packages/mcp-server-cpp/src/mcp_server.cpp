@@ -4,13 +4,33 @@
 
 #include "mcp_server.h"
 #include "json_rpc.h"
+#include "number_format.h"
 #include "location_database.h"
+#include "location_index.h"
+#include "location_trie.h"
+#include "location_qgram.h"
+#include "location_symspell.h"
+#include "location_binary.h"
+#include "location_cache.h"
+#include "location_store.h"
+#include "location_metadata.h"
+#include "location_places.h"
+#include "location_spatial.h"
+#include "location_rank.h"
+#include "location_suffix.h"
 #include "cesium_commands.h"
 #include "http_client.h"
 
 #include <cstring>
 #include <cstdio>
 #include <cmath>
+#include <algorithm>
+#include <string_view>
+#include <vector>
+
+// Arguments for a "%.*s" conversion of a std::string_view (string fields are
+// views into the message, not NUL-terminated copies)
+#define VIEW_ARG(view) static_cast<int>((view).size()), (view).data()
 
 namespace cesium {
 namespace mcp {
@@ -19,6 +39,9 @@ namespace mcp {
 static char response_buffer[MAX_RESPONSE_SIZE];
 static char tools_buffer[MAX_TOOLS_SIZE];
 
+// Tape of the message being handled, reused across messages
+static JsonDocument message_document;
+
 // Entity ID counter for generating unique IDs
 static int entity_counter = 1;
 
@@ -30,6 +53,12 @@ static double camera_target_longitude = 0.0;  // Where camera is looking at grou
 static double camera_target_latitude = 0.0;
 static bool camera_state_valid = false;
 
+// Last autocomplete prefix (normalized) and its trie position, so the next
+// keystroke only walks the newly typed bytes
+static char autocomplete_prefix[256] = "";
+static AutocompleteCursor autocomplete_cursor = {0, 0, false};
+static bool autocomplete_cursor_valid = false;
+
 // Tool definitions JSON (using custom delimiter to avoid issues with parentheses)
 static const char* TOOL_DEFINITIONS = R"JSON([
   {"name":"flyTo","description":"Fly the camera to a specific geographic location","inputSchema":{"type":"object","properties":{"longitude":{"type":"number","minimum":-180,"maximum":180},"latitude":{"type":"number","minimum":-90,"maximum":90},"height":{"type":"number"},"duration":{"type":"number"}},"required":["longitude","latitude"]}},
@@ -42,10 +71,15 @@ static const char* TOOL_DEFINITIONS = R"JSON([
   {"name":"addCylinder","description":"Add a 3D cylinder","inputSchema":{"type":"object","properties":{"longitude":{"type":"number"},"latitude":{"type":"number"},"topRadius":{"type":"number"},"bottomRadius":{"type":"number"},"cylinderHeight":{"type":"number"}},"required":["longitude","latitude","cylinderHeight"]}},
   {"name":"removeEntity","description":"Remove an entity by ID","inputSchema":{"type":"object","properties":{"id":{"type":"string"}},"required":["id"]}},
   {"name":"clearAll","description":"Remove all entities","inputSchema":{"type":"object","properties":{}}},
-  {"name":"resolveLocation","description":"Resolve a location name to coordinates","inputSchema":{"type":"object","properties":{"location":{"type":"string"}},"required":["location"]}},
-  {"name":"listLocations","description":"List known locations","inputSchema":{"type":"object","properties":{"prefix":{"type":"string"}}}},
-  {"name":"getTopCitiesByPopulation","description":"Get data about most populous cities. Returns data only, no visualization.","inputSchema":{"type":"object","properties":{"count":{"type":"number","description":"Number of cities to return (default: 10, max: 100)"},"minPopulation":{"type":"number","description":"Minimum population threshold (default: 0)"}}}},
-  {"name":"showTopCitiesByPopulation","description":"VISUALIZE the most populous cities on the map. Creates circles OR 3D bar rectangles sized/heighted by population. Use this when user wants to SEE/SHOW biggest cities.","inputSchema":{"type":"object","properties":{"count":{"type":"number","description":"Number of cities to show (default: 10, max: 100)"},"color":{"type":"string","description":"Color (default: cyan)"},"shape":{"type":"string","description":"Shape: 'circle' (flat circles) or 'rectangle' (3D bars with extruded height). Default: circle"},"baseSize":{"type":"number","description":"Base size in meters for rectangles (default: 50000 = 50km)"},"minRadius":{"type":"number","description":"Min radius in meters for circles (default: 10000)"},"maxRadius":{"type":"number","description":"Max radius in meters for circles (default: 200000)"},"minHeight":{"type":"number","description":"Min extruded height in meters for rectangles (default: 10000)"},"maxHeight":{"type":"number","description":"Max extruded height in meters for rectangles (default: 500000)"}}}},
+  {"name":"resolveLocation","description":"Resolve a location name to coordinates and list the place's other names. With type or country, the name must be a place of that kind.","inputSchema":{"type":"object","properties":{"location":{"type":"string"},"maxDistance":{"type":"number","description":"Edit distance for a fuzzy fallback when the name is not found exactly (default: 0 = exact only, max: 3)"},"type":{"type":"string","description":"Only places of these types, comma-separated: city, airport, landmark, state"},"country":{"type":"string","description":"Only places in this country (ISO 3166-1 alpha-2 code, e.g. fr)"}},"required":["location"]}},
+  {"name":"resolveLocations","description":"Resolve many location names in one call, e.g. every stop of a route or every label of a list. Returns columns in input order: resolved (1/0), longitude, latitude, heading (null when not found or not set).","inputSchema":{"type":"object","properties":{"names":{"type":"array","items":{"type":"string"},"description":"Location names (up to 256)"},"maxDistance":{"type":"number","description":"Edit distance for a fuzzy fallback on names not found exactly (default: 0 = exact only, max: 3)"}},"required":["names"]}},
+  {"name":"listLocations","description":"List known locations","inputSchema":{"type":"object","properties":{"prefix":{"type":"string"},"type":{"type":"string","description":"Only places of these types, comma-separated: city, airport, landmark, state"},"country":{"type":"string","description":"Only places in this country (ISO 3166-1 alpha-2 code, e.g. fr)"}}}},
+  {"name":"searchLocationsContaining","description":"Find known places whose name contains some text anywhere (e.g. 'berg', 'san '), most populous first. Returns data only.","inputSchema":{"type":"object","properties":{"text":{"type":"string","description":"Text to find inside place names (case-insensitive)"},"count":{"type":"number","description":"Number of places to return (default: 20, max: 100)"},"type":{"type":"string","description":"Only places of these types, comma-separated: city, airport, landmark, state"},"country":{"type":"string","description":"Only places in this country (ISO 3166-1 alpha-2 code, e.g. fr)"}},"required":["text"]}},
+  {"name":"getTopCitiesByPopulation","description":"Get data about most populous cities, optionally within a bounding box. Returns data only, no visualization.","inputSchema":{"type":"object","properties":{"count":{"type":"number","description":"Number of cities to return (default: 10, max: 100)"},"minPopulation":{"type":"number","description":"Minimum population threshold (default: 0)"},"west":{"type":"number","description":"Optional bounding box west edge in degrees (with south, east, north), e.g. Europe: -25,34,45,72"},"south":{"type":"number"},"east":{"type":"number"},"north":{"type":"number"},"country":{"type":"string","description":"Only cities in this country (ISO 3166-1 alpha-2 code, e.g. us)"}}}},
+  {"name":"findNearbyLocations","description":"Find the known places nearest to a point, closest first. Uses 'location', or longitude/latitude, or the current camera view center. Returns data only.","inputSchema":{"type":"object","properties":{"location":{"type":"string","description":"Center location name"},"longitude":{"type":"number","description":"Center longitude (use if not using location)"},"latitude":{"type":"number","description":"Center latitude"},"count":{"type":"number","description":"Number of places to return (default: 10, max: 100)"},"radius":{"type":"number","description":"Only include places within this many meters (default: no limit)"}}}},
+  {"name":"findLocationsInView","description":"List the known places inside a bounding box, most populous first. Returns data only.","inputSchema":{"type":"object","properties":{"west":{"type":"number"},"south":{"type":"number"},"east":{"type":"number"},"north":{"type":"number"},"count":{"type":"number","description":"Number of places to return (default: 20, max: 100)"}},"required":["west","south","east","north"]}},
+  {"name":"reverseGeocode","description":"Name the place at a coordinate (defaults to the current camera view center). Prefers the nearest populated city from the built-in database; queries Nominatim only when nothing is within maxDistance.","inputSchema":{"type":"object","properties":{"longitude":{"type":"number"},"latitude":{"type":"number"},"maxDistance":{"type":"number","description":"Search radius in meters for the built-in database (default: 50000)"}}}},
+  {"name":"showTopCitiesByPopulation","description":"VISUALIZE the most populous cities on the map. Creates circles OR 3D bar rectangles sized/heighted by population. Use this when user wants to SEE/SHOW biggest cities.","inputSchema":{"type":"object","properties":{"count":{"type":"number","description":"Number of cities to show (default: 10, max: 100)"},"color":{"type":"string","description":"Color (default: cyan)"},"shape":{"type":"string","description":"Shape: 'circle' (flat circles) or 'rectangle' (3D bars with extruded height). Default: circle"},"baseSize":{"type":"number","description":"Base size in meters for rectangles (default: 50000 = 50km)"},"minRadius":{"type":"number","description":"Min radius in meters for circles (default: 10000)"},"maxRadius":{"type":"number","description":"Max radius in meters for circles (default: 200000)"},"minHeight":{"type":"number","description":"Min extruded height in meters for rectangles (default: 10000)"},"maxHeight":{"type":"number","description":"Max extruded height in meters for rectangles (default: 500000)"},"minPopulation":{"type":"number","description":"Minimum population threshold (default: 0)"},"west":{"type":"number","description":"Optional bounding box west edge in degrees (with south, east, north), e.g. Europe: -25,34,45,72"},"south":{"type":"number"},"east":{"type":"number"},"north":{"type":"number"},"country":{"type":"string","description":"Only cities in this country (ISO 3166-1 alpha-2 code, e.g. us)"}}}},
   {"name":"flyToLocation","description":"Fly camera to a named location. Height 1000-50000m typical.","inputSchema":{"type":"object","properties":{"location":{"type":"string"},"height":{"type":"number","description":"Camera height in meters (1000-50000 typical)","minimum":100,"maximum":100000},"duration":{"type":"number","description":"Flight duration in seconds (1-5)"}},"required":["location"]}},
   {"name":"addSphereAtLocation","description":"Add sphere at named location. Radius 10-500m typical.","inputSchema":{"type":"object","properties":{"location":{"type":"string"},"radius":{"type":"number","description":"Radius in meters (10-500 typical)","minimum":1,"maximum":1000},"height":{"type":"number","description":"Height above ground (0-1000m)","maximum":1000},"color":{"type":"string"}},"required":["location"]}},
   {"name":"addBoxAtLocation","description":"Add box at named location. Auto-uses database heading if available; override with heading param (0=North, 90=East).","inputSchema":{"type":"object","properties":{"location":{"type":"string"},"dimensionX":{"type":"number"},"dimensionY":{"type":"number"},"dimensionZ":{"type":"number"},"color":{"type":"string"},"heading":{"type":"number"}},"required":["location"]}},
@@ -99,11 +133,122 @@ static const char* RESOURCES_JSON = R"JSON({"resources":[
   {"uri":"cesium://scene/state","name":"Scene State","mimeType":"application/json"},
   {"uri":"cesium://entities","name":"Entity List","mimeType":"application/json"},
   {"uri":"cesium://camera","name":"Camera State","mimeType":"application/json"},
-  {"uri":"cesium://locations","name":"Known Locations","mimeType":"application/json"}
+  {"uri":"cesium://locations","name":"Known Locations","mimeType":"application/json"},
+  {"uri":"cesium://locations/cache","name":"Location Resolution Cache Statistics","mimeType":"application/json"}
 ]})JSON";
 
+// Type/country filter from optional "type" (comma-separated names) and
+// "country" (two-letter code) arguments. A value that would not restrict
+// anything as asked is rejected rather than ignored: error gets a message
+// naming the accepted values.
+static bool json_get_location_filter(const JsonNode* args, LocationFilter& filter,
+                                     char* error, size_t error_size) {
+    filter = LocationFilter();
+    char value[64];
+    if (json_get_string(args, "type", value, sizeof(value))) {
+        size_t unrecognized = 0;
+        filter.types = parse_location_types(value, &unrecognized);
+        if (unrecognized > 0) {
+            char accepted[128];
+            format_location_types(LOCATION_TYPE_ALL, accepted, sizeof(accepted));
+            format_text(error, error_size, "Unknown location type '%s' (accepted, comma-separated: %s)",
+                        value, accepted);
+            return false;
+        }
+    }
+    if (json_get_string(args, "country", value, sizeof(value)) && value[0] != '\0') {
+        filter.country = parse_country_code(value);
+        if (filter.country == LOCATION_COUNTRY_UNKNOWN) {
+            format_text(error, error_size,
+                        "Invalid country '%s' (expected an ISO 3166-1 alpha-2 code, e.g. us, fr)", value);
+            return false;
+        }
+    }
+    return true;
+}
+
+// Report a rejected argument as a tool error (isError: true)
+static size_t tool_error_response(const char* id, const char* text, char* response, size_t response_size) {
+    char result[4096];
+    format_tool_result(text, true, result, sizeof(result));
+    return create_success_response(id, result, response, response_size);
+}
+
+// Escaped name or caller string in a JSON string field: names are under
+// 256 bytes and escaping grows a byte to at most six (\u00XX)
+constexpr size_t ESCAPED_NAME_SIZE = 256 * 6;
+
+// Largest batch accepted by resolveLocations / resolveLocationsBatch
+constexpr size_t MAX_BATCH_LOCATIONS = 256;
+
+// addPolyline / addPolygon vertices: more rows than fit in a tool result
+constexpr size_t MAX_POSITIONS = 2048;
+static const char* const POSITION_COLUMNS[] = {"longitude", "latitude", "height"};
+static const double POSITION_DEFAULTS[] = {0, 0, 0};
+static double position_rows[MAX_POSITIONS * 3];
+
+// Columnar batch result: a resolved flag per name plus coordinate columns,
+// null where a name was not found (or has no heading)
+static size_t format_batch_resolution(const LocationResolution* results, size_t count, size_t found,
+                                      char* output, size_t output_size) {
+    size_t offset = 0;
+    auto append = [&](const char* format, auto... args) {
+        if (offset < output_size) {
+            offset += format_text(output + offset, output_size - offset, format, args...);
+        }
+    };
+
+    append("{\"count\":%zu,\"found\":%zu,\"resolved\":[", count, found);
+    for (size_t i = 0; i < count; i++) {
+        append(i > 0 ? ",%d" : "%d", results[i].found ? 1 : 0);
+    }
+    append("],\"longitude\":[");
+    for (size_t i = 0; i < count; i++) {
+        if (results[i].found) append(i > 0 ? ",%.6f" : "%.6f", results[i].longitude);
+        else append(i > 0 ? ",null" : "null");
+    }
+    append("],\"latitude\":[");
+    for (size_t i = 0; i < count; i++) {
+        if (results[i].found) append(i > 0 ? ",%.6f" : "%.6f", results[i].latitude);
+        else append(i > 0 ? ",null" : "null");
+    }
+    append("],\"heading\":[");
+    for (size_t i = 0; i < count; i++) {
+        if (results[i].found && results[i].heading >= 0) append(i > 0 ? ",%.1f" : "%.1f", results[i].heading);
+        else append(i > 0 ? ",null" : "null");
+    }
+    append("]}");
+    return offset < output_size ? offset : output_size - 1;
+}
+
+// Population filter from optional minPopulation, west/south/east/north and
+// country arguments; the box only applies when all four edges are given.
+// Rejects an invalid country as json_get_location_filter() does.
+static bool json_get_population_filter(const JsonNode* args, PopulationFilter& filter,
+                                       char* error, size_t error_size) {
+    filter = PopulationFilter();
+    double min_population = 0;
+    if (json_get_number(args, "minPopulation", min_population)) {
+        filter.min_population = static_cast<int>(min_population);
+    }
+    filter.has_bbox = json_get_number(args, "west", filter.west) &&
+                      json_get_number(args, "south", filter.south) &&
+                      json_get_number(args, "east", filter.east) &&
+                      json_get_number(args, "north", filter.north);
+    return json_get_location_filter(args, filter.metadata, error, error_size);
+}
+
 void init() {
-    // Nothing to initialize currently
+    // Build location lookup indexes up front rather than on the first query
+    build_location_indexes();
+    build_location_store();
+    build_location_place_index();
+    build_location_spatial_index();
+    build_population_rank_index();
+    build_location_metadata_index();
+    build_location_trie();
+    build_location_qgram_index();
+    build_location_suffix_array();
 }
 
 size_t get_tool_definitions(char* output, size_t output_size) {
@@ -116,7 +261,7 @@ size_t get_tool_definitions(char* output, size_t output_size) {
     return len;
 }
 
-size_t handle_initialize(const char* id, const char* params, char* response, size_t response_size) {
+size_t handle_initialize(const char* id, const JsonNode* params, char* response, size_t response_size) {
     (void)params;  // Unused
 
     const char* result = R"JSON({
@@ -130,196 +275,266 @@ size_t handle_initialize(const char* id, const char* params, char* response, siz
 
 size_t handle_tools_list(const char* id, char* response, size_t response_size) {
     char result[MAX_TOOLS_SIZE];
-    snprintf(result, sizeof(result), "{\"tools\":%s}", TOOL_DEFINITIONS);
+    format_text(result, sizeof(result), "{\"tools\":%s}", TOOL_DEFINITIONS);
     return create_success_response(id, result, response, response_size);
 }
 
-size_t handle_tools_call(const char* id, const char* params, char* response, size_t response_size) {
-    char tool_name[64];
-    char args_json[4096];
+size_t handle_tools_call(const char* id, const JsonNode* params, char* response, size_t response_size) {
+    std::string_view tool_name;
 
-    if (!json_get_string(params, "name", tool_name, sizeof(tool_name))) {
+    if (!json_get_string_view(params, "name", tool_name)) {
         return create_error_response(id, ErrorCode::InvalidParams, "Missing tool name",
                                      response, response_size);
     }
 
-    json_get_object(params, "arguments", args_json, sizeof(args_json));
+    // Missing arguments read as an empty object
+    const JsonNode* args = json_find(params, "arguments");
 
     char result_text[32768];
 
     // Handle basic coordinate-based tools
-    if (strcmp(tool_name, "flyTo") == 0) {
+    if (tool_name == "flyTo") {
         double lon = 0, lat = 0, height = 10000, duration = 2.0;
-        json_get_number(args_json, "longitude", lon);
-        json_get_number(args_json, "latitude", lat);
-        json_get_number(args_json, "height", height);
-        json_get_number(args_json, "duration", duration);
-        snprintf(result_text, sizeof(result_text),
-                 "type,longitude,latitude,height,duration\nflyTo,%.6f,%.6f,%.1f,%.1f",
-                 lon, lat, height, duration);
-    }
-    else if (strcmp(tool_name, "addPoint") == 0) {
+        json_get_number(args, "longitude", lon);
+        json_get_number(args, "latitude", lat);
+        json_get_number(args, "height", height);
+        json_get_number(args, "duration", duration);
+        format_text(result_text, sizeof(result_text),
+                    "type,longitude,latitude,height,duration\nflyTo,%.6f,%.6f,%.1f,%.1f",
+                    lon, lat, height, duration);
+    }
+    else if (tool_name == "addPoint") {
         double lon = 0, lat = 0;
-        char name[128] = "";
-        char color[32] = "white";
+        std::string_view name;
+        std::string_view color = "white";
         char location[256] = "";
 
         // Check for location name first (preferred)
-        if (json_get_string(args_json, "location", location, sizeof(location))) {
+        if (json_get_string(args, "location", location, sizeof(location))) {
             double db_heading;
             if (resolve_location(location, lon, lat, db_heading)) {
-                if (name[0] == '\0') strncpy(name, location, sizeof(name) - 1);
+                if (name.empty()) name = location;
             }
         } else {
-            json_get_number(args_json, "longitude", lon);
-            json_get_number(args_json, "latitude", lat);
+            json_get_number(args, "longitude", lon);
+            json_get_number(args, "latitude", lat);
         }
-        json_get_string(args_json, "name", name, sizeof(name));
-        json_get_string(args_json, "color", color, sizeof(color));
+        json_get_string_view(args, "name", name);
+        json_get_string_view(args, "color", color);
         int entity_id = entity_counter++;
-        snprintf(result_text, sizeof(result_text),
-                 "type,id,longitude,latitude,color,name\naddPoint,entity-%d,%.6f,%.6f,%s,%s",
-                 entity_id, lon, lat, color, name[0] ? name : "point");
+        format_text(result_text, sizeof(result_text),
+                    "type,id,longitude,latitude,color,name\naddPoint,entity-%d,%.6f,%.6f,%.*s,%.*s",
+                    entity_id, lon, lat, VIEW_ARG(color), VIEW_ARG(!name.empty() ? name : "point"));
     }
-    else if (strcmp(tool_name, "addLabel") == 0) {
+    else if (tool_name == "addLabel") {
         double lon = 0, lat = 0;
-        char text[256] = "";
-        json_get_number(args_json, "longitude", lon);
-        json_get_number(args_json, "latitude", lat);
-        json_get_string(args_json, "text", text, sizeof(text));
+        std::string_view text;
+        json_get_number(args, "longitude", lon);
+        json_get_number(args, "latitude", lat);
+        json_get_string_view(args, "text", text);
         int entity_id = entity_counter++;
-        snprintf(result_text, sizeof(result_text),
-                 "type,id,longitude,latitude,text\naddLabel,entity-%d,%.6f,%.6f,%s",
-                 entity_id, lon, lat, text);
+        format_text(result_text, sizeof(result_text),
+                    "type,id,longitude,latitude,text\naddLabel,entity-%d,%.6f,%.6f,%.*s",
+                    entity_id, lon, lat, VIEW_ARG(text));
     }
-    else if (strcmp(tool_name, "addSphere") == 0) {
+    else if (tool_name == "addSphere") {
         double lon = 0, lat = 0, height = 0, radius = 1000;
-        char color[32] = "red";
-        char name[128] = "";
+        std::string_view color = "red";
+        std::string_view name;
         char location[256] = "";
 
         // Check for location name first (preferred)
-        if (json_get_string(args_json, "location", location, sizeof(location))) {
+        if (json_get_string(args, "location", location, sizeof(location))) {
             double db_heading;
             if (resolve_location(location, lon, lat, db_heading)) {
-                if (name[0] == '\0') strncpy(name, location, sizeof(name) - 1);
+                if (name.empty()) name = location;
             }
         } else {
-            json_get_number(args_json, "longitude", lon);
-            json_get_number(args_json, "latitude", lat);
+            json_get_number(args, "longitude", lon);
+            json_get_number(args, "latitude", lat);
         }
-        json_get_number(args_json, "height", height);
-        json_get_number(args_json, "radius", radius);
-        json_get_string(args_json, "color", color, sizeof(color));
-        json_get_string(args_json, "name", name, sizeof(name));
+        json_get_number(args, "height", height);
+        json_get_number(args, "radius", radius);
+        json_get_string_view(args, "color", color);
+        json_get_string_view(args, "name", name);
         // Clamp to reasonable values
         if (radius > 1000) radius = 1000;
         if (radius < 1) radius = 50;
         if (height > 1000) height = 0;
         if (height < 0) height = 0;
         int entity_id = entity_counter++;
-        snprintf(result_text, sizeof(result_text),
-                 "type,id,longitude,latitude,height,radius,color,name\naddSphere,entity-%d,%.6f,%.6f,%.1f,%.1f,%s,%s",
-                 entity_id, lon, lat, height, radius, color, name[0] ? name : "sphere");
+        format_text(result_text, sizeof(result_text),
+                    "type,id,longitude,latitude,height,radius,color,name\naddSphere,entity-%d,%.6f,%.6f,%.1f,%.1f,%.*s,%.*s",
+                    entity_id, lon, lat, height, radius, VIEW_ARG(color), VIEW_ARG(!name.empty() ? name : "sphere"));
     }
-    else if (strcmp(tool_name, "addBox") == 0) {
+    else if (tool_name == "addBox") {
         double lon = 0, lat = 0, height = 0;
         double dim_x = 100, dim_y = 100, dim_z = 50;
-        char color[32] = "blue";
-        char name[128] = "";
-        json_get_number(args_json, "longitude", lon);
-        json_get_number(args_json, "latitude", lat);
-        json_get_number(args_json, "height", height);
-        json_get_string(args_json, "color", color, sizeof(color));
-        json_get_string(args_json, "name", name, sizeof(name));
+        std::string_view color = "blue";
+        std::string_view name;
+        json_get_number(args, "longitude", lon);
+        json_get_number(args, "latitude", lat);
+        json_get_number(args, "height", height);
+        json_get_string_view(args, "color", color);
+        json_get_string_view(args, "name", name);
         // Support nested dimensions object
-        char dimensions[256];
-        if (json_get_object(args_json, "dimensions", dimensions, sizeof(dimensions))) {
+        if (const JsonNode* dimensions = json_find(args, "dimensions")) {
             json_get_number(dimensions, "x", dim_x);
             json_get_number(dimensions, "y", dim_y);
             json_get_number(dimensions, "z", dim_z);
         }
         int entity_id = entity_counter++;
-        snprintf(result_text, sizeof(result_text),
-                 "type,id,longitude,latitude,height,dimensionX,dimensionY,dimensionZ,color,name\naddBox,entity-%d,%.6f,%.6f,%.1f,%.1f,%.1f,%.1f,%s,%s",
-                 entity_id, lon, lat, height, dim_x, dim_y, dim_z, color, name[0] ? name : "box");
+        format_text(result_text, sizeof(result_text),
+                    "type,id,longitude,latitude,height,dimensionX,dimensionY,dimensionZ,color,name\naddBox,entity-%d,%.6f,%.6f,%.1f,%.1f,%.1f,%.1f,%.*s,%.*s",
+                    entity_id, lon, lat, height, dim_x, dim_y, dim_z, VIEW_ARG(color), VIEW_ARG(!name.empty() ? name : "box"));
     }
-    else if (strcmp(tool_name, "addCylinder") == 0) {
+    else if (tool_name == "addCylinder") {
         double lon = 0, lat = 0, height = 0;
         double top_radius = 100, bottom_radius = 100, cylinder_height = 100;
-        char color[32] = "green";
-        char name[128] = "";
-        json_get_number(args_json, "longitude", lon);
-        json_get_number(args_json, "latitude", lat);
-        json_get_number(args_json, "height", height);
-        json_get_number(args_json, "topRadius", top_radius);
-        json_get_number(args_json, "bottomRadius", bottom_radius);
-        json_get_number(args_json, "cylinderHeight", cylinder_height);
-        json_get_string(args_json, "color", color, sizeof(color));
-        json_get_string(args_json, "name", name, sizeof(name));
+        std::string_view color = "green";
+        std::string_view name;
+        json_get_number(args, "longitude", lon);
+        json_get_number(args, "latitude", lat);
+        json_get_number(args, "height", height);
+        json_get_number(args, "topRadius", top_radius);
+        json_get_number(args, "bottomRadius", bottom_radius);
+        json_get_number(args, "cylinderHeight", cylinder_height);
+        json_get_string_view(args, "color", color);
+        json_get_string_view(args, "name", name);
         int entity_id = entity_counter++;
-        snprintf(result_text, sizeof(result_text),
-                 "type,id,longitude,latitude,height,topRadius,bottomRadius,cylinderHeight,color,name\naddCylinder,entity-%d,%.6f,%.6f,%.1f,%.1f,%.1f,%.1f,%s,%s",
-                 entity_id, lon, lat, height, top_radius, bottom_radius, cylinder_height, color, name[0] ? name : "cylinder");
+        format_text(result_text, sizeof(result_text),
+                    "type,id,longitude,latitude,height,topRadius,bottomRadius,cylinderHeight,color,name\naddCylinder,entity-%d,%.6f,%.6f,%.1f,%.1f,%.1f,%.1f,%.*s,%.*s",
+                    entity_id, lon, lat, height, top_radius, bottom_radius, cylinder_height, VIEW_ARG(color), VIEW_ARG(!name.empty() ? name : "cylinder"));
     }
-    else if (strcmp(tool_name, "lookAt") == 0) {
+    else if (tool_name == "lookAt") {
         double lon = 0, lat = 0, range = 10000;
-        json_get_number(args_json, "longitude", lon);
-        json_get_number(args_json, "latitude", lat);
-        json_get_number(args_json, "range", range);
-        snprintf(result_text, sizeof(result_text),
-                 "type,longitude,latitude,range\nlookAt,%.6f,%.6f,%.1f",
-                 lon, lat, range);
-    }
-    else if (strcmp(tool_name, "zoom") == 0) {
+        json_get_number(args, "longitude", lon);
+        json_get_number(args, "latitude", lat);
+        json_get_number(args, "range", range);
+        format_text(result_text, sizeof(result_text),
+                    "type,longitude,latitude,range\nlookAt,%.6f,%.6f,%.1f",
+                    lon, lat, range);
+    }
+    else if (tool_name == "zoom") {
         double amount = 1.0;
-        json_get_number(args_json, "amount", amount);
-        snprintf(result_text, sizeof(result_text),
-                 "type,amount\nzoom,%.2f", amount);
+        json_get_number(args, "amount", amount);
+        format_text(result_text, sizeof(result_text),
+                    "type,amount\nzoom,%.2f", amount);
     }
-    else if (strcmp(tool_name, "removeEntity") == 0) {
-        char entity_id[64] = "";
-        json_get_string(args_json, "id", entity_id, sizeof(entity_id));
-        snprintf(result_text, sizeof(result_text),
-                 "type,id\nremoveEntity,%s", entity_id);
+    else if (tool_name == "removeEntity") {
+        std::string_view entity_id;
+        json_get_string_view(args, "id", entity_id);
+        format_text(result_text, sizeof(result_text),
+                    "type,id\nremoveEntity,%.*s", VIEW_ARG(entity_id));
     }
-    else if (strcmp(tool_name, "clearAll") == 0) {
-        snprintf(result_text, sizeof(result_text), "type\nclearAll");
+    else if (tool_name == "clearAll") {
+        format_text(result_text, sizeof(result_text), "type\nclearAll");
     }
     // Handle location-aware tools
-    else if (strcmp(tool_name, "resolveLocation") == 0) {
+    else if (tool_name == "resolveLocation") {
         char location[256];
-        if (json_get_string(args_json, "location", location, sizeof(location))) {
+        if (json_get_string(args, "location", location, sizeof(location))) {
             double longitude, latitude, heading;
-            if (resolve_location(location, longitude, latitude, heading)) {
+            LocationFilter filter;
+            if (!json_get_location_filter(args, filter, result_text, sizeof(result_text))) {
+                return tool_error_response(id, result_text, response, response_size);
+            }
+            bool filtered = filter.types != 0 || filter.country != LOCATION_COUNTRY_UNKNOWN;
+            double max_distance = 0;
+            json_get_number(args, "maxDistance", max_distance);
+            int distance = static_cast<int>(std::min(std::max(max_distance, 0.0), 3.0));
+
+            // Exact (or folded) name first; a filter only checks the place
+            // it names, whose canonical row holds the metadata
+            uint32_t location_id = find_location_id_any_spelling(location);
+            bool found;
+            if (!filtered) {
+                found = resolve_location(location, longitude, latitude, heading);
+            } else {
+                found = location_id != INVALID_LOCATION_ID &&
+                        location_matches_filter(get_canonical_location_id(location_id), filter);
+                if (found) {
+                    uint32_t place = get_canonical_location_id(location_id);
+                    const Location& loc = get_all_locations()[place];
+                    longitude = loc.longitude;
+                    latitude = loc.latitude;
+                    heading = loc.heading;
+                }
+            }
+            // Typo matches only when asked for; they name no entry to list
+            // aliases of
+            if (!found && distance > 0) {
+                found = filtered
+                    ? fuzzy_resolve_location_filtered(location, filter, longitude, latitude, heading, distance)
+                    : fuzzy_resolve_location(location, longitude, latitude, heading, distance);
+                location_id = INVALID_LOCATION_ID;
+            }
+            if (found) {
                 if (heading >= 0) {
-                    snprintf(result_text, sizeof(result_text),
-                             "Location '%s' resolved to: longitude=%.6f, latitude=%.6f, heading=%.1f",
-                             location, longitude, latitude, heading);
+                    format_text(result_text, sizeof(result_text),
+                                "Location '%s' resolved to: longitude=%.6f, latitude=%.6f, heading=%.1f",
+                                location, longitude, latitude, heading);
                 } else {
-                    snprintf(result_text, sizeof(result_text),
-                             "Location '%s' resolved to: longitude=%.6f, latitude=%.6f",
-                             location, longitude, latitude);
+                    format_text(result_text, sizeof(result_text),
+                                "Location '%s' resolved to: longitude=%.6f, latitude=%.6f",
+                                location, longitude, latitude);
+                }
+
+                // Other names of the same place come straight from the alias index
+                if (location_id != INVALID_LOCATION_ID) {
+                    const Location* locations = get_all_locations();
+                    size_t alias_count;
+                    const uint32_t* aliases = get_location_aliases(location_id, alias_count);
+                    size_t offset = strlen(result_text);
+                    const char* separator = "; also known as: ";
+                    for (size_t i = 0; i < alias_count && offset < sizeof(result_text) - 300; i++) {
+                        if (aliases[i] == location_id) continue;
+                        offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                                              "%s%s", separator, locations[aliases[i]].name);
+                        separator = ", ";
+                    }
                 }
             } else {
-                snprintf(result_text, sizeof(result_text),
-                         "Location '%s' not found in database", location);
+                format_text(result_text, sizeof(result_text),
+                            "Location '%s' not found in database", location);
             }
         } else {
             strcpy(result_text, "Missing 'location' parameter");
         }
     }
-    else if (strcmp(tool_name, "flyToLocation") == 0) {
+    else if (tool_name == "resolveLocations") {
+        static char names_storage[16384];
+        static const char* names[MAX_BATCH_LOCATIONS];
+        static LocationResolution results[MAX_BATCH_LOCATIONS];
+        size_t count = json_get_string_array(args, "names", names_storage, sizeof(names_storage),
+                                             names, MAX_BATCH_LOCATIONS);
+        if (count == JSON_ARRAY_OVERFLOW) {
+            format_text(result_text, sizeof(result_text),
+                        "Too many names: at most %zu per call, %zu bytes in total",
+                        MAX_BATCH_LOCATIONS, sizeof(names_storage));
+            return tool_error_response(id, result_text, response, response_size);
+        }
+        if (count > 0) {
+            double max_distance = 0;
+            json_get_number(args, "maxDistance", max_distance);
+            int distance = static_cast<int>(std::min(std::max(max_distance, 0.0), 3.0));
+            size_t found = resolve_locations(names, count, results, distance);
+            format_batch_resolution(results, count, found, result_text, sizeof(result_text));
+        } else {
+            strcpy(result_text, "Missing 'names' parameter (array of location names)");
+        }
+    }
+    else if (tool_name == "flyToLocation") {
         char location[256];
         // Accept both "location" and "locationName" for robustness (LLMs sometimes vary)
-        if (json_get_string(args_json, "location", location, sizeof(location)) ||
-            json_get_string(args_json, "locationName", location, sizeof(location))) {
+        if (json_get_string(args, "location", location, sizeof(location)) ||
+            json_get_string(args, "locationName", location, sizeof(location))) {
             double longitude, latitude, heading;
             if (resolve_location(location, longitude, latitude, heading)) {
                 double height = 10000;
                 double duration = 2.0;
-                json_get_number(args_json, "height", height);
-                json_get_number(args_json, "duration", duration);
+                json_get_number(args, "height", height);
+                json_get_number(args, "duration", duration);
 
                 // Clamp height to reasonable viewing distance (max 100km)
                 if (height > 100000) height = 10000;
@@ -327,32 +542,32 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
                 if (duration < 0.5) duration = 2.0;
                 if (duration > 10) duration = 3.0;
 
-                snprintf(result_text, sizeof(result_text),
-                         "type,longitude,latitude,height,duration\nflyTo,%.6f,%.6f,%.1f,%.1f",
-                         longitude, latitude, height, duration);
+                format_text(result_text, sizeof(result_text),
+                            "type,longitude,latitude,height,duration\nflyTo,%.6f,%.6f,%.1f,%.1f",
+                            longitude, latitude, height, duration);
             } else {
-                snprintf(result_text, sizeof(result_text),
-                         "Location '%s' not found", location);
+                format_text(result_text, sizeof(result_text),
+                            "Location '%s' not found", location);
             }
         } else {
             strcpy(result_text, "Missing 'location' parameter");
         }
     }
-    else if (strcmp(tool_name, "addSphereAtLocation") == 0) {
+    else if (tool_name == "addSphereAtLocation") {
         char location[256];
         // Accept both "location" and "locationName" for robustness
-        if (json_get_string(args_json, "location", location, sizeof(location)) ||
-            json_get_string(args_json, "locationName", location, sizeof(location))) {
+        if (json_get_string(args, "location", location, sizeof(location)) ||
+            json_get_string(args, "locationName", location, sizeof(location))) {
             double longitude, latitude, db_heading;
             if (resolve_location(location, longitude, latitude, db_heading)) {
                 double radius = 1000, height = 0;
-                char color[32] = "red";
-                char name[128] = "";
+                std::string_view color = "red";
+                std::string_view name;
 
-                json_get_number(args_json, "radius", radius);
-                json_get_number(args_json, "height", height);
-                json_get_string(args_json, "color", color, sizeof(color));
-                json_get_string(args_json, "name", name, sizeof(name));
+                json_get_number(args, "radius", radius);
+                json_get_number(args, "height", height);
+                json_get_string_view(args, "color", color);
+                json_get_string_view(args, "name", name);
 
                 // Clamp to reasonable values
                 if (radius > 1000) radius = 100;
@@ -361,43 +576,42 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
                 if (height < 0) height = 0;
 
                 int entity_id = entity_counter++;
-                snprintf(result_text, sizeof(result_text),
-                         "type,id,longitude,latitude,height,radius,color,name\naddSphere,entity-%d,%.6f,%.6f,%.1f,%.1f,%s,%s",
-                         entity_id, longitude, latitude, height, radius, color,
-                         name[0] ? name : location);
+                format_text(result_text, sizeof(result_text),
+                            "type,id,longitude,latitude,height,radius,color,name\naddSphere,entity-%d,%.6f,%.6f,%.1f,%.1f,%.*s,%.*s",
+                            entity_id, longitude, latitude, height, radius, VIEW_ARG(color),
+                            VIEW_ARG(!name.empty() ? name : location));
             } else {
-                snprintf(result_text, sizeof(result_text),
-                         "Location '%s' not found", location);
+                format_text(result_text, sizeof(result_text),
+                            "Location '%s' not found", location);
             }
         } else {
             strcpy(result_text, "Missing 'location' parameter");
         }
     }
-    else if (strcmp(tool_name, "addBoxAtLocation") == 0) {
+    else if (tool_name == "addBoxAtLocation") {
         char location[256];
         // Accept both "location" and "locationName" for robustness
-        if (json_get_string(args_json, "location", location, sizeof(location)) ||
-            json_get_string(args_json, "locationName", location, sizeof(location))) {
+        if (json_get_string(args, "location", location, sizeof(location)) ||
+            json_get_string(args, "locationName", location, sizeof(location))) {
             double longitude, latitude, db_heading;
             if (resolve_location(location, longitude, latitude, db_heading)) {
                 double height = 0;
                 double dim_x = 100, dim_y = 100, dim_z = 50;
                 double heading = db_heading;  // Use database heading as default
-                char color[32] = "blue";
-                char name[128] = "";
+                std::string_view color = "blue";
+                std::string_view name;
 
                 // Try flat dimension parameters first (preferred)
-                json_get_number(args_json, "dimensionX", dim_x);
-                json_get_number(args_json, "dimensionY", dim_y);
-                json_get_number(args_json, "dimensionZ", dim_z);
-                json_get_number(args_json, "heading", heading);  // Override if user specified
-                json_get_number(args_json, "height", height);
-                json_get_string(args_json, "color", color, sizeof(color));
-                json_get_string(args_json, "name", name, sizeof(name));
+                json_get_number(args, "dimensionX", dim_x);
+                json_get_number(args, "dimensionY", dim_y);
+                json_get_number(args, "dimensionZ", dim_z);
+                json_get_number(args, "heading", heading);  // Override if user specified
+                json_get_number(args, "height", height);
+                json_get_string_view(args, "color", color);
+                json_get_string_view(args, "name", name);
 
                 // Also support nested dimensions object for backwards compat
-                char dimensions[256];
-                if (json_get_object(args_json, "dimensions", dimensions, sizeof(dimensions))) {
+                if (const JsonNode* dimensions = json_find(args, "dimensions")) {
                     json_get_number(dimensions, "x", dim_x);
                     json_get_number(dimensions, "y", dim_y);
                     json_get_number(dimensions, "z", dim_z);
@@ -414,56 +628,56 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
                 // Generate entity ID
                 int entity_id = entity_counter++;
                 if (heading >= 0) {
-                    snprintf(result_text, sizeof(result_text),
-                             "type,id,longitude,latitude,height,dimensionX,dimensionY,dimensionZ,heading,color,name\n"
-                             "addBox,entity-%d,%.6f,%.6f,%.1f,%.1f,%.1f,%.1f,%.1f,%s,%s",
-                             entity_id, longitude, latitude, height, dim_x, dim_y, dim_z, heading, color,
-                             name[0] ? name : location);
+                    format_text(result_text, sizeof(result_text),
+                                "type,id,longitude,latitude,height,dimensionX,dimensionY,dimensionZ,heading,color,name\n"
+                                "addBox,entity-%d,%.6f,%.6f,%.1f,%.1f,%.1f,%.1f,%.1f,%.*s,%.*s",
+                                entity_id, longitude, latitude, height, dim_x, dim_y, dim_z, heading, VIEW_ARG(color),
+                                VIEW_ARG(!name.empty() ? name : location));
                 } else {
-                    snprintf(result_text, sizeof(result_text),
-                             "type,id,longitude,latitude,height,dimensionX,dimensionY,dimensionZ,color,name\n"
-                             "addBox,entity-%d,%.6f,%.6f,%.1f,%.1f,%.1f,%.1f,%s,%s",
-                             entity_id, longitude, latitude, height, dim_x, dim_y, dim_z, color,
-                             name[0] ? name : location);
+                    format_text(result_text, sizeof(result_text),
+                                "type,id,longitude,latitude,height,dimensionX,dimensionY,dimensionZ,color,name\n"
+                                "addBox,entity-%d,%.6f,%.6f,%.1f,%.1f,%.1f,%.1f,%.*s,%.*s",
+                                entity_id, longitude, latitude, height, dim_x, dim_y, dim_z, VIEW_ARG(color),
+                                VIEW_ARG(!name.empty() ? name : location));
                 }
             } else {
-                snprintf(result_text, sizeof(result_text),
-                         "Location '%s' not found", location);
+                format_text(result_text, sizeof(result_text),
+                            "Location '%s' not found", location);
             }
         } else {
             strcpy(result_text, "Missing 'location' parameter");
         }
     }
-    else if (strcmp(tool_name, "rotateEntity") == 0) {
-        char entity_id[64];
-        if (json_get_string(args_json, "id", entity_id, sizeof(entity_id))) {
+    else if (tool_name == "rotateEntity") {
+        std::string_view entity_id;
+        if (json_get_string_view(args, "id", entity_id)) {
             double heading = 0;
-            json_get_number(args_json, "heading", heading);
-            snprintf(result_text, sizeof(result_text),
-                     "type,id,heading\nrotateEntity,%s,%.1f",
-                     entity_id, heading);
+            json_get_number(args, "heading", heading);
+            format_text(result_text, sizeof(result_text),
+                        "type,id,heading\nrotateEntity,%.*s,%.1f",
+                        VIEW_ARG(entity_id), heading);
         } else {
             strcpy(result_text, "Missing 'id' parameter");
         }
     }
-    else if (strcmp(tool_name, "resizeEntity") == 0) {
-        char entity_id[64];
-        if (json_get_string(args_json, "id", entity_id, sizeof(entity_id))) {
+    else if (tool_name == "resizeEntity") {
+        std::string_view entity_id;
+        if (json_get_string_view(args, "id", entity_id)) {
             double scale = -1;
             double dim_x = -1, dim_y = -1, dim_z = -1;
-            json_get_number(args_json, "scale", scale);
-            json_get_number(args_json, "dimensionX", dim_x);
-            json_get_number(args_json, "dimensionY", dim_y);
-            json_get_number(args_json, "dimensionZ", dim_z);
+            json_get_number(args, "scale", scale);
+            json_get_number(args, "dimensionX", dim_x);
+            json_get_number(args, "dimensionY", dim_y);
+            json_get_number(args, "dimensionZ", dim_z);
 
             if (scale > 0) {
-                snprintf(result_text, sizeof(result_text),
-                         "type,id,scale\nresizeEntity,%s,%.2f",
-                         entity_id, scale);
+                format_text(result_text, sizeof(result_text),
+                            "type,id,scale\nresizeEntity,%.*s,%.2f",
+                            VIEW_ARG(entity_id), scale);
             } else if (dim_x > 0 || dim_y > 0 || dim_z > 0) {
-                snprintf(result_text, sizeof(result_text),
-                         "type,id,dimensionX,dimensionY,dimensionZ\nresizeEntity,%s,%.1f,%.1f,%.1f",
-                         entity_id, dim_x, dim_y, dim_z);
+                format_text(result_text, sizeof(result_text),
+                            "type,id,dimensionX,dimensionY,dimensionZ\nresizeEntity,%.*s,%.1f,%.1f,%.1f",
+                            VIEW_ARG(entity_id), dim_x, dim_y, dim_z);
             } else {
                 strcpy(result_text, "Missing 'scale' or dimension parameters");
             }
@@ -471,34 +685,34 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
             strcpy(result_text, "Missing 'id' parameter");
         }
     }
-    else if (strcmp(tool_name, "moveEntity") == 0) {
-        char entity_id[64];
-        if (json_get_string(args_json, "id", entity_id, sizeof(entity_id))) {
+    else if (tool_name == "moveEntity") {
+        std::string_view entity_id;
+        if (json_get_string_view(args, "id", entity_id)) {
             double lon = -999, lat = -999, height = -999;
             double offset_x = 0, offset_y = 0, offset_z = 0;
-            json_get_number(args_json, "longitude", lon);
-            json_get_number(args_json, "latitude", lat);
-            json_get_number(args_json, "height", height);
-            json_get_number(args_json, "offsetX", offset_x);
-            json_get_number(args_json, "offsetY", offset_y);
-            json_get_number(args_json, "offsetZ", offset_z);
+            json_get_number(args, "longitude", lon);
+            json_get_number(args, "latitude", lat);
+            json_get_number(args, "height", height);
+            json_get_number(args, "offsetX", offset_x);
+            json_get_number(args, "offsetY", offset_y);
+            json_get_number(args, "offsetZ", offset_z);
 
             if (lon > -999 && lat > -999) {
                 // Absolute position
                 if (height > -999) {
-                    snprintf(result_text, sizeof(result_text),
-                             "type,id,longitude,latitude,height\nmoveEntity,%s,%.6f,%.6f,%.1f",
-                             entity_id, lon, lat, height);
+                    format_text(result_text, sizeof(result_text),
+                                "type,id,longitude,latitude,height\nmoveEntity,%.*s,%.6f,%.6f,%.1f",
+                                VIEW_ARG(entity_id), lon, lat, height);
                 } else {
-                    snprintf(result_text, sizeof(result_text),
-                             "type,id,longitude,latitude\nmoveEntity,%s,%.6f,%.6f",
-                             entity_id, lon, lat);
+                    format_text(result_text, sizeof(result_text),
+                                "type,id,longitude,latitude\nmoveEntity,%.*s,%.6f,%.6f",
+                                VIEW_ARG(entity_id), lon, lat);
                 }
             } else if (offset_x != 0 || offset_y != 0 || offset_z != 0) {
                 // Relative offset in meters
-                snprintf(result_text, sizeof(result_text),
-                         "type,id,offsetX,offsetY,offsetZ\nmoveEntity,%s,%.1f,%.1f,%.1f",
-                         entity_id, offset_x, offset_y, offset_z);
+                format_text(result_text, sizeof(result_text),
+                            "type,id,offsetX,offsetY,offsetZ\nmoveEntity,%.*s,%.1f,%.1f,%.1f",
+                            VIEW_ARG(entity_id), offset_x, offset_y, offset_z);
             } else {
                 strcpy(result_text, "Missing position (longitude/latitude) or offset parameters");
             }
@@ -506,275 +720,464 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
             strcpy(result_text, "Missing 'id' parameter");
         }
     }
-    else if (strcmp(tool_name, "loadTileset") == 0) {
+    else if (tool_name == "loadTileset") {
         double ion_asset_id = -1;
-        char url[512] = "";
-        char name[128] = "";
+        std::string_view url;
+        std::string_view name;
         bool show = true;
 
-        json_get_number(args_json, "ionAssetId", ion_asset_id);
-        json_get_string(args_json, "url", url, sizeof(url));
-        json_get_string(args_json, "name", name, sizeof(name));
+        json_get_number(args, "ionAssetId", ion_asset_id);
+        json_get_string_view(args, "url", url);
+        json_get_string_view(args, "name", name);
         // Note: show defaults to true
 
         int tileset_id = entity_counter++;
         if (ion_asset_id > 0) {
-            snprintf(result_text, sizeof(result_text),
-                     "type,id,ionAssetId,name,show\nloadTileset,tileset-%d,%.0f,%s,true",
-                     tileset_id, ion_asset_id, name[0] ? name : "tileset");
-        } else if (url[0] != '\0') {
-            snprintf(result_text, sizeof(result_text),
-                     "type,id,url,name,show\nloadTileset,tileset-%d,%s,%s,true",
-                     tileset_id, url, name[0] ? name : "tileset");
+            format_text(result_text, sizeof(result_text),
+                        "type,id,ionAssetId,name,show\nloadTileset,tileset-%d,%.0f,%.*s,true",
+                        tileset_id, ion_asset_id, VIEW_ARG(!name.empty() ? name : "tileset"));
+        } else if (!url.empty()) {
+            format_text(result_text, sizeof(result_text),
+                        "type,id,url,name,show\nloadTileset,tileset-%d,%.*s,%.*s,true",
+                        tileset_id, VIEW_ARG(url), VIEW_ARG(!name.empty() ? name : "tileset"));
         } else {
             strcpy(result_text, "Missing 'ionAssetId' or 'url' parameter");
         }
     }
-    else if (strcmp(tool_name, "setImagery") == 0) {
-        char provider[64] = "";
-        char url[512] = "";
+    else if (tool_name == "setImagery") {
+        std::string_view provider;
+        std::string_view url;
         double ion_asset_id = -1;
 
-        json_get_string(args_json, "provider", provider, sizeof(provider));
-        json_get_string(args_json, "url", url, sizeof(url));
-        json_get_number(args_json, "ionAssetId", ion_asset_id);
+        json_get_string_view(args, "provider", provider);
+        json_get_string_view(args, "url", url);
+        json_get_number(args, "ionAssetId", ion_asset_id);
 
-        if (provider[0] != '\0') {
-            if (url[0] != '\0') {
-                snprintf(result_text, sizeof(result_text),
-                         "type,provider,url\nsetImagery,%s,%s",
-                         provider, url);
+        if (!provider.empty()) {
+            if (!url.empty()) {
+                format_text(result_text, sizeof(result_text),
+                            "type,provider,url\nsetImagery,%.*s,%.*s",
+                            VIEW_ARG(provider), VIEW_ARG(url));
             } else if (ion_asset_id > 0) {
-                snprintf(result_text, sizeof(result_text),
-                         "type,provider,ionAssetId\nsetImagery,%s,%.0f",
-                         provider, ion_asset_id);
+                format_text(result_text, sizeof(result_text),
+                            "type,provider,ionAssetId\nsetImagery,%.*s,%.0f",
+                            VIEW_ARG(provider), ion_asset_id);
             } else {
-                snprintf(result_text, sizeof(result_text),
-                         "type,provider\nsetImagery,%s",
-                         provider);
+                format_text(result_text, sizeof(result_text),
+                            "type,provider\nsetImagery,%.*s",
+                            VIEW_ARG(provider));
             }
         } else {
             strcpy(result_text, "Missing 'provider' parameter");
         }
     }
-    else if (strcmp(tool_name, "setTerrain") == 0) {
-        char provider[64] = "";
+    else if (tool_name == "setTerrain") {
+        std::string_view provider;
         double ion_asset_id = -1;
         double exaggeration = 1.0;
 
-        json_get_string(args_json, "provider", provider, sizeof(provider));
-        json_get_number(args_json, "ionAssetId", ion_asset_id);
-        json_get_number(args_json, "exaggeration", exaggeration);
+        json_get_string_view(args, "provider", provider);
+        json_get_number(args, "ionAssetId", ion_asset_id);
+        json_get_number(args, "exaggeration", exaggeration);
 
-        if (provider[0] != '\0') {
+        if (!provider.empty()) {
             if (ion_asset_id > 0) {
-                snprintf(result_text, sizeof(result_text),
-                         "type,provider,ionAssetId,exaggeration\nsetTerrain,%s,%.0f,%.2f",
-                         provider, ion_asset_id, exaggeration);
+                format_text(result_text, sizeof(result_text),
+                            "type,provider,ionAssetId,exaggeration\nsetTerrain,%.*s,%.0f,%.2f",
+                            VIEW_ARG(provider), ion_asset_id, exaggeration);
             } else {
-                snprintf(result_text, sizeof(result_text),
-                         "type,provider,exaggeration\nsetTerrain,%s,%.2f",
-                         provider, exaggeration);
+                format_text(result_text, sizeof(result_text),
+                            "type,provider,exaggeration\nsetTerrain,%.*s,%.2f",
+                            VIEW_ARG(provider), exaggeration);
             }
         } else {
             strcpy(result_text, "Missing 'provider' parameter");
         }
     }
-    else if (strcmp(tool_name, "toggleLayerVisibility") == 0) {
-        char layer_id[64] = "";
+    else if (tool_name == "toggleLayerVisibility") {
+        std::string_view layer_id;
         bool visible = true;
         double visible_num = 1;
 
-        json_get_string(args_json, "id", layer_id, sizeof(layer_id));
-        json_get_number(args_json, "visible", visible_num);
+        json_get_string_view(args, "id", layer_id);
+        json_get_number(args, "visible", visible_num);
         visible = visible_num > 0;
 
-        if (layer_id[0] != '\0') {
-            snprintf(result_text, sizeof(result_text),
-                     "type,id,visible\ntoggleLayerVisibility,%s,%s",
-                     layer_id, visible ? "true" : "false");
+        if (!layer_id.empty()) {
+            format_text(result_text, sizeof(result_text),
+                        "type,id,visible\ntoggleLayerVisibility,%.*s,%s",
+                        VIEW_ARG(layer_id), visible ? "true" : "false");
         } else {
             strcpy(result_text, "Missing 'id' parameter");
         }
     }
-    else if (strcmp(tool_name, "setEntityStyle") == 0) {
-        char entity_id[64] = "";
-        char color[32] = "";
-        char outline_color[32] = "";
+    else if (tool_name == "setEntityStyle") {
+        std::string_view entity_id;
+        std::string_view color;
+        std::string_view outline_color;
         double opacity = -1;
         double outline_width = -1;
 
-        json_get_string(args_json, "id", entity_id, sizeof(entity_id));
-        json_get_string(args_json, "color", color, sizeof(color));
-        json_get_string(args_json, "outlineColor", outline_color, sizeof(outline_color));
-        json_get_number(args_json, "opacity", opacity);
-        json_get_number(args_json, "outlineWidth", outline_width);
+        json_get_string_view(args, "id", entity_id);
+        json_get_string_view(args, "color", color);
+        json_get_string_view(args, "outlineColor", outline_color);
+        json_get_number(args, "opacity", opacity);
+        json_get_number(args, "outlineWidth", outline_width);
 
-        if (entity_id[0] != '\0') {
+        if (!entity_id.empty()) {
             // Build CSV header and data dynamically based on which fields are set
             char csv_header[256];
             char csv_data[256];
             size_t h_off = 0, d_off = 0;
-            h_off += snprintf(csv_header + h_off, sizeof(csv_header) - h_off, "type,id");
-            d_off += snprintf(csv_data + d_off, sizeof(csv_data) - d_off, "setEntityStyle,%s", entity_id);
-            if (color[0] != '\0') {
-                h_off += snprintf(csv_header + h_off, sizeof(csv_header) - h_off, ",color");
-                d_off += snprintf(csv_data + d_off, sizeof(csv_data) - d_off, ",%s", color);
+            h_off += format_text(csv_header + h_off, sizeof(csv_header) - h_off, "type,id");
+            d_off += format_text(csv_data + d_off, sizeof(csv_data) - d_off, "setEntityStyle,%.*s", VIEW_ARG(entity_id));
+            if (!color.empty()) {
+                h_off += format_text(csv_header + h_off, sizeof(csv_header) - h_off, ",color");
+                d_off += format_text(csv_data + d_off, sizeof(csv_data) - d_off, ",%.*s", VIEW_ARG(color));
             }
             if (opacity >= 0) {
-                h_off += snprintf(csv_header + h_off, sizeof(csv_header) - h_off, ",opacity");
-                d_off += snprintf(csv_data + d_off, sizeof(csv_data) - d_off, ",%.2f", opacity);
+                h_off += format_text(csv_header + h_off, sizeof(csv_header) - h_off, ",opacity");
+                d_off += format_text(csv_data + d_off, sizeof(csv_data) - d_off, ",%.2f", opacity);
             }
-            if (outline_color[0] != '\0') {
-                h_off += snprintf(csv_header + h_off, sizeof(csv_header) - h_off, ",outlineColor");
-                d_off += snprintf(csv_data + d_off, sizeof(csv_data) - d_off, ",%s", outline_color);
+            if (!outline_color.empty()) {
+                h_off += format_text(csv_header + h_off, sizeof(csv_header) - h_off, ",outlineColor");
+                d_off += format_text(csv_data + d_off, sizeof(csv_data) - d_off, ",%.*s", VIEW_ARG(outline_color));
             }
             if (outline_width >= 0) {
-                h_off += snprintf(csv_header + h_off, sizeof(csv_header) - h_off, ",outlineWidth");
-                d_off += snprintf(csv_data + d_off, sizeof(csv_data) - d_off, ",%.1f", outline_width);
+                h_off += format_text(csv_header + h_off, sizeof(csv_header) - h_off, ",outlineWidth");
+                d_off += format_text(csv_data + d_off, sizeof(csv_data) - d_off, ",%.1f", outline_width);
             }
-            snprintf(result_text, sizeof(result_text), "%s\n%s", csv_header, csv_data);
+            format_text(result_text, sizeof(result_text), "%s\n%s", csv_header, csv_data);
         } else {
             strcpy(result_text, "Missing 'id' parameter");
         }
     }
-    else if (strcmp(tool_name, "setTime") == 0) {
-        char iso8601[64] = "";
+    else if (tool_name == "setTime") {
+        std::string_view iso8601;
         double julian_date = -1;
 
-        json_get_string(args_json, "iso8601", iso8601, sizeof(iso8601));
-        json_get_number(args_json, "julianDate", julian_date);
+        json_get_string_view(args, "iso8601", iso8601);
+        json_get_number(args, "julianDate", julian_date);
 
-        if (iso8601[0] != '\0') {
-            snprintf(result_text, sizeof(result_text),
-                     "type,iso8601\nsetTime,%s", iso8601);
+        if (!iso8601.empty()) {
+            format_text(result_text, sizeof(result_text),
+                        "type,iso8601\nsetTime,%.*s", VIEW_ARG(iso8601));
         } else if (julian_date > 0) {
-            snprintf(result_text, sizeof(result_text),
-                     "type,julianDate\nsetTime,%.6f", julian_date);
+            format_text(result_text, sizeof(result_text),
+                        "type,julianDate\nsetTime,%.6f", julian_date);
         } else {
             strcpy(result_text, "Missing 'iso8601' or 'julianDate' parameter");
         }
     }
-    else if (strcmp(tool_name, "setClockRange") == 0) {
-        char start_time[64] = "";
-        char end_time[64] = "";
+    else if (tool_name == "setClockRange") {
+        std::string_view start_time;
+        std::string_view end_time;
         double multiplier = 1.0;
         double should_animate = 1;
 
-        json_get_string(args_json, "startTime", start_time, sizeof(start_time));
-        json_get_string(args_json, "endTime", end_time, sizeof(end_time));
-        json_get_number(args_json, "multiplier", multiplier);
-        json_get_number(args_json, "shouldAnimate", should_animate);
+        json_get_string_view(args, "startTime", start_time);
+        json_get_string_view(args, "endTime", end_time);
+        json_get_number(args, "multiplier", multiplier);
+        json_get_number(args, "shouldAnimate", should_animate);
 
         // Build CSV header and data dynamically
         char csv_header[256];
         char csv_data[256];
         size_t h_off = 0, d_off = 0;
-        h_off += snprintf(csv_header + h_off, sizeof(csv_header) - h_off, "type");
-        d_off += snprintf(csv_data + d_off, sizeof(csv_data) - d_off, "setClockRange");
-        if (start_time[0] != '\0') {
-            h_off += snprintf(csv_header + h_off, sizeof(csv_header) - h_off, ",startTime");
-            d_off += snprintf(csv_data + d_off, sizeof(csv_data) - d_off, ",%s", start_time);
-        }
-        if (end_time[0] != '\0') {
-            h_off += snprintf(csv_header + h_off, sizeof(csv_header) - h_off, ",endTime");
-            d_off += snprintf(csv_data + d_off, sizeof(csv_data) - d_off, ",%s", end_time);
-        }
-        h_off += snprintf(csv_header + h_off, sizeof(csv_header) - h_off, ",multiplier,shouldAnimate");
-        d_off += snprintf(csv_data + d_off, sizeof(csv_data) - d_off, ",%.2f,%s",
-                          multiplier, should_animate > 0 ? "true" : "false");
-        snprintf(result_text, sizeof(result_text), "%s\n%s", csv_header, csv_data);
-    }
-    else if (strcmp(tool_name, "listLocations") == 0) {
+        h_off += format_text(csv_header + h_off, sizeof(csv_header) - h_off, "type");
+        d_off += format_text(csv_data + d_off, sizeof(csv_data) - d_off, "setClockRange");
+        if (!start_time.empty()) {
+            h_off += format_text(csv_header + h_off, sizeof(csv_header) - h_off, ",startTime");
+            d_off += format_text(csv_data + d_off, sizeof(csv_data) - d_off, ",%.*s", VIEW_ARG(start_time));
+        }
+        if (!end_time.empty()) {
+            h_off += format_text(csv_header + h_off, sizeof(csv_header) - h_off, ",endTime");
+            d_off += format_text(csv_data + d_off, sizeof(csv_data) - d_off, ",%.*s", VIEW_ARG(end_time));
+        }
+        h_off += format_text(csv_header + h_off, sizeof(csv_header) - h_off, ",multiplier,shouldAnimate");
+        d_off += format_text(csv_data + d_off, sizeof(csv_data) - d_off, ",%.2f,%s",
+                             multiplier, should_animate > 0 ? "true" : "false");
+        format_text(result_text, sizeof(result_text), "%s\n%s", csv_header, csv_data);
+    }
+    else if (tool_name == "listLocations") {
         char prefix[64] = "";
-        json_get_string(args_json, "prefix", prefix, sizeof(prefix));
-
-        const Location* locations = get_all_locations();
-        size_t count = get_location_count();
+        json_get_string(args, "prefix", prefix, sizeof(prefix));
 
         // Build CSV of locations
         size_t offset = 0;
-        offset += snprintf(result_text + offset, sizeof(result_text) - offset,
-                           "name,longitude,latitude");
+        offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                              "name,longitude,latitude");
 
-        for (size_t i = 0; i < count && offset < sizeof(result_text) - 100; i++) {
-            if (locations[i].name == nullptr) continue;
+        LocationFilter filter;
+        if (!json_get_location_filter(args, filter, result_text, sizeof(result_text))) {
+            return tool_error_response(id, result_text, response, response_size);
+        }
+        bool filtered = filter.types != 0 || filter.country != LOCATION_COUNTRY_UNKNOWN;
 
-            // Filter by prefix if provided
-            if (prefix[0] != '\0') {
-                char normalized[256];
-                normalize_location_name(prefix, normalized, sizeof(normalized));
-                if (strncmp(locations[i].name, normalized, strlen(normalized)) != 0) {
-                    continue;
-                }
+        // An attached binary database answers unfiltered prefix queries
+        // from its own records, which carry no type or country
+        const LocdbRecord* records[1024];
+        size_t num_records = 0;
+        if (prefix[0] != '\0' && !filtered && get_binary_location_count() > 0) {
+            num_records = search_binary_locations(prefix, records, 1024);
+        }
+
+        if (num_records > 0) {
+            for (size_t i = 0; i < num_records && offset < sizeof(result_text) - 100; i++) {
+                offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                                      "\n%s,%.6f,%.6f",
+                                      records[i]->name, records[i]->longitude, records[i]->latitude);
             }
+        } else if (prefix[0] != '\0' || filtered) {
+            // Prefix matches come from the sorted name index (or the type or
+            // country sub-index), alphabetically
+            const Location* matches[1024];
+            size_t num_matches = filtered ? search_locations_filtered(prefix, filter, matches, 1024)
+                                          : search_locations(prefix, matches, 1024);
+
+            for (size_t i = 0; i < num_matches && offset < sizeof(result_text) - 100; i++) {
+                offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                                      "\n%s,%.6f,%.6f",
+                                      matches[i]->name, matches[i]->longitude, matches[i]->latitude);
+            }
+        } else {
+            const Location* locations = get_all_locations();
+            size_t count = get_location_count();
+
+            for (size_t i = 0; i < count && offset < sizeof(result_text) - 100; i++) {
+                if (locations[i].name == nullptr) continue;
 
-            offset += snprintf(result_text + offset, sizeof(result_text) - offset,
-                               "\n%s,%.6f,%.6f",
-                               locations[i].name, locations[i].longitude, locations[i].latitude);
+                offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                                      "\n%s,%.6f,%.6f",
+                                      locations[i].name, locations[i].longitude, locations[i].latitude);
+            }
         }
     }
-    else if (strcmp(tool_name, "getTopCitiesByPopulation") == 0) {
+    else if (tool_name == "searchLocationsContaining") {
+        char text[256] = "";
+        double count_d = 20;
+        json_get_string(args, "text", text, sizeof(text));
+        json_get_number(args, "count", count_d);
+        LocationFilter filter;
+        if (!json_get_location_filter(args, filter, result_text, sizeof(result_text))) {
+            return tool_error_response(id, result_text, response, response_size);
+        }
+
+        size_t count = static_cast<size_t>(count_d);
+        if (count > 100) count = 100;
+        if (count < 1) count = 20;
+
+        if (text[0] == '\0') {
+            strcpy(result_text, "Missing 'text' parameter (text to find inside place names)");
+        } else {
+            const Location* results[100];
+            size_t num_results = search_locations_containing(text, filter, results, count);
+
+            size_t offset = 0;
+            offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                                  "name,population,longitude,latitude");
+
+            for (size_t i = 0; i < num_results && offset < sizeof(result_text) - 200; i++) {
+                offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                                      "\n%s,%d,%.6f,%.6f",
+                                      results[i]->name, results[i]->population,
+                                      results[i]->longitude, results[i]->latitude);
+            }
+        }
+    }
+    else if (tool_name == "getTopCitiesByPopulation") {
         double count_d = 10;
-        double min_pop = 0;
-        json_get_number(args_json, "count", count_d);
-        json_get_number(args_json, "minPopulation", min_pop);
+        json_get_number(args, "count", count_d);
+        PopulationFilter filter;
+        if (!json_get_population_filter(args, filter, result_text, sizeof(result_text))) {
+            return tool_error_response(id, result_text, response, response_size);
+        }
 
         size_t count = static_cast<size_t>(count_d);
         if (count > 100) count = 100;
         if (count < 1) count = 10;
 
         const Location* results[100];
-        size_t num_results = get_top_cities_by_population(results, count, static_cast<int>(min_pop));
+        size_t num_results = find_top_locations_by_population(filter, results, count);
 
         // Build CSV output
         size_t offset = 0;
-        offset += snprintf(result_text + offset, sizeof(result_text) - offset,
-                           "name,population,longitude,latitude");
+        offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                              "name,population,longitude,latitude");
 
         for (size_t i = 0; i < num_results && offset < sizeof(result_text) - 200; i++) {
-            offset += snprintf(result_text + offset, sizeof(result_text) - offset,
-                               "\n%s,%d,%.6f,%.6f",
-                               results[i]->name, results[i]->population,
-                               results[i]->longitude, results[i]->latitude);
+            offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                                  "\n%s,%d,%.6f,%.6f",
+                                  results[i]->name, results[i]->population,
+                                  results[i]->longitude, results[i]->latitude);
         }
     }
-    else if (strcmp(tool_name, "showTopCitiesByPopulation") == 0) {
+    else if (tool_name == "findNearbyLocations") {
+        char location[256] = "";
+        double longitude = 0, latitude = 0, heading;
+        double count_d = 10;
+        double radius = 0;
+        json_get_number(args, "count", count_d);
+        json_get_number(args, "radius", radius);
+
+        // Center: named location, explicit coordinates, then camera target
+        bool have_center = false;
+        if (json_get_string(args, "location", location, sizeof(location)) && location[0] != '\0') {
+            have_center = resolve_location(location, longitude, latitude, heading);
+        } else if (json_get_number(args, "longitude", longitude) &&
+                   json_get_number(args, "latitude", latitude)) {
+            have_center = true;
+        } else if (camera_state_valid) {
+            longitude = camera_target_longitude;
+            latitude = camera_target_latitude;
+            have_center = true;
+        }
+
+        size_t count = static_cast<size_t>(count_d);
+        if (count > 100) count = 100;
+        if (count < 1) count = 10;
+
+        if (!have_center) {
+            if (location[0] != '\0') {
+                format_text(result_text, sizeof(result_text), "Unknown location: %s", location);
+            } else {
+                strcpy(result_text, "Camera position not available. Please wait for camera to initialize.");
+            }
+        } else {
+            std::vector<SpatialMatch> matches;
+            find_nearest_locations(longitude, latitude, count, radius, matches);
+
+            const Location* locations = get_all_locations();
+            size_t offset = 0;
+            offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                                  "name,distanceKm,population,longitude,latitude");
+            for (size_t i = 0; i < matches.size() && offset < sizeof(result_text) - 200; i++) {
+                const Location& loc = locations[matches[i].id];
+                offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                                      "\n%s,%.2f,%d,%.6f,%.6f",
+                                      loc.name, matches[i].distance / 1000.0, loc.population,
+                                      loc.longitude, loc.latitude);
+            }
+        }
+    }
+    else if (tool_name == "findLocationsInView") {
+        double west = 0, south = 0, east = 0, north = 0;
+        double count_d = 20;
+        bool have_bbox = json_get_number(args, "west", west) &&
+                         json_get_number(args, "south", south) &&
+                         json_get_number(args, "east", east) &&
+                         json_get_number(args, "north", north);
+        json_get_number(args, "count", count_d);
+
+        size_t count = static_cast<size_t>(count_d);
+        if (count > 100) count = 100;
+        if (count < 1) count = 20;
+
+        if (!have_bbox) {
+            strcpy(result_text, "Bounding box requires west, south, east and north");
+        } else {
+            std::vector<uint32_t> ids;
+            find_locations_in_bbox(west, south, east, north, ids);
+
+            // Most populous first; ties keep database order
+            const LocationStore& store = get_location_store();
+            size_t shown = std::min(count, ids.size());
+            std::partial_sort(ids.begin(), ids.begin() + shown, ids.end(),
+                              [&store](uint32_t a, uint32_t b) {
+                                  if (store.population[a] != store.population[b]) {
+                                      return store.population[a] > store.population[b];
+                                  }
+                                  return a < b;
+                              });
+
+            const Location* locations = get_all_locations();
+            size_t offset = 0;
+            offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                                  "name,population,longitude,latitude");
+            for (size_t i = 0; i < shown && offset < sizeof(result_text) - 200; i++) {
+                const Location& loc = locations[ids[i]];
+                offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                                      "\n%s,%d,%.6f,%.6f",
+                                      loc.name, loc.population, loc.longitude, loc.latitude);
+            }
+        }
+    }
+    else if (tool_name == "reverseGeocode") {
+        double lon = 0, lat = 0;
+        double max_distance = REVERSE_GEOCODE_DISTANCE;
+        bool have_point = json_get_number(args, "longitude", lon) &&
+                          json_get_number(args, "latitude", lat);
+        json_get_number(args, "maxDistance", max_distance);
+
+        if (!have_point && camera_state_valid) {
+            lon = camera_target_longitude;
+            lat = camera_target_latitude;
+            have_point = true;
+        }
+
+        SpatialMatch match;
+        if (!have_point) {
+            strcpy(result_text, "Camera position not available. Please wait for camera to initialize.");
+        } else if (reverse_geocode_location(lon, lat, max_distance, match)) {
+            const Location& loc = get_all_locations()[match.id];
+            format_text(result_text, sizeof(result_text),
+                        "name,distanceKm,population,longitude,latitude,source\n"
+                        "%s,%.2f,%d,%.6f,%.6f,local",
+                        loc.name, match.distance / 1000.0, loc.population,
+                        loc.longitude, loc.latitude);
+        } else {
+            // Nothing known nearby (open ocean, sparse regions): ask Nominatim
+            char http_response[8192];
+            size_t len = nominatim_reverse(lon, lat, http_response, sizeof(http_response));
+            if (len > 0) {
+                format_text(result_text, sizeof(result_text),
+                            "longitude,latitude,source,nominatimJson\n%.6f,%.6f,nominatim,%s",
+                            lon, lat, http_response);
+            } else {
+                format_text(result_text, sizeof(result_text),
+                            "No known place within %.0f km of %.6f,%.6f",
+                            max_distance / 1000.0, lon, lat);
+            }
+        }
+    }
+    else if (tool_name == "showTopCitiesByPopulation") {
         double count_d = 10;
         double min_radius = 10000;
         double max_radius = 200000;
         double base_size = 50000;
         double min_height = 10000;
         double max_height = 500000;
-        char color[32] = "cyan";
-        char shape[32] = "circle";
-
-        json_get_number(args_json, "count", count_d);
-        json_get_number(args_json, "minRadius", min_radius);
-        json_get_number(args_json, "maxRadius", max_radius);
-        json_get_number(args_json, "baseSize", base_size);
-        json_get_number(args_json, "minHeight", min_height);
-        json_get_number(args_json, "maxHeight", max_height);
-        if (!json_get_string(args_json, "color", color, sizeof(color)) || color[0] == '\0') {
-            strcpy(color, "cyan");
-        }
-        if (!json_get_string(args_json, "shape", shape, sizeof(shape)) || shape[0] == '\0') {
-            strcpy(shape, "circle");
-        }
+        std::string_view color = "cyan";
+        std::string_view shape = "circle";
+
+        json_get_number(args, "count", count_d);
+        json_get_number(args, "minRadius", min_radius);
+        json_get_number(args, "maxRadius", max_radius);
+        json_get_number(args, "baseSize", base_size);
+        json_get_number(args, "minHeight", min_height);
+        json_get_number(args, "maxHeight", max_height);
+        json_get_string_view(args, "color", color);
+        if (color.empty()) color = "cyan";
+        json_get_string_view(args, "shape", shape);
+        if (shape.empty()) shape = "circle";
 
         size_t count = static_cast<size_t>(count_d);
         if (count > 100) count = 100;
         if (count < 1) count = 10;
 
+        PopulationFilter filter;
+        if (!json_get_population_filter(args, filter, result_text, sizeof(result_text))) {
+            return tool_error_response(id, result_text, response, response_size);
+        }
         const Location* results[100];
-        size_t num_results = get_top_cities_by_population(results, count, 0);
+        size_t num_results = find_top_locations_by_population(filter, results, count);
 
-        bool is_rectangle = (strcmp(shape, "rectangle") == 0 || strcmp(shape, "bar") == 0);
+        bool is_rectangle = (shape == "rectangle" || shape == "bar");
 
         // Section 1: command metadata
         size_t offset = 0;
-        offset += snprintf(result_text + offset, sizeof(result_text) - offset,
-                           "type,color,shape\nshowTopCities,%s,%s", color, shape);
+        offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                              "type,color,shape\nshowTopCities,%.*s,%.*s", VIEW_ARG(color), VIEW_ARG(shape));
 
         if (num_results > 0) {
             int max_pop = results[0]->population;
@@ -783,341 +1186,307 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
 
             if (is_rectangle) {
                 // Section 2: batch data rows for rectangles
-                offset += snprintf(result_text + offset, sizeof(result_text) - offset,
-                                   "\n\nname,population,longitude,latitude,baseSize,extrudedHeight");
+                offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                                      "\n\nname,population,longitude,latitude,baseSize,extrudedHeight");
 
                 for (size_t i = 0; i < num_results && offset < sizeof(result_text) - 200; i++) {
                     double pop_ratio = static_cast<double>(results[i]->population - min_pop_val) /
                                        static_cast<double>(max_pop - min_pop_val);
                     double ext_height = min_height + pop_ratio * (max_height - min_height);
 
-                    offset += snprintf(result_text + offset, sizeof(result_text) - offset,
-                                       "\n%s,%d,%.4f,%.4f,%.0f,%.0f",
-                                       results[i]->name, results[i]->population,
-                                       results[i]->longitude, results[i]->latitude,
-                                       base_size, ext_height);
+                    offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                                          "\n%s,%d,%.4f,%.4f,%.0f,%.0f",
+                                          results[i]->name, results[i]->population,
+                                          results[i]->longitude, results[i]->latitude,
+                                          base_size, ext_height);
                 }
             } else {
                 // Section 2: batch data rows for circles
-                offset += snprintf(result_text + offset, sizeof(result_text) - offset,
-                                   "\n\nname,population,longitude,latitude,radius");
+                offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                                      "\n\nname,population,longitude,latitude,radius");
 
                 for (size_t i = 0; i < num_results && offset < sizeof(result_text) - 100; i++) {
                     double pop_ratio = static_cast<double>(results[i]->population - min_pop_val) /
                                        static_cast<double>(max_pop - min_pop_val);
                     double radius = min_radius + pop_ratio * (max_radius - min_radius);
 
-                    offset += snprintf(result_text + offset, sizeof(result_text) - offset,
-                                       "\n%s,%d,%.4f,%.4f,%.0f",
-                                       results[i]->name, results[i]->population,
-                                       results[i]->longitude, results[i]->latitude, radius);
+                    offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                                          "\n%s,%d,%.4f,%.4f,%.0f",
+                                          results[i]->name, results[i]->population,
+                                          results[i]->longitude, results[i]->latitude, radius);
                 }
             }
         }
     }
-    else if (strcmp(tool_name, "addPolyline") == 0) {
-        char positions_json[4096] = "";
-        char color[32] = "white";
+    else if (tool_name == "addPolyline") {
+        std::string_view color = "white";
         double width = 2.0;
         double clamp = 0;
-        char name[128] = "";
+        std::string_view name;
 
-        json_get_object(args_json, "positions", positions_json, sizeof(positions_json));
-        json_get_string(args_json, "color", color, sizeof(color));
-        json_get_number(args_json, "width", width);
-        json_get_number(args_json, "clampToGround", clamp);
-        json_get_string(args_json, "name", name, sizeof(name));
+        json_get_string_view(args, "color", color);
+        json_get_number(args, "width", width);
+        json_get_number(args, "clampToGround", clamp);
+        json_get_string_view(args, "name", name);
 
         int entity_id = entity_counter++;
         // Section 1: command metadata
         size_t offset = 0;
-        offset += snprintf(result_text + offset, sizeof(result_text) - offset,
-                           "type,id,color,width,clampToGround,name\n"
-                           "addPolyline,entity-%d,%s,%.1f,%s,%s",
-                           entity_id, color, width, clamp > 0 ? "true" : "false",
-                           name[0] ? name : "polyline");
+        offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                              "type,id,color,width,clampToGround,name\n"
+                              "addPolyline,entity-%d,%.*s,%.1f,%s,%.*s",
+                              entity_id, VIEW_ARG(color), width, clamp > 0 ? "true" : "false",
+                              VIEW_ARG(!name.empty() ? name : "polyline"));
 
         // Section 2: position rows (parse JSON positions array)
-        offset += snprintf(result_text + offset, sizeof(result_text) - offset,
-                           "\n\nlongitude,latitude,height");
-        // Iterate through JSON positions array
-        const char* p = positions_json;
-        while (*p && *p != '[') p++;
-        if (*p) p++;
-        while (*p) {
-            while (*p && *p != '{' && *p != ']') p++;
-            if (*p == ']' || !*p) break;
-            char pos_obj[256];
-            int depth = 0;
-            int pi = 0;
-            for (; *p && pi < (int)sizeof(pos_obj)-1; p++) {
-                pos_obj[pi++] = *p;
-                if (*p == '{') depth++;
-                if (*p == '}') { depth--; if (depth == 0) { p++; break; } }
-            }
-            pos_obj[pi] = '\0';
-            double plon = 0, plat = 0, ph = 0;
-            json_get_number(pos_obj, "longitude", plon);
-            json_get_number(pos_obj, "latitude", plat);
-            json_get_number(pos_obj, "height", ph);
-            offset += snprintf(result_text + offset, sizeof(result_text) - offset,
-                               "\n%.6f,%.6f,%.1f", plon, plat, ph);
-        }
-    }
-    else if (strcmp(tool_name, "addPolygon") == 0) {
-        char positions_json[4096] = "";
-        char color[32] = "blue";
-        char outline_color[32] = "white";
+        offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                              "\n\nlongitude,latitude,height");
+        size_t rows = json_get_number_rows(args, "positions", POSITION_COLUMNS, POSITION_DEFAULTS, 3,
+                                           position_rows, MAX_POSITIONS);
+        for (size_t i = 0; i < rows && offset < sizeof(result_text); i++) {
+            const double* row = position_rows + i * 3;
+            offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                                  "\n%.6f,%.6f,%.1f", row[0], row[1], row[2]);
+        }
+    }
+    else if (tool_name == "addPolygon") {
+        std::string_view color = "blue";
+        std::string_view outline_color = "white";
         double height = 0;
         double extruded_height = -1;
-        char name[128] = "";
+        std::string_view name;
 
-        json_get_object(args_json, "positions", positions_json, sizeof(positions_json));
-        json_get_string(args_json, "color", color, sizeof(color));
-        json_get_string(args_json, "outlineColor", outline_color, sizeof(outline_color));
-        json_get_number(args_json, "height", height);
-        json_get_number(args_json, "extrudedHeight", extruded_height);
-        json_get_string(args_json, "name", name, sizeof(name));
+        json_get_string_view(args, "color", color);
+        json_get_string_view(args, "outlineColor", outline_color);
+        json_get_number(args, "height", height);
+        json_get_number(args, "extrudedHeight", extruded_height);
+        json_get_string_view(args, "name", name);
 
         int entity_id = entity_counter++;
         // Section 1: command metadata
         size_t offset = 0;
         if (extruded_height >= 0) {
-            offset += snprintf(result_text + offset, sizeof(result_text) - offset,
-                               "type,id,color,outlineColor,height,extrudedHeight,name\n"
-                               "addPolygon,entity-%d,%s,%s,%.1f,%.1f,%s",
-                               entity_id, color, outline_color, height, extruded_height,
-                               name[0] ? name : "polygon");
+            offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                                  "type,id,color,outlineColor,height,extrudedHeight,name\n"
+                                  "addPolygon,entity-%d,%.*s,%.*s,%.1f,%.1f,%.*s",
+                                  entity_id, VIEW_ARG(color), VIEW_ARG(outline_color), height, extruded_height,
+                                  VIEW_ARG(!name.empty() ? name : "polygon"));
         } else {
-            offset += snprintf(result_text + offset, sizeof(result_text) - offset,
-                               "type,id,color,outlineColor,height,name\n"
-                               "addPolygon,entity-%d,%s,%s,%.1f,%s",
-                               entity_id, color, outline_color, height,
-                               name[0] ? name : "polygon");
+            offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                                  "type,id,color,outlineColor,height,name\n"
+                                  "addPolygon,entity-%d,%.*s,%.*s,%.1f,%.*s",
+                                  entity_id, VIEW_ARG(color), VIEW_ARG(outline_color), height,
+                                  VIEW_ARG(!name.empty() ? name : "polygon"));
         }
 
         // Section 2: position rows
-        offset += snprintf(result_text + offset, sizeof(result_text) - offset,
-                           "\n\nlongitude,latitude");
-        const char* p = positions_json;
-        while (*p && *p != '[') p++;
-        if (*p) p++;
-        while (*p) {
-            while (*p && *p != '{' && *p != ']') p++;
-            if (*p == ']' || !*p) break;
-            char pos_obj[256];
-            int depth = 0;
-            int pi = 0;
-            for (; *p && pi < (int)sizeof(pos_obj)-1; p++) {
-                pos_obj[pi++] = *p;
-                if (*p == '{') depth++;
-                if (*p == '}') { depth--; if (depth == 0) { p++; break; } }
-            }
-            pos_obj[pi] = '\0';
-            double plon = 0, plat = 0;
-            json_get_number(pos_obj, "longitude", plon);
-            json_get_number(pos_obj, "latitude", plat);
-            offset += snprintf(result_text + offset, sizeof(result_text) - offset,
-                               "\n%.6f,%.6f", plon, plat);
+        offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                              "\n\nlongitude,latitude");
+        size_t rows = json_get_number_rows(args, "positions", POSITION_COLUMNS, POSITION_DEFAULTS, 2,
+                                           position_rows, MAX_POSITIONS);
+        for (size_t i = 0; i < rows && offset < sizeof(result_text); i++) {
+            const double* row = position_rows + i * 2;
+            offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                                  "\n%.6f,%.6f", row[0], row[1]);
         }
     }
-    else if (strcmp(tool_name, "addModel") == 0) {
+    else if (tool_name == "addModel") {
         double lon = 0, lat = 0, height = 0;
         double scale = 1.0, heading = 0;
         double ion_asset_id = -1;
-        char url[512] = "";
-        char name[128] = "";
-
-        json_get_number(args_json, "longitude", lon);
-        json_get_number(args_json, "latitude", lat);
-        json_get_number(args_json, "height", height);
-        json_get_string(args_json, "url", url, sizeof(url));
-        json_get_number(args_json, "ionAssetId", ion_asset_id);
-        json_get_number(args_json, "scale", scale);
-        json_get_number(args_json, "heading", heading);
-        json_get_string(args_json, "name", name, sizeof(name));
+        std::string_view url;
+        std::string_view name;
+
+        json_get_number(args, "longitude", lon);
+        json_get_number(args, "latitude", lat);
+        json_get_number(args, "height", height);
+        json_get_string_view(args, "url", url);
+        json_get_number(args, "ionAssetId", ion_asset_id);
+        json_get_number(args, "scale", scale);
+        json_get_number(args, "heading", heading);
+        json_get_string_view(args, "name", name);
 
         int entity_id = entity_counter++;
         if (ion_asset_id > 0) {
-            snprintf(result_text, sizeof(result_text),
-                     "type,id,longitude,latitude,height,ionAssetId,scale,heading,name\n"
-                     "addModel,entity-%d,%.6f,%.6f,%.1f,%.0f,%.2f,%.1f,%s",
-                     entity_id, lon, lat, height, ion_asset_id, scale, heading, name[0] ? name : "model");
+            format_text(result_text, sizeof(result_text),
+                        "type,id,longitude,latitude,height,ionAssetId,scale,heading,name\n"
+                        "addModel,entity-%d,%.6f,%.6f,%.1f,%.0f,%.2f,%.1f,%.*s",
+                        entity_id, lon, lat, height, ion_asset_id, scale, heading, VIEW_ARG(!name.empty() ? name : "model"));
         } else {
-            snprintf(result_text, sizeof(result_text),
-                     "type,id,longitude,latitude,height,url,scale,heading,name\n"
-                     "addModel,entity-%d,%.6f,%.6f,%.1f,%s,%.2f,%.1f,%s",
-                     entity_id, lon, lat, height, url, scale, heading, name[0] ? name : "model");
+            format_text(result_text, sizeof(result_text),
+                        "type,id,longitude,latitude,height,url,scale,heading,name\n"
+                        "addModel,entity-%d,%.6f,%.6f,%.1f,%.*s,%.2f,%.1f,%.*s",
+                        entity_id, lon, lat, height, VIEW_ARG(url), scale, heading, VIEW_ARG(!name.empty() ? name : "model"));
         }
     }
-    else if (strcmp(tool_name, "addModelAtLocation") == 0) {
+    else if (tool_name == "addModelAtLocation") {
         char location[256];
-        if (json_get_string(args_json, "location", location, sizeof(location))) {
+        if (json_get_string(args, "location", location, sizeof(location))) {
             double longitude, latitude, db_heading;
             if (resolve_location(location, longitude, latitude, db_heading)) {
                 double scale = 1.0, heading = db_heading;
                 double ion_asset_id = -1;
-                char url[512] = "";
-                char name[128] = "";
+                std::string_view url;
+                std::string_view name;
 
-                json_get_string(args_json, "url", url, sizeof(url));
-                json_get_number(args_json, "ionAssetId", ion_asset_id);
-                json_get_number(args_json, "scale", scale);
-                json_get_number(args_json, "heading", heading);
-                json_get_string(args_json, "name", name, sizeof(name));
+                json_get_string_view(args, "url", url);
+                json_get_number(args, "ionAssetId", ion_asset_id);
+                json_get_number(args, "scale", scale);
+                json_get_number(args, "heading", heading);
+                json_get_string_view(args, "name", name);
 
                 int entity_id = entity_counter++;
                 if (ion_asset_id > 0) {
-                    snprintf(result_text, sizeof(result_text),
-                             "type,id,longitude,latitude,height,ionAssetId,scale,heading,name\n"
-                             "addModel,entity-%d,%.6f,%.6f,0,%.0f,%.2f,%.1f,%s",
-                             entity_id, longitude, latitude, ion_asset_id, scale, heading, name[0] ? name : location);
+                    format_text(result_text, sizeof(result_text),
+                                "type,id,longitude,latitude,height,ionAssetId,scale,heading,name\n"
+                                "addModel,entity-%d,%.6f,%.6f,0,%.0f,%.2f,%.1f,%.*s",
+                                entity_id, longitude, latitude, ion_asset_id, scale, heading, VIEW_ARG(!name.empty() ? name : location));
                 } else {
-                    snprintf(result_text, sizeof(result_text),
-                             "type,id,longitude,latitude,height,url,scale,heading,name\n"
-                             "addModel,entity-%d,%.6f,%.6f,0,%s,%.2f,%.1f,%s",
-                             entity_id, longitude, latitude, url, scale, heading, name[0] ? name : location);
+                    format_text(result_text, sizeof(result_text),
+                                "type,id,longitude,latitude,height,url,scale,heading,name\n"
+                                "addModel,entity-%d,%.6f,%.6f,0,%.*s,%.2f,%.1f,%.*s",
+                                entity_id, longitude, latitude, VIEW_ARG(url), scale, heading, VIEW_ARG(!name.empty() ? name : location));
                 }
             } else {
-                snprintf(result_text, sizeof(result_text), "Location '%s' not found", location);
+                format_text(result_text, sizeof(result_text), "Location '%s' not found", location);
             }
         } else {
             strcpy(result_text, "Missing 'location' parameter");
         }
     }
-    else if (strcmp(tool_name, "flyToEntity") == 0) {
-        char entity_id[64];
-        if (json_get_string(args_json, "id", entity_id, sizeof(entity_id))) {
+    else if (tool_name == "flyToEntity") {
+        std::string_view entity_id;
+        if (json_get_string_view(args, "id", entity_id)) {
             double duration = 2.0;
-            json_get_number(args_json, "duration", duration);
-            snprintf(result_text, sizeof(result_text),
-                     "type,id,duration\nflyToEntity,%s,%.1f",
-                     entity_id, duration);
+            json_get_number(args, "duration", duration);
+            format_text(result_text, sizeof(result_text),
+                        "type,id,duration\nflyToEntity,%.*s,%.1f",
+                        VIEW_ARG(entity_id), duration);
         } else {
             strcpy(result_text, "Missing 'id' parameter");
         }
     }
-    else if (strcmp(tool_name, "showEntity") == 0) {
-        char entity_id[64];
-        if (json_get_string(args_json, "id", entity_id, sizeof(entity_id))) {
-            snprintf(result_text, sizeof(result_text),
-                     "type,id,show\nshowEntity,%s,true", entity_id);
+    else if (tool_name == "showEntity") {
+        std::string_view entity_id;
+        if (json_get_string_view(args, "id", entity_id)) {
+            format_text(result_text, sizeof(result_text),
+                        "type,id,show\nshowEntity,%.*s,true", VIEW_ARG(entity_id));
         } else {
             strcpy(result_text, "Missing 'id' parameter");
         }
     }
-    else if (strcmp(tool_name, "hideEntity") == 0) {
-        char entity_id[64];
-        if (json_get_string(args_json, "id", entity_id, sizeof(entity_id))) {
-            snprintf(result_text, sizeof(result_text),
-                     "type,id,show\nshowEntity,%s,false", entity_id);
+    else if (tool_name == "hideEntity") {
+        std::string_view entity_id;
+        if (json_get_string_view(args, "id", entity_id)) {
+            format_text(result_text, sizeof(result_text),
+                        "type,id,show\nshowEntity,%.*s,false", VIEW_ARG(entity_id));
         } else {
             strcpy(result_text, "Missing 'id' parameter");
         }
     }
-    else if (strcmp(tool_name, "setSceneMode") == 0) {
-        char mode[16] = "3D";
-        json_get_string(args_json, "mode", mode, sizeof(mode));
-        snprintf(result_text, sizeof(result_text),
-                 "type,mode\nsetSceneMode,%s", mode);
+    else if (tool_name == "setSceneMode") {
+        std::string_view mode = "3D";
+        json_get_string_view(args, "mode", mode);
+        format_text(result_text, sizeof(result_text),
+                    "type,mode\nsetSceneMode,%.*s", VIEW_ARG(mode));
     }
-    else if (strcmp(tool_name, "setView") == 0) {
+    else if (tool_name == "setView") {
         double lon = 0, lat = 0, height = 10000;
         double heading = 0, pitch = -90, roll = 0;
 
-        json_get_number(args_json, "longitude", lon);
-        json_get_number(args_json, "latitude", lat);
-        json_get_number(args_json, "height", height);
-        json_get_number(args_json, "heading", heading);
-        json_get_number(args_json, "pitch", pitch);
-        json_get_number(args_json, "roll", roll);
+        json_get_number(args, "longitude", lon);
+        json_get_number(args, "latitude", lat);
+        json_get_number(args, "height", height);
+        json_get_number(args, "heading", heading);
+        json_get_number(args, "pitch", pitch);
+        json_get_number(args, "roll", roll);
 
-        snprintf(result_text, sizeof(result_text),
-                 "type,longitude,latitude,height,heading,pitch,roll\n"
-                 "setView,%.6f,%.6f,%.1f,%.1f,%.1f,%.1f",
-                 lon, lat, height, heading, pitch, roll);
+        format_text(result_text, sizeof(result_text),
+                    "type,longitude,latitude,height,heading,pitch,roll\n"
+                    "setView,%.6f,%.6f,%.1f,%.1f,%.1f,%.1f",
+                    lon, lat, height, heading, pitch, roll);
     }
-    else if (strcmp(tool_name, "getCamera") == 0) {
-        snprintf(result_text, sizeof(result_text), "type\ngetCamera");
+    else if (tool_name == "getCamera") {
+        format_text(result_text, sizeof(result_text), "type\ngetCamera");
     }
-    else if (strcmp(tool_name, "addCircle") == 0) {
+    else if (tool_name == "addCircle") {
         double lon = 0, lat = 0, radius = 1000;
         double height = 0, extruded_height = -1;
-        char color[32] = "blue";
-        char name[128] = "";
+        std::string_view color = "blue";
+        std::string_view name;
 
-        json_get_number(args_json, "longitude", lon);
-        json_get_number(args_json, "latitude", lat);
-        json_get_number(args_json, "radius", radius);
-        json_get_number(args_json, "height", height);
-        json_get_number(args_json, "extrudedHeight", extruded_height);
-        json_get_string(args_json, "color", color, sizeof(color));
-        json_get_string(args_json, "name", name, sizeof(name));
+        json_get_number(args, "longitude", lon);
+        json_get_number(args, "latitude", lat);
+        json_get_number(args, "radius", radius);
+        json_get_number(args, "height", height);
+        json_get_number(args, "extrudedHeight", extruded_height);
+        json_get_string_view(args, "color", color);
+        json_get_string_view(args, "name", name);
 
         int entity_id = entity_counter++;
         if (extruded_height >= 0) {
-            snprintf(result_text, sizeof(result_text),
-                     "type,id,longitude,latitude,radius,height,color,extrudedHeight,name\n"
-                     "addCircle,entity-%d,%.6f,%.6f,%.1f,%.1f,%s,%.1f,%s",
-                     entity_id, lon, lat, radius, height, color, extruded_height,
-                     name[0] ? name : "circle");
+            format_text(result_text, sizeof(result_text),
+                        "type,id,longitude,latitude,radius,height,color,extrudedHeight,name\n"
+                        "addCircle,entity-%d,%.6f,%.6f,%.1f,%.1f,%.*s,%.1f,%.*s",
+                        entity_id, lon, lat, radius, height, VIEW_ARG(color), extruded_height,
+                        VIEW_ARG(!name.empty() ? name : "circle"));
         } else {
-            snprintf(result_text, sizeof(result_text),
-                     "type,id,longitude,latitude,radius,height,color,name\n"
-                     "addCircle,entity-%d,%.6f,%.6f,%.1f,%.1f,%s,%s",
-                     entity_id, lon, lat, radius, height, color,
-                     name[0] ? name : "circle");
+            format_text(result_text, sizeof(result_text),
+                        "type,id,longitude,latitude,radius,height,color,name\n"
+                        "addCircle,entity-%d,%.6f,%.6f,%.1f,%.1f,%.*s,%.*s",
+                        entity_id, lon, lat, radius, height, VIEW_ARG(color),
+                        VIEW_ARG(!name.empty() ? name : "circle"));
         }
     }
-    else if (strcmp(tool_name, "addRectangle") == 0) {
+    else if (tool_name == "addRectangle") {
         double west = 0, south = 0, east = 0, north = 0;
         double height = 0, extruded_height = -1;
-        char color[32] = "blue";
-        char name[128] = "";
-
-        json_get_number(args_json, "west", west);
-        json_get_number(args_json, "south", south);
-        json_get_number(args_json, "east", east);
-        json_get_number(args_json, "north", north);
-        json_get_number(args_json, "height", height);
-        json_get_number(args_json, "extrudedHeight", extruded_height);
-        json_get_string(args_json, "color", color, sizeof(color));
-        json_get_string(args_json, "name", name, sizeof(name));
+        std::string_view color = "blue";
+        std::string_view name;
+
+        json_get_number(args, "west", west);
+        json_get_number(args, "south", south);
+        json_get_number(args, "east", east);
+        json_get_number(args, "north", north);
+        json_get_number(args, "height", height);
+        json_get_number(args, "extrudedHeight", extruded_height);
+        json_get_string_view(args, "color", color);
+        json_get_string_view(args, "name", name);
 
         int entity_id = entity_counter++;
         if (extruded_height >= 0) {
-            snprintf(result_text, sizeof(result_text),
-                     "type,id,west,south,east,north,height,color,extrudedHeight,name\n"
-                     "addRectangle,entity-%d,%.6f,%.6f,%.6f,%.6f,%.1f,%s,%.1f,%s",
-                     entity_id, west, south, east, north, height, color, extruded_height,
-                     name[0] ? name : "rectangle");
+            format_text(result_text, sizeof(result_text),
+                        "type,id,west,south,east,north,height,color,extrudedHeight,name\n"
+                        "addRectangle,entity-%d,%.6f,%.6f,%.6f,%.6f,%.1f,%.*s,%.1f,%.*s",
+                        entity_id, west, south, east, north, height, VIEW_ARG(color), extruded_height,
+                        VIEW_ARG(!name.empty() ? name : "rectangle"));
         } else {
-            snprintf(result_text, sizeof(result_text),
-                     "type,id,west,south,east,north,height,color,name\n"
-                     "addRectangle,entity-%d,%.6f,%.6f,%.6f,%.6f,%.1f,%s,%s",
-                     entity_id, west, south, east, north, height, color,
-                     name[0] ? name : "rectangle");
+            format_text(result_text, sizeof(result_text),
+                        "type,id,west,south,east,north,height,color,name\n"
+                        "addRectangle,entity-%d,%.6f,%.6f,%.6f,%.6f,%.1f,%.*s,%.*s",
+                        entity_id, west, south, east, north, height, VIEW_ARG(color),
+                        VIEW_ARG(!name.empty() ? name : "rectangle"));
         }
     }
-    else if (strcmp(tool_name, "playAnimation") == 0) {
-        snprintf(result_text, sizeof(result_text), "type\nplayAnimation");
+    else if (tool_name == "playAnimation") {
+        format_text(result_text, sizeof(result_text), "type\nplayAnimation");
     }
-    else if (strcmp(tool_name, "pauseAnimation") == 0) {
-        snprintf(result_text, sizeof(result_text), "type\npauseAnimation");
+    else if (tool_name == "pauseAnimation") {
+        format_text(result_text, sizeof(result_text), "type\npauseAnimation");
     }
     // "Here" tools - use camera target position
-    else if (strcmp(tool_name, "addSphereHere") == 0) {
+    else if (tool_name == "addSphereHere") {
         if (!camera_state_valid) {
             strcpy(result_text, "Camera position not available. Please wait for camera to initialize.");
         } else {
             double radius = 100, height = 0;
-            char color[32] = "red";
-            char name[128] = "";
+            std::string_view color = "red";
+            std::string_view name;
 
-            json_get_number(args_json, "radius", radius);
-            json_get_number(args_json, "height", height);
-            json_get_string(args_json, "color", color, sizeof(color));
-            json_get_string(args_json, "name", name, sizeof(name));
+            json_get_number(args, "radius", radius);
+            json_get_number(args, "height", height);
+            json_get_string_view(args, "color", color);
+            json_get_string_view(args, "name", name);
 
             // Clamp to reasonable values
             if (radius > 1000) radius = 100;
@@ -1126,28 +1495,28 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
             if (height < 0) height = 0;
 
             int entity_id = entity_counter++;
-            snprintf(result_text, sizeof(result_text),
-                     "type,id,longitude,latitude,height,radius,color,name\n"
-                     "addSphere,entity-%d,%.6f,%.6f,%.1f,%.1f,%s,%s",
-                     entity_id, camera_target_longitude, camera_target_latitude,
-                     height, radius, color, name[0] ? name : "sphere");
+            format_text(result_text, sizeof(result_text),
+                        "type,id,longitude,latitude,height,radius,color,name\n"
+                        "addSphere,entity-%d,%.6f,%.6f,%.1f,%.1f,%.*s,%.*s",
+                        entity_id, camera_target_longitude, camera_target_latitude,
+                        height, radius, VIEW_ARG(color), VIEW_ARG(!name.empty() ? name : "sphere"));
         }
     }
-    else if (strcmp(tool_name, "addBoxHere") == 0) {
+    else if (tool_name == "addBoxHere") {
         if (!camera_state_valid) {
             strcpy(result_text, "Camera position not available. Please wait for camera to initialize.");
         } else {
             double dim_x = 100, dim_y = 100, dim_z = 50;
             double heading = 0;
-            char color[32] = "blue";
-            char name[128] = "";
+            std::string_view color = "blue";
+            std::string_view name;
 
-            json_get_number(args_json, "dimensionX", dim_x);
-            json_get_number(args_json, "dimensionY", dim_y);
-            json_get_number(args_json, "dimensionZ", dim_z);
-            json_get_number(args_json, "heading", heading);
-            json_get_string(args_json, "color", color, sizeof(color));
-            json_get_string(args_json, "name", name, sizeof(name));
+            json_get_number(args, "dimensionX", dim_x);
+            json_get_number(args, "dimensionY", dim_y);
+            json_get_number(args, "dimensionZ", dim_z);
+            json_get_number(args, "heading", heading);
+            json_get_string_view(args, "color", color);
+            json_get_string_view(args, "name", name);
 
             // Enforce minimum dimensions
             if (dim_x < 10) dim_x = 10;
@@ -1157,143 +1526,143 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
             double height = dim_z / 2.0;  // Center on ground
 
             int entity_id = entity_counter++;
-            snprintf(result_text, sizeof(result_text),
-                     "type,id,longitude,latitude,height,dimensionX,dimensionY,dimensionZ,heading,color,name\n"
-                     "addBox,entity-%d,%.6f,%.6f,%.1f,%.1f,%.1f,%.1f,%.1f,%s,%s",
-                     entity_id, camera_target_longitude, camera_target_latitude,
-                     height, dim_x, dim_y, dim_z, heading, color, name[0] ? name : "box");
+            format_text(result_text, sizeof(result_text),
+                        "type,id,longitude,latitude,height,dimensionX,dimensionY,dimensionZ,heading,color,name\n"
+                        "addBox,entity-%d,%.6f,%.6f,%.1f,%.1f,%.1f,%.1f,%.1f,%.*s,%.*s",
+                        entity_id, camera_target_longitude, camera_target_latitude,
+                        height, dim_x, dim_y, dim_z, heading, VIEW_ARG(color), VIEW_ARG(!name.empty() ? name : "box"));
         }
     }
-    else if (strcmp(tool_name, "addPointHere") == 0) {
+    else if (tool_name == "addPointHere") {
         if (!camera_state_valid) {
             strcpy(result_text, "Camera position not available. Please wait for camera to initialize.");
         } else {
-            char color[32] = "white";
-            char name[128] = "";
+            std::string_view color = "white";
+            std::string_view name;
 
-            json_get_string(args_json, "color", color, sizeof(color));
-            json_get_string(args_json, "name", name, sizeof(name));
+            json_get_string_view(args, "color", color);
+            json_get_string_view(args, "name", name);
 
             int entity_id = entity_counter++;
-            snprintf(result_text, sizeof(result_text),
-                     "type,id,longitude,latitude,color,name\n"
-                     "addPoint,entity-%d,%.6f,%.6f,%s,%s",
-                     entity_id, camera_target_longitude, camera_target_latitude,
-                     color, name[0] ? name : "point");
+            format_text(result_text, sizeof(result_text),
+                        "type,id,longitude,latitude,color,name\n"
+                        "addPoint,entity-%d,%.6f,%.6f,%.*s,%.*s",
+                        entity_id, camera_target_longitude, camera_target_latitude,
+                        VIEW_ARG(color), VIEW_ARG(!name.empty() ? name : "point"));
         }
     }
-    else if (strcmp(tool_name, "addLabelHere") == 0) {
+    else if (tool_name == "addLabelHere") {
         if (!camera_state_valid) {
             strcpy(result_text, "Camera position not available. Please wait for camera to initialize.");
         } else {
-            char text[256] = "";
-            json_get_string(args_json, "text", text, sizeof(text));
+            std::string_view text;
+            json_get_string_view(args, "text", text);
 
             int entity_id = entity_counter++;
-            snprintf(result_text, sizeof(result_text),
-                     "type,id,longitude,latitude,text\n"
-                     "addLabel,entity-%d,%.6f,%.6f,%s",
-                     entity_id, camera_target_longitude, camera_target_latitude, text);
+            format_text(result_text, sizeof(result_text),
+                        "type,id,longitude,latitude,text\n"
+                        "addLabel,entity-%d,%.6f,%.6f,%.*s",
+                        entity_id, camera_target_longitude, camera_target_latitude, VIEW_ARG(text));
         }
     }
-    else if (strcmp(tool_name, "addCylinderHere") == 0) {
+    else if (tool_name == "addCylinderHere") {
         if (!camera_state_valid) {
             strcpy(result_text, "Camera position not available. Please wait for camera to initialize.");
         } else {
             double top_radius = 50, bottom_radius = 50, cylinder_height = 100;
-            char color[32] = "green";
-            char name[128] = "";
+            std::string_view color = "green";
+            std::string_view name;
 
-            json_get_number(args_json, "topRadius", top_radius);
-            json_get_number(args_json, "bottomRadius", bottom_radius);
-            json_get_number(args_json, "cylinderHeight", cylinder_height);
-            json_get_string(args_json, "color", color, sizeof(color));
-            json_get_string(args_json, "name", name, sizeof(name));
+            json_get_number(args, "topRadius", top_radius);
+            json_get_number(args, "bottomRadius", bottom_radius);
+            json_get_number(args, "cylinderHeight", cylinder_height);
+            json_get_string_view(args, "color", color);
+            json_get_string_view(args, "name", name);
 
             int entity_id = entity_counter++;
-            snprintf(result_text, sizeof(result_text),
-                     "type,id,longitude,latitude,height,topRadius,bottomRadius,cylinderHeight,color,name\n"
-                     "addCylinder,entity-%d,%.6f,%.6f,0,%.1f,%.1f,%.1f,%s,%s",
-                     entity_id, camera_target_longitude, camera_target_latitude,
-                     top_radius, bottom_radius, cylinder_height, color, name[0] ? name : "cylinder");
+            format_text(result_text, sizeof(result_text),
+                        "type,id,longitude,latitude,height,topRadius,bottomRadius,cylinderHeight,color,name\n"
+                        "addCylinder,entity-%d,%.6f,%.6f,0,%.1f,%.1f,%.1f,%.*s,%.*s",
+                        entity_id, camera_target_longitude, camera_target_latitude,
+                        top_radius, bottom_radius, cylinder_height, VIEW_ARG(color), VIEW_ARG(!name.empty() ? name : "cylinder"));
         }
     }
-    else if (strcmp(tool_name, "addCircleHere") == 0) {
+    else if (tool_name == "addCircleHere") {
         if (!camera_state_valid) {
             strcpy(result_text, "Camera position not available. Please wait for camera to initialize.");
         } else {
             double radius = 100, height = 0, extruded_height = -1;
-            char color[32] = "blue";
-            char name[128] = "";
+            std::string_view color = "blue";
+            std::string_view name;
 
-            json_get_number(args_json, "radius", radius);
-            json_get_number(args_json, "height", height);
-            json_get_number(args_json, "extrudedHeight", extruded_height);
-            json_get_string(args_json, "color", color, sizeof(color));
-            json_get_string(args_json, "name", name, sizeof(name));
+            json_get_number(args, "radius", radius);
+            json_get_number(args, "height", height);
+            json_get_number(args, "extrudedHeight", extruded_height);
+            json_get_string_view(args, "color", color);
+            json_get_string_view(args, "name", name);
 
             int entity_id = entity_counter++;
             if (extruded_height >= 0) {
-                snprintf(result_text, sizeof(result_text),
-                         "type,id,longitude,latitude,radius,height,color,extrudedHeight,name\n"
-                         "addCircle,entity-%d,%.6f,%.6f,%.1f,%.1f,%s,%.1f,%s",
-                         entity_id, camera_target_longitude, camera_target_latitude,
-                         radius, height, color, extruded_height, name[0] ? name : "circle");
+                format_text(result_text, sizeof(result_text),
+                            "type,id,longitude,latitude,radius,height,color,extrudedHeight,name\n"
+                            "addCircle,entity-%d,%.6f,%.6f,%.1f,%.1f,%.*s,%.1f,%.*s",
+                            entity_id, camera_target_longitude, camera_target_latitude,
+                            radius, height, VIEW_ARG(color), extruded_height, VIEW_ARG(!name.empty() ? name : "circle"));
             } else {
-                snprintf(result_text, sizeof(result_text),
-                         "type,id,longitude,latitude,radius,height,color,name\n"
-                         "addCircle,entity-%d,%.6f,%.6f,%.1f,%.1f,%s,%s",
-                         entity_id, camera_target_longitude, camera_target_latitude,
-                         radius, height, color, name[0] ? name : "circle");
+                format_text(result_text, sizeof(result_text),
+                            "type,id,longitude,latitude,radius,height,color,name\n"
+                            "addCircle,entity-%d,%.6f,%.6f,%.1f,%.1f,%.*s,%.*s",
+                            entity_id, camera_target_longitude, camera_target_latitude,
+                            radius, height, VIEW_ARG(color), VIEW_ARG(!name.empty() ? name : "circle"));
             }
         }
     }
-    else if (strcmp(tool_name, "addModelHere") == 0) {
+    else if (tool_name == "addModelHere") {
         if (!camera_state_valid) {
             strcpy(result_text, "Camera position not available. Please wait for camera to initialize.");
         } else {
             double scale = 1.0, heading = 0;
             double ion_asset_id = -1;
-            char url[512] = "";
-            char name[128] = "";
+            std::string_view url;
+            std::string_view name;
 
-            json_get_string(args_json, "url", url, sizeof(url));
-            json_get_number(args_json, "ionAssetId", ion_asset_id);
-            json_get_number(args_json, "scale", scale);
-            json_get_number(args_json, "heading", heading);
-            json_get_string(args_json, "name", name, sizeof(name));
+            json_get_string_view(args, "url", url);
+            json_get_number(args, "ionAssetId", ion_asset_id);
+            json_get_number(args, "scale", scale);
+            json_get_number(args, "heading", heading);
+            json_get_string_view(args, "name", name);
 
             int entity_id = entity_counter++;
             if (ion_asset_id > 0) {
-                snprintf(result_text, sizeof(result_text),
-                         "type,id,longitude,latitude,height,ionAssetId,scale,heading,name\n"
-                         "addModel,entity-%d,%.6f,%.6f,0,%.0f,%.2f,%.1f,%s",
-                         entity_id, camera_target_longitude, camera_target_latitude,
-                         ion_asset_id, scale, heading, name[0] ? name : "model");
+                format_text(result_text, sizeof(result_text),
+                            "type,id,longitude,latitude,height,ionAssetId,scale,heading,name\n"
+                            "addModel,entity-%d,%.6f,%.6f,0,%.0f,%.2f,%.1f,%.*s",
+                            entity_id, camera_target_longitude, camera_target_latitude,
+                            ion_asset_id, scale, heading, VIEW_ARG(!name.empty() ? name : "model"));
             } else {
-                snprintf(result_text, sizeof(result_text),
-                         "type,id,longitude,latitude,height,url,scale,heading,name\n"
-                         "addModel,entity-%d,%.6f,%.6f,0,%s,%.2f,%.1f,%s",
-                         entity_id, camera_target_longitude, camera_target_latitude,
-                         url, scale, heading, name[0] ? name : "model");
+                format_text(result_text, sizeof(result_text),
+                            "type,id,longitude,latitude,height,url,scale,heading,name\n"
+                            "addModel,entity-%d,%.6f,%.6f,0,%.*s,%.2f,%.1f,%.*s",
+                            entity_id, camera_target_longitude, camera_target_latitude,
+                            VIEW_ARG(url), scale, heading, VIEW_ARG(!name.empty() ? name : "model"));
             }
         }
     }
-    else if (strcmp(tool_name, "addPolygonHere") == 0) {
+    else if (tool_name == "addPolygonHere") {
         if (!camera_state_valid) {
             strcpy(result_text, "Camera position not available. Please wait for camera to initialize.");
         } else {
             double radius = 100, height = 0, extruded_height = -1;
             double sides = 6;  // Default hexagon
-            char color[32] = "blue";
-            char name[128] = "";
+            std::string_view color = "blue";
+            std::string_view name;
 
-            json_get_number(args_json, "radius", radius);
-            json_get_number(args_json, "sides", sides);
-            json_get_number(args_json, "height", height);
-            json_get_number(args_json, "extrudedHeight", extruded_height);
-            json_get_string(args_json, "color", color, sizeof(color));
-            json_get_string(args_json, "name", name, sizeof(name));
+            json_get_number(args, "radius", radius);
+            json_get_number(args, "sides", sides);
+            json_get_number(args, "height", height);
+            json_get_number(args, "extrudedHeight", extruded_height);
+            json_get_string_view(args, "color", color);
+            json_get_string_view(args, "name", name);
 
             if (sides < 3) sides = 3;
             if (sides > 32) sides = 32;
@@ -1307,113 +1676,113 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
             // Section 1: command metadata
             size_t offset = 0;
             if (extruded_height >= 0) {
-                offset += snprintf(result_text + offset, sizeof(result_text) - offset,
-                                   "type,id,color,height,extrudedHeight,name\n"
-                                   "addPolygon,entity-%d,%s,%.1f,%.1f,%s",
-                                   entity_id, color, height, extruded_height,
-                                   name[0] ? name : "polygon");
+                offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                                      "type,id,color,height,extrudedHeight,name\n"
+                                      "addPolygon,entity-%d,%.*s,%.1f,%.1f,%.*s",
+                                      entity_id, VIEW_ARG(color), height, extruded_height,
+                                      VIEW_ARG(!name.empty() ? name : "polygon"));
             } else {
-                offset += snprintf(result_text + offset, sizeof(result_text) - offset,
-                                   "type,id,color,height,name\n"
-                                   "addPolygon,entity-%d,%s,%.1f,%s",
-                                   entity_id, color, height,
-                                   name[0] ? name : "polygon");
+                offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                                      "type,id,color,height,name\n"
+                                      "addPolygon,entity-%d,%.*s,%.1f,%.*s",
+                                      entity_id, VIEW_ARG(color), height,
+                                      VIEW_ARG(!name.empty() ? name : "polygon"));
             }
 
             // Section 2: position rows
-            offset += snprintf(result_text + offset, sizeof(result_text) - offset,
-                               "\n\nlongitude,latitude");
+            offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                                  "\n\nlongitude,latitude");
             for (int i = 0; i < (int)sides; i++) {
                 double angle = 2.0 * 3.14159265358979 * i / sides;
                 double dx = radius * cos(angle) * lon_deg_per_meter;
                 double dy = radius * sin(angle) * lat_deg_per_meter;
-                offset += snprintf(result_text + offset, sizeof(result_text) - offset,
-                                   "\n%.6f,%.6f",
-                                   camera_target_longitude + dx, camera_target_latitude + dy);
+                offset += format_text(result_text + offset, sizeof(result_text) - offset,
+                                      "\n%.6f,%.6f",
+                                      camera_target_longitude + dx, camera_target_latitude + dy);
             }
         }
     }
-    else if (strcmp(tool_name, "addEntityHere") == 0) {
+    else if (tool_name == "addEntityHere") {
         // Generic entity add - routes to appropriate type
         if (!camera_state_valid) {
             strcpy(result_text, "Camera position not available. Please wait for camera to initialize.");
         } else {
-            char entity_type[32] = "sphere";
+            std::string_view entity_type = "sphere";
             double radius = 50, height = 0;
-            char color[32] = "red";
-            char name[128] = "";
-            char text[256] = "";
+            std::string_view color = "red";
+            std::string_view name;
+            std::string_view text;
 
-            json_get_string(args_json, "entityType", entity_type, sizeof(entity_type));
-            json_get_number(args_json, "radius", radius);
-            json_get_number(args_json, "height", height);
-            json_get_string(args_json, "color", color, sizeof(color));
-            json_get_string(args_json, "name", name, sizeof(name));
-            json_get_string(args_json, "text", text, sizeof(text));
+            json_get_string_view(args, "entityType", entity_type);
+            json_get_number(args, "radius", radius);
+            json_get_number(args, "height", height);
+            json_get_string_view(args, "color", color);
+            json_get_string_view(args, "name", name);
+            json_get_string_view(args, "text", text);
 
             int entity_id = entity_counter++;
 
-            if (strcmp(entity_type, "sphere") == 0) {
+            if (entity_type == "sphere") {
                 if (radius > 1000) radius = 100;
                 if (radius < 1) radius = 50;
-                snprintf(result_text, sizeof(result_text),
-                         "type,id,longitude,latitude,height,radius,color,name\n"
-                         "addSphere,entity-%d,%.6f,%.6f,%.1f,%.1f,%s,%s",
-                         entity_id, camera_target_longitude, camera_target_latitude,
-                         height, radius, color, name[0] ? name : "sphere");
+                format_text(result_text, sizeof(result_text),
+                            "type,id,longitude,latitude,height,radius,color,name\n"
+                            "addSphere,entity-%d,%.6f,%.6f,%.1f,%.1f,%.*s,%.*s",
+                            entity_id, camera_target_longitude, camera_target_latitude,
+                            height, radius, VIEW_ARG(color), VIEW_ARG(!name.empty() ? name : "sphere"));
             }
-            else if (strcmp(entity_type, "box") == 0) {
+            else if (entity_type == "box") {
                 double dim = radius > 0 ? radius : 50;
-                snprintf(result_text, sizeof(result_text),
-                         "type,id,longitude,latitude,height,dimensionX,dimensionY,dimensionZ,color,name\n"
-                         "addBox,entity-%d,%.6f,%.6f,%.1f,%.1f,%.1f,%.1f,%s,%s",
-                         entity_id, camera_target_longitude, camera_target_latitude,
-                         dim / 2.0, dim, dim, dim, color, name[0] ? name : "box");
+                format_text(result_text, sizeof(result_text),
+                            "type,id,longitude,latitude,height,dimensionX,dimensionY,dimensionZ,color,name\n"
+                            "addBox,entity-%d,%.6f,%.6f,%.1f,%.1f,%.1f,%.1f,%.*s,%.*s",
+                            entity_id, camera_target_longitude, camera_target_latitude,
+                            dim / 2.0, dim, dim, dim, VIEW_ARG(color), VIEW_ARG(!name.empty() ? name : "box"));
             }
-            else if (strcmp(entity_type, "cylinder") == 0) {
+            else if (entity_type == "cylinder") {
                 double r = radius > 0 ? radius : 50;
-                snprintf(result_text, sizeof(result_text),
-                         "type,id,longitude,latitude,height,topRadius,bottomRadius,cylinderHeight,color,name\n"
-                         "addCylinder,entity-%d,%.6f,%.6f,0,%.1f,%.1f,%.1f,%s,%s",
-                         entity_id, camera_target_longitude, camera_target_latitude,
-                         r, r, r * 2, color, name[0] ? name : "cylinder");
+                format_text(result_text, sizeof(result_text),
+                            "type,id,longitude,latitude,height,topRadius,bottomRadius,cylinderHeight,color,name\n"
+                            "addCylinder,entity-%d,%.6f,%.6f,0,%.1f,%.1f,%.1f,%.*s,%.*s",
+                            entity_id, camera_target_longitude, camera_target_latitude,
+                            r, r, r * 2, VIEW_ARG(color), VIEW_ARG(!name.empty() ? name : "cylinder"));
             }
-            else if (strcmp(entity_type, "point") == 0) {
-                snprintf(result_text, sizeof(result_text),
-                         "type,id,longitude,latitude,color,name\n"
-                         "addPoint,entity-%d,%.6f,%.6f,%s,%s",
-                         entity_id, camera_target_longitude, camera_target_latitude,
-                         color, name[0] ? name : "point");
+            else if (entity_type == "point") {
+                format_text(result_text, sizeof(result_text),
+                            "type,id,longitude,latitude,color,name\n"
+                            "addPoint,entity-%d,%.6f,%.6f,%.*s,%.*s",
+                            entity_id, camera_target_longitude, camera_target_latitude,
+                            VIEW_ARG(color), VIEW_ARG(!name.empty() ? name : "point"));
             }
-            else if (strcmp(entity_type, "label") == 0) {
-                snprintf(result_text, sizeof(result_text),
-                         "type,id,longitude,latitude,text\n"
-                         "addLabel,entity-%d,%.6f,%.6f,%s",
-                         entity_id, camera_target_longitude, camera_target_latitude,
-                         text[0] ? text : "Label");
+            else if (entity_type == "label") {
+                format_text(result_text, sizeof(result_text),
+                            "type,id,longitude,latitude,text\n"
+                            "addLabel,entity-%d,%.6f,%.6f,%.*s",
+                            entity_id, camera_target_longitude, camera_target_latitude,
+                            VIEW_ARG(!text.empty() ? text : "Label"));
             }
-            else if (strcmp(entity_type, "circle") == 0) {
-                snprintf(result_text, sizeof(result_text),
-                         "type,id,longitude,latitude,radius,height,color,name\n"
-                         "addCircle,entity-%d,%.6f,%.6f,%.1f,%.1f,%s,%s",
-                         entity_id, camera_target_longitude, camera_target_latitude,
-                         radius > 0 ? radius : 100, height, color, name[0] ? name : "circle");
+            else if (entity_type == "circle") {
+                format_text(result_text, sizeof(result_text),
+                            "type,id,longitude,latitude,radius,height,color,name\n"
+                            "addCircle,entity-%d,%.6f,%.6f,%.1f,%.1f,%.*s,%.*s",
+                            entity_id, camera_target_longitude, camera_target_latitude,
+                            radius > 0 ? radius : 100, height, VIEW_ARG(color), VIEW_ARG(!name.empty() ? name : "circle"));
             }
-            else if (strcmp(entity_type, "model") == 0) {
-                snprintf(result_text, sizeof(result_text),
-                         "type,id,longitude,latitude,height,url,scale,heading,name\n"
-                         "addModel,entity-%d,%.6f,%.6f,%.1f,,1.0,0,%s",
-                         entity_id, camera_target_longitude, camera_target_latitude,
-                         height, name[0] ? name : "model");
+            else if (entity_type == "model") {
+                format_text(result_text, sizeof(result_text),
+                            "type,id,longitude,latitude,height,url,scale,heading,name\n"
+                            "addModel,entity-%d,%.6f,%.6f,%.1f,,1.0,0,%.*s",
+                            entity_id, camera_target_longitude, camera_target_latitude,
+                            height, VIEW_ARG(!name.empty() ? name : "model"));
             }
             else {
-                snprintf(result_text, sizeof(result_text),
-                         "Unknown entity type: %s. Use: sphere, box, cylinder, point, label, circle, model",
-                         entity_type);
+                format_text(result_text, sizeof(result_text),
+                            "Unknown entity type: %.*s. Use: sphere, box, cylinder, point, label, circle, model",
+                            VIEW_ARG(entity_type));
             }
         }
     }
-    else if (strcmp(tool_name, "addSensorConeHere") == 0) {
+    else if (tool_name == "addSensorConeHere") {
         // Add sensor cone/fan at camera target
         if (!camera_state_valid) {
             strcpy(result_text, "Camera position not available. Please wait for camera to initialize.");
@@ -1426,19 +1795,19 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
             double height = 100;          // Default 100m above ground (so it doesn't clip)
             double inner_radius = 0;      // Default solid cone
             double opacity = 0.5;         // Default semi-transparent
-            char color[32] = "lime";
-            char name[128] = "";
-
-            json_get_number(args_json, "radius", radius);
-            json_get_number(args_json, "horizontalAngle", horizontal_angle);
-            json_get_number(args_json, "verticalAngle", vertical_angle);
-            json_get_number(args_json, "heading", heading);
-            json_get_number(args_json, "pitch", pitch);
-            json_get_number(args_json, "height", height);
-            json_get_number(args_json, "innerRadius", inner_radius);
-            json_get_number(args_json, "opacity", opacity);
-            json_get_string(args_json, "color", color, sizeof(color));
-            json_get_string(args_json, "name", name, sizeof(name));
+            std::string_view color = "lime";
+            std::string_view name;
+
+            json_get_number(args, "radius", radius);
+            json_get_number(args, "horizontalAngle", horizontal_angle);
+            json_get_number(args, "verticalAngle", vertical_angle);
+            json_get_number(args, "heading", heading);
+            json_get_number(args, "pitch", pitch);
+            json_get_number(args, "height", height);
+            json_get_number(args, "innerRadius", inner_radius);
+            json_get_number(args, "opacity", opacity);
+            json_get_string_view(args, "color", color);
+            json_get_string_view(args, "name", name);
 
             // Clamp values
             if (horizontal_angle < 1) horizontal_angle = 1;
@@ -1452,19 +1821,19 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
             if (inner_radius >= radius) inner_radius = 0;
 
             int entity_id = entity_counter++;
-            snprintf(result_text, sizeof(result_text),
-                     "type,id,longitude,latitude,height,radius,horizontalAngle,verticalAngle,heading,pitch,innerRadius,color,opacity,name\n"
-                     "addSensorCone,entity-%d,%.6f,%.6f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%s,%.2f,%s",
-                     entity_id, camera_target_longitude, camera_target_latitude,
-                     height, radius, horizontal_angle, vertical_angle,
-                     heading, pitch, inner_radius, color, opacity,
-                     name[0] ? name : "sensor");
+            format_text(result_text, sizeof(result_text),
+                        "type,id,longitude,latitude,height,radius,horizontalAngle,verticalAngle,heading,pitch,innerRadius,color,opacity,name\n"
+                        "addSensorCone,entity-%d,%.6f,%.6f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.*s,%.2f,%.*s",
+                        entity_id, camera_target_longitude, camera_target_latitude,
+                        height, radius, horizontal_angle, vertical_angle,
+                        heading, pitch, inner_radius, VIEW_ARG(color), opacity,
+                        VIEW_ARG(!name.empty() ? name : "sensor"));
         }
     }
     // ========================================================================
     // ROUTING & POI TOOLS (use external APIs via HTTP)
     // ========================================================================
-    else if (strcmp(tool_name, "getRoute") == 0) {
+    else if (tool_name == "getRoute") {
         // Get directions between two locations
         char start_location[256] = "";
         char end_location[256] = "";
@@ -1472,21 +1841,21 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
         char api_key[128] = "";
         double start_lon = 0, start_lat = 0, end_lon = 0, end_lat = 0;
 
-        json_get_string(args_json, "startLocation", start_location, sizeof(start_location));
-        json_get_string(args_json, "endLocation", end_location, sizeof(end_location));
-        json_get_string(args_json, "mode", mode, sizeof(mode));
-        json_get_string(args_json, "apiKey", api_key, sizeof(api_key));
-        json_get_number(args_json, "startLon", start_lon);
-        json_get_number(args_json, "startLat", start_lat);
-        json_get_number(args_json, "endLon", end_lon);
-        json_get_number(args_json, "endLat", end_lat);
+        json_get_string(args, "startLocation", start_location, sizeof(start_location));
+        json_get_string(args, "endLocation", end_location, sizeof(end_location));
+        json_get_string(args, "mode", mode, sizeof(mode));
+        json_get_string(args, "apiKey", api_key, sizeof(api_key));
+        json_get_number(args, "startLon", start_lon);
+        json_get_number(args, "startLat", start_lat);
+        json_get_number(args, "endLon", end_lon);
+        json_get_number(args, "endLat", end_lat);
 
         // Resolve location names to coordinates
         if (start_location[0] != '\0') {
             double heading;
             if (!resolve_location(start_location, start_lon, start_lat, heading)) {
-                snprintf(result_text, sizeof(result_text),
-                         "Could not resolve start location: %s", start_location);
+                format_text(result_text, sizeof(result_text),
+                            "Could not resolve start location: %s", start_location);
                 char result[65536];
                 format_tool_result(result_text, true, result, sizeof(result));
                 return create_success_response(id, result, response, response_size);
@@ -1495,8 +1864,8 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
         if (end_location[0] != '\0') {
             double heading;
             if (!resolve_location(end_location, end_lon, end_lat, heading)) {
-                snprintf(result_text, sizeof(result_text),
-                         "Could not resolve end location: %s", end_location);
+                format_text(result_text, sizeof(result_text),
+                            "Could not resolve end location: %s", end_location);
                 char result[65536];
                 format_tool_result(result_text, true, result, sizeof(result));
                 return create_success_response(id, result, response, response_size);
@@ -1533,28 +1902,28 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
 
         if (len > 0) {
             // Return the GeoJSON response - TypeScript side will parse and visualize
-            snprintf(result_text, sizeof(result_text),
-                     "type,startLon,startLat,endLon,endLat,mode,backend,geojson\n"
-                     "route,%.6f,%.6f,%.6f,%.6f,%s,%s,%s",
-                     start_lon, start_lat, end_lon, end_lat, mode, backend_used, http_response);
+            format_text(result_text, sizeof(result_text),
+                        "type,startLon,startLat,endLon,endLat,mode,backend,geojson\n"
+                        "route,%.6f,%.6f,%.6f,%.6f,%s,%s,%s",
+                        start_lon, start_lat, end_lon, end_lat, mode, backend_used, http_response);
         } else if (api_key[0] == '\0') {
             strcpy(result_text, "No routing backend available. Either start a local OSRM server (docker run -p 5000:5000 osrm/osrm-backend) or provide an apiKey for OpenRouteService.");
         } else {
             strcpy(result_text, "Failed to get route. Check API key and try again.");
         }
     }
-    else if (strcmp(tool_name, "searchPOI") == 0) {
+    else if (tool_name == "searchPOI") {
         // Search for points of interest
         char category[64] = "";
         char location[256] = "";
         double lon = 0, lat = 0;
         double radius = 1000;
 
-        json_get_string(args_json, "category", category, sizeof(category));
-        json_get_string(args_json, "location", location, sizeof(location));
-        json_get_number(args_json, "longitude", lon);
-        json_get_number(args_json, "latitude", lat);
-        json_get_number(args_json, "radius", radius);
+        json_get_string(args, "category", category, sizeof(category));
+        json_get_string(args, "location", location, sizeof(location));
+        json_get_number(args, "longitude", lon);
+        json_get_number(args, "latitude", lat);
+        json_get_number(args, "radius", radius);
 
         // Resolve location name
         if (location[0] != '\0') {
@@ -1565,8 +1934,8 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
                     lon = camera_target_longitude;
                     lat = camera_target_latitude;
                 } else {
-                    snprintf(result_text, sizeof(result_text),
-                             "Could not resolve location: %s", location);
+                    format_text(result_text, sizeof(result_text),
+                                "Could not resolve location: %s", location);
                     char result[65536];
                     format_tool_result(result_text, true, result, sizeof(result));
                     return create_success_response(id, result, response, response_size);
@@ -1589,30 +1958,30 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
 
             if (len > 0) {
                 // Return Overpass JSON - TypeScript side will parse and visualize
-                snprintf(result_text, sizeof(result_text),
-                         "type,category,centerLon,centerLat,radius,overpassJson\n"
-                         "poi,%s,%.6f,%.6f,%.1f,%s",
-                         category, lon, lat, radius, http_response);
+                format_text(result_text, sizeof(result_text),
+                            "type,category,centerLon,centerLat,radius,overpassJson\n"
+                            "poi,%s,%.6f,%.6f,%.1f,%s",
+                            category, lon, lat, radius, http_response);
             } else {
-                snprintf(result_text, sizeof(result_text),
-                         "No %s found within %.0fm of the location.", category, radius);
+                format_text(result_text, sizeof(result_text),
+                            "No %s found within %.0fm of the location.", category, radius);
             }
         }
     }
-    else if (strcmp(tool_name, "getIsochrone") == 0) {
+    else if (tool_name == "getIsochrone") {
         // Get reachable area within time
         char location[256] = "";
-        char mode[32] = "walking";
+        std::string_view mode = "walking";
         char api_key[128] = "";
         double lon = 0, lat = 0;
         double minutes = 15;
 
-        json_get_string(args_json, "location", location, sizeof(location));
-        json_get_string(args_json, "mode", mode, sizeof(mode));
-        json_get_string(args_json, "apiKey", api_key, sizeof(api_key));
-        json_get_number(args_json, "longitude", lon);
-        json_get_number(args_json, "latitude", lat);
-        json_get_number(args_json, "minutes", minutes);
+        json_get_string(args, "location", location, sizeof(location));
+        json_get_string_view(args, "mode", mode);
+        json_get_string(args, "apiKey", api_key, sizeof(api_key));
+        json_get_number(args, "longitude", lon);
+        json_get_number(args, "latitude", lat);
+        json_get_number(args, "minutes", minutes);
 
         // Resolve location name
         if (location[0] != '\0') {
@@ -1632,8 +2001,8 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
             strcpy(result_text, "API key required for isochrones. Get a free key at https://openrouteservice.org/");
         } else {
             const char* profile = "foot-walking";
-            if (strcmp(mode, "cycling") == 0) profile = "cycling-regular";
-            else if (strcmp(mode, "driving") == 0) profile = "driving-car";
+            if (mode == "cycling") profile = "cycling-regular";
+            else if (mode == "driving") profile = "driving-car";
 
             int range_seconds = (int)(minutes * 60);
 
@@ -1642,10 +2011,10 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
                                            http_response, sizeof(http_response));
 
             if (len > 0) {
-                snprintf(result_text, sizeof(result_text),
-                         "type,centerLon,centerLat,minutes,mode,geojson\n"
-                         "isochrone,%.6f,%.6f,%.1f,%s,%s",
-                         lon, lat, minutes, mode, http_response);
+                format_text(result_text, sizeof(result_text),
+                            "type,centerLon,centerLat,minutes,mode,geojson\n"
+                            "isochrone,%.6f,%.6f,%.1f,%.*s,%s",
+                            lon, lat, minutes, VIEW_ARG(mode), http_response);
             } else {
                 strcpy(result_text, "Failed to get isochrone from OpenRouteService.");
             }
@@ -1654,32 +2023,32 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
     // ========================================================================
     // COMPOUND TOOLS (combine routing/POI with visualization)
     // ========================================================================
-    else if (strcmp(tool_name, "walkTo") == 0 || strcmp(tool_name, "driveTo") == 0) {
+    else if (tool_name == "walkTo" || tool_name == "driveTo") {
         // Animated route with model
-        bool is_walking = (strcmp(tool_name, "walkTo") == 0);
+        bool is_walking = (tool_name == "walkTo");
         char start_location[256] = "";
         char end_location[256] = "";
         char api_key[128] = "";
-        char model_url[512] = "";
+        std::string_view model_url;
         double start_lon = 0, start_lat = 0, end_lon = 0, end_lat = 0;
         double duration = 30;
 
-        json_get_string(args_json, "startLocation", start_location, sizeof(start_location));
-        json_get_string(args_json, "endLocation", end_location, sizeof(end_location));
-        json_get_string(args_json, "apiKey", api_key, sizeof(api_key));
-        json_get_string(args_json, "modelUrl", model_url, sizeof(model_url));
-        json_get_number(args_json, "startLon", start_lon);
-        json_get_number(args_json, "startLat", start_lat);
-        json_get_number(args_json, "endLon", end_lon);
-        json_get_number(args_json, "endLat", end_lat);
-        json_get_number(args_json, "duration", duration);
+        json_get_string(args, "startLocation", start_location, sizeof(start_location));
+        json_get_string(args, "endLocation", end_location, sizeof(end_location));
+        json_get_string(args, "apiKey", api_key, sizeof(api_key));
+        json_get_string_view(args, "modelUrl", model_url);
+        json_get_number(args, "startLon", start_lon);
+        json_get_number(args, "startLat", start_lat);
+        json_get_number(args, "endLon", end_lon);
+        json_get_number(args, "endLat", end_lat);
+        json_get_number(args, "duration", duration);
 
         // Resolve locations
         if (start_location[0] != '\0') {
             double heading;
             if (!resolve_location(start_location, start_lon, start_lat, heading)) {
-                snprintf(result_text, sizeof(result_text),
-                         "Could not resolve start location: %s", start_location);
+                format_text(result_text, sizeof(result_text),
+                            "Could not resolve start location: %s", start_location);
                 char result[65536];
                 format_tool_result(result_text, true, result, sizeof(result));
                 return create_success_response(id, result, response, response_size);
@@ -1688,8 +2057,8 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
         if (end_location[0] != '\0') {
             double heading;
             if (!resolve_location(end_location, end_lon, end_lat, heading)) {
-                snprintf(result_text, sizeof(result_text),
-                         "Could not resolve end location: %s", end_location);
+                format_text(result_text, sizeof(result_text),
+                            "Could not resolve end location: %s", end_location);
                 char result[65536];
                 format_tool_result(result_text, true, result, sizeof(result));
                 return create_success_response(id, result, response, response_size);
@@ -1716,42 +2085,42 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
 
         if (len > 0) {
             // Return animated route command
-            snprintf(result_text, sizeof(result_text),
-                     "type,startLon,startLat,endLon,endLat,mode,duration,modelUrl,animate,geojson\n"
-                     "animatedRoute,%.6f,%.6f,%.6f,%.6f,%s,%.1f,%s,true,%s",
-                     start_lon, start_lat, end_lon, end_lat, mode, duration,
-                     model_url[0] ? model_url : "", http_response);
+            format_text(result_text, sizeof(result_text),
+                        "type,startLon,startLat,endLon,endLat,mode,duration,modelUrl,animate,geojson\n"
+                        "animatedRoute,%.6f,%.6f,%.6f,%.6f,%s,%.1f,%.*s,true,%s",
+                        start_lon, start_lat, end_lon, end_lat, mode, duration,
+                        VIEW_ARG(!model_url.empty() ? model_url : ""), http_response);
         } else if (api_key[0] == '\0') {
             strcpy(result_text, "No routing backend available. Either start a local OSRM server (docker run -p 5000:5000 osrm/osrm-backend) or provide an apiKey for OpenRouteService.");
         } else {
             strcpy(result_text, "Failed to get route. Check API key and try again.");
         }
     }
-    else if (strcmp(tool_name, "flyPathTo") == 0) {
+    else if (tool_name == "flyPathTo") {
         // Great circle flight animation
         char start_location[256] = "";
         char end_location[256] = "";
-        char model_url[512] = "";
+        std::string_view model_url;
         double start_lon = 0, start_lat = 0, end_lon = 0, end_lat = 0;
         double altitude = 10000;
         double duration = 30;
 
-        json_get_string(args_json, "startLocation", start_location, sizeof(start_location));
-        json_get_string(args_json, "endLocation", end_location, sizeof(end_location));
-        json_get_string(args_json, "modelUrl", model_url, sizeof(model_url));
-        json_get_number(args_json, "startLon", start_lon);
-        json_get_number(args_json, "startLat", start_lat);
-        json_get_number(args_json, "endLon", end_lon);
-        json_get_number(args_json, "endLat", end_lat);
-        json_get_number(args_json, "altitude", altitude);
-        json_get_number(args_json, "duration", duration);
+        json_get_string(args, "startLocation", start_location, sizeof(start_location));
+        json_get_string(args, "endLocation", end_location, sizeof(end_location));
+        json_get_string_view(args, "modelUrl", model_url);
+        json_get_number(args, "startLon", start_lon);
+        json_get_number(args, "startLat", start_lat);
+        json_get_number(args, "endLon", end_lon);
+        json_get_number(args, "endLat", end_lat);
+        json_get_number(args, "altitude", altitude);
+        json_get_number(args, "duration", duration);
 
         // Resolve locations
         if (start_location[0] != '\0') {
             double heading;
             if (!resolve_location(start_location, start_lon, start_lat, heading)) {
-                snprintf(result_text, sizeof(result_text),
-                         "Could not resolve start location: %s", start_location);
+                format_text(result_text, sizeof(result_text),
+                            "Could not resolve start location: %s", start_location);
                 char result[65536];
                 format_tool_result(result_text, true, result, sizeof(result));
                 return create_success_response(id, result, response, response_size);
@@ -1760,8 +2129,8 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
         if (end_location[0] != '\0') {
             double heading;
             if (!resolve_location(end_location, end_lon, end_lat, heading)) {
-                snprintf(result_text, sizeof(result_text),
-                         "Could not resolve end location: %s", end_location);
+                format_text(result_text, sizeof(result_text),
+                            "Could not resolve end location: %s", end_location);
                 char result[65536];
                 format_tool_result(result_text, true, result, sizeof(result));
                 return create_success_response(id, result, response, response_size);
@@ -1769,32 +2138,32 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
         }
 
         // Return great circle flight command (no external API needed)
-        snprintf(result_text, sizeof(result_text),
-                 "type,startLon,startLat,endLon,endLat,altitude,duration,modelUrl\n"
-                 "flightPath,%.6f,%.6f,%.6f,%.6f,%.1f,%.1f,%s",
-                 start_lon, start_lat, end_lon, end_lat, altitude, duration,
-                 model_url[0] ? model_url : "");
+        format_text(result_text, sizeof(result_text),
+                    "type,startLon,startLat,endLon,endLat,altitude,duration,modelUrl\n"
+                    "flightPath,%.6f,%.6f,%.6f,%.6f,%.1f,%.1f,%.*s",
+                    start_lon, start_lat, end_lon, end_lat, altitude, duration,
+                    VIEW_ARG(!model_url.empty() ? model_url : ""));
     }
-    else if (strcmp(tool_name, "findAndShow") == 0) {
+    else if (tool_name == "findAndShow") {
         // Search POI and visualize
         char category[64] = "";
         char location[256] = "";
-        char marker_color[32] = "cyan";
+        std::string_view marker_color = "cyan";
         double lon = 0, lat = 0;
         double radius = 1000;
         bool show_labels = true;
 
-        json_get_string(args_json, "category", category, sizeof(category));
-        json_get_string(args_json, "location", location, sizeof(location));
-        json_get_string(args_json, "markerColor", marker_color, sizeof(marker_color));
-        json_get_number(args_json, "longitude", lon);
-        json_get_number(args_json, "latitude", lat);
-        json_get_number(args_json, "radius", radius);
+        json_get_string(args, "category", category, sizeof(category));
+        json_get_string(args, "location", location, sizeof(location));
+        json_get_string_view(args, "markerColor", marker_color);
+        json_get_number(args, "longitude", lon);
+        json_get_number(args, "latitude", lat);
+        json_get_number(args, "radius", radius);
 
         // Check for showLabels boolean
-        char show_labels_str[16] = "";
-        if (json_get_string(args_json, "showLabels", show_labels_str, sizeof(show_labels_str))) {
-            show_labels = (strcmp(show_labels_str, "false") != 0 && strcmp(show_labels_str, "0") != 0);
+        std::string_view show_labels_str;
+        if (json_get_string_view(args, "showLabels", show_labels_str)) {
+            show_labels = (show_labels_str != "false" && show_labels_str != "0");
         }
 
         // Resolve location name
@@ -1820,21 +2189,22 @@ size_t handle_tools_call(const char* id, const char* params, char* response, siz
 
             if (len > 0) {
                 // Return POI with visualization options
-                snprintf(result_text, sizeof(result_text),
-                         "type,category,centerLon,centerLat,radius,markerColor,showLabels,flyTo,overpassJson\n"
-                         "poiVisualize,%s,%.6f,%.6f,%.1f,%s,%s,true,%s",
-                         category, lon, lat, radius, marker_color,
-                         show_labels ? "true" : "false", http_response);
+                format_text(result_text, sizeof(result_text),
+                            "type,category,centerLon,centerLat,radius,markerColor,showLabels,flyTo,overpassJson\n"
+                            "poiVisualize,%s,%.6f,%.6f,%.1f,%.*s,%s,true,%s",
+                            category, lon, lat, radius, VIEW_ARG(marker_color),
+                            show_labels ? "true" : "false", http_response);
             } else {
-                snprintf(result_text, sizeof(result_text),
-                         "No %s found within %.0fm of the location.", category, radius);
+                format_text(result_text, sizeof(result_text),
+                            "No %s found within %.0fm of the location.", category, radius);
             }
         }
     }
     else {
         // Pass through to external handler (will be implemented by JS glue code)
-        snprintf(result_text, sizeof(result_text),
-                 "Tool '%s' executed with args: %s", tool_name, args_json);
+        std::string_view arguments = args != nullptr ? std::string_view(args->text, args->length) : "{}";
+        format_text(result_text, sizeof(result_text),
+                    "Tool '%.*s' executed with args: %.*s", VIEW_ARG(tool_name), VIEW_ARG(arguments));
     }
 
     char result[65536];
@@ -1846,48 +2216,61 @@ size_t handle_resources_list(const char* id, char* response, size_t response_siz
     return create_success_response(id, RESOURCES_JSON, response, response_size);
 }
 
-size_t handle_resources_read(const char* id, const char* params, char* response, size_t response_size) {
-    char uri[256];
-    if (!json_get_string(params, "uri", uri, sizeof(uri))) {
+size_t handle_resources_read(const char* id, const JsonNode* params, char* response, size_t response_size) {
+    std::string_view uri;
+    if (!json_get_string_view(params, "uri", uri)) {
         return create_error_response(id, ErrorCode::InvalidParams, "Missing uri",
                                      response, response_size);
     }
 
     char content[8192];
 
-    if (strcmp(uri, "cesium://scene/state") == 0) {
+    if (uri == "cesium://scene/state") {
         strcpy(content, R"JSON({"contents":[{"uri":"cesium://scene/state","mimeType":"application/json","text":"{\"mode\":\"3D\"}"}]})JSON");
     }
-    else if (strcmp(uri, "cesium://entities") == 0) {
+    else if (uri == "cesium://entities") {
         strcpy(content, R"JSON({"contents":[{"uri":"cesium://entities","mimeType":"application/json","text":"[]"}]})JSON");
     }
-    else if (strcmp(uri, "cesium://camera") == 0) {
+    else if (uri == "cesium://camera") {
         strcpy(content, R"JSON({"contents":[{"uri":"cesium://camera","mimeType":"application/json","text":"{\"longitude\":0,\"latitude\":0,\"height\":10000000}"}]})JSON");
     }
-    else if (strcmp(uri, "cesium://locations") == 0) {
+    else if (uri == "cesium://locations") {
         // Build locations list
         const Location* locations = get_all_locations();
         size_t count = get_location_count();
 
         char locations_json[32768];
         size_t offset = 0;
-        offset += snprintf(locations_json + offset, sizeof(locations_json) - offset, "[");
+        offset += format_text(locations_json + offset, sizeof(locations_json) - offset, "[");
 
         bool first = true;
         for (size_t i = 0; i < count && offset < sizeof(locations_json) - 100; i++) {
             if (locations[i].name == nullptr) continue;
             if (!first) {
-                offset += snprintf(locations_json + offset, sizeof(locations_json) - offset, ",");
+                offset += format_text(locations_json + offset, sizeof(locations_json) - offset, ",");
             }
             first = false;
-            offset += snprintf(locations_json + offset, sizeof(locations_json) - offset,
-                               "\"%s\"", locations[i].name);
-        }
-        offset += snprintf(locations_json + offset, sizeof(locations_json) - offset, "]");
-
-        snprintf(content, sizeof(content),
-                 "{\"contents\":[{\"uri\":\"cesium://locations\",\"mimeType\":\"application/json\",\"text\":%s}]}",
-                 locations_json);
+            char escaped_name[ESCAPED_NAME_SIZE];
+            json_escape_string(locations[i].name, escaped_name, sizeof(escaped_name));
+            offset += format_text(locations_json + offset, sizeof(locations_json) - offset,
+                                  "\"%s\"", escaped_name);
+        }
+        offset += format_text(locations_json + offset, sizeof(locations_json) - offset, "]");
+
+        format_text(content, sizeof(content),
+                    "{\"contents\":[{\"uri\":\"cesium://locations\",\"mimeType\":\"application/json\",\"text\":%s}]}",
+                    locations_json);
+    }
+    else if (uri == "cesium://locations/cache") {
+        LocationCacheStats stats = get_location_cache_stats();
+        uint64_t lookups = stats.hits + stats.misses;
+        format_text(content, sizeof(content),
+                    "{\"contents\":[{\"uri\":\"cesium://locations/cache\",\"mimeType\":\"application/json\","
+                    "\"text\":\"{\\\"capacity\\\":%zu,\\\"entries\\\":%zu,\\\"hits\\\":%llu,"
+                    "\\\"misses\\\":%llu,\\\"evictions\\\":%llu,\\\"hitRate\\\":%.4f}\"}]}",
+                    stats.capacity, stats.entries, static_cast<unsigned long long>(stats.hits),
+                    static_cast<unsigned long long>(stats.misses), static_cast<unsigned long long>(stats.evictions),
+                    lookups > 0 ? static_cast<double>(stats.hits) / lookups : 0.0);
     }
     else {
         return create_error_response(id, ErrorCode::InvalidParams, "Unknown resource",
@@ -1897,72 +2280,174 @@ size_t handle_resources_read(const char* id, const char* params, char* response,
     return create_success_response(id, content, response, response_size);
 }
 
-size_t handle_message(const char* message, char* response, size_t response_size) {
+// Room for the echoed ID, quotes and escapes included; longer IDs are
+// refused rather than cut short
+constexpr size_t REQUEST_ID_SIZE = 256;
+
+// Echo the ID as sent: numbers verbatim, strings re-escaped. False (and
+// "null") when it does not fit in REQUEST_ID_SIZE.
+static bool format_request_id(const JsonNode* request, char* id_str) {
+    strcpy(id_str, "null");
+    const JsonNode* id = json_find(request, "id");
+    if (id != nullptr && id->type == JsonType::Number) {
+        if (id->length >= REQUEST_ID_SIZE) return false;
+        memcpy(id_str, id->text, id->length);
+        id_str[id->length] = '\0';
+    } else if (id != nullptr && id->type == JsonType::String) {
+        // Escaping grows a byte to at most six (\u00XX), so escaped_id
+        // always holds the whole string and its length can be checked
+        char id_string[REQUEST_ID_SIZE];
+        char escaped_id[REQUEST_ID_SIZE * 6];
+        if (json_string_copy(id, id_string, sizeof(id_string)) != id->length ||
+            strlen(id_string) != id->length ||
+            json_escape_string(id_string, escaped_id, sizeof(escaped_id)) + 2 >= REQUEST_ID_SIZE) {
+            return false;
+        }
+        format_text(id_str, REQUEST_ID_SIZE, "\"%s\"", escaped_id);
+    }
+    return true;
+}
+
+// Route a method to its handler
+static size_t dispatch_method(std::string_view method, const char* id_str, const JsonNode* params,
+                              char* response, size_t response_size) {
+    if (method == "initialize") {
+        return handle_initialize(id_str, params, response, response_size);
+    }
+    if (method == "initialized") {
+        // Notification - no response
+        return 0;
+    }
+    if (method == "tools/list") {
+        return handle_tools_list(id_str, response, response_size);
+    }
+    if (method == "tools/call") {
+        return handle_tools_call(id_str, params, response, response_size);
+    }
+    if (method == "resources/list") {
+        return handle_resources_list(id_str, response, response_size);
+    }
+    if (method == "resources/read") {
+        return handle_resources_read(id_str, params, response, response_size);
+    }
+    if (method == "ping") {
+        return create_success_response(id_str, "{}", response, response_size);
+    }
+
+    // Unknown method
+    char error_msg[128];
+    format_text(error_msg, sizeof(error_msg), "Method not found: %.*s", VIEW_ARG(method));
+    return create_error_response(id_str, ErrorCode::MethodNotFound, error_msg,
+                                 response, response_size);
+}
+
+// One request object (a whole message, or an element of a batch)
+static size_t handle_request(const JsonNode* request, char* response, size_t response_size) {
+    if (request->type != JsonType::Object) {
+        return create_error_response("null", ErrorCode::InvalidRequest,
+                                     "Invalid Request", response, response_size);
+    }
+
     // Validate JSON-RPC structure
-    if (strstr(message, "\"jsonrpc\"") == nullptr) {
+    const JsonNode* jsonrpc = json_find(request, "jsonrpc");
+    if (jsonrpc == nullptr) {
         return create_error_response("null", ErrorCode::InvalidRequest,
                                      "Missing jsonrpc field", response, response_size);
     }
-
-    char jsonrpc[8];
-    if (!json_get_string(message, "jsonrpc", jsonrpc, sizeof(jsonrpc)) ||
-        strcmp(jsonrpc, "2.0") != 0) {
+    if (jsonrpc->type != JsonType::String || json_string_view(jsonrpc) != JSONRPC_VERSION) {
         return create_error_response("null", ErrorCode::InvalidRequest,
                                      "Invalid JSON-RPC version", response, response_size);
     }
 
-    // Extract ID
-    char id_str[64] = "null";
-    int64_t id_int;
-    if (json_get_int(message, "id", id_int)) {
-        snprintf(id_str, sizeof(id_str), "%lld", (long long)id_int);
-    } else {
-        char id_string[64];
-        if (json_get_string(message, "id", id_string, sizeof(id_string))) {
-            snprintf(id_str, sizeof(id_str), "\"%s\"", id_string);
-        }
-    }
-
     // Extract method
-    char method[64];
-    if (!json_get_string(message, "method", method, sizeof(method))) {
+    std::string_view method;
+    if (!json_get_string_view(request, "method", method)) {
         // Might be a response, not a request
         return 0;
     }
 
-    // Extract params
-    char params[8192];
-    json_get_object(message, "params", params, sizeof(params));
+    char id_str[REQUEST_ID_SIZE];
+    if (!format_request_id(request, id_str)) {
+        return create_error_response("null", ErrorCode::InvalidRequest,
+                                     "Request id too long", response, response_size);
+    }
+
+    // Missing params read as an empty object
+    const JsonNode* params = json_find(request, "params");
 
-    // Route to handlers
-    if (strcmp(method, "initialize") == 0) {
-        return handle_initialize(id_str, params, response, response_size);
+    size_t length = dispatch_method(method, id_str, params, response, response_size);
+
+    // A request without an ID is a notification: it runs, but nothing is
+    // sent back, not even an error
+    if (json_find(request, "id") == nullptr) {
+        if (response_size > 0) response[0] = '\0';
+        return 0;
     }
-    if (strcmp(method, "initialized") == 0) {
-        // Notification - no response
+    return length;
+}
+
+// Batch: elements are dispatched in order, each response written in place
+// after the previous one, so N calls cost one parse and one buffer.
+// Notifications add nothing; a response too large for the space left is
+// replaced by an error under its request's ID, and a request for which not
+// even that fits goes unanswered.
+static size_t handle_batch(const JsonNode* batch, char* response, size_t response_size) {
+    if (response_size < 3) {
+        if (response_size > 0) response[0] = '\0';
         return 0;
     }
-    if (strcmp(method, "tools/list") == 0) {
-        return handle_tools_list(id_str, response, response_size);
+
+    response[0] = '[';
+    size_t offset = 1;
+    size_t responses = 0;
+    const JsonNode* request = batch + 1;
+    for (uint32_t i = 0; i < batch->count; i++, request = json_next(request)) {
+        // A separator goes in only once this element has produced a response
+        size_t start = offset + (responses > 0 ? 1 : 0);
+        if (start + 1 >= response_size) break;
+        // One byte stays reserved for the closing bracket
+        size_t available = response_size - 1 - start;
+
+        size_t length = handle_request(request, response + start, available);
+        if (length >= available) {
+            char id_str[REQUEST_ID_SIZE];
+            format_request_id(request, id_str);
+            length = create_error_response(id_str, ErrorCode::InternalError, "Response too large for batch",
+                                           response + start, available);
+            if (length >= available) continue;
+        }
+        if (length == 0) continue;
+
+        if (responses > 0) response[offset] = ',';
+        offset = start + length;
+        responses++;
     }
-    if (strcmp(method, "tools/call") == 0) {
-        return handle_tools_call(id_str, params, response, response_size);
+
+    // A batch of notifications gets no response at all
+    if (responses == 0) {
+        response[0] = '\0';
+        return 0;
     }
-    if (strcmp(method, "resources/list") == 0) {
-        return handle_resources_list(id_str, response, response_size);
+    response[offset++] = ']';
+    response[offset] = '\0';
+    return offset;
+}
+
+size_t handle_message(const char* message, char* response, size_t response_size) {
+    // Tokenize once; every field below is a lookup on the tape
+    if (!json_parse(message, strlen(message), message_document)) {
+        return create_error_response("null", ErrorCode::ParseError,
+                                     "Parse error", response, response_size);
     }
-    if (strcmp(method, "resources/read") == 0) {
-        return handle_resources_read(id_str, params, response, response_size);
+    const JsonNode* root = json_root(message_document);
+    if (root->type != JsonType::Array) {
+        return handle_request(root, response, response_size);
     }
-    if (strcmp(method, "ping") == 0) {
-        return create_success_response(id_str, "{}", response, response_size);
+    if (root->count == 0) {
+        return create_error_response("null", ErrorCode::InvalidRequest,
+                                     "Invalid Request", response, response_size);
     }
-
-    // Unknown method
-    char error_msg[128];
-    snprintf(error_msg, sizeof(error_msg), "Method not found: %s", method);
-    return create_error_response(id_str, ErrorCode::MethodNotFound, error_msg,
-                                 response, response_size);
+    return handle_batch(root, response, response_size);
 }
 
 }  // namespace mcp
@@ -1979,8 +2464,11 @@ void init() {
 }
 
 const char* handleMessage(const char* message) {
-    cesium::mcp::handle_message(message, cesium::mcp::response_buffer,
-                                cesium::mcp::MAX_RESPONSE_SIZE);
+    // Notifications (and batches of them) answer with an empty string
+    if (cesium::mcp::handle_message(message, cesium::mcp::response_buffer,
+                                    cesium::mcp::MAX_RESPONSE_SIZE) == 0) {
+        cesium::mcp::response_buffer[0] = '\0';
+    }
     return cesium::mcp::response_buffer;
 }
 
@@ -1994,21 +2482,59 @@ const char* resolveLocation(const char* name) {
     double longitude, latitude, heading;
     if (cesium::mcp::resolve_location(name, longitude, latitude, heading)) {
         if (heading >= 0) {
-            snprintf(cesium::mcp::response_buffer, cesium::mcp::MAX_RESPONSE_SIZE,
-                     "{\"found\":true,\"longitude\":%.6f,\"latitude\":%.6f,\"heading\":%.1f}",
-                     longitude, latitude, heading);
+            cesium::mcp::format_text(cesium::mcp::response_buffer, cesium::mcp::MAX_RESPONSE_SIZE,
+                                     "{\"found\":true,\"longitude\":%.6f,\"latitude\":%.6f,\"heading\":%.1f}",
+                                     longitude, latitude, heading);
         } else {
-            snprintf(cesium::mcp::response_buffer, cesium::mcp::MAX_RESPONSE_SIZE,
-                     "{\"found\":true,\"longitude\":%.6f,\"latitude\":%.6f}",
-                     longitude, latitude);
+            cesium::mcp::format_text(cesium::mcp::response_buffer, cesium::mcp::MAX_RESPONSE_SIZE,
+                                     "{\"found\":true,\"longitude\":%.6f,\"latitude\":%.6f}",
+                                     longitude, latitude);
         }
     } else {
-        snprintf(cesium::mcp::response_buffer, cesium::mcp::MAX_RESPONSE_SIZE,
-                 "{\"found\":false,\"error\":\"Location not found: %s\"}", name);
+        char escaped_name[cesium::mcp::ESCAPED_NAME_SIZE];
+        cesium::mcp::json_escape_string(name, escaped_name, sizeof(escaped_name));
+        cesium::mcp::format_text(cesium::mcp::response_buffer, cesium::mcp::MAX_RESPONSE_SIZE,
+                                 "{\"found\":false,\"error\":\"Location not found: %s\"}", escaped_name);
     }
     return cesium::mcp::response_buffer;
 }
 
+const char* resolveLocationsBatch(const char* names, int maxDistance) {
+    using namespace cesium::mcp;
+
+    // Split the newline-separated names in place of a copy
+    static char names_buffer[16384];
+    static const char* batch[MAX_BATCH_LOCATIONS];
+    static LocationResolution results[MAX_BATCH_LOCATIONS];
+    size_t length = strlen(names);
+    if (length >= sizeof(names_buffer)) {
+        format_text(response_buffer, MAX_RESPONSE_SIZE,
+                    "{\"error\":\"Names exceed %zu bytes\"}", sizeof(names_buffer) - 1);
+        return response_buffer;
+    }
+    memcpy(names_buffer, names, length + 1);
+
+    size_t count = 0;
+    char* line = names_buffer;
+    while (*line != '\0') {
+        if (count == MAX_BATCH_LOCATIONS) {
+            format_text(response_buffer, MAX_RESPONSE_SIZE,
+                        "{\"error\":\"Too many names: at most %zu per call\"}", MAX_BATCH_LOCATIONS);
+            return response_buffer;
+        }
+        char* end = strchr(line, '\n');
+        if (end != nullptr) *end = '\0';
+        batch[count++] = line;
+        if (end == nullptr) break;
+        line = end + 1;
+    }
+
+    int distance = std::min(std::max(maxDistance, 0), 3);
+    size_t found = resolve_locations(batch, count, results, distance);
+    format_batch_resolution(results, count, found, response_buffer, MAX_RESPONSE_SIZE);
+    return response_buffer;
+}
+
 void setCameraState(double lon, double lat, double height, double targetLon, double targetLat) {
     cesium::mcp::camera_longitude = lon;
     cesium::mcp::camera_latitude = lat;
@@ -2020,15 +2546,31 @@ void setCameraState(double lon, double lat, double height, double targetLon, dou
 
 const char* getCameraTarget() {
     if (cesium::mcp::camera_state_valid) {
-        snprintf(cesium::mcp::response_buffer, cesium::mcp::MAX_RESPONSE_SIZE,
-                 "{\"valid\":true,\"longitude\":%.6f,\"latitude\":%.6f,\"height\":%.1f,"
-                 "\"targetLongitude\":%.6f,\"targetLatitude\":%.6f}",
-                 cesium::mcp::camera_longitude, cesium::mcp::camera_latitude,
-                 cesium::mcp::camera_height,
-                 cesium::mcp::camera_target_longitude, cesium::mcp::camera_target_latitude);
+        int offset = cesium::mcp::format_text(cesium::mcp::response_buffer, cesium::mcp::MAX_RESPONSE_SIZE,
+                                              "{\"valid\":true,\"longitude\":%.6f,\"latitude\":%.6f,\"height\":%.1f,"
+                                              "\"targetLongitude\":%.6f,\"targetLatitude\":%.6f",
+                                              cesium::mcp::camera_longitude, cesium::mcp::camera_latitude,
+                                              cesium::mcp::camera_height,
+                                              cesium::mcp::camera_target_longitude, cesium::mcp::camera_target_latitude);
+
+        // Name what the camera is looking at, locally, when anything is close
+        cesium::mcp::SpatialMatch match;
+        if (cesium::mcp::reverse_geocode_location(cesium::mcp::camera_target_longitude,
+                                                  cesium::mcp::camera_target_latitude,
+                                                  cesium::mcp::REVERSE_GEOCODE_DISTANCE, match)) {
+            char escaped_name[cesium::mcp::ESCAPED_NAME_SIZE];
+            cesium::mcp::json_escape_string(cesium::mcp::get_all_locations()[match.id].name,
+                                            escaped_name, sizeof(escaped_name));
+            offset += cesium::mcp::format_text(cesium::mcp::response_buffer + offset,
+                                               cesium::mcp::MAX_RESPONSE_SIZE - offset,
+                                               ",\"targetPlace\":\"%s\",\"targetPlaceDistance\":%.1f",
+                                               escaped_name, match.distance);
+        }
+        cesium::mcp::format_text(cesium::mcp::response_buffer + offset,
+                                 cesium::mcp::MAX_RESPONSE_SIZE - offset, "}");
     } else {
-        snprintf(cesium::mcp::response_buffer, cesium::mcp::MAX_RESPONSE_SIZE,
-                 "{\"valid\":false}");
+        cesium::mcp::format_text(cesium::mcp::response_buffer, cesium::mcp::MAX_RESPONSE_SIZE,
+                                 "{\"valid\":false}");
     }
     return cesium::mcp::response_buffer;
 }
@@ -2038,34 +2580,102 @@ const char* listLocations() {
     size_t count = cesium::mcp::get_location_count();
 
     size_t offset = 0;
-    offset += snprintf(cesium::mcp::response_buffer + offset,
-                       cesium::mcp::MAX_RESPONSE_SIZE - offset, "[");
+    offset += cesium::mcp::format_text(cesium::mcp::response_buffer + offset,
+                                       cesium::mcp::MAX_RESPONSE_SIZE - offset, "[");
 
     bool first = true;
     for (size_t i = 0; i < count && offset < cesium::mcp::MAX_RESPONSE_SIZE - 100; i++) {
         if (locations[i].name == nullptr) continue;
         if (!first) {
-            offset += snprintf(cesium::mcp::response_buffer + offset,
-                               cesium::mcp::MAX_RESPONSE_SIZE - offset, ",");
+            offset += cesium::mcp::format_text(cesium::mcp::response_buffer + offset,
+                                               cesium::mcp::MAX_RESPONSE_SIZE - offset, ",");
         }
         first = false;
+        char escaped_name[cesium::mcp::ESCAPED_NAME_SIZE];
+        cesium::mcp::json_escape_string(locations[i].name, escaped_name, sizeof(escaped_name));
         if (locations[i].heading >= 0) {
-            offset += snprintf(cesium::mcp::response_buffer + offset,
-                               cesium::mcp::MAX_RESPONSE_SIZE - offset,
-                               "{\"name\":\"%s\",\"longitude\":%.6f,\"latitude\":%.6f,\"heading\":%.1f}",
-                               locations[i].name, locations[i].longitude, locations[i].latitude, locations[i].heading);
+            offset += cesium::mcp::format_text(cesium::mcp::response_buffer + offset,
+                                               cesium::mcp::MAX_RESPONSE_SIZE - offset,
+                                               "{\"name\":\"%s\",\"longitude\":%.6f,\"latitude\":%.6f,\"heading\":%.1f}",
+                                               escaped_name, locations[i].longitude, locations[i].latitude, locations[i].heading);
         } else {
-            offset += snprintf(cesium::mcp::response_buffer + offset,
-                               cesium::mcp::MAX_RESPONSE_SIZE - offset,
-                               "{\"name\":\"%s\",\"longitude\":%.6f,\"latitude\":%.6f}",
-                               locations[i].name, locations[i].longitude, locations[i].latitude);
+            offset += cesium::mcp::format_text(cesium::mcp::response_buffer + offset,
+                                               cesium::mcp::MAX_RESPONSE_SIZE - offset,
+                                               "{\"name\":\"%s\",\"longitude\":%.6f,\"latitude\":%.6f}",
+                                               escaped_name, locations[i].longitude, locations[i].latitude);
         }
     }
 
-    snprintf(cesium::mcp::response_buffer + offset,
-             cesium::mcp::MAX_RESPONSE_SIZE - offset, "]");
+    cesium::mcp::format_text(cesium::mcp::response_buffer + offset,
+                             cesium::mcp::MAX_RESPONSE_SIZE - offset, "]");
 
     return cesium::mcp::response_buffer;
 }
 
+const char* autocompleteLocations(const char* prefix, int maxResults) {
+    using namespace cesium::mcp;
+
+    char normalized[256];
+    normalize_location_name(prefix, normalized, sizeof(normalized));
+    size_t normalized_len = strlen(normalized);
+    size_t cached_len = strlen(autocomplete_prefix);
+
+    // Resume from the previous keystroke when the prefix only grew
+    if (!autocomplete_cursor_valid || cached_len > normalized_len ||
+        strncmp(autocomplete_prefix, normalized, cached_len) != 0) {
+        autocomplete_cursor = autocomplete_begin();
+        cached_len = 0;
+    }
+    autocomplete_advance(autocomplete_cursor, normalized + cached_len, normalized_len - cached_len);
+    memcpy(autocomplete_prefix, normalized, normalized_len + 1);
+    autocomplete_cursor_valid = true;
+
+    size_t max_results = maxResults > 0 ? static_cast<size_t>(maxResults) : 10;
+    if (max_results > 100) max_results = 100;
+
+    const Location* matches[100];
+    size_t num_matches = autocomplete_top(autocomplete_cursor, matches, max_results);
+
+    size_t offset = 0;
+    offset += format_text(response_buffer + offset, MAX_RESPONSE_SIZE - offset, "[");
+    for (size_t i = 0; i < num_matches && offset < MAX_RESPONSE_SIZE - 300; i++) {
+        char escaped_name[ESCAPED_NAME_SIZE];
+        json_escape_string(matches[i]->name, escaped_name, sizeof(escaped_name));
+        offset += format_text(response_buffer + offset, MAX_RESPONSE_SIZE - offset,
+                              "%s{\"name\":\"%s\",\"longitude\":%.6f,\"latitude\":%.6f,\"population\":%d}",
+                              i > 0 ? "," : "", escaped_name,
+                              matches[i]->longitude, matches[i]->latitude, matches[i]->population);
+    }
+    format_text(response_buffer + offset, MAX_RESPONSE_SIZE - offset, "]");
+
+    return response_buffer;
+}
+
+const char* reverseGeocode(double lon, double lat, double maxDistance) {
+    using namespace cesium::mcp;
+
+    SpatialMatch match;
+    double max_distance = maxDistance > 0 ? maxDistance : REVERSE_GEOCODE_DISTANCE;
+    if (reverse_geocode_location(lon, lat, max_distance, match)) {
+        const Location& loc = get_all_locations()[match.id];
+        char escaped_name[ESCAPED_NAME_SIZE];
+        json_escape_string(loc.name, escaped_name, sizeof(escaped_name));
+        format_text(response_buffer, MAX_RESPONSE_SIZE,
+                    "{\"found\":true,\"name\":\"%s\",\"distance\":%.1f,\"population\":%d,"
+                    "\"longitude\":%.6f,\"latitude\":%.6f}",
+                    escaped_name, match.distance, loc.population, loc.longitude, loc.latitude);
+    } else {
+        format_text(response_buffer, MAX_RESPONSE_SIZE, "{\"found\":false}");
+    }
+    return response_buffer;
+}
+
+int attachSymSpellIndex(const uint8_t* data, size_t size) {
+    return cesium::mcp::attach_symspell_index(data, size) ? 1 : 0;
+}
+
+int attachLocationDatabase(const uint8_t* data, size_t size) {
+    return cesium::mcp::attach_location_database(data, size) ? 1 : 0;
+}
+
 }
@@ -0,0 +1,273 @@
+/**
+ * Number Parsing and Formatting Implementation
+ */
+
+#include "number_format.h"
+#include <charconv>
+#include <cfloat>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <system_error>
+
+namespace cesium {
+namespace mcp {
+
+// Exactly representable powers of ten
+static const double POWERS_OF_TEN[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+static const uint64_t INTEGER_POWERS_OF_TEN[] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000,
+};
+
+constexpr int MAX_FAST_PRECISION = 9;
+
+// The fast paths need each operation rounded once, to double
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+constexpr bool EXACT_DOUBLE_ARITHMETIC = true;
+#else
+constexpr bool EXACT_DOUBLE_ARITHMETIC = false;
+#endif
+
+// ============================================================================
+// Parsing
+// ============================================================================
+
+bool parse_double_strtod(const char* first, const char* last, double& value) {
+    // strtod needs a terminator; the text is not necessarily followed by one
+    size_t length = static_cast<size_t>(last - first);
+    char digits[64];
+    std::string long_digits;
+    const char* text = digits;
+    if (length < sizeof(digits)) {
+        memcpy(digits, first, length);
+        digits[length] = '\0';
+    } else {
+        long_digits.assign(first, length);
+        text = long_digits.c_str();
+    }
+
+    char* end = nullptr;
+    value = strtod(text, &end);
+    return length > 0 && end == text + length;
+}
+
+bool parse_double(const char* first, const char* last, double& value) {
+    const char* p = first;
+    bool negative = p < last && *p == '-';
+    if (negative) p++;
+
+    // Up to 15 significant digits fit the mantissa exactly
+    uint64_t mantissa = 0;
+    int significant = 0;
+    int exponent = 0;
+    bool fast = EXACT_DOUBLE_ARITHMETIC;
+    const char* digits_start = p;
+    for (; p < last && *p >= '0' && *p <= '9'; p++) {
+        if (mantissa == 0 && *p == '0') continue;
+        if (++significant > 15) fast = false;
+        mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+    }
+    if (p == digits_start) return false;
+    if (p < last && *p == '.') {
+        for (p++; p < last && *p >= '0' && *p <= '9'; p++) {
+            exponent--;
+            if (mantissa == 0 && *p == '0') continue;
+            if (++significant > 15) fast = false;
+            mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+        }
+    }
+    if (p < last && (*p == 'e' || *p == 'E')) {
+        p++;
+        bool negative_exponent = p < last && *p == '-';
+        if (p < last && (*p == '-' || *p == '+')) p++;
+        int written = 0;
+        for (; p < last && *p >= '0' && *p <= '9'; p++) {
+            if (written < 10000) written = written * 10 + (*p - '0');
+        }
+        exponent += negative_exponent ? -written : written;
+    }
+    if (p != last) return false;
+
+    if (fast && exponent >= -22 && exponent <= 22) {
+        double result = static_cast<double>(mantissa);
+        result = exponent < 0 ? result / POWERS_OF_TEN[-exponent] : result * POWERS_OF_TEN[exponent];
+        value = negative ? -result : result;
+        return true;
+    }
+
+#if defined(__cpp_lib_to_chars)
+    std::from_chars_result result = std::from_chars(first, last, value);
+    if (result.ec == std::errc()) return result.ptr == last;
+    // Out of range leaves value unset; strtod gives +/-inf or 0
+    if (result.ec != std::errc::result_out_of_range) return false;
+#endif
+    return parse_double_strtod(first, last, value);
+}
+
+// ============================================================================
+// Formatting
+// ============================================================================
+
+static size_t write_unsigned(unsigned long long value, char* text) {
+    char digits[24];
+    size_t count = 0;
+    do {
+        digits[count++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    for (size_t i = 0; i < count; i++) text[i] = digits[count - 1 - i];
+    return count;
+}
+
+// Copy a formatted text out the way snprintf truncates
+static size_t copy_out(const char* text, size_t length, char* output, size_t output_size) {
+    if (output_size > 0) {
+        size_t copied = length < output_size - 1 ? length : output_size - 1;
+        memcpy(output, text, copied);
+        output[copied] = '\0';
+    }
+    return length;
+}
+
+size_t format_fixed_snprintf(double value, int precision, char* output, size_t output_size) {
+    int length = snprintf(output, output_size, "%.*f", precision, value);
+    return length > 0 ? static_cast<size_t>(length) : 0;
+}
+
+size_t format_fixed(double value, int precision, char* output, size_t output_size) {
+    char text[64];
+
+    if (EXACT_DOUBLE_ARITHMETIC && precision >= 0 && precision <= MAX_FAST_PRECISION && std::isfinite(value)) {
+        double scaled = std::fabs(value) * POWERS_OF_TEN[precision];
+        if (scaled < 9007199254740992.0) {  // 2^53
+            double whole = std::floor(scaled);
+            double fraction = scaled - whole;
+            // scaled is within half an ulp of the exact product, so only a
+            // fraction that close to .5 could round either way
+            if (std::fabs(fraction - 0.5) > scaled * DBL_EPSILON) {
+                uint64_t rounded = static_cast<uint64_t>(whole) + (fraction > 0.5 ? 1 : 0);
+                uint64_t unit = INTEGER_POWERS_OF_TEN[precision];
+                size_t length = 0;
+                if (std::signbit(value)) text[length++] = '-';
+                length += write_unsigned(rounded / unit, text + length);
+                if (precision > 0) {
+                    text[length++] = '.';
+                    uint64_t digits = rounded % unit;
+                    for (int i = precision - 1; i >= 0; i--) {
+                        text[length + static_cast<size_t>(i)] = static_cast<char>('0' + digits % 10);
+                        digits /= 10;
+                    }
+                    length += static_cast<size_t>(precision);
+                }
+                return copy_out(text, length, output, output_size);
+            }
+        }
+    }
+
+#if defined(__cpp_lib_to_chars)
+    if (std::isfinite(value)) {
+        std::to_chars_result result =
+            std::to_chars(text, text + sizeof(text), value, std::chars_format::fixed, precision);
+        if (result.ec == std::errc()) {
+            return copy_out(text, static_cast<size_t>(result.ptr - text), output, output_size);
+        }
+    }
+#endif
+    return format_fixed_snprintf(value, precision, output, output_size);
+}
+
+// Append within bounds; length keeps counting past the end, as snprintf does
+static void append(char* output, size_t output_size, size_t& length, const char* text, size_t count) {
+    if (length + 1 < output_size) {
+        size_t room = output_size - 1 - length;
+        memcpy(output + length, text, count < room ? count : room);
+    }
+    length += count;
+}
+
+int format_text(char* output, size_t output_size, const char* format, ...) {
+    va_list args;
+    va_list original;
+    va_start(args, format);
+    va_copy(original, args);
+
+    size_t length = 0;
+    char number[24];
+    for (const char* p = format; *p;) {
+        if (*p != '%') {
+            const char* next = strchr(p, '%');
+            size_t count = next != nullptr ? static_cast<size_t>(next - p) : strlen(p);
+            append(output, output_size, length, p, count);
+            p += count;
+            continue;
+        }
+
+        p++;
+        if (p[0] == 's') {
+            const char* text = va_arg(args, const char*);
+            if (text == nullptr) text = "(null)";
+            append(output, output_size, length, text, strlen(text));
+            p += 1;
+        } else if (p[0] == '.' && p[1] == '*' && p[2] == 's') {
+            // A std::string_view: stops at the precision or a NUL, as printf does
+            int precision = va_arg(args, int);
+            const char* text = va_arg(args, const char*);
+            if (text == nullptr) text = "(null)";
+            size_t count = precision < 0 ? strlen(text) : strnlen(text, static_cast<size_t>(precision));
+            append(output, output_size, length, text, count);
+            p += 3;
+        } else if (p[0] == 'd') {
+            int value = va_arg(args, int);
+            long long wide = value;
+            size_t count = 0;
+            if (wide < 0) {
+                number[count++] = '-';
+                wide = -wide;
+            }
+            count += write_unsigned(static_cast<unsigned long long>(wide), number + count);
+            append(output, output_size, length, number, count);
+            p += 1;
+        } else if (p[0] == 'z' && p[1] == 'u') {
+            size_t count = write_unsigned(va_arg(args, size_t), number);
+            append(output, output_size, length, number, count);
+            p += 2;
+        } else if (p[0] == 'l' && p[1] == 'l' && p[2] == 'u') {
+            size_t count = write_unsigned(va_arg(args, unsigned long long), number);
+            append(output, output_size, length, number, count);
+            p += 3;
+        } else if (p[0] == '.' && p[1] >= '0' && p[1] <= '9' && p[2] == 'f') {
+            double value = va_arg(args, double);
+            int precision = p[1] - '0';
+            if (length + 1 < output_size) {
+                length += format_fixed(value, precision, output + length, output_size - length);
+            } else {
+                length += format_fixed(value, precision, nullptr, 0);
+            }
+            p += 3;
+        } else if (p[0] == '%') {
+            append(output, output_size, length, "%", 1);
+            p += 1;
+        } else {
+            va_end(args);
+            int result = vsnprintf(output, output_size, format, original);
+            va_end(original);
+            return result;
+        }
+    }
+    va_end(args);
+    va_end(original);
+
+    if (output_size > 0) output[length < output_size ? length : output_size - 1] = '\0';
+    return static_cast<int>(length);
+}
+
+}  // namespace mcp
+}  // namespace cesium
@@ -0,0 +1,150 @@
+/**
+ * UTF-8 Case Folding Implementation
+ *
+ * The table itself is generated into utf8_fold_table.cpp by
+ * scripts/build-utf8-fold-table.mjs.
+ */
+
+#include "utf8_fold.h"
+#include <algorithm>
+#include <cstring>
+
+namespace cesium {
+namespace mcp {
+
+// Decode one UTF-8 sequence; malformed input is consumed one byte at a time
+// and reported as not decodable (codepoint 0)
+static size_t decode_utf8(const unsigned char* p, uint32_t& codepoint) {
+    if (p[0] < 0x80) {
+        codepoint = p[0];
+        return 1;
+    }
+
+    size_t length;
+    uint32_t cp;
+    if ((p[0] & 0xE0) == 0xC0) {
+        length = 2;
+        cp = p[0] & 0x1F;
+    } else if ((p[0] & 0xF0) == 0xE0) {
+        length = 3;
+        cp = p[0] & 0x0F;
+    } else if ((p[0] & 0xF8) == 0xF0) {
+        length = 4;
+        cp = p[0] & 0x07;
+    } else {
+        codepoint = 0;
+        return 1;
+    }
+
+    for (size_t i = 1; i < length; i++) {
+        if ((p[i] & 0xC0) != 0x80) {
+            codepoint = 0;
+            return 1;
+        }
+        cp = (cp << 6) | (p[i] & 0x3F);
+    }
+    codepoint = cp;
+    return length;
+}
+
+// Code points below this (Latin, Greek, Cyrillic, Armenian) are looked up
+// through a dense index instead of a binary search
+constexpr uint32_t DENSE_FOLD_LIMIT = 0x0600;
+
+struct DenseFoldIndex {
+    uint16_t slots[DENSE_FOLD_LIMIT];   // Entry index + 1, 0 = no entry
+};
+
+static DenseFoldIndex build_dense_fold_index() {
+    DenseFoldIndex index = {};
+    size_t count;
+    const Utf8FoldEntry* entries = get_utf8_fold_entries(count);
+    for (size_t i = 0; i < count && entries[i].codepoint < DENSE_FOLD_LIMIT; i++) {
+        index.slots[entries[i].codepoint] = static_cast<uint16_t>(i + 1);
+    }
+    return index;
+}
+
+static const Utf8FoldEntry* find_fold_entry(uint32_t codepoint) {
+    size_t count;
+    const Utf8FoldEntry* entries = get_utf8_fold_entries(count);
+
+    if (codepoint < DENSE_FOLD_LIMIT) {
+        static const DenseFoldIndex dense = build_dense_fold_index();
+        uint16_t slot = dense.slots[codepoint];
+        return slot != 0 ? &entries[slot - 1] : nullptr;
+    }
+    if (count == 0 || codepoint > entries[count - 1].codepoint) {
+        return nullptr;
+    }
+
+    const Utf8FoldEntry* end = entries + count;
+    const Utf8FoldEntry* it = std::lower_bound(entries, end, codepoint,
+        [](const Utf8FoldEntry& e, uint32_t cp) { return e.codepoint < cp; });
+    return (it != end && it->codepoint == codepoint) ? it : nullptr;
+}
+
+// Shared walk: ASCII bytes are written inline, other characters are
+// replaced by their table string (lower or folded) when they have one
+template <bool Fold>
+static size_t transform_utf8(const char* input, char* output, size_t output_size) {
+    if (output_size == 0) return 0;
+
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(input);
+    size_t limit = output_size - 1;
+    size_t j = 0;
+    bool pending_space = false;
+
+    while (*p != '\0') {
+        unsigned char c = *p;
+        if (c < 0x80) {
+            if (Fold && (c == ' ' || c == '\t')) {
+                pending_space = true;
+                p++;
+                continue;
+            }
+            size_t needed = (Fold && pending_space && j > 0) ? 2 : 1;
+            if (j + needed > limit) break;
+            if (needed == 2) output[j++] = ' ';
+            pending_space = false;
+            output[j++] = static_cast<char>((c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c);
+            p++;
+            continue;
+        }
+
+        uint32_t codepoint;
+        size_t consumed = decode_utf8(p, codepoint);
+        const char* bytes = reinterpret_cast<const char*>(p);
+        size_t length = consumed;
+        if (const Utf8FoldEntry* entry = find_fold_entry(codepoint)) {
+            bytes = get_utf8_fold_strings() + (Fold ? entry->folded : entry->lower);
+            length = std::strlen(bytes);
+        }
+
+        if (Fold && length == 1 && bytes[0] == ' ') {
+            pending_space = true;
+        } else if (length > 0) {
+            size_t needed = length + ((Fold && pending_space && j > 0) ? 1 : 0);
+            if (j + needed > limit) break;
+            if (needed > length) output[j++] = ' ';
+            pending_space = false;
+            std::memcpy(output + j, bytes, length);
+            j += length;
+        }
+        p += consumed;
+    }
+
+    output[j] = '\0';
+    return j;
+}
+
+size_t utf8_lowercase(const char* input, char* output, size_t output_size) {
+    return transform_utf8<false>(input, output, output_size);
+}
+
+size_t utf8_fold(const char* input, char* output, size_t output_size) {
+    return transform_utf8<true>(input, output, output_size);
+}
+
+}  // namespace mcp
+}  // namespace cesium
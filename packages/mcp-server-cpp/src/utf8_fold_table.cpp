@@ -0,0 +1,2324 @@
+/**
+ * UTF-8 Fold Table
+ *
+ * Lowercase and folded forms per code point, sorted by code point.
+ * Generated by scripts/build-utf8-fold-table.mjs; do not edit.
+ * Entries: 1313
+ */
+
+#include "utf8_fold.h"
+
+namespace cesium {
+namespace mcp {
+
+// NUL-terminated replacement strings
+static const char FOLD_STRINGS[] =
+    "\xc2\xa0" "\0"
+    " " "\0"
+    "\xc2\xa8" "\0"
+    "\xc2\xaa" "\0"
+    "a" "\0"
+    "\xc2\xab" "\0"
+    "" "\0"
+    "\xc2\xad" "\0"
+    "\xc2\xaf" "\0"
+    "\xc2\xb2" "\0"
+    "2" "\0"
+    "\xc2\xb3" "\0"
+    "3" "\0"
+    "\xc2\xb4" "\0"
+    "'" "\0"
+    "\xc2\xb5" "\0"
+    "\xce\xbc" "\0"
+    "\xc2\xb8" "\0"
+    "\xc2\xb9" "\0"
+    "1" "\0"
+    "\xc2\xba" "\0"
+    "o" "\0"
+    "\xc2\xbb" "\0"
+    "\xc2\xbc" "\0"
+    "1\xe2\x81\x84""4" "\0"
+    "\xc2\xbd" "\0"
+    "1\xe2\x81\x84""2" "\0"
+    "\xc2\xbe" "\0"
+    "3\xe2\x81\x84""4" "\0"
+    "\xc3\xa0" "\0"
+    "\xc3\xa1" "\0"
+    "\xc3\xa2" "\0"
+    "\xc3\xa3" "\0"
+    "\xc3\xa4" "\0"
+    "\xc3\xa5" "\0"
+    "\xc3\xa6" "\0"
+    "ae" "\0"
+    "\xc3\xa7" "\0"
+    "c" "\0"
+    "\xc3\xa8" "\0"
+    "e" "\0"
+    "\xc3\xa9" "\0"
+    "\xc3\xaa" "\0"
+    "\xc3\xab" "\0"
+    "\xc3\xac" "\0"
+    "i" "\0"
+    "\xc3\xad" "\0"
+    "\xc3\xae" "\0"
+    "\xc3\xaf" "\0"
+    "\xc3\xb0" "\0"
+    "d" "\0"
+    "\xc3\xb1" "\0"
+    "n" "\0"
+    "\xc3\xb2" "\0"
+    "\xc3\xb3" "\0"
+    "\xc3\xb4" "\0"
+    "\xc3\xb5" "\0"
+    "\xc3\xb6" "\0"
+    "\xc3\xb8" "\0"
+    "\xc3\xb9" "\0"
+    "u" "\0"
+    "\xc3\xba" "\0"
+    "\xc3\xbb" "\0"
+    "\xc3\xbc" "\0"
+    "\xc3\xbd" "\0"
+    "y" "\0"
+    "\xc3\xbe" "\0"
+    "th" "\0"
+    "\xc3\x9f" "\0"
+    "ss" "\0"
+    "\xc3\xbf" "\0"
+    "\xc4\x81" "\0"
+    "\xc4\x83" "\0"
+    "\xc4\x85" "\0"
+    "\xc4\x87" "\0"
+    "\xc4\x89" "\0"
+    "\xc4\x8b" "\0"
+    "\xc4\x8d" "\0"
+    "\xc4\x8f" "\0"
+    "\xc4\x91" "\0"
+    "\xc4\x93" "\0"
+    "\xc4\x95" "\0"
+    "\xc4\x97" "\0"
+    "\xc4\x99" "\0"
+    "\xc4\x9b" "\0"
+    "\xc4\x9d" "\0"
+    "g" "\0"
+    "\xc4\x9f" "\0"
+    "\xc4\xa1" "\0"
+    "\xc4\xa3" "\0"
+    "\xc4\xa5" "\0"
+    "h" "\0"
+    "\xc4\xa7" "\0"
+    "\xc4\xa9" "\0"
+    "\xc4\xab" "\0"
+    "\xc4\xad" "\0"
+    "\xc4\xaf" "\0"
+    "i\xcc\x87" "\0"
+    "\xc4\xb1" "\0"
+    "\xc4\xb3" "\0"
+    "ij" "\0"
+    "\xc4\xb5" "\0"
+    "j" "\0"
+    "\xc4\xb7" "\0"
+    "k" "\0"
+    "\xc4\xb8" "\0"
+    "\xc4\xba" "\0"
+    "l" "\0"
+    "\xc4\xbc" "\0"
+    "\xc4\xbe" "\0"
+    "\xc5\x80" "\0"
+    "l\xc2\xb7" "\0"
+    "\xc5\x82" "\0"
+    "\xc5\x84" "\0"
+    "\xc5\x86" "\0"
+    "\xc5\x88" "\0"
+    "\xc5\x89" "\0"
+    "\xca\xbcn" "\0"
+    "\xc5\x8b" "\0"
+    "\xc5\x8d" "\0"
+    "\xc5\x8f" "\0"
+    "\xc5\x91" "\0"
+    "\xc5\x93" "\0"
+    "oe" "\0"
+    "\xc5\x95" "\0"
+    "r" "\0"
+    "\xc5\x97" "\0"
+    "\xc5\x99" "\0"
+    "\xc5\x9b" "\0"
+    "s" "\0"
+    "\xc5\x9d" "\0"
+    "\xc5\x9f" "\0"
+    "\xc5\xa1" "\0"
+    "\xc5\xa3" "\0"
+    "t" "\0"
+    "\xc5\xa5" "\0"
+    "\xc5\xa7" "\0"
+    "\xc5\xa9" "\0"
+    "\xc5\xab" "\0"
+    "\xc5\xad" "\0"
+    "\xc5\xaf" "\0"
+    "\xc5\xb1" "\0"
+    "\xc5\xb3" "\0"
+    "\xc5\xb5" "\0"
+    "w" "\0"
+    "\xc5\xb7" "\0"
+    "\xc5\xba" "\0"
+    "z" "\0"
+    "\xc5\xbc" "\0"
+    "\xc5\xbe" "\0"
+    "\xc5\xbf" "\0"
+    "\xc9\x93" "\0"
+    "\xc6\x83" "\0"
+    "\xc6\x85" "\0"
+    "\xc9\x94" "\0"
+    "\xc6\x88" "\0"
+    "\xc9\x96" "\0"
+    "\xc9\x97" "\0"
+    "\xc6\x8c" "\0"
+    "\xc7\x9d" "\0"
+    "\xc9\x99" "\0"
+    "\xc9\x9b" "\0"
+    "\xc6\x92" "\0"
+    "f" "\0"
+    "\xc9\xa0" "\0"
+    "\xc9\xa3" "\0"
+    "\xc9\xa9" "\0"
+    "\xc9\xa8" "\0"
+    "\xc6\x99" "\0"
+    "\xc9\xaf" "\0"
+    "\xc9\xb2" "\0"
+    "\xc9\xb5" "\0"
+    "\xc6\xa1" "\0"
+    "\xc6\xa3" "\0"
+    "\xc6\xa5" "\0"
+    "\xca\x80" "\0"
+    "\xc6\xa8" "\0"
+    "\xca\x83" "\0"
+    "\xc6\xad" "\0"
+    "\xca\x88" "\0"
+    "\xc6\xb0" "\0"
+    "\xca\x8a" "\0"
+    "\xca\x8b" "\0"
+    "\xc6\xb4" "\0"
+    "\xc6\xb6" "\0"
+    "\xca\x92" "\0"
+    "\xc6\xb9" "\0"
+    "\xc6\xbd" "\0"
+    "\xc7\x86" "\0"
+    "dz" "\0"
+    "\xc7\x89" "\0"
+    "lj" "\0"
+    "\xc7\x8c" "\0"
+    "nj" "\0"
+    "\xc7\x8e" "\0"
+    "\xc7\x90" "\0"
+    "\xc7\x92" "\0"
+    "\xc7\x94" "\0"
+    "\xc7\x96" "\0"
+    "\xc7\x98" "\0"
+    "\xc7\x9a" "\0"
+    "\xc7\x9c" "\0"
+    "\xc7\x9f" "\0"
+    "\xc7\xa1" "\0"
+    "\xc7\xa3" "\0"
+    "\xc7\xa5" "\0"
+    "\xc7\xa7" "\0"
+    "\xc7\xa9" "\0"
+    "\xc7\xab" "\0"
+    "\xc7\xad" "\0"
+    "\xc7\xaf" "\0"
+    "\xc7\xb0" "\0"
+    "\xc7\xb3" "\0"
+    "\xc7\xb5" "\0"
+    "\xc6\x95" "\0"
+    "\xc6\xbf" "\0"
+    "\xc7\xb9" "\0"
+    "\xc7\xbb" "\0"
+    "\xc7\xbd" "\0"
+    "\xc7\xbf" "\0"
+    "\xc8\x81" "\0"
+    "\xc8\x83" "\0"
+    "\xc8\x85" "\0"
+    "\xc8\x87" "\0"
+    "\xc8\x89" "\0"
+    "\xc8\x8b" "\0"
+    "\xc8\x8d" "\0"
+    "\xc8\x8f" "\0"
+    "\xc8\x91" "\0"
+    "\xc8\x93" "\0"
+    "\xc8\x95" "\0"
+    "\xc8\x97" "\0"
+    "\xc8\x99" "\0"
+    "\xc8\x9b" "\0"
+    "\xc8\x9d" "\0"
+    "\xc8\x9f" "\0"
+    "\xc6\x9e" "\0"
+    "\xc8\xa3" "\0"
+    "\xc8\xa5" "\0"
+    "\xc8\xa7" "\0"
+    "\xc8\xa9" "\0"
+    "\xc8\xab" "\0"
+    "\xc8\xad" "\0"
+    "\xc8\xaf" "\0"
+    "\xc8\xb1" "\0"
+    "\xc8\xb3" "\0"
+    "\xe2\xb1\xa5" "\0"
+    "\xc8\xbc" "\0"
+    "\xc6\x9a" "\0"
+    "\xe2\xb1\xa6" "\0"
+    "\xc9\x82" "\0"
+    "\xc6\x80" "\0"
+    "\xca\x89" "\0"
+    "\xca\x8c" "\0"
+    "\xc9\x87" "\0"
+    "\xc9\x89" "\0"
+    "\xc9\x8b" "\0"
+    "\xc9\x8d" "\0"
+    "\xc9\x8f" "\0"
+    "\xca\xb0" "\0"
+    "\xca\xb1" "\0"
+    "\xc9\xa6" "\0"
+    "\xca\xb2" "\0"
+    "\xca\xb3" "\0"
+    "\xca\xb4" "\0"
+    "\xc9\xb9" "\0"
+    "\xca\xb5" "\0"
+    "\xc9\xbb" "\0"
+    "\xca\xb6" "\0"
+    "\xca\x81" "\0"
+    "\xca\xb7" "\0"
+    "\xca\xb8" "\0"
+    "\xca\xb9" "\0"
+    "\xca\xbb" "\0"
+    "\xca\xbc" "\0"
+    "\xcb\x98" "\0"
+    "\xcb\x99" "\0"
+    "\xcb\x9a" "\0"
+    "\xcb\x9b" "\0"
+    "\xcb\x9c" "\0"
+    "\xcb\x9d" "\0"
+    "\xcb\xa0" "\0"
+    "\xcb\xa1" "\0"
+    "\xcb\xa2" "\0"
+    "\xcb\xa3" "\0"
+    "x" "\0"
+    "\xcb\xa4" "\0"
+    "\xca\x95" "\0"
+    "\xcc\x80" "\0"
+    "\xcc\x81" "\0"
+    "\xcc\x82" "\0"
+    "\xcc\x83" "\0"
+    "\xcc\x84" "\0"
+    "\xcc\x85" "\0"
+    "\xcc\x86" "\0"
+    "\xcc\x87" "\0"
+    "\xcc\x88" "\0"
+    "\xcc\x89" "\0"
+    "\xcc\x8a" "\0"
+    "\xcc\x8b" "\0"
+    "\xcc\x8c" "\0"
+    "\xcc\x8d" "\0"
+    "\xcc\x8e" "\0"
+    "\xcc\x8f" "\0"
+    "\xcc\x90" "\0"
+    "\xcc\x91" "\0"
+    "\xcc\x92" "\0"
+    "\xcc\x93" "\0"
+    "\xcc\x94" "\0"
+    "\xcc\x95" "\0"
+    "\xcc\x96" "\0"
+    "\xcc\x97" "\0"
+    "\xcc\x98" "\0"
+    "\xcc\x99" "\0"
+    "\xcc\x9a" "\0"
+    "\xcc\x9b" "\0"
+    "\xcc\x9c" "\0"
+    "\xcc\x9d" "\0"
+    "\xcc\x9e" "\0"
+    "\xcc\x9f" "\0"
+    "\xcc\xa0" "\0"
+    "\xcc\xa1" "\0"
+    "\xcc\xa2" "\0"
+    "\xcc\xa3" "\0"
+    "\xcc\xa4" "\0"
+    "\xcc\xa5" "\0"
+    "\xcc\xa6" "\0"
+    "\xcc\xa7" "\0"
+    "\xcc\xa8" "\0"
+    "\xcc\xa9" "\0"
+    "\xcc\xaa" "\0"
+    "\xcc\xab" "\0"
+    "\xcc\xac" "\0"
+    "\xcc\xad" "\0"
+    "\xcc\xae" "\0"
+    "\xcc\xaf" "\0"
+    "\xcc\xb0" "\0"
+    "\xcc\xb1" "\0"
+    "\xcc\xb2" "\0"
+    "\xcc\xb3" "\0"
+    "\xcc\xb4" "\0"
+    "\xcc\xb5" "\0"
+    "\xcc\xb6" "\0"
+    "\xcc\xb7" "\0"
+    "\xcc\xb8" "\0"
+    "\xcc\xb9" "\0"
+    "\xcc\xba" "\0"
+    "\xcc\xbb" "\0"
+    "\xcc\xbc" "\0"
+    "\xcc\xbd" "\0"
+    "\xcc\xbe" "\0"
+    "\xcc\xbf" "\0"
+    "\xcd\x82" "\0"
+    "\xcc\x88\xcc\x81" "\0"
+    "\xcd\x85" "\0"
+    "\xcd\x86" "\0"
+    "\xcd\x87" "\0"
+    "\xcd\x88" "\0"
+    "\xcd\x89" "\0"
+    "\xcd\x8a" "\0"
+    "\xcd\x8b" "\0"
+    "\xcd\x8c" "\0"
+    "\xcd\x8d" "\0"
+    "\xcd\x8e" "\0"
+    "\xcd\x8f" "\0"
+    "\xcd\x90" "\0"
+    "\xcd\x91" "\0"
+    "\xcd\x92" "\0"
+    "\xcd\x93" "\0"
+    "\xcd\x94" "\0"
+    "\xcd\x95" "\0"
+    "\xcd\x96" "\0"
+    "\xcd\x97" "\0"
+    "\xcd\x98" "\0"
+    "\xcd\x99" "\0"
+    "\xcd\x9a" "\0"
+    "\xcd\x9b" "\0"
+    "\xcd\x9c" "\0"
+    "\xcd\x9d" "\0"
+    "\xcd\x9e" "\0"
+    "\xcd\x9f" "\0"
+    "\xcd\xa0" "\0"
+    "\xcd\xa1" "\0"
+    "\xcd\xa2" "\0"
+    "\xcd\xa3" "\0"
+    "\xcd\xa4" "\0"
+    "\xcd\xa5" "\0"
+    "\xcd\xa6" "\0"
+    "\xcd\xa7" "\0"
+    "\xcd\xa8" "\0"
+    "\xcd\xa9" "\0"
+    "\xcd\xaa" "\0"
+    "\xcd\xab" "\0"
+    "\xcd\xac" "\0"
+    "\xcd\xad" "\0"
+    "\xcd\xae" "\0"
+    "\xcd\xaf" "\0"
+    "\xcd\xb1" "\0"
+    "\xcd\xb3" "\0"
+    "\xcd\xb7" "\0"
+    "\xcd\xba" "\0"
+    ";" "\0"
+    "\xcf\xb3" "\0"
+    "\xce\x84" "\0"
+    "\xce\x85" "\0"
+    "\xce\xac" "\0"
+    "\xce\xb1" "\0"
+    "\xc2\xb7" "\0"
+    "\xce\xad" "\0"
+    "\xce\xb5" "\0"
+    "\xce\xae" "\0"
+    "\xce\xb7" "\0"
+    "\xce\xaf" "\0"
+    "\xce\xb9" "\0"
+    "\xcf\x8c" "\0"
+    "\xce\xbf" "\0"
+    "\xcf\x8d" "\0"
+    "\xcf\x85" "\0"
+    "\xcf\x8e" "\0"
+    "\xcf\x89" "\0"
+    "\xce\x90" "\0"
+    "\xce\xb2" "\0"
+    "\xce\xb3" "\0"
+    "\xce\xb4" "\0"
+    "\xce\xb6" "\0"
+    "\xce\xb8" "\0"
+    "\xce\xba" "\0"
+    "\xce\xbb" "\0"
+    "\xce\xbd" "\0"
+    "\xce\xbe" "\0"
+    "\xcf\x80" "\0"
+    "\xcf\x81" "\0"
+    "\xcf\x83" "\0"
+    "\xcf\x84" "\0"
+    "\xcf\x86" "\0"
+    "\xcf\x87" "\0"
+    "\xcf\x88" "\0"
+    "\xcf\x8a" "\0"
+    "\xcf\x8b" "\0"
+    "\xce\xb0" "\0"
+    "\xcf\x82" "\0"
+    "\xcf\x97" "\0"
+    "\xcf\x90" "\0"
+    "\xcf\x91" "\0"
+    "\xcf\x92" "\0"
+    "\xce\xa5" "\0"
+    "\xcf\x93" "\0"
+    "\xcf\x94" "\0"
+    "\xcf\x95" "\0"
+    "\xcf\x96" "\0"
+    "\xcf\x99" "\0"
+    "\xcf\x9b" "\0"
+    "\xcf\x9d" "\0"
+    "\xcf\x9f" "\0"
+    "\xcf\xa1" "\0"
+    "\xcf\xa3" "\0"
+    "\xcf\xa5" "\0"
+    "\xcf\xa7" "\0"
+    "\xcf\xa9" "\0"
+    "\xcf\xab" "\0"
+    "\xcf\xad" "\0"
+    "\xcf\xaf" "\0"
+    "\xcf\xb0" "\0"
+    "\xcf\xb1" "\0"
+    "\xcf\xb2" "\0"
+    "\xcf\xb5" "\0"
+    "\xcf\xb8" "\0"
+    "\xcf\xbb" "\0"
+    "\xcd\xbb" "\0"
+    "\xcd\xbc" "\0"
+    "\xcd\xbd" "\0"
+    "\xd1\x90" "\0"
+    "\xd1\x91" "\0"
+    "\xd0\xb5" "\0"
+    "\xd1\x92" "\0"
+    "\xd1\x93" "\0"
+    "\xd1\x94" "\0"
+    "\xd1\x95" "\0"
+    "\xd1\x96" "\0"
+    "\xd1\x97" "\0"
+    "\xd1\x98" "\0"
+    "\xd1\x99" "\0"
+    "\xd1\x9a" "\0"
+    "\xd1\x9b" "\0"
+    "\xd1\x9c" "\0"
+    "\xd1\x9d" "\0"
+    "\xd1\x9e" "\0"
+    "\xd1\x9f" "\0"
+    "\xd0\xb0" "\0"
+    "\xd0\xb1" "\0"
+    "\xd0\xb2" "\0"
+    "\xd0\xb3" "\0"
+    "\xd0\xb4" "\0"
+    "\xd0\xb6" "\0"
+    "\xd0\xb7" "\0"
+    "\xd0\xb8" "\0"
+    "\xd0\xb9" "\0"
+    "\xd0\xba" "\0"
+    "\xd0\xbb" "\0"
+    "\xd0\xbc" "\0"
+    "\xd0\xbd" "\0"
+    "\xd0\xbe" "\0"
+    "\xd0\xbf" "\0"
+    "\xd1\x80" "\0"
+    "\xd1\x81" "\0"
+    "\xd1\x82" "\0"
+    "\xd1\x83" "\0"
+    "\xd1\x84" "\0"
+    "\xd1\x85" "\0"
+    "\xd1\x86" "\0"
+    "\xd1\x87" "\0"
+    "\xd1\x88" "\0"
+    "\xd1\x89" "\0"
+    "\xd1\x8a" "\0"
+    "\xd1\x8b" "\0"
+    "\xd1\x8c" "\0"
+    "\xd1\x8d" "\0"
+    "\xd1\x8e" "\0"
+    "\xd1\x8f" "\0"
+    "\xd1\xa1" "\0"
+    "\xd1\xa3" "\0"
+    "\xd1\xa5" "\0"
+    "\xd1\xa7" "\0"
+    "\xd1\xa9" "\0"
+    "\xd1\xab" "\0"
+    "\xd1\xad" "\0"
+    "\xd1\xaf" "\0"
+    "\xd1\xb1" "\0"
+    "\xd1\xb3" "\0"
+    "\xd1\xb5" "\0"
+    "\xd1\xb7" "\0"
+    "\xd1\xb9" "\0"
+    "\xd1\xbb" "\0"
+    "\xd1\xbd" "\0"
+    "\xd1\xbf" "\0"
+    "\xd2\x81" "\0"
+    "\xd2\x8b" "\0"
+    "\xd2\x8d" "\0"
+    "\xd2\x8f" "\0"
+    "\xd2\x91" "\0"
+    "\xd2\x93" "\0"
+    "\xd2\x95" "\0"
+    "\xd2\x97" "\0"
+    "\xd2\x99" "\0"
+    "\xd2\x9b" "\0"
+    "\xd2\x9d" "\0"
+    "\xd2\x9f" "\0"
+    "\xd2\xa1" "\0"
+    "\xd2\xa3" "\0"
+    "\xd2\xa5" "\0"
+    "\xd2\xa7" "\0"
+    "\xd2\xa9" "\0"
+    "\xd2\xab" "\0"
+    "\xd2\xad" "\0"
+    "\xd2\xaf" "\0"
+    "\xd2\xb1" "\0"
+    "\xd2\xb3" "\0"
+    "\xd2\xb5" "\0"
+    "\xd2\xb7" "\0"
+    "\xd2\xb9" "\0"
+    "\xd2\xbb" "\0"
+    "\xd2\xbd" "\0"
+    "\xd2\xbf" "\0"
+    "\xd3\x8f" "\0"
+    "\xd3\x82" "\0"
+    "\xd3\x84" "\0"
+    "\xd3\x86" "\0"
+    "\xd3\x88" "\0"
+    "\xd3\x8a" "\0"
+    "\xd3\x8c" "\0"
+    "\xd3\x8e" "\0"
+    "\xd3\x91" "\0"
+    "\xd3\x93" "\0"
+    "\xd3\x95" "\0"
+    "\xd3\x97" "\0"
+    "\xd3\x99" "\0"
+    "\xd3\x9b" "\0"
+    "\xd3\x9d" "\0"
+    "\xd3\x9f" "\0"
+    "\xd3\xa1" "\0"
+    "\xd3\xa3" "\0"
+    "\xd3\xa5" "\0"
+    "\xd3\xa7" "\0"
+    "\xd3\xa9" "\0"
+    "\xd3\xab" "\0"
+    "\xd3\xad" "\0"
+    "\xd3\xaf" "\0"
+    "\xd3\xb1" "\0"
+    "\xd3\xb3" "\0"
+    "\xd3\xb5" "\0"
+    "\xd3\xb7" "\0"
+    "\xd3\xb9" "\0"
+    "\xd3\xbb" "\0"
+    "\xd3\xbd" "\0"
+    "\xd3\xbf" "\0"
+    "\xd4\x81" "\0"
+    "\xd4\x83" "\0"
+    "\xd4\x85" "\0"
+    "\xd4\x87" "\0"
+    "\xd4\x89" "\0"
+    "\xd4\x8b" "\0"
+    "\xd4\x8d" "\0"
+    "\xd4\x8f" "\0"
+    "\xd4\x91" "\0"
+    "\xd4\x93" "\0"
+    "\xd4\x95" "\0"
+    "\xd4\x97" "\0"
+    "\xd4\x99" "\0"
+    "\xd4\x9b" "\0"
+    "\xd4\x9d" "\0"
+    "\xd4\x9f" "\0"
+    "\xd4\xa1" "\0"
+    "\xd4\xa3" "\0"
+    "\xd4\xa5" "\0"
+    "\xd4\xa7" "\0"
+    "\xd4\xa9" "\0"
+    "\xd4\xab" "\0"
+    "\xd4\xad" "\0"
+    "\xd4\xaf" "\0"
+    "\xd5\xa1" "\0"
+    "\xd5\xa2" "\0"
+    "\xd5\xa3" "\0"
+    "\xd5\xa4" "\0"
+    "\xd5\xa5" "\0"
+    "\xd5\xa6" "\0"
+    "\xd5\xa7" "\0"
+    "\xd5\xa8" "\0"
+    "\xd5\xa9" "\0"
+    "\xd5\xaa" "\0"
+    "\xd5\xab" "\0"
+    "\xd5\xac" "\0"
+    "\xd5\xad" "\0"
+    "\xd5\xae" "\0"
+    "\xd5\xaf" "\0"
+    "\xd5\xb0" "\0"
+    "\xd5\xb1" "\0"
+    "\xd5\xb2" "\0"
+    "\xd5\xb3" "\0"
+    "\xd5\xb4" "\0"
+    "\xd5\xb5" "\0"
+    "\xd5\xb6" "\0"
+    "\xd5\xb7" "\0"
+    "\xd5\xb8" "\0"
+    "\xd5\xb9" "\0"
+    "\xd5\xba" "\0"
+    "\xd5\xbb" "\0"
+    "\xd5\xbc" "\0"
+    "\xd5\xbd" "\0"
+    "\xd5\xbe" "\0"
+    "\xd5\xbf" "\0"
+    "\xd6\x80" "\0"
+    "\xd6\x81" "\0"
+    "\xd6\x82" "\0"
+    "\xd6\x83" "\0"
+    "\xd6\x84" "\0"
+    "\xd6\x85" "\0"
+    "\xd6\x86" "\0"
+    "\xe1\xb8\x81" "\0"
+    "\xe1\xb8\x83" "\0"
+    "b" "\0"
+    "\xe1\xb8\x85" "\0"
+    "\xe1\xb8\x87" "\0"
+    "\xe1\xb8\x89" "\0"
+    "\xe1\xb8\x8b" "\0"
+    "\xe1\xb8\x8d" "\0"
+    "\xe1\xb8\x8f" "\0"
+    "\xe1\xb8\x91" "\0"
+    "\xe1\xb8\x93" "\0"
+    "\xe1\xb8\x95" "\0"
+    "\xe1\xb8\x97" "\0"
+    "\xe1\xb8\x99" "\0"
+    "\xe1\xb8\x9b" "\0"
+    "\xe1\xb8\x9d" "\0"
+    "\xe1\xb8\x9f" "\0"
+    "\xe1\xb8\xa1" "\0"
+    "\xe1\xb8\xa3" "\0"
+    "\xe1\xb8\xa5" "\0"
+    "\xe1\xb8\xa7" "\0"
+    "\xe1\xb8\xa9" "\0"
+    "\xe1\xb8\xab" "\0"
+    "\xe1\xb8\xad" "\0"
+    "\xe1\xb8\xaf" "\0"
+    "\xe1\xb8\xb1" "\0"
+    "\xe1\xb8\xb3" "\0"
+    "\xe1\xb8\xb5" "\0"
+    "\xe1\xb8\xb7" "\0"
+    "\xe1\xb8\xb9" "\0"
+    "\xe1\xb8\xbb" "\0"
+    "\xe1\xb8\xbd" "\0"
+    "\xe1\xb8\xbf" "\0"
+    "m" "\0"
+    "\xe1\xb9\x81" "\0"
+    "\xe1\xb9\x83" "\0"
+    "\xe1\xb9\x85" "\0"
+    "\xe1\xb9\x87" "\0"
+    "\xe1\xb9\x89" "\0"
+    "\xe1\xb9\x8b" "\0"
+    "\xe1\xb9\x8d" "\0"
+    "\xe1\xb9\x8f" "\0"
+    "\xe1\xb9\x91" "\0"
+    "\xe1\xb9\x93" "\0"
+    "\xe1\xb9\x95" "\0"
+    "p" "\0"
+    "\xe1\xb9\x97" "\0"
+    "\xe1\xb9\x99" "\0"
+    "\xe1\xb9\x9b" "\0"
+    "\xe1\xb9\x9d" "\0"
+    "\xe1\xb9\x9f" "\0"
+    "\xe1\xb9\xa1" "\0"
+    "\xe1\xb9\xa3" "\0"
+    "\xe1\xb9\xa5" "\0"
+    "\xe1\xb9\xa7" "\0"
+    "\xe1\xb9\xa9" "\0"
+    "\xe1\xb9\xab" "\0"
+    "\xe1\xb9\xad" "\0"
+    "\xe1\xb9\xaf" "\0"
+    "\xe1\xb9\xb1" "\0"
+    "\xe1\xb9\xb3" "\0"
+    "\xe1\xb9\xb5" "\0"
+    "\xe1\xb9\xb7" "\0"
+    "\xe1\xb9\xb9" "\0"
+    "\xe1\xb9\xbb" "\0"
+    "\xe1\xb9\xbd" "\0"
+    "v" "\0"
+    "\xe1\xb9\xbf" "\0"
+    "\xe1\xba\x81" "\0"
+    "\xe1\xba\x83" "\0"
+    "\xe1\xba\x85" "\0"
+    "\xe1\xba\x87" "\0"
+    "\xe1\xba\x89" "\0"
+    "\xe1\xba\x8b" "\0"
+    "\xe1\xba\x8d" "\0"
+    "\xe1\xba\x8f" "\0"
+    "\xe1\xba\x91" "\0"
+    "\xe1\xba\x93" "\0"
+    "\xe1\xba\x95" "\0"
+    "\xe1\xba\x96" "\0"
+    "\xe1\xba\x97" "\0"
+    "\xe1\xba\x98" "\0"
+    "\xe1\xba\x99" "\0"
+    "\xe1\xba\x9a" "\0"
+    "a\xca\xbe" "\0"
+    "\xe1\xba\x9b" "\0"
+    "\xe1\xba\xa1" "\0"
+    "\xe1\xba\xa3" "\0"
+    "\xe1\xba\xa5" "\0"
+    "\xe1\xba\xa7" "\0"
+    "\xe1\xba\xa9" "\0"
+    "\xe1\xba\xab" "\0"
+    "\xe1\xba\xad" "\0"
+    "\xe1\xba\xaf" "\0"
+    "\xe1\xba\xb1" "\0"
+    "\xe1\xba\xb3" "\0"
+    "\xe1\xba\xb5" "\0"
+    "\xe1\xba\xb7" "\0"
+    "\xe1\xba\xb9" "\0"
+    "\xe1\xba\xbb" "\0"
+    "\xe1\xba\xbd" "\0"
+    "\xe1\xba\xbf" "\0"
+    "\xe1\xbb\x81" "\0"
+    "\xe1\xbb\x83" "\0"
+    "\xe1\xbb\x85" "\0"
+    "\xe1\xbb\x87" "\0"
+    "\xe1\xbb\x89" "\0"
+    "\xe1\xbb\x8b" "\0"
+    "\xe1\xbb\x8d" "\0"
+    "\xe1\xbb\x8f" "\0"
+    "\xe1\xbb\x91" "\0"
+    "\xe1\xbb\x93" "\0"
+    "\xe1\xbb\x95" "\0"
+    "\xe1\xbb\x97" "\0"
+    "\xe1\xbb\x99" "\0"
+    "\xe1\xbb\x9b" "\0"
+    "\xe1\xbb\x9d" "\0"
+    "\xe1\xbb\x9f" "\0"
+    "\xe1\xbb\xa1" "\0"
+    "\xe1\xbb\xa3" "\0"
+    "\xe1\xbb\xa5" "\0"
+    "\xe1\xbb\xa7" "\0"
+    "\xe1\xbb\xa9" "\0"
+    "\xe1\xbb\xab" "\0"
+    "\xe1\xbb\xad" "\0"
+    "\xe1\xbb\xaf" "\0"
+    "\xe1\xbb\xb1" "\0"
+    "\xe1\xbb\xb3" "\0"
+    "\xe1\xbb\xb5" "\0"
+    "\xe1\xbb\xb7" "\0"
+    "\xe1\xbb\xb9" "\0"
+    "\xe1\xbb\xbb" "\0"
+    "\xe1\xbb\xbd" "\0"
+    "\xe1\xbb\xbf" "\0"
+    "\xe1\xbc\x80" "\0"
+    "\xe1\xbc\x81" "\0"
+    "\xe1\xbc\x82" "\0"
+    "\xe1\xbc\x83" "\0"
+    "\xe1\xbc\x84" "\0"
+    "\xe1\xbc\x85" "\0"
+    "\xe1\xbc\x86" "\0"
+    "\xe1\xbc\x87" "\0"
+    "\xe1\xbc\x90" "\0"
+    "\xe1\xbc\x91" "\0"
+    "\xe1\xbc\x92" "\0"
+    "\xe1\xbc\x93" "\0"
+    "\xe1\xbc\x94" "\0"
+    "\xe1\xbc\x95" "\0"
+    "\xe1\xbc\xa0" "\0"
+    "\xe1\xbc\xa1" "\0"
+    "\xe1\xbc\xa2" "\0"
+    "\xe1\xbc\xa3" "\0"
+    "\xe1\xbc\xa4" "\0"
+    "\xe1\xbc\xa5" "\0"
+    "\xe1\xbc\xa6" "\0"
+    "\xe1\xbc\xa7" "\0"
+    "\xe1\xbc\xb0" "\0"
+    "\xe1\xbc\xb1" "\0"
+    "\xe1\xbc\xb2" "\0"
+    "\xe1\xbc\xb3" "\0"
+    "\xe1\xbc\xb4" "\0"
+    "\xe1\xbc\xb5" "\0"
+    "\xe1\xbc\xb6" "\0"
+    "\xe1\xbc\xb7" "\0"
+    "\xe1\xbd\x80" "\0"
+    "\xe1\xbd\x81" "\0"
+    "\xe1\xbd\x82" "\0"
+    "\xe1\xbd\x83" "\0"
+    "\xe1\xbd\x84" "\0"
+    "\xe1\xbd\x85" "\0"
+    "\xe1\xbd\x90" "\0"
+    "\xe1\xbd\x91" "\0"
+    "\xe1\xbd\x92" "\0"
+    "\xe1\xbd\x93" "\0"
+    "\xe1\xbd\x94" "\0"
+    "\xe1\xbd\x95" "\0"
+    "\xe1\xbd\x96" "\0"
+    "\xe1\xbd\x97" "\0"
+    "\xe1\xbd\xa0" "\0"
+    "\xe1\xbd\xa1" "\0"
+    "\xe1\xbd\xa2" "\0"
+    "\xe1\xbd\xa3" "\0"
+    "\xe1\xbd\xa4" "\0"
+    "\xe1\xbd\xa5" "\0"
+    "\xe1\xbd\xa6" "\0"
+    "\xe1\xbd\xa7" "\0"
+    "\xe1\xbd\xb0" "\0"
+    "\xe1\xbd\xb2" "\0"
+    "\xe1\xbd\xb4" "\0"
+    "\xe1\xbd\xb6" "\0"
+    "\xe1\xbd\xb8" "\0"
+    "\xe1\xbd\xba" "\0"
+    "\xe1\xbd\xbc" "\0"
+    "\xe1\xbe\x80" "\0"
+    "\xe1\xbe\x81" "\0"
+    "\xe1\xbe\x82" "\0"
+    "\xe1\xbe\x83" "\0"
+    "\xe1\xbe\x84" "\0"
+    "\xe1\xbe\x85" "\0"
+    "\xe1\xbe\x86" "\0"
+    "\xe1\xbe\x87" "\0"
+    "\xe1\xbe\x90" "\0"
+    "\xe1\xbe\x91" "\0"
+    "\xe1\xbe\x92" "\0"
+    "\xe1\xbe\x93" "\0"
+    "\xe1\xbe\x94" "\0"
+    "\xe1\xbe\x95" "\0"
+    "\xe1\xbe\x96" "\0"
+    "\xe1\xbe\x97" "\0"
+    "\xe1\xbe\xa0" "\0"
+    "\xe1\xbe\xa1" "\0"
+    "\xe1\xbe\xa2" "\0"
+    "\xe1\xbe\xa3" "\0"
+    "\xe1\xbe\xa4" "\0"
+    "\xe1\xbe\xa5" "\0"
+    "\xe1\xbe\xa6" "\0"
+    "\xe1\xbe\xa7" "\0"
+    "\xe1\xbe\xb0" "\0"
+    "\xe1\xbe\xb1" "\0"
+    "\xe1\xbe\xb2" "\0"
+    "\xe1\xbe\xb3" "\0"
+    "\xe1\xbe\xb4" "\0"
+    "\xe1\xbe\xb6" "\0"
+    "\xe1\xbe\xb7" "\0"
+    "\xe1\xbe\xbd" "\0"
+    "\xe1\xbe\xbf" "\0"
+    "\xe1\xbf\x80" "\0"
+    "\xe1\xbf\x81" "\0"
+    "\xe1\xbf\x82" "\0"
+    "\xe1\xbf\x83" "\0"
+    "\xe1\xbf\x84" "\0"
+    "\xe1\xbf\x86" "\0"
+    "\xe1\xbf\x87" "\0"
+    "\xe1\xbf\x8d" "\0"
+    "\xe1\xbf\x8e" "\0"
+    "\xe1\xbf\x8f" "\0"
+    "\xe1\xbf\x90" "\0"
+    "\xe1\xbf\x91" "\0"
+    "\xe1\xbf\x92" "\0"
+    "\xe1\xbf\x96" "\0"
+    "\xe1\xbf\x97" "\0"
+    "\xe1\xbf\x9d" "\0"
+    "\xe1\xbf\x9e" "\0"
+    "\xe1\xbf\x9f" "\0"
+    "\xe1\xbf\xa0" "\0"
+    "\xe1\xbf\xa1" "\0"
+    "\xe1\xbf\xa2" "\0"
+    "\xe1\xbf\xa4" "\0"
+    "\xe1\xbf\xa5" "\0"
+    "\xe1\xbf\xa6" "\0"
+    "\xe1\xbf\xa7" "\0"
+    "\xe1\xbf\xad" "\0"
+    "`" "\0"
+    "\xe1\xbf\xb2" "\0"
+    "\xe1\xbf\xb3" "\0"
+    "\xe1\xbf\xb4" "\0"
+    "\xe1\xbf\xb6" "\0"
+    "\xe1\xbf\xb7" "\0"
+    "\xe1\xbf\xbe" "\0"
+    "\xe2\x80\x82" "\0"
+    "\xe2\x80\x83" "\0"
+    "\xe2\x80\x84" "\0"
+    "\xe2\x80\x85" "\0"
+    "\xe2\x80\x86" "\0"
+    "\xe2\x80\x87" "\0"
+    "\xe2\x80\x88" "\0"
+    "\xe2\x80\x89" "\0"
+    "\xe2\x80\x8a" "\0"
+    "\xe2\x80\x8b" "\0"
+    "\xe2\x80\x8c" "\0"
+    "\xe2\x80\x8d" "\0"
+    "\xe2\x80\x8e" "\0"
+    "\xe2\x80\x8f" "\0"
+    "\xe2\x80\x90" "\0"
+    "-" "\0"
+    "\xe2\x80\x91" "\0"
+    "\xe2\x80\x92" "\0"
+    "\xe2\x80\x93" "\0"
+    "\xe2\x80\x94" "\0"
+    "\xe2\x80\x95" "\0"
+    "\xe2\x80\x97" "\0"
+    "\xe2\x80\x98" "\0"
+    "\xe2\x80\x99" "\0"
+    "\xe2\x80\x9a" "\0"
+    "\xe2\x80\x9b" "\0"
+    "\xe2\x80\x9c" "\0"
+    "\xe2\x80\x9d" "\0"
+    "\xe2\x80\x9e" "\0"
+    "\xe2\x80\x9f" "\0"
+    "\xe2\x80\xa4" "\0"
+    "." "\0"
+    "\xe2\x80\xa5" "\0"
+    ".." "\0"
+    "\xe2\x80\xa6" "\0"
+    "..." "\0"
+    "\xe2\x80\xaf" "\0"
+    "\xe2\x80\xb3" "\0"
+    "\xe2\x80\xb2\xe2\x80\xb2" "\0"
+    "\xe2\x80\xb4" "\0"
+    "\xe2\x80\xb2\xe2\x80\xb2\xe2\x80\xb2" "\0"
+    "\xe2\x80\xb6" "\0"
+    "\xe2\x80\xb5\xe2\x80\xb5" "\0"
+    "\xe2\x80\xb7" "\0"
+    "\xe2\x80\xb5\xe2\x80\xb5\xe2\x80\xb5" "\0"
+    "\xe2\x80\xb9" "\0"
+    "\xe2\x80\xba" "\0"
+    "\xe2\x80\xbc" "\0"
+    "!!" "\0"
+    "\xe2\x80\xbe" "\0"
+    "\xe2\x81\x87" "\0"
+    "??" "\0"
+    "\xe2\x81\x88" "\0"
+    "?!" "\0"
+    "\xe2\x81\x89" "\0"
+    "!?" "\0"
+    "\xe2\x81\x97" "\0"
+    "\xe2\x80\xb2\xe2\x80\xb2\xe2\x80\xb2\xe2\x80\xb2" "\0"
+    "\xe2\x81\x9f" "\0"
+    "\xe2\x81\xa0" "\0"
+    "\xe2\x81\xa1" "\0"
+    "\xe2\x81\xa2" "\0"
+    "\xe2\x81\xa3" "\0"
+    "\xe2\x81\xa4" "\0"
+    ;
+
+static const Utf8FoldEntry FOLD_ENTRIES[] = {
+    {0x00A0, 0, 3},
+    {0x00A8, 5, 3},
+    {0x00AA, 8, 11},
+    {0x00AB, 13, 16},
+    {0x00AD, 17, 16},
+    {0x00AF, 20, 3},
+    {0x00B2, 23, 26},
+    {0x00B3, 28, 31},
+    {0x00B4, 33, 36},
+    {0x00B5, 38, 41},
+    {0x00B8, 44, 3},
+    {0x00B9, 47, 50},
+    {0x00BA, 52, 55},
+    {0x00BB, 57, 16},
+    {0x00BC, 60, 63},
+    {0x00BD, 69, 72},
+    {0x00BE, 78, 81},
+    {0x00C0, 87, 11},
+    {0x00C1, 90, 11},
+    {0x00C2, 93, 11},
+    {0x00C3, 96, 11},
+    {0x00C4, 99, 11},
+    {0x00C5, 102, 11},
+    {0x00C6, 105, 108},
+    {0x00C7, 111, 114},
+    {0x00C8, 116, 119},
+    {0x00C9, 121, 119},
+    {0x00CA, 124, 119},
+    {0x00CB, 127, 119},
+    {0x00CC, 130, 133},
+    {0x00CD, 135, 133},
+    {0x00CE, 138, 133},
+    {0x00CF, 141, 133},
+    {0x00D0, 144, 147},
+    {0x00D1, 149, 152},
+    {0x00D2, 154, 55},
+    {0x00D3, 157, 55},
+    {0x00D4, 160, 55},
+    {0x00D5, 163, 55},
+    {0x00D6, 166, 55},
+    {0x00D8, 169, 55},
+    {0x00D9, 172, 175},
+    {0x00DA, 177, 175},
+    {0x00DB, 180, 175},
+    {0x00DC, 183, 175},
+    {0x00DD, 186, 189},
+    {0x00DE, 191, 194},
+    {0x00DF, 197, 200},
+    {0x00E0, 87, 11},
+    {0x00E1, 90, 11},
+    {0x00E2, 93, 11},
+    {0x00E3, 96, 11},
+    {0x00E4, 99, 11},
+    {0x00E5, 102, 11},
+    {0x00E6, 105, 108},
+    {0x00E7, 111, 114},
+    {0x00E8, 116, 119},
+    {0x00E9, 121, 119},
+    {0x00EA, 124, 119},
+    {0x00EB, 127, 119},
+    {0x00EC, 130, 133},
+    {0x00ED, 135, 133},
+    {0x00EE, 138, 133},
+    {0x00EF, 141, 133},
+    {0x00F0, 144, 147},
+    {0x00F1, 149, 152},
+    {0x00F2, 154, 55},
+    {0x00F3, 157, 55},
+    {0x00F4, 160, 55},
+    {0x00F5, 163, 55},
+    {0x00F6, 166, 55},
+    {0x00F8, 169, 55},
+    {0x00F9, 172, 175},
+    {0x00FA, 177, 175},
+    {0x00FB, 180, 175},
+    {0x00FC, 183, 175},
+    {0x00FD, 186, 189},
+    {0x00FE, 191, 194},
+    {0x00FF, 203, 189},
+    {0x0100, 206, 11},
+    {0x0101, 206, 11},
+    {0x0102, 209, 11},
+    {0x0103, 209, 11},
+    {0x0104, 212, 11},
+    {0x0105, 212, 11},
+    {0x0106, 215, 114},
+    {0x0107, 215, 114},
+    {0x0108, 218, 114},
+    {0x0109, 218, 114},
+    {0x010A, 221, 114},
+    {0x010B, 221, 114},
+    {0x010C, 224, 114},
+    {0x010D, 224, 114},
+    {0x010E, 227, 147},
+    {0x010F, 227, 147},
+    {0x0110, 230, 147},
+    {0x0111, 230, 147},
+    {0x0112, 233, 119},
+    {0x0113, 233, 119},
+    {0x0114, 236, 119},
+    {0x0115, 236, 119},
+    {0x0116, 239, 119},
+    {0x0117, 239, 119},
+    {0x0118, 242, 119},
+    {0x0119, 242, 119},
+    {0x011A, 245, 119},
+    {0x011B, 245, 119},
+    {0x011C, 248, 251},
+    {0x011D, 248, 251},
+    {0x011E, 253, 251},
+    {0x011F, 253, 251},
+    {0x0120, 256, 251},
+    {0x0121, 256, 251},
+    {0x0122, 259, 251},
+    {0x0123, 259, 251},
+    {0x0124, 262, 265},
+    {0x0125, 262, 265},
+    {0x0126, 267, 265},
+    {0x0127, 267, 265},
+    {0x0128, 270, 133},
+    {0x0129, 270, 133},
+    {0x012A, 273, 133},
+    {0x012B, 273, 133},
+    {0x012C, 276, 133},
+    {0x012D, 276, 133},
+    {0x012E, 279, 133},
+    {0x012F, 279, 133},
+    {0x0130, 282, 133},
+    {0x0131, 286, 133},
+    {0x0132, 289, 292},
+    {0x0133, 289, 292},
+    {0x0134, 295, 298},
+    {0x0135, 295, 298},
+    {0x0136, 300, 303},
+    {0x0137, 300, 303},
+    {0x0138, 305, 303},
+    {0x0139, 308, 311},
+    {0x013A, 308, 311},
+    {0x013B, 313, 311},
+    {0x013C, 313, 311},
+    {0x013D, 316, 311},
+    {0x013E, 316, 311},
+    {0x013F, 319, 322},
+    {0x0140, 319, 322},
+    {0x0141, 326, 311},
+    {0x0142, 326, 311},
+    {0x0143, 329, 152},
+    {0x0144, 329, 152},
+    {0x0145, 332, 152},
+    {0x0146, 332, 152},
+    {0x0147, 335, 152},
+    {0x0148, 335, 152},
+    {0x0149, 338, 341},
+    {0x014A, 345, 152},
+    {0x014B, 345, 152},
+    {0x014C, 348, 55},
+    {0x014D, 348, 55},
+    {0x014E, 351, 55},
+    {0x014F, 351, 55},
+    {0x0150, 354, 55},
+    {0x0151, 354, 55},
+    {0x0152, 357, 360},
+    {0x0153, 357, 360},
+    {0x0154, 363, 366},
+    {0x0155, 363, 366},
+    {0x0156, 368, 366},
+    {0x0157, 368, 366},
+    {0x0158, 371, 366},
+    {0x0159, 371, 366},
+    {0x015A, 374, 377},
+    {0x015B, 374, 377},
+    {0x015C, 379, 377},
+    {0x015D, 379, 377},
+    {0x015E, 382, 377},
+    {0x015F, 382, 377},
+    {0x0160, 385, 377},
+    {0x0161, 385, 377},
+    {0x0162, 388, 391},
+    {0x0163, 388, 391},
+    {0x0164, 393, 391},
+    {0x0165, 393, 391},
+    {0x0166, 396, 391},
+    {0x0167, 396, 391},
+    {0x0168, 399, 175},
+    {0x0169, 399, 175},
+    {0x016A, 402, 175},
+    {0x016B, 402, 175},
+    {0x016C, 405, 175},
+    {0x016D, 405, 175},
+    {0x016E, 408, 175},
+    {0x016F, 408, 175},
+    {0x0170, 411, 175},
+    {0x0171, 411, 175},
+    {0x0172, 414, 175},
+    {0x0173, 414, 175},
+    {0x0174, 417, 420},
+    {0x0175, 417, 420},
+    {0x0176, 422, 189},
+    {0x0177, 422, 189},
+    {0x0178, 203, 189},
+    {0x0179, 425, 428},
+    {0x017A, 425, 428},
+    {0x017B, 430, 428},
+    {0x017C, 430, 428},
+    {0x017D, 433, 428},
+    {0x017E, 433, 428},
+    {0x017F, 436, 377},
+    {0x0181, 439, 439},
+    {0x0182, 442, 442},
+    {0x0184, 445, 445},
+    {0x0186, 448, 448},
+    {0x0187, 451, 451},
+    {0x0189, 454, 454},
+    {0x018A, 457, 457},
+    {0x018B, 460, 460},
+    {0x018E, 463, 119},
+    {0x018F, 466, 119},
+    {0x0190, 469, 469},
+    {0x0191, 472, 475},
+    {0x0192, 472, 475},
+    {0x0193, 477, 477},
+    {0x0194, 480, 480},
+    {0x0196, 483, 483},
+    {0x0197, 486, 133},
+    {0x0198, 489, 489},
+    {0x019C, 492, 492},
+    {0x019D, 495, 495},
+    {0x019F, 498, 498},
+    {0x01A0, 501, 55},
+    {0x01A1, 501, 55},
+    {0x01A2, 504, 504},
+    {0x01A4, 507, 507},
+    {0x01A6, 510, 510},
+    {0x01A7, 513, 513},
+    {0x01A9, 516, 516},
+    {0x01AC, 519, 519},
+    {0x01AE, 522, 522},
+    {0x01AF, 525, 175},
+    {0x01B0, 525, 175},
+    {0x01B1, 528, 528},
+    {0x01B2, 531, 531},
+    {0x01B3, 534, 534},
+    {0x01B5, 537, 537},
+    {0x01B7, 540, 540},
+    {0x01B8, 543, 543},
+    {0x01BC, 546, 546},
+    {0x01C4, 549, 552},
+    {0x01C5, 549, 552},
+    {0x01C6, 549, 552},
+    {0x01C7, 555, 558},
+    {0x01C8, 555, 558},
+    {0x01C9, 555, 558},
+    {0x01CA, 561, 564},
+    {0x01CB, 561, 564},
+    {0x01CC, 561, 564},
+    {0x01CD, 567, 11},
+    {0x01CE, 567, 11},
+    {0x01CF, 570, 133},
+    {0x01D0, 570, 133},
+    {0x01D1, 573, 55},
+    {0x01D2, 573, 55},
+    {0x01D3, 576, 175},
+    {0x01D4, 576, 175},
+    {0x01D5, 579, 175},
+    {0x01D6, 579, 175},
+    {0x01D7, 582, 175},
+    {0x01D8, 582, 175},
+    {0x01D9, 585, 175},
+    {0x01DA, 585, 175},
+    {0x01DB, 588, 175},
+    {0x01DC, 588, 175},
+    {0x01DD, 463, 119},
+    {0x01DE, 591, 11},
+    {0x01DF, 591, 11},
+    {0x01E0, 594, 11},
+    {0x01E1, 594, 11},
+    {0x01E2, 597, 108},
+    {0x01E3, 597, 108},
+    {0x01E4, 600, 600},
+    {0x01E6, 603, 251},
+    {0x01E7, 603, 251},
+    {0x01E8, 606, 303},
+    {0x01E9, 606, 303},
+    {0x01EA, 609, 55},
+    {0x01EB, 609, 55},
+    {0x01EC, 612, 55},
+    {0x01ED, 612, 55},
+    {0x01EE, 615, 540},
+    {0x01EF, 615, 540},
+    {0x01F0, 618, 298},
+    {0x01F1, 621, 552},
+    {0x01F2, 621, 552},
+    {0x01F3, 621, 552},
+    {0x01F4, 624, 251},
+    {0x01F5, 624, 251},
+    {0x01F6, 627, 627},
+    {0x01F7, 630, 630},
+    {0x01F8, 633, 152},
+    {0x01F9, 633, 152},
+    {0x01FA, 636, 11},
+    {0x01FB, 636, 11},
+    {0x01FC, 639, 108},
+    {0x01FD, 639, 108},
+    {0x01FE, 642, 55},
+    {0x01FF, 642, 55},
+    {0x0200, 645, 11},
+    {0x0201, 645, 11},
+    {0x0202, 648, 11},
+    {0x0203, 648, 11},
+    {0x0204, 651, 119},
+    {0x0205, 651, 119},
+    {0x0206, 654, 119},
+    {0x0207, 654, 119},
+    {0x0208, 657, 133},
+    {0x0209, 657, 133},
+    {0x020A, 660, 133},
+    {0x020B, 660, 133},
+    {0x020C, 663, 55},
+    {0x020D, 663, 55},
+    {0x020E, 666, 55},
+    {0x020F, 666, 55},
+    {0x0210, 669, 366},
+    {0x0211, 669, 366},
+    {0x0212, 672, 366},
+    {0x0213, 672, 366},
+    {0x0214, 675, 175},
+    {0x0215, 675, 175},
+    {0x0216, 678, 175},
+    {0x0217, 678, 175},
+    {0x0218, 681, 377},
+    {0x0219, 681, 377},
+    {0x021A, 684, 391},
+    {0x021B, 684, 391},
+    {0x021C, 687, 687},
+    {0x021E, 690, 265},
+    {0x021F, 690, 265},
+    {0x0220, 693, 693},
+    {0x0222, 696, 696},
+    {0x0224, 699, 699},
+    {0x0226, 702, 11},
+    {0x0227, 702, 11},
+    {0x0228, 705, 119},
+    {0x0229, 705, 119},
+    {0x022A, 708, 55},
+    {0x022B, 708, 55},
+    {0x022C, 711, 55},
+    {0x022D, 711, 55},
+    {0x022E, 714, 55},
+    {0x022F, 714, 55},
+    {0x0230, 717, 55},
+    {0x0231, 717, 55},
+    {0x0232, 720, 189},
+    {0x0233, 720, 189},
+    {0x023A, 723, 723},
+    {0x023B, 727, 727},
+    {0x023D, 730, 730},
+    {0x023E, 733, 733},
+    {0x0241, 737, 737},
+    {0x0243, 740, 740},
+    {0x0244, 743, 175},
+    {0x0245, 746, 746},
+    {0x0246, 749, 749},
+    {0x0248, 752, 752},
+    {0x024A, 755, 755},
+    {0x024C, 758, 758},
+    {0x024E, 761, 761},
+    {0x0259, 466, 119},
+    {0x0268, 486, 133},
+    {0x0289, 743, 175},
+    {0x02B0, 764, 265},
+    {0x02B1, 767, 770},
+    {0x02B2, 773, 298},
+    {0x02B3, 776, 366},
+    {0x02B4, 779, 782},
+    {0x02B5, 785, 788},
+    {0x02B6, 791, 794},
+    {0x02B7, 797, 420},
+    {0x02B8, 800, 189},
+    {0x02B9, 803, 36},
+    {0x02BB, 806, 36},
+    {0x02BC, 809, 36},
+    {0x02D8, 812, 3},
+    {0x02D9, 815, 3},
+    {0x02DA, 818, 3},
+    {0x02DB, 821, 3},
+    {0x02DC, 824, 3},
+    {0x02DD, 827, 3},
+    {0x02E0, 830, 480},
+    {0x02E1, 833, 311},
+    {0x02E2, 836, 377},
+    {0x02E3, 839, 842},
+    {0x02E4, 844, 847},
+    {0x0300, 850, 16},
+    {0x0301, 853, 16},
+    {0x0302, 856, 16},
+    {0x0303, 859, 16},
+    {0x0304, 862, 16},
+    {0x0305, 865, 16},
+    {0x0306, 868, 16},
+    {0x0307, 871, 16},
+    {0x0308, 874, 16},
+    {0x0309, 877, 16},
+    {0x030A, 880, 16},
+    {0x030B, 883, 16},
+    {0x030C, 886, 16},
+    {0x030D, 889, 16},
+    {0x030E, 892, 16},
+    {0x030F, 895, 16},
+    {0x0310, 898, 16},
+    {0x0311, 901, 16},
+    {0x0312, 904, 16},
+    {0x0313, 907, 16},
+    {0x0314, 910, 16},
+    {0x0315, 913, 16},
+    {0x0316, 916, 16},
+    {0x0317, 919, 16},
+    {0x0318, 922, 16},
+    {0x0319, 925, 16},
+    {0x031A, 928, 16},
+    {0x031B, 931, 16},
+    {0x031C, 934, 16},
+    {0x031D, 937, 16},
+    {0x031E, 940, 16},
+    {0x031F, 943, 16},
+    {0x0320, 946, 16},
+    {0x0321, 949, 16},
+    {0x0322, 952, 16},
+    {0x0323, 955, 16},
+    {0x0324, 958, 16},
+    {0x0325, 961, 16},
+    {0x0326, 964, 16},
+    {0x0327, 967, 16},
+    {0x0328, 970, 16},
+    {0x0329, 973, 16},
+    {0x032A, 976, 16},
+    {0x032B, 979, 16},
+    {0x032C, 982, 16},
+    {0x032D, 985, 16},
+    {0x032E, 988, 16},
+    {0x032F, 991, 16},
+    {0x0330, 994, 16},
+    {0x0331, 997, 16},
+    {0x0332, 1000, 16},
+    {0x0333, 1003, 16},
+    {0x0334, 1006, 16},
+    {0x0335, 1009, 16},
+    {0x0336, 1012, 16},
+    {0x0337, 1015, 16},
+    {0x0338, 1018, 16},
+    {0x0339, 1021, 16},
+    {0x033A, 1024, 16},
+    {0x033B, 1027, 16},
+    {0x033C, 1030, 16},
+    {0x033D, 1033, 16},
+    {0x033E, 1036, 16},
+    {0x033F, 1039, 16},
+    {0x0340, 850, 16},
+    {0x0341, 853, 16},
+    {0x0342, 1042, 16},
+    {0x0343, 907, 16},
+    {0x0344, 1045, 16},
+    {0x0345, 1050, 16},
+    {0x0346, 1053, 16},
+    {0x0347, 1056, 16},
+    {0x0348, 1059, 16},
+    {0x0349, 1062, 16},
+    {0x034A, 1065, 16},
+    {0x034B, 1068, 16},
+    {0x034C, 1071, 16},
+    {0x034D, 1074, 16},
+    {0x034E, 1077, 16},
+    {0x034F, 1080, 16},
+    {0x0350, 1083, 16},
+    {0x0351, 1086, 16},
+    {0x0352, 1089, 16},
+    {0x0353, 1092, 16},
+    {0x0354, 1095, 16},
+    {0x0355, 1098, 16},
+    {0x0356, 1101, 16},
+    {0x0357, 1104, 16},
+    {0x0358, 1107, 16},
+    {0x0359, 1110, 16},
+    {0x035A, 1113, 16},
+    {0x035B, 1116, 16},
+    {0x035C, 1119, 16},
+    {0x035D, 1122, 16},
+    {0x035E, 1125, 16},
+    {0x035F, 1128, 16},
+    {0x0360, 1131, 16},
+    {0x0361, 1134, 16},
+    {0x0362, 1137, 16},
+    {0x0363, 1140, 16},
+    {0x0364, 1143, 16},
+    {0x0365, 1146, 16},
+    {0x0366, 1149, 16},
+    {0x0367, 1152, 16},
+    {0x0368, 1155, 16},
+    {0x0369, 1158, 16},
+    {0x036A, 1161, 16},
+    {0x036B, 1164, 16},
+    {0x036C, 1167, 16},
+    {0x036D, 1170, 16},
+    {0x036E, 1173, 16},
+    {0x036F, 1176, 16},
+    {0x0370, 1179, 1179},
+    {0x0372, 1182, 1182},
+    {0x0374, 803, 803},
+    {0x0376, 1185, 1185},
+    {0x037A, 1188, 3},
+    {0x037E, 1191, 1191},
+    {0x037F, 1193, 1193},
+    {0x0384, 1196, 3},
+    {0x0385, 1199, 3},
+    {0x0386, 1202, 1205},
+    {0x0387, 1208, 1208},
+    {0x0388, 1211, 1214},
+    {0x0389, 1217, 1220},
+    {0x038A, 1223, 1226},
+    {0x038C, 1229, 1232},
+    {0x038E, 1235, 1238},
+    {0x038F, 1241, 1244},
+    {0x0390, 1247, 1226},
+    {0x0391, 1205, 1205},
+    {0x0392, 1250, 1250},
+    {0x0393, 1253, 1253},
+    {0x0394, 1256, 1256},
+    {0x0395, 1214, 1214},
+    {0x0396, 1259, 1259},
+    {0x0397, 1220, 1220},
+    {0x0398, 1262, 1262},
+    {0x0399, 1226, 1226},
+    {0x039A, 1265, 1265},
+    {0x039B, 1268, 1268},
+    {0x039C, 41, 41},
+    {0x039D, 1271, 1271},
+    {0x039E, 1274, 1274},
+    {0x039F, 1232, 1232},
+    {0x03A0, 1277, 1277},
+    {0x03A1, 1280, 1280},
+    {0x03A3, 1283, 1283},
+    {0x03A4, 1286, 1286},
+    {0x03A5, 1238, 1238},
+    {0x03A6, 1289, 1289},
+    {0x03A7, 1292, 1292},
+    {0x03A8, 1295, 1295},
+    {0x03A9, 1244, 1244},
+    {0x03AA, 1298, 1226},
+    {0x03AB, 1301, 1238},
+    {0x03AC, 1202, 1205},
+    {0x03AD, 1211, 1214},
+    {0x03AE, 1217, 1220},
+    {0x03AF, 1223, 1226},
+    {0x03B0, 1304, 1238},
+    {0x03C2, 1307, 1283},
+    {0x03CA, 1298, 1226},
+    {0x03CB, 1301, 1238},
+    {0x03CC, 1229, 1232},
+    {0x03CD, 1235, 1238},
+    {0x03CE, 1241, 1244},
+    {0x03CF, 1310, 1310},
+    {0x03D0, 1313, 1250},
+    {0x03D1, 1316, 1262},
+    {0x03D2, 1319, 1322},
+    {0x03D3, 1325, 1322},
+    {0x03D4, 1328, 1322},
+    {0x03D5, 1331, 1289},
+    {0x03D6, 1334, 1277},
+    {0x03D8, 1337, 1337},
+    {0x03DA, 1340, 1340},
+    {0x03DC, 1343, 1343},
+    {0x03DE, 1346, 1346},
+    {0x03E0, 1349, 1349},
+    {0x03E2, 1352, 1352},
+    {0x03E4, 1355, 1355},
+    {0x03E6, 1358, 1358},
+    {0x03E8, 1361, 1361},
+    {0x03EA, 1364, 1364},
+    {0x03EC, 1367, 1367},
+    {0x03EE, 1370, 1370},
+    {0x03F0, 1373, 1265},
+    {0x03F1, 1376, 1280},
+    {0x03F2, 1379, 1283},
+    {0x03F4, 1262, 1262},
+    {0x03F5, 1382, 1214},
+    {0x03F7, 1385, 1385},
+    {0x03F9, 1379, 1283},
+    {0x03FA, 1388, 1388},
+    {0x03FD, 1391, 1391},
+    {0x03FE, 1394, 1394},
+    {0x03FF, 1397, 1397},
+    {0x0400, 1400, 1400},
+    {0x0401, 1403, 1406},
+    {0x0402, 1409, 1409},
+    {0x0403, 1412, 1412},
+    {0x0404, 1415, 1415},
+    {0x0405, 1418, 1418},
+    {0x0406, 1421, 1421},
+    {0x0407, 1424, 1424},
+    {0x0408, 1427, 1427},
+    {0x0409, 1430, 1430},
+    {0x040A, 1433, 1433},
+    {0x040B, 1436, 1436},
+    {0x040C, 1439, 1439},
+    {0x040D, 1442, 1442},
+    {0x040E, 1445, 1445},
+    {0x040F, 1448, 1448},
+    {0x0410, 1451, 1451},
+    {0x0411, 1454, 1454},
+    {0x0412, 1457, 1457},
+    {0x0413, 1460, 1460},
+    {0x0414, 1463, 1463},
+    {0x0415, 1406, 1406},
+    {0x0416, 1466, 1466},
+    {0x0417, 1469, 1469},
+    {0x0418, 1472, 1472},
+    {0x0419, 1475, 1475},
+    {0x041A, 1478, 1478},
+    {0x041B, 1481, 1481},
+    {0x041C, 1484, 1484},
+    {0x041D, 1487, 1487},
+    {0x041E, 1490, 1490},
+    {0x041F, 1493, 1493},
+    {0x0420, 1496, 1496},
+    {0x0421, 1499, 1499},
+    {0x0422, 1502, 1502},
+    {0x0423, 1505, 1505},
+    {0x0424, 1508, 1508},
+    {0x0425, 1511, 1511},
+    {0x0426, 1514, 1514},
+    {0x0427, 1517, 1517},
+    {0x0428, 1520, 1520},
+    {0x0429, 1523, 1523},
+    {0x042A, 1526, 1526},
+    {0x042B, 1529, 1529},
+    {0x042C, 1532, 1532},
+    {0x042D, 1535, 1535},
+    {0x042E, 1538, 1538},
+    {0x042F, 1541, 1541},
+    {0x0451, 1403, 1406},
+    {0x0460, 1544, 1544},
+    {0x0462, 1547, 1547},
+    {0x0464, 1550, 1550},
+    {0x0466, 1553, 1553},
+    {0x0468, 1556, 1556},
+    {0x046A, 1559, 1559},
+    {0x046C, 1562, 1562},
+    {0x046E, 1565, 1565},
+    {0x0470, 1568, 1568},
+    {0x0472, 1571, 1571},
+    {0x0474, 1574, 1574},
+    {0x0476, 1577, 1577},
+    {0x0478, 1580, 1580},
+    {0x047A, 1583, 1583},
+    {0x047C, 1586, 1586},
+    {0x047E, 1589, 1589},
+    {0x0480, 1592, 1592},
+    {0x048A, 1595, 1595},
+    {0x048C, 1598, 1598},
+    {0x048E, 1601, 1601},
+    {0x0490, 1604, 1604},
+    {0x0492, 1607, 1607},
+    {0x0494, 1610, 1610},
+    {0x0496, 1613, 1613},
+    {0x0498, 1616, 1616},
+    {0x049A, 1619, 1619},
+    {0x049C, 1622, 1622},
+    {0x049E, 1625, 1625},
+    {0x04A0, 1628, 1628},
+    {0x04A2, 1631, 1631},
+    {0x04A4, 1634, 1634},
+    {0x04A6, 1637, 1637},
+    {0x04A8, 1640, 1640},
+    {0x04AA, 1643, 1643},
+    {0x04AC, 1646, 1646},
+    {0x04AE, 1649, 1649},
+    {0x04B0, 1652, 1652},
+    {0x04B2, 1655, 1655},
+    {0x04B4, 1658, 1658},
+    {0x04B6, 1661, 1661},
+    {0x04B8, 1664, 1664},
+    {0x04BA, 1667, 1667},
+    {0x04BC, 1670, 1670},
+    {0x04BE, 1673, 1673},
+    {0x04C0, 1676, 1676},
+    {0x04C1, 1679, 1679},
+    {0x04C3, 1682, 1682},
+    {0x04C5, 1685, 1685},
+    {0x04C7, 1688, 1688},
+    {0x04C9, 1691, 1691},
+    {0x04CB, 1694, 1694},
+    {0x04CD, 1697, 1697},
+    {0x04D0, 1700, 1700},
+    {0x04D2, 1703, 1703},
+    {0x04D4, 1706, 1706},
+    {0x04D6, 1709, 1709},
+    {0x04D8, 1712, 1712},
+    {0x04DA, 1715, 1715},
+    {0x04DC, 1718, 1718},
+    {0x04DE, 1721, 1721},
+    {0x04E0, 1724, 1724},
+    {0x04E2, 1727, 1727},
+    {0x04E4, 1730, 1730},
+    {0x04E6, 1733, 1733},
+    {0x04E8, 1736, 1736},
+    {0x04EA, 1739, 1739},
+    {0x04EC, 1742, 1742},
+    {0x04EE, 1745, 1745},
+    {0x04F0, 1748, 1748},
+    {0x04F2, 1751, 1751},
+    {0x04F4, 1754, 1754},
+    {0x04F6, 1757, 1757},
+    {0x04F8, 1760, 1760},
+    {0x04FA, 1763, 1763},
+    {0x04FC, 1766, 1766},
+    {0x04FE, 1769, 1769},
+    {0x0500, 1772, 1772},
+    {0x0502, 1775, 1775},
+    {0x0504, 1778, 1778},
+    {0x0506, 1781, 1781},
+    {0x0508, 1784, 1784},
+    {0x050A, 1787, 1787},
+    {0x050C, 1790, 1790},
+    {0x050E, 1793, 1793},
+    {0x0510, 1796, 1796},
+    {0x0512, 1799, 1799},
+    {0x0514, 1802, 1802},
+    {0x0516, 1805, 1805},
+    {0x0518, 1808, 1808},
+    {0x051A, 1811, 1811},
+    {0x051C, 1814, 1814},
+    {0x051E, 1817, 1817},
+    {0x0520, 1820, 1820},
+    {0x0522, 1823, 1823},
+    {0x0524, 1826, 1826},
+    {0x0526, 1829, 1829},
+    {0x0528, 1832, 1832},
+    {0x052A, 1835, 1835},
+    {0x052C, 1838, 1838},
+    {0x052E, 1841, 1841},
+    {0x0531, 1844, 1844},
+    {0x0532, 1847, 1847},
+    {0x0533, 1850, 1850},
+    {0x0534, 1853, 1853},
+    {0x0535, 1856, 1856},
+    {0x0536, 1859, 1859},
+    {0x0537, 1862, 1862},
+    {0x0538, 1865, 1865},
+    {0x0539, 1868, 1868},
+    {0x053A, 1871, 1871},
+    {0x053B, 1874, 1874},
+    {0x053C, 1877, 1877},
+    {0x053D, 1880, 1880},
+    {0x053E, 1883, 1883},
+    {0x053F, 1886, 1886},
+    {0x0540, 1889, 1889},
+    {0x0541, 1892, 1892},
+    {0x0542, 1895, 1895},
+    {0x0543, 1898, 1898},
+    {0x0544, 1901, 1901},
+    {0x0545, 1904, 1904},
+    {0x0546, 1907, 1907},
+    {0x0547, 1910, 1910},
+    {0x0548, 1913, 1913},
+    {0x0549, 1916, 1916},
+    {0x054A, 1919, 1919},
+    {0x054B, 1922, 1922},
+    {0x054C, 1925, 1925},
+    {0x054D, 1928, 1928},
+    {0x054E, 1931, 1931},
+    {0x054F, 1934, 1934},
+    {0x0550, 1937, 1937},
+    {0x0551, 1940, 1940},
+    {0x0552, 1943, 1943},
+    {0x0553, 1946, 1946},
+    {0x0554, 1949, 1949},
+    {0x0555, 1952, 1952},
+    {0x0556, 1955, 1955},
+    {0x1E00, 1958, 11},
+    {0x1E01, 1958, 11},
+    {0x1E02, 1962, 1966},
+    {0x1E03, 1962, 1966},
+    {0x1E04, 1968, 1966},
+    {0x1E05, 1968, 1966},
+    {0x1E06, 1972, 1966},
+    {0x1E07, 1972, 1966},
+    {0x1E08, 1976, 114},
+    {0x1E09, 1976, 114},
+    {0x1E0A, 1980, 147},
+    {0x1E0B, 1980, 147},
+    {0x1E0C, 1984, 147},
+    {0x1E0D, 1984, 147},
+    {0x1E0E, 1988, 147},
+    {0x1E0F, 1988, 147},
+    {0x1E10, 1992, 147},
+    {0x1E11, 1992, 147},
+    {0x1E12, 1996, 147},
+    {0x1E13, 1996, 147},
+    {0x1E14, 2000, 119},
+    {0x1E15, 2000, 119},
+    {0x1E16, 2004, 119},
+    {0x1E17, 2004, 119},
+    {0x1E18, 2008, 119},
+    {0x1E19, 2008, 119},
+    {0x1E1A, 2012, 119},
+    {0x1E1B, 2012, 119},
+    {0x1E1C, 2016, 119},
+    {0x1E1D, 2016, 119},
+    {0x1E1E, 2020, 475},
+    {0x1E1F, 2020, 475},
+    {0x1E20, 2024, 251},
+    {0x1E21, 2024, 251},
+    {0x1E22, 2028, 265},
+    {0x1E23, 2028, 265},
+    {0x1E24, 2032, 265},
+    {0x1E25, 2032, 265},
+    {0x1E26, 2036, 265},
+    {0x1E27, 2036, 265},
+    {0x1E28, 2040, 265},
+    {0x1E29, 2040, 265},
+    {0x1E2A, 2044, 265},
+    {0x1E2B, 2044, 265},
+    {0x1E2C, 2048, 133},
+    {0x1E2D, 2048, 133},
+    {0x1E2E, 2052, 133},
+    {0x1E2F, 2052, 133},
+    {0x1E30, 2056, 303},
+    {0x1E31, 2056, 303},
+    {0x1E32, 2060, 303},
+    {0x1E33, 2060, 303},
+    {0x1E34, 2064, 303},
+    {0x1E35, 2064, 303},
+    {0x1E36, 2068, 311},
+    {0x1E37, 2068, 311},
+    {0x1E38, 2072, 311},
+    {0x1E39, 2072, 311},
+    {0x1E3A, 2076, 311},
+    {0x1E3B, 2076, 311},
+    {0x1E3C, 2080, 311},
+    {0x1E3D, 2080, 311},
+    {0x1E3E, 2084, 2088},
+    {0x1E3F, 2084, 2088},
+    {0x1E40, 2090, 2088},
+    {0x1E41, 2090, 2088},
+    {0x1E42, 2094, 2088},
+    {0x1E43, 2094, 2088},
+    {0x1E44, 2098, 152},
+    {0x1E45, 2098, 152},
+    {0x1E46, 2102, 152},
+    {0x1E47, 2102, 152},
+    {0x1E48, 2106, 152},
+    {0x1E49, 2106, 152},
+    {0x1E4A, 2110, 152},
+    {0x1E4B, 2110, 152},
+    {0x1E4C, 2114, 55},
+    {0x1E4D, 2114, 55},
+    {0x1E4E, 2118, 55},
+    {0x1E4F, 2118, 55},
+    {0x1E50, 2122, 55},
+    {0x1E51, 2122, 55},
+    {0x1E52, 2126, 55},
+    {0x1E53, 2126, 55},
+    {0x1E54, 2130, 2134},
+    {0x1E55, 2130, 2134},
+    {0x1E56, 2136, 2134},
+    {0x1E57, 2136, 2134},
+    {0x1E58, 2140, 366},
+    {0x1E59, 2140, 366},
+    {0x1E5A, 2144, 366},
+    {0x1E5B, 2144, 366},
+    {0x1E5C, 2148, 366},
+    {0x1E5D, 2148, 366},
+    {0x1E5E, 2152, 366},
+    {0x1E5F, 2152, 366},
+    {0x1E60, 2156, 377},
+    {0x1E61, 2156, 377},
+    {0x1E62, 2160, 377},
+    {0x1E63, 2160, 377},
+    {0x1E64, 2164, 377},
+    {0x1E65, 2164, 377},
+    {0x1E66, 2168, 377},
+    {0x1E67, 2168, 377},
+    {0x1E68, 2172, 377},
+    {0x1E69, 2172, 377},
+    {0x1E6A, 2176, 391},
+    {0x1E6B, 2176, 391},
+    {0x1E6C, 2180, 391},
+    {0x1E6D, 2180, 391},
+    {0x1E6E, 2184, 391},
+    {0x1E6F, 2184, 391},
+    {0x1E70, 2188, 391},
+    {0x1E71, 2188, 391},
+    {0x1E72, 2192, 175},
+    {0x1E73, 2192, 175},
+    {0x1E74, 2196, 175},
+    {0x1E75, 2196, 175},
+    {0x1E76, 2200, 175},
+    {0x1E77, 2200, 175},
+    {0x1E78, 2204, 175},
+    {0x1E79, 2204, 175},
+    {0x1E7A, 2208, 175},
+    {0x1E7B, 2208, 175},
+    {0x1E7C, 2212, 2216},
+    {0x1E7D, 2212, 2216},
+    {0x1E7E, 2218, 2216},
+    {0x1E7F, 2218, 2216},
+    {0x1E80, 2222, 420},
+    {0x1E81, 2222, 420},
+    {0x1E82, 2226, 420},
+    {0x1E83, 2226, 420},
+    {0x1E84, 2230, 420},
+    {0x1E85, 2230, 420},
+    {0x1E86, 2234, 420},
+    {0x1E87, 2234, 420},
+    {0x1E88, 2238, 420},
+    {0x1E89, 2238, 420},
+    {0x1E8A, 2242, 842},
+    {0x1E8B, 2242, 842},
+    {0x1E8C, 2246, 842},
+    {0x1E8D, 2246, 842},
+    {0x1E8E, 2250, 189},
+    {0x1E8F, 2250, 189},
+    {0x1E90, 2254, 428},
+    {0x1E91, 2254, 428},
+    {0x1E92, 2258, 428},
+    {0x1E93, 2258, 428},
+    {0x1E94, 2262, 428},
+    {0x1E95, 2262, 428},
+    {0x1E96, 2266, 265},
+    {0x1E97, 2270, 391},
+    {0x1E98, 2274, 420},
+    {0x1E99, 2278, 189},
+    {0x1E9A, 2282, 2286},
+    {0x1E9B, 2290, 377},
+    {0x1E9E, 197, 200},
+    {0x1EA0, 2294, 11},
+    {0x1EA1, 2294, 11},
+    {0x1EA2, 2298, 11},
+    {0x1EA3, 2298, 11},
+    {0x1EA4, 2302, 11},
+    {0x1EA5, 2302, 11},
+    {0x1EA6, 2306, 11},
+    {0x1EA7, 2306, 11},
+    {0x1EA8, 2310, 11},
+    {0x1EA9, 2310, 11},
+    {0x1EAA, 2314, 11},
+    {0x1EAB, 2314, 11},
+    {0x1EAC, 2318, 11},
+    {0x1EAD, 2318, 11},
+    {0x1EAE, 2322, 11},
+    {0x1EAF, 2322, 11},
+    {0x1EB0, 2326, 11},
+    {0x1EB1, 2326, 11},
+    {0x1EB2, 2330, 11},
+    {0x1EB3, 2330, 11},
+    {0x1EB4, 2334, 11},
+    {0x1EB5, 2334, 11},
+    {0x1EB6, 2338, 11},
+    {0x1EB7, 2338, 11},
+    {0x1EB8, 2342, 119},
+    {0x1EB9, 2342, 119},
+    {0x1EBA, 2346, 119},
+    {0x1EBB, 2346, 119},
+    {0x1EBC, 2350, 119},
+    {0x1EBD, 2350, 119},
+    {0x1EBE, 2354, 119},
+    {0x1EBF, 2354, 119},
+    {0x1EC0, 2358, 119},
+    {0x1EC1, 2358, 119},
+    {0x1EC2, 2362, 119},
+    {0x1EC3, 2362, 119},
+    {0x1EC4, 2366, 119},
+    {0x1EC5, 2366, 119},
+    {0x1EC6, 2370, 119},
+    {0x1EC7, 2370, 119},
+    {0x1EC8, 2374, 133},
+    {0x1EC9, 2374, 133},
+    {0x1ECA, 2378, 133},
+    {0x1ECB, 2378, 133},
+    {0x1ECC, 2382, 55},
+    {0x1ECD, 2382, 55},
+    {0x1ECE, 2386, 55},
+    {0x1ECF, 2386, 55},
+    {0x1ED0, 2390, 55},
+    {0x1ED1, 2390, 55},
+    {0x1ED2, 2394, 55},
+    {0x1ED3, 2394, 55},
+    {0x1ED4, 2398, 55},
+    {0x1ED5, 2398, 55},
+    {0x1ED6, 2402, 55},
+    {0x1ED7, 2402, 55},
+    {0x1ED8, 2406, 55},
+    {0x1ED9, 2406, 55},
+    {0x1EDA, 2410, 55},
+    {0x1EDB, 2410, 55},
+    {0x1EDC, 2414, 55},
+    {0x1EDD, 2414, 55},
+    {0x1EDE, 2418, 55},
+    {0x1EDF, 2418, 55},
+    {0x1EE0, 2422, 55},
+    {0x1EE1, 2422, 55},
+    {0x1EE2, 2426, 55},
+    {0x1EE3, 2426, 55},
+    {0x1EE4, 2430, 175},
+    {0x1EE5, 2430, 175},
+    {0x1EE6, 2434, 175},
+    {0x1EE7, 2434, 175},
+    {0x1EE8, 2438, 175},
+    {0x1EE9, 2438, 175},
+    {0x1EEA, 2442, 175},
+    {0x1EEB, 2442, 175},
+    {0x1EEC, 2446, 175},
+    {0x1EED, 2446, 175},
+    {0x1EEE, 2450, 175},
+    {0x1EEF, 2450, 175},
+    {0x1EF0, 2454, 175},
+    {0x1EF1, 2454, 175},
+    {0x1EF2, 2458, 189},
+    {0x1EF3, 2458, 189},
+    {0x1EF4, 2462, 189},
+    {0x1EF5, 2462, 189},
+    {0x1EF6, 2466, 189},
+    {0x1EF7, 2466, 189},
+    {0x1EF8, 2470, 189},
+    {0x1EF9, 2470, 189},
+    {0x1EFA, 2474, 2474},
+    {0x1EFC, 2478, 2478},
+    {0x1EFE, 2482, 2482},
+    {0x1F00, 2486, 1205},
+    {0x1F01, 2490, 1205},
+    {0x1F02, 2494, 1205},
+    {0x1F03, 2498, 1205},
+    {0x1F04, 2502, 1205},
+    {0x1F05, 2506, 1205},
+    {0x1F06, 2510, 1205},
+    {0x1F07, 2514, 1205},
+    {0x1F08, 2486, 1205},
+    {0x1F09, 2490, 1205},
+    {0x1F0A, 2494, 1205},
+    {0x1F0B, 2498, 1205},
+    {0x1F0C, 2502, 1205},
+    {0x1F0D, 2506, 1205},
+    {0x1F0E, 2510, 1205},
+    {0x1F0F, 2514, 1205},
+    {0x1F10, 2518, 1214},
+    {0x1F11, 2522, 1214},
+    {0x1F12, 2526, 1214},
+    {0x1F13, 2530, 1214},
+    {0x1F14, 2534, 1214},
+    {0x1F15, 2538, 1214},
+    {0x1F18, 2518, 1214},
+    {0x1F19, 2522, 1214},
+    {0x1F1A, 2526, 1214},
+    {0x1F1B, 2530, 1214},
+    {0x1F1C, 2534, 1214},
+    {0x1F1D, 2538, 1214},
+    {0x1F20, 2542, 1220},
+    {0x1F21, 2546, 1220},
+    {0x1F22, 2550, 1220},
+    {0x1F23, 2554, 1220},
+    {0x1F24, 2558, 1220},
+    {0x1F25, 2562, 1220},
+    {0x1F26, 2566, 1220},
+    {0x1F27, 2570, 1220},
+    {0x1F28, 2542, 1220},
+    {0x1F29, 2546, 1220},
+    {0x1F2A, 2550, 1220},
+    {0x1F2B, 2554, 1220},
+    {0x1F2C, 2558, 1220},
+    {0x1F2D, 2562, 1220},
+    {0x1F2E, 2566, 1220},
+    {0x1F2F, 2570, 1220},
+    {0x1F30, 2574, 1226},
+    {0x1F31, 2578, 1226},
+    {0x1F32, 2582, 1226},
+    {0x1F33, 2586, 1226},
+    {0x1F34, 2590, 1226},
+    {0x1F35, 2594, 1226},
+    {0x1F36, 2598, 1226},
+    {0x1F37, 2602, 1226},
+    {0x1F38, 2574, 1226},
+    {0x1F39, 2578, 1226},
+    {0x1F3A, 2582, 1226},
+    {0x1F3B, 2586, 1226},
+    {0x1F3C, 2590, 1226},
+    {0x1F3D, 2594, 1226},
+    {0x1F3E, 2598, 1226},
+    {0x1F3F, 2602, 1226},
+    {0x1F40, 2606, 1232},
+    {0x1F41, 2610, 1232},
+    {0x1F42, 2614, 1232},
+    {0x1F43, 2618, 1232},
+    {0x1F44, 2622, 1232},
+    {0x1F45, 2626, 1232},
+    {0x1F48, 2606, 1232},
+    {0x1F49, 2610, 1232},
+    {0x1F4A, 2614, 1232},
+    {0x1F4B, 2618, 1232},
+    {0x1F4C, 2622, 1232},
+    {0x1F4D, 2626, 1232},
+    {0x1F50, 2630, 1238},
+    {0x1F51, 2634, 1238},
+    {0x1F52, 2638, 1238},
+    {0x1F53, 2642, 1238},
+    {0x1F54, 2646, 1238},
+    {0x1F55, 2650, 1238},
+    {0x1F56, 2654, 1238},
+    {0x1F57, 2658, 1238},
+    {0x1F59, 2634, 1238},
+    {0x1F5B, 2642, 1238},
+    {0x1F5D, 2650, 1238},
+    {0x1F5F, 2658, 1238},
+    {0x1F60, 2662, 1244},
+    {0x1F61, 2666, 1244},
+    {0x1F62, 2670, 1244},
+    {0x1F63, 2674, 1244},
+    {0x1F64, 2678, 1244},
+    {0x1F65, 2682, 1244},
+    {0x1F66, 2686, 1244},
+    {0x1F67, 2690, 1244},
+    {0x1F68, 2662, 1244},
+    {0x1F69, 2666, 1244},
+    {0x1F6A, 2670, 1244},
+    {0x1F6B, 2674, 1244},
+    {0x1F6C, 2678, 1244},
+    {0x1F6D, 2682, 1244},
+    {0x1F6E, 2686, 1244},
+    {0x1F6F, 2690, 1244},
+    {0x1F70, 2694, 1205},
+    {0x1F71, 1202, 1205},
+    {0x1F72, 2698, 1214},
+    {0x1F73, 1211, 1214},
+    {0x1F74, 2702, 1220},
+    {0x1F75, 1217, 1220},
+    {0x1F76, 2706, 1226},
+    {0x1F77, 1223, 1226},
+    {0x1F78, 2710, 1232},
+    {0x1F79, 1229, 1232},
+    {0x1F7A, 2714, 1238},
+    {0x1F7B, 1235, 1238},
+    {0x1F7C, 2718, 1244},
+    {0x1F7D, 1241, 1244},
+    {0x1F80, 2722, 1205},
+    {0x1F81, 2726, 1205},
+    {0x1F82, 2730, 1205},
+    {0x1F83, 2734, 1205},
+    {0x1F84, 2738, 1205},
+    {0x1F85, 2742, 1205},
+    {0x1F86, 2746, 1205},
+    {0x1F87, 2750, 1205},
+    {0x1F88, 2722, 1205},
+    {0x1F89, 2726, 1205},
+    {0x1F8A, 2730, 1205},
+    {0x1F8B, 2734, 1205},
+    {0x1F8C, 2738, 1205},
+    {0x1F8D, 2742, 1205},
+    {0x1F8E, 2746, 1205},
+    {0x1F8F, 2750, 1205},
+    {0x1F90, 2754, 1220},
+    {0x1F91, 2758, 1220},
+    {0x1F92, 2762, 1220},
+    {0x1F93, 2766, 1220},
+    {0x1F94, 2770, 1220},
+    {0x1F95, 2774, 1220},
+    {0x1F96, 2778, 1220},
+    {0x1F97, 2782, 1220},
+    {0x1F98, 2754, 1220},
+    {0x1F99, 2758, 1220},
+    {0x1F9A, 2762, 1220},
+    {0x1F9B, 2766, 1220},
+    {0x1F9C, 2770, 1220},
+    {0x1F9D, 2774, 1220},
+    {0x1F9E, 2778, 1220},
+    {0x1F9F, 2782, 1220},
+    {0x1FA0, 2786, 1244},
+    {0x1FA1, 2790, 1244},
+    {0x1FA2, 2794, 1244},
+    {0x1FA3, 2798, 1244},
+    {0x1FA4, 2802, 1244},
+    {0x1FA5, 2806, 1244},
+    {0x1FA6, 2810, 1244},
+    {0x1FA7, 2814, 1244},
+    {0x1FA8, 2786, 1244},
+    {0x1FA9, 2790, 1244},
+    {0x1FAA, 2794, 1244},
+    {0x1FAB, 2798, 1244},
+    {0x1FAC, 2802, 1244},
+    {0x1FAD, 2806, 1244},
+    {0x1FAE, 2810, 1244},
+    {0x1FAF, 2814, 1244},
+    {0x1FB0, 2818, 1205},
+    {0x1FB1, 2822, 1205},
+    {0x1FB2, 2826, 1205},
+    {0x1FB3, 2830, 1205},
+    {0x1FB4, 2834, 1205},
+    {0x1FB6, 2838, 1205},
+    {0x1FB7, 2842, 1205},
+    {0x1FB8, 2818, 1205},
+    {0x1FB9, 2822, 1205},
+    {0x1FBA, 2694, 1205},
+    {0x1FBB, 1202, 1205},
+    {0x1FBC, 2830, 1205},
+    {0x1FBD, 2846, 3},
+    {0x1FBE, 1226, 1226},
+    {0x1FBF, 2850, 3},
+    {0x1FC0, 2854, 3},
+    {0x1FC1, 2858, 3},
+    {0x1FC2, 2862, 1220},
+    {0x1FC3, 2866, 1220},
+    {0x1FC4, 2870, 1220},
+    {0x1FC6, 2874, 1220},
+    {0x1FC7, 2878, 1220},
+    {0x1FC8, 2698, 1214},
+    {0x1FC9, 1211, 1214},
+    {0x1FCA, 2702, 1220},
+    {0x1FCB, 1217, 1220},
+    {0x1FCC, 2866, 1220},
+    {0x1FCD, 2882, 3},
+    {0x1FCE, 2886, 3},
+    {0x1FCF, 2890, 3},
+    {0x1FD0, 2894, 1226},
+    {0x1FD1, 2898, 1226},
+    {0x1FD2, 2902, 1226},
+    {0x1FD3, 1247, 1226},
+    {0x1FD6, 2906, 1226},
+    {0x1FD7, 2910, 1226},
+    {0x1FD8, 2894, 1226},
+    {0x1FD9, 2898, 1226},
+    {0x1FDA, 2706, 1226},
+    {0x1FDB, 1223, 1226},
+    {0x1FDD, 2914, 3},
+    {0x1FDE, 2918, 3},
+    {0x1FDF, 2922, 3},
+    {0x1FE0, 2926, 1238},
+    {0x1FE1, 2930, 1238},
+    {0x1FE2, 2934, 1238},
+    {0x1FE3, 1304, 1238},
+    {0x1FE4, 2938, 1280},
+    {0x1FE5, 2942, 1280},
+    {0x1FE6, 2946, 1238},
+    {0x1FE7, 2950, 1238},
+    {0x1FE8, 2926, 1238},
+    {0x1FE9, 2930, 1238},
+    {0x1FEA, 2714, 1238},
+    {0x1FEB, 1235, 1238},
+    {0x1FEC, 2942, 1280},
+    {0x1FED, 2954, 3},
+    {0x1FEE, 1199, 3},
+    {0x1FEF, 2958, 2958},
+    {0x1FF2, 2960, 1244},
+    {0x1FF3, 2964, 1244},
+    {0x1FF4, 2968, 1244},
+    {0x1FF6, 2972, 1244},
+    {0x1FF7, 2976, 1244},
+    {0x1FF8, 2710, 1232},
+    {0x1FF9, 1229, 1232},
+    {0x1FFA, 2718, 1244},
+    {0x1FFB, 1241, 1244},
+    {0x1FFC, 2964, 1244},
+    {0x1FFD, 33, 3},
+    {0x1FFE, 2980, 3},
+    {0x2000, 2984, 3},
+    {0x2001, 2988, 3},
+    {0x2002, 2984, 3},
+    {0x2003, 2988, 3},
+    {0x2004, 2992, 3},
+    {0x2005, 2996, 3},
+    {0x2006, 3000, 3},
+    {0x2007, 3004, 3},
+    {0x2008, 3008, 3},
+    {0x2009, 3012, 3},
+    {0x200A, 3016, 3},
+    {0x200B, 3020, 16},
+    {0x200C, 3024, 16},
+    {0x200D, 3028, 16},
+    {0x200E, 3032, 16},
+    {0x200F, 3036, 16},
+    {0x2010, 3040, 3044},
+    {0x2011, 3046, 3044},
+    {0x2012, 3050, 3044},
+    {0x2013, 3054, 3044},
+    {0x2014, 3058, 3044},
+    {0x2015, 3062, 3044},
+    {0x2017, 3066, 3},
+    {0x2018, 3070, 36},
+    {0x2019, 3074, 36},
+    {0x201A, 3078, 36},
+    {0x201B, 3082, 36},
+    {0x201C, 3086, 16},
+    {0x201D, 3090, 16},
+    {0x201E, 3094, 16},
+    {0x201F, 3098, 16},
+    {0x2024, 3102, 3106},
+    {0x2025, 3108, 3112},
+    {0x2026, 3115, 3119},
+    {0x202F, 3123, 3},
+    {0x2033, 3127, 3131},
+    {0x2034, 3138, 3142},
+    {0x2036, 3152, 3156},
+    {0x2037, 3163, 3167},
+    {0x2039, 3177, 16},
+    {0x203A, 3181, 16},
+    {0x203C, 3185, 3189},
+    {0x203E, 3192, 3},
+    {0x2047, 3196, 3200},
+    {0x2048, 3203, 3207},
+    {0x2049, 3210, 3214},
+    {0x2057, 3217, 3221},
+    {0x205F, 3234, 3},
+    {0x2060, 3238, 16},
+    {0x2061, 3242, 16},
+    {0x2062, 3246, 16},
+    {0x2063, 3250, 16},
+    {0x2064, 3254, 16},
+};
+
+const Utf8FoldEntry* get_utf8_fold_entries(size_t& count) {
+    count = sizeof(FOLD_ENTRIES) / sizeof(FOLD_ENTRIES[0]);
+    return FOLD_ENTRIES;
+}
+
+const char* get_utf8_fold_strings() {
+    return FOLD_STRINGS;
+}
+
+}  // namespace mcp
+}  // namespace cesium
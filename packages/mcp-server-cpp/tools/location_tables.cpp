@@ -0,0 +1,120 @@
+/**
+ * Location Tables Generator
+ *
+ * Builds the name hash tables, the name-sorted order and the autocomplete
+ * trie over the compiled-in location data and writes them as constant
+ * arrays to a C++ source file (see location_tables.h). CMake runs it for
+ * native builds; the WASM build compiles a file written by a native build.
+ *
+ * Usage:
+ *   location-tables <location_tables_data.cpp>
+ */
+
+#include "location_tables.h"
+
+#include <cstdio>
+
+using namespace cesium::mcp;
+
+// Values per line in the emitted arrays
+constexpr size_t VALUES_PER_LINE = 8;
+
+static void write_hash_slots(FILE* file, const char* name, const LocationHashSlot* slots, size_t count) {
+    fprintf(file, "\nstatic constexpr LocationHashSlot %s[%zu] = {", name, count);
+    for (size_t i = 0; i < count; i++) {
+        fprintf(file, "%s{0x%x,0x%x},", i % VALUES_PER_LINE == 0 ? "\n    " : "",
+                slots[i].hash, slots[i].id);
+    }
+    fprintf(file, "\n};\n");
+}
+
+static void write_uint32s(FILE* file, const char* name, const uint32_t* values, size_t count) {
+    fprintf(file, "\nstatic constexpr uint32_t %s[%zu] = {", name, count);
+    for (size_t i = 0; i < count; i++) {
+        fprintf(file, "%s%u,", i % (VALUES_PER_LINE * 2) == 0 ? "\n    " : "", values[i]);
+    }
+    fprintf(file, "\n};\n");
+}
+
+static void write_trie(FILE* file, const LocationTables& tables) {
+    fprintf(file, "\nstatic constexpr LocationTrieNode TRIE_NODES[%zu] = {", tables.trie_node_count);
+    for (size_t i = 0; i < tables.trie_node_count; i++) {
+        const LocationTrieNode& node = tables.trie_nodes[i];
+        fprintf(file, "%s{%u,%u,%u,%u,%u},", i % (VALUES_PER_LINE / 2) == 0 ? "\n    " : "",
+                node.first_child, node.range_begin, node.range_end, node.child_count, node.depth);
+    }
+    fprintf(file, "\n};\n");
+
+    fprintf(file, "\nstatic constexpr uint8_t TRIE_FIRST_BYTES[%zu] = {", tables.trie_node_count);
+    for (size_t i = 0; i < tables.trie_node_count; i++) {
+        fprintf(file, "%s%u,", i % (VALUES_PER_LINE * 4) == 0 ? "\n    " : "", tables.trie_first_bytes[i]);
+    }
+    fprintf(file, "\n};\n");
+
+    write_uint32s(file, "TRIE_BEST", tables.trie_best, tables.trie_leaves * 2);
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <location_tables_data.cpp>\n", argv[0]);
+        return 1;
+    }
+
+    LocationTables tables = get_location_tables();
+
+    FILE* file = fopen(argv[1], "w");
+    if (file == nullptr) {
+        fprintf(stderr, "Failed to write %s\n", argv[1]);
+        return 1;
+    }
+
+    fprintf(file,
+            "/**\n"
+            " * Prebuilt Location Tables\n"
+            " *\n"
+            " * Generated by tools/location_tables.cpp - do not edit.\n"
+            " */\n"
+            "\n"
+            "#include \"location_tables.h\"\n"
+            "#include \"location_database.h\"\n"
+            "\n"
+            "namespace cesium {\n"
+            "namespace mcp {\n");
+
+    write_hash_slots(file, "NAME_SLOTS", tables.name_slots, tables.name_slot_count);
+    write_hash_slots(file, "FOLDED_SLOTS", tables.folded_slots, tables.folded_slot_count);
+    write_uint32s(file, "SORTED_IDS", tables.sorted_ids, tables.sorted_count);
+    write_trie(file, tables);
+
+    fprintf(file,
+            "\nstatic constexpr LocationTables TABLES = {\n"
+            "    %zu, 0x%xu,\n"
+            "    NAME_SLOTS, %zu,\n"
+            "    FOLDED_SLOTS, %zu,\n"
+            "    SORTED_IDS, %zu,\n"
+            "    TRIE_NODES, TRIE_FIRST_BYTES, %zu,\n"
+            "    TRIE_BEST, %zu,\n"
+            "};\n"
+            "\n"
+            "const LocationTables* get_prebuilt_location_tables() {\n"
+            "    return get_location_count() == TABLES.location_count &&\n"
+            "           get_location_fingerprint() == TABLES.fingerprint ? &TABLES : nullptr;\n"
+            "}\n"
+            "\n"
+            "}  // namespace mcp\n"
+            "}  // namespace cesium\n",
+            tables.location_count, tables.fingerprint, tables.name_slot_count, tables.folded_slot_count,
+            tables.sorted_count, tables.trie_node_count, tables.trie_leaves);
+
+    bool ok = ferror(file) == 0;
+    ok = fclose(file) == 0 && ok;
+    if (!ok) {
+        fprintf(stderr, "Failed to write %s\n", argv[1]);
+        return 1;
+    }
+
+    printf("Wrote %s (%zu locations, %zu + %zu hash slots, %zu trie nodes)\n",
+           argv[1], tables.location_count, tables.name_slot_count, tables.folded_slot_count,
+           tables.trie_node_count);
+    return 0;
+}
@@ -0,0 +1,48 @@
+/**
+ * SymSpell Index Generator
+ *
+ * Builds the symmetric-delete typo index over the compiled-in location
+ * data and writes it to a file that the WASM build can attach at startup
+ * (attachSymSpellIndex) instead of rebuilding it.
+ *
+ * Usage:
+ *   symspell-index <output.bin> [max_distance] [prefix_length]
+ */
+
+#include "location_symspell.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace cesium::mcp;
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <output.bin> [max_distance] [prefix_length]\n", argv[0]);
+        return 1;
+    }
+
+    int max_distance = argc > 2 ? atoi(argv[2]) : SYMSPELL_DEFAULT_MAX_DISTANCE;
+    int prefix_length = argc > 3 ? atoi(argv[3]) : SYMSPELL_DEFAULT_PREFIX_LENGTH;
+    if (!build_symspell_index(max_distance, prefix_length)) {
+        fprintf(stderr, "Invalid parameters: max_distance=%d prefix_length=%d\n",
+                max_distance, prefix_length);
+        return 1;
+    }
+
+    std::vector<uint8_t> data(get_symspell_index_size());
+    size_t written = serialize_symspell_index(data.data(), data.size());
+
+    FILE* file = fopen(argv[1], "wb");
+    if (file == nullptr || fwrite(data.data(), 1, written, file) != written) {
+        fprintf(stderr, "Failed to write %s\n", argv[1]);
+        if (file != nullptr) fclose(file);
+        return 1;
+    }
+    fclose(file);
+
+    printf("Wrote %s (%zu bytes, max_distance=%d, prefix_length=%d)\n",
+           argv[1], written, max_distance, prefix_length);
+    return 0;
+}
@@ -0,0 +1,318 @@
+#!/usr/bin/env node
+/**
+ * Build Location Metadata Columns
+ *
+ * Derives a type flag set and an ISO 3166-1 alpha-2 country code for every
+ * entry of the location table (packages/mcp-server-cpp/data/location_table.bin) and
+ * writes them as parallel C++ tables to location_metadata_data.cpp.
+ *
+ * Sources (all local, no network access):
+ * - data/location_database_generated.cpp: Overpass category sections
+ *   (airports, landmarks, major cities, ...)
+ * - data/cities15000.zip: GeoNames cities with country codes
+ * - us-states.mjs: US states, territories and their aliases
+ *
+ * Entries matching a GeoNames city of the same name nearby take that city's
+ * country; every other entry takes the country of the nearest GeoNames city
+ * within COUNTRY_RADIUS_KM, which can be wrong right at a border.
+ */
+
+import { existsSync, readFileSync, writeFileSync } from 'fs';
+import { join, dirname } from 'path';
+import { fileURLToPath } from 'url';
+import { execSync } from 'child_process';
+import { US_STATES } from './us-states.mjs';
+import { LOCATION_TABLE_PATH, readLocationTable } from './location-table.mjs';
+
+const __dirname = dirname(fileURLToPath(import.meta.url));
+const PROJECT_ROOT = join(__dirname, '..');
+const CATEGORY_SOURCE_PATH = join(PROJECT_ROOT, 'data/location_database_generated.cpp');
+const GEONAMES_ZIP = join(PROJECT_ROOT, 'data/cities15000.zip');
+const OUTPUT_PATH = join(PROJECT_ROOT, 'packages/mcp-server-cpp/src/location_metadata_data.cpp');
+
+// Type flags (same values as LOCDB_TYPE_* in location_binary.h)
+const TYPE_STATE = 1;
+const TYPE_CITY = 2;
+const TYPE_LANDMARK = 4;
+const TYPE_AIRPORT = 32;
+
+// Overpass sections that name settlements; every other section is a landmark
+const CATEGORY_TYPES = {
+  AIRPORTS: TYPE_AIRPORT,
+  MAJORCITIES: TYPE_CITY,
+  CAPITALS: TYPE_CITY,
+};
+
+// Same-name matches must be this close to count as the same place
+const SAME_PLACE_KM = 30;
+const STATE_MATCH_KM = 50;
+const COUNTRY_RADIUS_KM = 100;
+
+const LOCATION_REGEX = /\{"((?:[^"\\]|\\.)*)",\s*([-\d.]+),\s*([-\d.]+)(?:,\s*([-\d.]+))?(?:,\s*(\d+))?\}/;
+
+function unescapeCpp(name) {
+  return name.replace(/\\(.)/g, '$1');
+}
+
+function distanceKm(lon1, lat1, lon2, lat2) {
+  const toRad = (deg) => deg * Math.PI / 180;
+  const dLat = toRad(lat2 - lat1);
+  const dLon = toRad(lon2 - lon1);
+  const h = Math.sin(dLat / 2) ** 2 +
+            Math.cos(toRad(lat1)) * Math.cos(toRad(lat2)) * Math.sin(dLon / 2) ** 2;
+  return 2 * 6371.0088 * Math.asin(Math.sqrt(Math.min(h, 1)));
+}
+
+/**
+ * Read the location table in order (IDs are table indexes)
+ */
+function parseLocations() {
+  const locations = readLocationTable().map(loc => ({
+    name: loc.name,
+    lon: loc.longitude,
+    lat: loc.latitude,
+    population: loc.population,
+  }));
+  console.log(`Read ${locations.length} locations from ${LOCATION_TABLE_PATH}`);
+  return locations;
+}
+
+/**
+ * Map name -> [{type, lon, lat}] from the Overpass category sections
+ */
+function parseCategories() {
+  const categories = new Map();
+  if (!existsSync(CATEGORY_SOURCE_PATH)) {
+    console.warn(`Missing ${CATEGORY_SOURCE_PATH}; skipping category types`);
+    return categories;
+  }
+
+  let type = TYPE_LANDMARK;
+  for (const line of readFileSync(CATEGORY_SOURCE_PATH, 'utf-8').split('\n')) {
+    const section = /\/\/ === (\w+) ===/.exec(line);
+    if (section) {
+      type = CATEGORY_TYPES[section[1]] ?? TYPE_LANDMARK;
+      continue;
+    }
+    const match = LOCATION_REGEX.exec(line);
+    if (!match) continue;
+
+    const name = unescapeCpp(match[1]);
+    if (!categories.has(name)) categories.set(name, []);
+    categories.get(name).push({ type, lon: parseFloat(match[2]), lat: parseFloat(match[3]) });
+  }
+  console.log(`Parsed ${categories.size} categorized names`);
+  return categories;
+}
+
+/**
+ * GeoNames cities: name -> [{country, lon, lat}] plus a 1-degree grid of all
+ * cities for nearest-city country lookups
+ */
+function parseGeoNames() {
+  const byName = new Map();
+  const grid = new Map();
+  if (!existsSync(GEONAMES_ZIP)) {
+    console.warn(`Missing ${GEONAMES_ZIP}; skipping countries and GeoNames cities`);
+    return { byName, grid };
+  }
+
+  const content = execSync(`unzip -p "${GEONAMES_ZIP}" cities15000.txt`,
+                           { maxBuffer: 64 * 1024 * 1024 }).toString('utf-8');
+  let count = 0;
+  for (const line of content.split('\n')) {
+    const fields = line.split('\t');
+    if (fields.length < 15) continue;
+
+    const [, name, asciiname, , latitude, longitude, , , countryCode] = fields;
+    if (!/^[A-Z]{2}$/.test(countryCode)) continue;
+
+    const city = { country: countryCode.toLowerCase(), lon: parseFloat(longitude), lat: parseFloat(latitude) };
+    for (const variant of new Set([name.toLowerCase().trim(), asciiname.toLowerCase().trim()])) {
+      if (!variant) continue;
+      if (!byName.has(variant)) byName.set(variant, []);
+      byName.get(variant).push(city);
+    }
+
+    const cell = `${Math.floor(city.lon)},${Math.floor(city.lat)}`;
+    if (!grid.has(cell)) grid.set(cell, []);
+    grid.get(cell).push(city);
+    count++;
+  }
+  console.log(`Parsed ${count} GeoNames cities`);
+  return { byName, grid };
+}
+
+function nearestEntry(entries, lon, lat, maxKm) {
+  let best = null;
+  let bestKm = maxKm;
+  for (const entry of entries || []) {
+    const km = distanceKm(lon, lat, entry.lon, entry.lat);
+    if (km <= bestKm) {
+      best = entry;
+      bestKm = km;
+    }
+  }
+  return best;
+}
+
+// Nearest city in the surrounding grid cells (2 degrees covers
+// COUNTRY_RADIUS_KM of latitude; longitude cells shrink toward the poles,
+// so the search is conservative there)
+function nearestCity(grid, lon, lat) {
+  const cx = Math.floor(lon);
+  const cy = Math.floor(lat);
+  let best = null;
+  let bestKm = COUNTRY_RADIUS_KM;
+  for (let dx = -2; dx <= 2; dx++) {
+    for (let dy = -2; dy <= 2; dy++) {
+      const x = ((cx + dx + 180) % 360 + 360) % 360 - 180;
+      const city = nearestEntry(grid.get(`${x},${cy + dy}`), lon, lat, bestKm);
+      if (city) {
+        best = city;
+        bestKm = distanceKm(lon, lat, city.lon, city.lat);
+      }
+    }
+  }
+  return best;
+}
+
+// ~100 m grid key for entries that name the same point
+function coordinateKey(loc) {
+  return `${Math.round(loc.lon * 1000)},${Math.round(loc.lat * 1000)}`;
+}
+
+function buildMetadata(locations, categories, geonames) {
+  const states = new Map();
+  for (const state of US_STATES) {
+    for (const name of [state.name, ...(state.alias || [])]) {
+      states.set(name, state);
+    }
+  }
+
+  const stats = { state: 0, city: 0, landmark: 0, airport: 0, country: 0 };
+  const metadata = locations.map((loc) => {
+    let type = 0;
+    let country = '';
+
+    if (loc.population > 0) type |= TYPE_CITY;
+
+    for (const entry of categories.get(loc.name) || []) {
+      if (distanceKm(loc.lon, loc.lat, entry.lon, entry.lat) <= SAME_PLACE_KM) {
+        type |= entry.type;
+      }
+    }
+
+    const state = states.get(loc.name);
+    if (state && distanceKm(loc.lon, loc.lat, state.lon, state.lat) <= STATE_MATCH_KM) {
+      type |= TYPE_STATE;
+      country = 'us';
+    }
+
+    const city = nearestEntry(geonames.byName.get(loc.name), loc.lon, loc.lat, SAME_PLACE_KM);
+    if (city) {
+      type |= TYPE_CITY;
+      country = country || city.country;
+    }
+    if (!country) {
+      const nearest = nearestCity(geonames.grid, loc.lon, loc.lat);
+      if (nearest) country = nearest.country;
+    }
+
+    if (type & TYPE_STATE) stats.state++;
+    if (type & TYPE_CITY) stats.city++;
+    if (type & TYPE_LANDMARK) stats.landmark++;
+    if (type & TYPE_AIRPORT) stats.airport++;
+    if (country) stats.country++;
+    return { type, country };
+  });
+
+  // Aliases ("nyc", "the big apple") share coordinates with a typed entry
+  const typeAt = new Map();
+  metadata.forEach((m, i) => {
+    const key = coordinateKey(locations[i]);
+    if (m.type && !typeAt.has(key)) typeAt.set(key, m.type);
+  });
+  metadata.forEach((m, i) => {
+    if (m.type) return;
+    m.type = typeAt.get(coordinateKey(locations[i])) || 0;
+    if (m.type & TYPE_STATE) stats.state++;
+    if (m.type & TYPE_CITY) stats.city++;
+    if (m.type & TYPE_LANDMARK) stats.landmark++;
+    if (m.type & TYPE_AIRPORT) stats.airport++;
+  });
+
+  console.log(`  states ${stats.state}, cities ${stats.city}, landmarks ${stats.landmark}, ` +
+              `airports ${stats.airport}, with country ${stats.country}`);
+  return metadata;
+}
+
+function generateCppSource(metadata) {
+  const lines = [];
+
+  lines.push('/**');
+  lines.push(' * Location Metadata Tables');
+  lines.push(' *');
+  lines.push(' * Type flags and country codes parallel to the location table (data/location_table.bin).');
+  lines.push(' * Generated by scripts/build-location-metadata.mjs; do not edit.');
+  lines.push(` * Generated: ${new Date().toISOString()}`);
+  lines.push(` * Total locations: ${metadata.length}`);
+  lines.push(' */');
+  lines.push('');
+  lines.push('#include "location_metadata.h"');
+  lines.push('');
+  lines.push('namespace cesium {');
+  lines.push('namespace mcp {');
+  lines.push('');
+  lines.push('// LOCATION_TYPE_* flags per location, 0 = unknown');
+  lines.push('static const uint8_t LOCATION_TYPES[] = {');
+  for (let i = 0; i < metadata.length; i += 32) {
+    const row = metadata.slice(i, i + 32).map((m) => m.type).join(',');
+    lines.push(`    ${row},`);
+  }
+  lines.push('};');
+  lines.push('');
+  lines.push('// Lowercase ISO 3166-1 alpha-2 code per location, two bytes each, "--" = unknown');
+  lines.push('static const char LOCATION_COUNTRIES[] =');
+  for (let i = 0; i < metadata.length; i += 48) {
+    const row = metadata.slice(i, i + 48).map((m) => m.country || '--').join('');
+    lines.push(`    "${row}"`);
+  }
+  lines.push('    ;');
+  lines.push('');
+  lines.push(`static constexpr size_t METADATA_COUNT = ${metadata.length};`);
+  lines.push('static_assert(sizeof(LOCATION_TYPES) == METADATA_COUNT, "one type per location");');
+  lines.push('static_assert(sizeof(LOCATION_COUNTRIES) == METADATA_COUNT * 2 + 1, "one country per location");');
+  lines.push(`
+const uint8_t* get_generated_location_types() {
+    return LOCATION_TYPES;
+}
+
+const char* get_generated_location_countries() {
+    return LOCATION_COUNTRIES;
+}
+
+size_t get_generated_location_metadata_count() {
+    return METADATA_COUNT;
+}
+`);
+  lines.push('}  // namespace mcp');
+  lines.push('}  // namespace cesium');
+  lines.push('');
+
+  return lines.join('\n');
+}
+
+function main() {
+  const locations = parseLocations();
+  const categories = parseCategories();
+  const geonames = parseGeoNames();
+
+  console.log('Deriving metadata...');
+  const metadata = buildMetadata(locations, categories, geonames);
+
+  writeFileSync(OUTPUT_PATH, generateCppSource(metadata));
+  console.log(`\nWrote ${OUTPUT_PATH}`);
+}
+
+main();
@@ -0,0 +1,168 @@
+#!/usr/bin/env node
+/**
+ * Build UTF-8 Fold Table
+ *
+ * Writes packages/mcp-server-cpp/src/utf8_fold_table.cpp: a code point table
+ * giving, for every character the location lookups care about, its lowercase
+ * form and its folded form (lowercase, diacritics and typographic quotes
+ * removed). Derived from the JavaScript engine's Unicode data
+ * (toLowerCase / normalize), so the C++ side needs no ICU.
+ *
+ * Covered: Latin-1 Supplement, Latin Extended-A/B, IPA and spacing modifier
+ * letters, combining diacritics, Greek (and Greek Extended), Cyrillic,
+ * Armenian, Latin Extended Additional and general punctuation. Other scripts
+ * (CJK, Arabic, Hebrew, Indic, ...) pass through unchanged.
+ */
+
+import { writeFileSync } from 'fs';
+import { join, dirname } from 'path';
+import { fileURLToPath } from 'url';
+
+const __dirname = dirname(fileURLToPath(import.meta.url));
+const OUTPUT_PATH = join(__dirname, '..', 'packages/mcp-server-cpp/src/utf8_fold_table.cpp');
+
+const RANGES = [
+  [0x00A0, 0x02FF],   // Latin-1 Supplement, Latin Extended-A/B, IPA, modifiers
+  [0x0300, 0x036F],   // Combining diacritical marks
+  [0x0370, 0x03FF],   // Greek and Coptic
+  [0x0400, 0x052F],   // Cyrillic, Cyrillic Supplement
+  [0x0531, 0x0587],   // Armenian
+  [0x1E00, 0x1FFF],   // Latin Extended Additional, Greek Extended
+  [0x2000, 0x206F],   // General punctuation
+];
+
+// Letters with no canonical decomposition that still read as a base letter
+const LETTER_FOLDS = {
+  'ß': 'ss', 'æ': 'ae', 'œ': 'oe', 'ø': 'o', 'đ': 'd', 'ð': 'd', 'þ': 'th',
+  'ł': 'l', 'ı': 'i', 'ħ': 'h', 'ŧ': 't', 'ŀ': 'l', 'ĸ': 'k', 'ŋ': 'n',
+  'ə': 'e', 'ǝ': 'e', 'ƒ': 'f', 'ɨ': 'i', 'ʉ': 'u',
+  'ς': 'σ',           // Greek final sigma
+  'ё': 'е',           // Russian yo is commonly written as ye
+};
+
+// Typographic punctuation: quotes and guillemets are dropped, apostrophes,
+// dashes and spaces become their ASCII forms
+const PUNCTUATION_FOLDS = {
+  '«': '', '»': '', '‹': '', '›': '', '“': '', '”': '', '„': '', '‟': '',
+  '‘': "'", '’': "'", '‚': "'", '‛': "'", 'ʻ': "'", 'ʼ': "'", 'ʹ': "'", '´': "'",
+  '‐': '-', '‑': '-', '‒': '-', '–': '-', '—': '-', '―': '-',
+};
+
+const COMBINING = /[\u0300-\u036f]/g;
+
+function isCyrillicOrArmenian(cp) {
+  return (cp >= 0x0400 && cp <= 0x052F) || (cp >= 0x0531 && cp <= 0x0587);
+}
+
+function isSpace(cp) {
+  return cp === 0x00A0 || (cp >= 0x2000 && cp <= 0x200A) || cp === 0x202F || cp === 0x205F;
+}
+
+function isInvisible(cp) {
+  return (cp >= 0x200B && cp <= 0x200F) || (cp >= 0x2060 && cp <= 0x2064) || cp === 0x00AD;
+}
+
+function foldChar(ch) {
+  const cp = ch.codePointAt(0);
+  const lower = ch.toLowerCase().normalize('NFC');
+
+  let folded;
+  if (PUNCTUATION_FOLDS[ch] !== undefined) {
+    folded = PUNCTUATION_FOLDS[ch];
+  } else if (isSpace(cp)) {
+    folded = ' ';
+  } else if (isInvisible(cp) || (cp >= 0x0300 && cp <= 0x036F)) {
+    folded = '';
+  } else if (isCyrillicOrArmenian(cp)) {
+    // Breves and diaereses mark distinct letters here (й, ї); only case folds
+    folded = LETTER_FOLDS[lower] ?? lower;
+  } else {
+    folded = [...lower.normalize('NFKD').replace(COMBINING, '')]
+      .map((c) => LETTER_FOLDS[c] ?? c).join('');
+  }
+  return { cp, lower, folded };
+}
+
+function cppString(s) {
+  let out = '';
+  for (const byte of Buffer.from(s, 'utf-8')) {
+    out += byte < 0x80 && byte !== 0x22 && byte !== 0x5C && byte >= 0x20
+      ? String.fromCharCode(byte)
+      : `\\x${byte.toString(16).padStart(2, '0')}`;
+  }
+  // Keep a hex escape from swallowing a following hex digit
+  return `"${out.replace(/(\\x[0-9a-f]{2})(?=[0-9a-fA-F])/g, '$1""')}"`;
+}
+
+function main() {
+  const entries = [];
+  for (const [first, last] of RANGES) {
+    for (let cp = first; cp <= last; cp++) {
+      const ch = String.fromCodePoint(cp);
+      if (/\p{Cn}/u.test(ch)) continue;   // Unassigned
+      const entry = foldChar(ch);
+      if (entry.lower !== ch || entry.folded !== ch) entries.push(entry);
+    }
+  }
+
+  // One pool of NUL-terminated strings; entries refer to it by offset
+  const pool = new Map();
+  let poolSize = 0;
+  const poolParts = [];
+  const intern = (s) => {
+    if (!pool.has(s)) {
+      pool.set(s, poolSize);
+      poolParts.push(s);
+      poolSize += Buffer.byteLength(s, 'utf-8') + 1;
+    }
+    return pool.get(s);
+  };
+  const rows = entries.map((e) => ({ ...e, lowerOffset: intern(e.lower), foldedOffset: intern(e.folded) }));
+  if (poolSize > 0xFFFF) throw new Error('string pool exceeds uint16_t offsets');
+
+  const lines = [];
+  lines.push('/**');
+  lines.push(' * UTF-8 Fold Table');
+  lines.push(' *');
+  lines.push(' * Lowercase and folded forms per code point, sorted by code point.');
+  lines.push(' * Generated by scripts/build-utf8-fold-table.mjs; do not edit.');
+  lines.push(` * Entries: ${rows.length}`);
+  lines.push(' */');
+  lines.push('');
+  lines.push('#include "utf8_fold.h"');
+  lines.push('');
+  lines.push('namespace cesium {');
+  lines.push('namespace mcp {');
+  lines.push('');
+  lines.push('// NUL-terminated replacement strings');
+  lines.push('static const char FOLD_STRINGS[] =');
+  for (const s of poolParts) {
+    lines.push(`    ${cppString(s)} "\\0"`);
+  }
+  lines.push('    ;');
+  lines.push('');
+  lines.push('static const Utf8FoldEntry FOLD_ENTRIES[] = {');
+  for (const r of rows) {
+    const cp = `0x${r.cp.toString(16).toUpperCase().padStart(4, '0')}`;
+    lines.push(`    {${cp}, ${r.lowerOffset}, ${r.foldedOffset}},`);
+  }
+  lines.push('};');
+  lines.push(`
+const Utf8FoldEntry* get_utf8_fold_entries(size_t& count) {
+    count = sizeof(FOLD_ENTRIES) / sizeof(FOLD_ENTRIES[0]);
+    return FOLD_ENTRIES;
+}
+
+const char* get_utf8_fold_strings() {
+    return FOLD_STRINGS;
+}
+`);
+  lines.push('}  // namespace mcp');
+  lines.push('}  // namespace cesium');
+  lines.push('');
+
+  writeFileSync(OUTPUT_PATH, lines.join('\n'));
+  console.log(`Wrote ${rows.length} entries (${poolSize} string bytes) to ${OUTPUT_PATH}`);
+}
+
+main();
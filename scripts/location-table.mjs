@@ -0,0 +1,88 @@
+/**
+ * Read and write the location table (packages/mcp-server-cpp/data/location_table.bin)
+ *
+ * The C++ server embeds this file at build time and decodes it on first
+ * use (src/location_database.cpp). Layout, little-endian:
+ *
+ *   char     magic[8]              "LOCTAB01"
+ *   uint32_t count
+ *   uint32_t names_size
+ *   count x { double longitude, latitude, heading; int32_t population; uint32_t name_offset; }
+ *   char     names[names_size]     NUL-terminated UTF-8 names
+ *
+ * heading: -1 = not set, 0-360 = orientation in degrees (0=North, 90=East)
+ * population: 0 = unknown
+ */
+
+import { readFileSync, writeFileSync } from 'fs';
+import { join, dirname } from 'path';
+import { fileURLToPath } from 'url';
+
+const __dirname = dirname(fileURLToPath(import.meta.url));
+
+export const LOCATION_TABLE_PATH = join(__dirname, '..', 'packages', 'mcp-server-cpp', 'data', 'location_table.bin');
+
+const MAGIC = 'LOCTAB01';
+const HEADER_SIZE = 16;
+const RECORD_SIZE = 32;
+
+/**
+ * Read the location table
+ * @returns {{name: string, longitude: number, latitude: number, heading: number, population: number}[]}
+ */
+export function readLocationTable(path = LOCATION_TABLE_PATH) {
+  const data = readFileSync(path);
+  if (data.length < HEADER_SIZE || data.toString('latin1', 0, 8) !== MAGIC) {
+    throw new Error(`${path} is not a location table`);
+  }
+
+  const count = data.readUInt32LE(8);
+  const namesSize = data.readUInt32LE(12);
+  const namesStart = HEADER_SIZE + count * RECORD_SIZE;
+  if (namesStart + namesSize !== data.length) {
+    throw new Error(`${path} is truncated or has trailing data`);
+  }
+
+  const locations = [];
+  for (let i = 0; i < count; i++) {
+    const record = HEADER_SIZE + i * RECORD_SIZE;
+    const nameStart = namesStart + data.readUInt32LE(record + 28);
+    const nameEnd = data.indexOf(0, nameStart);
+    locations.push({
+      name: data.toString('utf-8', nameStart, nameEnd),
+      longitude: data.readDoubleLE(record),
+      latitude: data.readDoubleLE(record + 8),
+      heading: data.readDoubleLE(record + 16),
+      population: data.readInt32LE(record + 24),
+    });
+  }
+  return locations;
+}
+
+/**
+ * Write the location table, entries in the order given
+ */
+export function writeLocationTable(locations, path = LOCATION_TABLE_PATH) {
+  const names = locations.map(loc => Buffer.from(`${loc.name}\0`, 'utf-8'));
+  const namesSize = names.reduce((size, name) => size + name.length, 0);
+  const namesStart = HEADER_SIZE + locations.length * RECORD_SIZE;
+
+  const data = Buffer.alloc(namesStart + namesSize);
+  data.write(MAGIC, 0, 'latin1');
+  data.writeUInt32LE(locations.length, 8);
+  data.writeUInt32LE(namesSize, 12);
+
+  let nameOffset = 0;
+  locations.forEach((loc, i) => {
+    const record = HEADER_SIZE + i * RECORD_SIZE;
+    data.writeDoubleLE(loc.longitude, record);
+    data.writeDoubleLE(loc.latitude, record + 8);
+    data.writeDoubleLE(loc.heading, record + 16);
+    data.writeInt32LE(loc.population, record + 24);
+    data.writeUInt32LE(nameOffset, record + 28);
+    names[i].copy(data, namesStart + nameOffset);
+    nameOffset += names[i].length;
+  });
+
+  writeFileSync(path, data);
+}
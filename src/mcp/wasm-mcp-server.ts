@@ -15,6 +15,7 @@ interface WasmModule {
   stringToUTF8: (str: string, ptr: number, maxBytes: number) => void;
   _malloc: (size: number) => number;
   _free: (ptr: number) => void;
+  HEAPU8: Uint8Array;
 }
 
 // Tool definition interface (matches what LLM engine expects)
@@ -33,7 +34,11 @@ type InitFn = () => void;
 type HandleMessageFn = (msg: string) => string;
 type GetToolDefinitionsFn = () => string;
 type ResolveLocationFn = (name: string) => string;
+type ResolveLocationsBatchFn = (names: string, maxDistance: number) => string;
 type ListLocationsFn = () => string;
+type AutocompleteLocationsFn = (prefix: string, maxResults: number) => string;
+type ReverseGeocodeFn = (lon: number, lat: number, maxDistance: number) => string;
+type AttachBufferFn = (ptr: number, size: number) => number;
 type SetCameraStateFn = (lon: number, lat: number, height: number, targetLon: number, targetLat: number) => void;
 type GetCameraTargetFn = () => string;
 
@@ -46,7 +51,12 @@ export class WasmMCPServer {
   private wasmHandleMessage: HandleMessageFn | null = null;
   private wasmGetToolDefinitions: GetToolDefinitionsFn | null = null;
   private wasmResolveLocation: ResolveLocationFn | null = null;
+  private wasmResolveLocationsBatch: ResolveLocationsBatchFn | null = null;
   private wasmListLocations: ListLocationsFn | null = null;
+  private wasmAutocompleteLocations: AutocompleteLocationsFn | null = null;
+  private wasmReverseGeocode: ReverseGeocodeFn | null = null;
+  private wasmAttachSymSpellIndex: AttachBufferFn | null = null;
+  private wasmAttachLocationDatabase: AttachBufferFn | null = null;
   private wasmSetCameraState: SetCameraStateFn | null = null;
   private wasmGetCameraTarget: GetCameraTargetFn | null = null;
 
@@ -134,13 +144,30 @@ export class WasmMCPServer {
       this.wasmHandleMessage = this.module.cwrap('handleMessage', 'string', ['string']) as HandleMessageFn;
       this.wasmGetToolDefinitions = this.module.cwrap('getToolDefinitions', 'string', []) as GetToolDefinitionsFn;
       this.wasmResolveLocation = this.module.cwrap('resolveLocation', 'string', ['string']) as ResolveLocationFn;
+      this.wasmResolveLocationsBatch = this.module.cwrap('resolveLocationsBatch', 'string', ['string', 'number']) as ResolveLocationsBatchFn;
       this.wasmListLocations = this.module.cwrap('listLocations', 'string', []) as ListLocationsFn;
+      this.wasmAutocompleteLocations = this.module.cwrap('autocompleteLocations', 'string', ['string', 'number']) as AutocompleteLocationsFn;
+      this.wasmReverseGeocode = this.module.cwrap('reverseGeocode', 'string', ['number', 'number', 'number']) as ReverseGeocodeFn;
+      this.wasmAttachSymSpellIndex = this.module.cwrap('attachSymSpellIndex', 'number', ['number', 'number']) as AttachBufferFn;
+      this.wasmAttachLocationDatabase = this.module.cwrap('attachLocationDatabase', 'number', ['number', 'number']) as AttachBufferFn;
       this.wasmSetCameraState = this.module.cwrap('setCameraState', null, ['number', 'number', 'number', 'number', 'number']) as SetCameraStateFn;
       this.wasmGetCameraTarget = this.module.cwrap('getCameraTarget', 'string', []) as GetCameraTargetFn;
 
       // Initialize the WASM server
       this.wasmInit();
 
+      // Optional data files: the LOCDB001 location database is consulted
+      // before the compiled-in table, and the prebuilt typo index saves
+      // building it on the first fuzzy lookup
+      const locationDbBytes = await this.fetchOptional('../../packages/mcp-server-cpp/data/locations.bin');
+      if (locationDbBytes) {
+        this.attachLocationDatabase(locationDbBytes);
+      }
+      const symspellBytes = await this.fetchOptional('../../packages/mcp-server-cpp/dist/cesium-mcp-symspell.bin');
+      if (symspellBytes) {
+        this.attachSymSpellIndex(symspellBytes);
+      }
+
       // Cache tool definitions
       this.loadToolDefinitions();
 
@@ -283,6 +310,26 @@ export class WasmMCPServer {
     }
   }
 
+  /**
+   * Resolve many location names in one call (up to 256). Columns are in
+   * input order; unresolved names have null coordinates. With maxDistance > 0,
+   * names not found exactly fall back to fuzzy matching.
+   */
+  resolveLocations(names: string[], maxDistance = 0): { count: number; found: number; resolved: number[]; longitude: Array<number | null>; latitude: Array<number | null>; heading: Array<number | null> } | null {
+    if (!this.wasmResolveLocationsBatch) {
+      return null;
+    }
+
+    try {
+      // Names travel newline-separated; a newline inside a name would split it
+      const batch = names.map((name) => name.replace(/[\r\n]+/g, ' ')).join('\n');
+      return JSON.parse(this.wasmResolveLocationsBatch(batch, maxDistance));
+    } catch (e) {
+      console.error('[WasmMCPServer] Failed to resolve locations:', e);
+      return null;
+    }
+  }
+
   /**
    * List all known locations
    */
@@ -300,6 +347,89 @@ export class WasmMCPServer {
     }
   }
 
+  /**
+   * Autocomplete a location prefix, most populous matches first.
+   * Call once per keystroke; extending the previous prefix is incremental.
+   */
+  autocompleteLocations(prefix: string, maxResults = 10): Array<{ name: string; longitude: number; latitude: number; population: number }> {
+    if (!this.wasmAutocompleteLocations) {
+      return [];
+    }
+
+    try {
+      const resultStr = this.wasmAutocompleteLocations(prefix, maxResults);
+      return JSON.parse(resultStr);
+    } catch (e) {
+      console.error('[WasmMCPServer] Failed to autocomplete locations:', e);
+      return [];
+    }
+  }
+
+  /**
+   * Name the place nearest a coordinate from the built-in database, without
+   * a network request. Populated places win over landmarks within the radius.
+   */
+  reverseGeocode(longitude: number, latitude: number, maxDistance = 0): { found: boolean; name?: string; distance?: number; population?: number; longitude?: number; latitude?: number } {
+    if (!this.wasmReverseGeocode) {
+      return { found: false };
+    }
+
+    try {
+      return JSON.parse(this.wasmReverseGeocode(longitude, latitude, maxDistance));
+    } catch (e) {
+      console.error('[WasmMCPServer] Failed to reverse geocode:', e);
+      return { found: false };
+    }
+  }
+
+  /**
+   * Attach a prebuilt SymSpell typo index (written by the native
+   * symspell-index tool) so fuzzy resolution does not build it on first use.
+   * The copy in WASM memory is kept for the lifetime of the module.
+   */
+  attachSymSpellIndex(bytes: Uint8Array): boolean {
+    return this.attachBuffer(bytes, this.wasmAttachSymSpellIndex, 'SymSpell index');
+  }
+
+  /**
+   * Attach a LOCDB001 location database (scripts/build-binary-locations.mjs).
+   * It is queried in place, so the copy in WASM memory is kept alive.
+   */
+  attachLocationDatabase(bytes: Uint8Array): boolean {
+    return this.attachBuffer(bytes, this.wasmAttachLocationDatabase, 'Location database');
+  }
+
+  /**
+   * Copy a buffer into WASM memory and hand it to an attach export.
+   * The memory is only released if the export rejects it.
+   */
+  private attachBuffer(bytes: Uint8Array, attach: AttachBufferFn | null, label: string): boolean {
+    if (!this.module || !attach) {
+      return false;
+    }
+
+    const ptr = this.module._malloc(bytes.length);
+    this.module.HEAPU8.set(bytes, ptr);
+    if (attach(ptr, bytes.length) === 0) {
+      this.module._free(ptr);
+      console.warn(`[WasmMCPServer] ${label} rejected (stale or malformed)`);
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * Fetch an optional data file relative to this module
+   */
+  private async fetchOptional(relativePath: string): Promise<Uint8Array | null> {
+    try {
+      const response = await fetch(new URL(relativePath, import.meta.url).href);
+      return response.ok ? new Uint8Array(await response.arrayBuffer()) : null;
+    } catch {
+      return null;
+    }
+  }
+
   /**
    * Check if the server is initialized
    */
@@ -331,9 +461,10 @@ export class WasmMCPServer {
   }
 
   /**
-   * Get the current camera target position
+   * Get the current camera target position, named from the built-in
+   * database when a known place is nearby
    */
-  getCameraTarget(): { valid: boolean; longitude?: number; latitude?: number; height?: number; targetLongitude?: number; targetLatitude?: number } {
+  getCameraTarget(): { valid: boolean; longitude?: number; latitude?: number; height?: number; targetLongitude?: number; targetLatitude?: number; targetPlace?: string; targetPlaceDistance?: number } {
     if (!this.wasmGetCameraTarget) {
       return { valid: false };
     }